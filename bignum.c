@@ -0,0 +1,916 @@
+#include "bignum.h"
+#include <string.h>
+
+/* Arbitrary-precision integers
+
+   The low level works on plain limb arrays (least significant first) and the bn_t
+   functions around it deal with signs, sizes and memory. Limbs come from a bump arena:
+   temporaries are given back with a mark and release around each operation, and results
+   are either written into the limbs a bn_t already has, when there is room and it is
+   safe to, or into new limbs from the top of the arena.
+*/
+
+static scratch_arena_t *arena = NULL;
+static bool failed = false;
+static uint32_t karatsuba_threshold = BN_KARATSUBA_THRESHOLD;
+
+/* Memory */
+
+void bn_use_arena(scratch_arena_t *new_arena) {
+    arena = new_arena;
+    failed = false;
+}
+
+uint32_t bn_mark(void) {
+    return arena ? arena->used : 0;
+}
+
+void bn_release(uint32_t mark) {
+    if (arena && mark <= arena->used) arena->used = mark;
+}
+
+void bn_release_keep(uint32_t mark, bn_t *keep) {
+    if (!arena || mark > arena->used) return;
+
+    uint8_t *bottom = arena->base + mark;
+    if ((uint8_t *)keep->limb < bottom || keep->size == 0) {
+        /* Lives below the mark (or has no limbs): nothing to move */
+        if ((uint8_t *)keep->limb >= bottom) {
+            keep->limb = NULL;
+            keep->capacity = 0;
+        }
+        arena->used = mark;
+        return;
+    }
+
+    memmove(bottom, keep->limb, keep->size * sizeof(uint32_t));
+    keep->limb = (uint32_t *)bottom;
+    keep->capacity = keep->size;
+    arena->used = mark + keep->size * sizeof(uint32_t);
+}
+
+bool bn_failed(void) {
+    return failed;
+}
+
+void bn_set_karatsuba_threshold(uint32_t limbs) {
+    karatsuba_threshold = limbs < 2 ? 2 : limbs;
+}
+
+static uint32_t *_alloc(uint32_t limbs) {
+    uint32_t *limb = NULL;
+    if (!failed && arena) {
+        limb = scratch_arena_alloc(arena, (limbs ? limbs : 1) * sizeof(uint32_t));
+    }
+    if (!limb) failed = true;
+    return limb;
+}
+
+/* Room for need limbs in r, keeping its own limbs if they are big enough */
+static uint32_t *_reserve(bn_t *r, uint32_t need) {
+    if (r->limb && r->capacity >= need) return r->limb;
+
+    uint32_t *limb = _alloc(need);
+    if (!limb) return NULL;
+    r->limb = limb;
+    r->capacity = need;
+    return limb;
+}
+
+/* As _reserve, but never the limbs of a or b */
+static uint32_t *_reserve_apart(bn_t *r, uint32_t need, const uint32_t *a, const uint32_t *b) {
+    if (r->limb == a || r->limb == b) r->capacity = 0;
+    return _reserve(r, need);
+}
+
+static bool _fail(bn_t *r) {
+    r->size = 0;
+    r->negative = false;
+    return false;
+}
+
+/* Limb arrays */
+
+static uint32_t _trim(const uint32_t *a, uint32_t n) {
+    while (n > 0 && a[n - 1] == 0) n--;
+    return n;
+}
+
+static int _cmp_n(const uint32_t *a, uint32_t an, const uint32_t *b, uint32_t bn) {
+    if (an != bn) return an < bn ? -1 : 1;
+    for (uint32_t i = an; i-- > 0;) {
+        if (a[i] != b[i]) return a[i] < b[i] ? -1 : 1;
+    }
+    return 0;
+}
+
+/* r = a + b for an >= bn, returning the carry out of limb an - 1. r can be a or b. */
+static uint32_t _add_n(uint32_t *r, const uint32_t *a, uint32_t an, const uint32_t *b, uint32_t bn) {
+    uint64_t carry = 0;
+    uint32_t i = 0;
+    for (; i < bn; i++) {
+        carry += (uint64_t)a[i] + b[i];
+        r[i] = (uint32_t)carry;
+        carry >>= 32;
+    }
+    for (; i < an; i++) {
+        carry += a[i];
+        r[i] = (uint32_t)carry;
+        carry >>= 32;
+    }
+    return (uint32_t)carry;
+}
+
+/* r = a - b for an >= bn, returning the borrow. r can be a or b. */
+static uint32_t _sub_n(uint32_t *r, const uint32_t *a, uint32_t an, const uint32_t *b, uint32_t bn) {
+    uint32_t borrow = 0;
+    uint32_t i = 0;
+    for (; i < bn; i++) {
+        uint64_t d = (uint64_t)a[i] - b[i] - borrow;
+        r[i] = (uint32_t)d;
+        borrow = (uint32_t)(d >> 32) & 1;
+    }
+    for (; i < an; i++) {
+        uint64_t d = (uint64_t)a[i] - borrow;
+        r[i] = (uint32_t)d;
+        borrow = (uint32_t)(d >> 32) & 1;
+    }
+    return borrow;
+}
+
+/* r = a * m, returning the top limb. r can be a. */
+static uint32_t _mul_1(uint32_t *r, const uint32_t *a, uint32_t n, uint32_t m) {
+    uint64_t carry = 0;
+    for (uint32_t i = 0; i < n; i++) {
+        carry += (uint64_t)a[i] * m;
+        r[i] = (uint32_t)carry;
+        carry >>= 32;
+    }
+    return (uint32_t)carry;
+}
+
+/* r += a * m, returning the carry out of limb n - 1 */
+static uint32_t _addmul_1(uint32_t *r, const uint32_t *a, uint32_t n, uint32_t m) {
+    uint64_t carry = 0;
+    for (uint32_t i = 0; i < n; i++) {
+        carry += (uint64_t)a[i] * m + r[i];
+        r[i] = (uint32_t)carry;
+        carry >>= 32;
+    }
+    return (uint32_t)carry;
+}
+
+/* q = a / d, returning the remainder. q can be a.
+
+   Each step divides two limbs by one, which the core cannot do in hardware, so this
+   multiplies by a reciprocal of d worked out once instead (Moller and Granlund, "Improved
+   division by invariant integers"). The divisor has to have its top bit set, so the
+   dividend is shifted by the same amount as it is read. */
+static uint32_t _divrem_1(uint32_t *q, const uint32_t *a, uint32_t n, uint32_t d) {
+    if (n == 0) return 0;
+
+    uint32_t shift = __builtin_clz(d);
+    uint32_t dn = d << shift;
+    uint32_t v = (uint32_t)(UINT64_MAX / dn - ((uint64_t)1 << 32));
+
+    uint32_t r = shift ? a[n - 1] >> (32 - shift) : 0;
+    for (uint32_t i = n; i-- > 0;) {
+        uint32_t u0 = a[i] << shift;
+        if (shift && i > 0) u0 |= a[i - 1] >> (32 - shift);
+
+        uint64_t p = (uint64_t)v * r + (((uint64_t)r << 32) | u0);
+        uint32_t q1 = (uint32_t)(p >> 32) + 1;
+        uint32_t rem = u0 - q1 * dn;
+        if (rem > (uint32_t)p) {
+            q1--;
+            rem += dn;
+        }
+        if (rem >= dn) {
+            q1++;
+            rem -= dn;
+        }
+        q[i] = q1;
+        r = rem;
+    }
+    return r >> shift;
+}
+
+/* Multiplication */
+
+static void _mul_school(uint32_t *r, const uint32_t *a, uint32_t an, const uint32_t *b, uint32_t bn) {
+    r[an] = _mul_1(r, a, an, b[0]);
+    for (uint32_t j = 1; j < bn; j++) {
+        r[an + j] = _addmul_1(r + j, a, an, b[j]);
+    }
+}
+
+/* r = a * b into an + bn limbs, which must not overlap a or b */
+static bool _mul(uint32_t *r, const uint32_t *a, uint32_t an, const uint32_t *b, uint32_t bn);
+
+/* Karatsuba for bn <= an < 2 * bn: with a = a1 * B^h + a0 and b likewise,
+   a * b = a1 b1 B^2h + ((a0 + a1)(b0 + b1) - a0 b0 - a1 b1) B^h + a0 b0,
+   three half-size multiplications instead of four */
+static bool _karatsuba(uint32_t *r, const uint32_t *a, uint32_t an, const uint32_t *b, uint32_t bn) {
+    uint32_t h = (an + 1) / 2;
+    uint32_t rn = an + bn;
+
+    if (bn <= h) {
+        /* b has no top half: a0 b + a1 b B^h */
+        uint32_t *t = _alloc(an - h + bn);
+        if (!t) return false;
+        if (!_mul(r, a, h, b, bn)) return false;
+        memset(r + h + bn, 0, (rn - h - bn) * sizeof(uint32_t));
+        if (!_mul(t, a + h, an - h, b, bn)) return false;
+        _add_n(r + h, r + h, rn - h, t, an - h + bn);
+        return true;
+    }
+
+    uint32_t a0n = _trim(a, h), b0n = _trim(b, h);
+    uint32_t *sa = _alloc(h + 1);
+    uint32_t *sb = _alloc(h + 1);
+    uint32_t *z1 = _alloc(2 * h + 2);
+    if (!sa || !sb || !z1) return false;
+
+    /* z0 and z2 go straight into the low and high halves of r */
+    if (!_mul(r, a, a0n, b, b0n)) return false;
+    memset(r + a0n + b0n, 0, (2 * h - a0n - b0n) * sizeof(uint32_t));
+    if (!_mul(r + 2 * h, a + h, an - h, b + h, bn - h)) return false;
+
+    sa[h] = _add_n(sa, a, h, a + h, an - h);
+    sb[h] = _add_n(sb, b, h, b + h, bn - h);
+    uint32_t san = _trim(sa, h + 1), sbn = _trim(sb, h + 1);
+    if (!_mul(z1, sa, san, sb, sbn)) return false;
+
+    uint32_t z1n = san + sbn;
+    _sub_n(z1, z1, z1n, r, a0n + b0n);
+    _sub_n(z1, z1, z1n, r + 2 * h, rn - 2 * h);
+    z1n = _trim(z1, z1n);
+    _add_n(r + h, r + h, rn - h, z1, z1n);
+    return true;
+}
+
+/* Split a much longer a into pieces as long as b */
+static bool _mul_unbalanced(uint32_t *r, const uint32_t *a, uint32_t an, const uint32_t *b, uint32_t bn) {
+    uint32_t *t = _alloc(2 * bn);
+    if (!t) return false;
+
+    memset(r, 0, (an + bn) * sizeof(uint32_t));
+    for (uint32_t offset = 0; offset < an; offset += bn) {
+        uint32_t n = an - offset < bn ? an - offset : bn;
+        if (!_mul(t, a + offset, n, b, bn)) return false;
+        _add_n(r + offset, r + offset, an + bn - offset, t, n + bn);
+    }
+    return true;
+}
+
+static bool _mul(uint32_t *r, const uint32_t *a, uint32_t an, const uint32_t *b, uint32_t bn) {
+    /* The splitting below counts on the top limbs being nonzero */
+    uint32_t rn = an + bn;
+    an = _trim(a, an);
+    bn = _trim(b, bn);
+    memset(r + an + bn, 0, (rn - an - bn) * sizeof(uint32_t));
+    if (an < bn) {
+        const uint32_t *t = a; a = b; b = t;
+        uint32_t tn = an; an = bn; bn = tn;
+    }
+    if (bn == 0) {
+        memset(r, 0, an * sizeof(uint32_t));
+        return true;
+    }
+    if (bn < karatsuba_threshold) {
+        _mul_school(r, a, an, b, bn);
+        return true;
+    }
+
+    uint32_t mark = bn_mark();
+    bool ok = an >= 2 * bn ? _mul_unbalanced(r, a, an, b, bn) : _karatsuba(r, a, an, b, bn);
+    bn_release(mark);
+    return ok;
+}
+
+/* Division */
+
+/* Knuth's algorithm D: q = a / b (an - bn + 1 limbs) and r = a % b (bn limbs), for
+   an >= bn >= 2. One quotient limb at a time, guessed from the top limbs and corrected. */
+static bool _divrem_school(uint32_t *q, uint32_t *r, const uint32_t *a, uint32_t an, const uint32_t *b, uint32_t bn) {
+    uint32_t mark = bn_mark();
+    uint32_t *vn = _alloc(bn);
+    uint32_t *un = _alloc(an + 1);
+    if (!vn || !un) return false;
+
+    /* Shift so the top bit of the divisor is set, which keeps the guesses within 2 */
+    uint32_t s = __builtin_clz(b[bn - 1]);
+    for (uint32_t i = bn - 1; i > 0; i--) {
+        vn[i] = (b[i] << s) | (s ? b[i - 1] >> (32 - s) : 0);
+    }
+    vn[0] = b[0] << s;
+    un[an] = s ? a[an - 1] >> (32 - s) : 0;
+    for (uint32_t i = an - 1; i > 0; i--) {
+        un[i] = (a[i] << s) | (s ? a[i - 1] >> (32 - s) : 0);
+    }
+    un[0] = a[0] << s;
+
+    const uint64_t base = (uint64_t)1 << 32;
+    for (uint32_t j = an - bn + 1; j-- > 0;) {
+        uint64_t top = ((uint64_t)un[j + bn] << 32) | un[j + bn - 1];
+        uint64_t qhat = top / vn[bn - 1];
+        uint64_t rhat = top - qhat * vn[bn - 1];
+        while (qhat >= base || qhat * vn[bn - 2] > ((rhat << 32) | un[j + bn - 2])) {
+            qhat--;
+            rhat += vn[bn - 1];
+            if (rhat >= base) break;
+        }
+
+        /* Multiply and subtract */
+        int64_t t;
+        uint64_t k = 0;
+        for (uint32_t i = 0; i < bn; i++) {
+            uint64_t p = qhat * vn[i];
+            t = (int64_t)un[i + j] - (int64_t)k - (int64_t)(p & 0xFFFFFFFF);
+            un[i + j] = (uint32_t)t;
+            k = (p >> 32) - (t >> 32);
+        }
+        t = (int64_t)un[j + bn] - (int64_t)k;
+        un[j + bn] = (uint32_t)t;
+
+        /* Guessed one too many: add the divisor back */
+        if (t < 0) {
+            qhat--;
+            _add_n(un + j, un + j, bn + 1, vn, bn);
+        }
+        if (q) q[j] = (uint32_t)qhat;
+    }
+
+    if (r) {
+        for (uint32_t i = 0; i < bn; i++) {
+            r[i] = (un[i] >> s) | (s ? un[i + 1] << (32 - s) : 0);
+        }
+    }
+    bn_release(mark);
+    return true;
+}
+
+static bn_t _view(const uint32_t *limb, uint32_t size) {
+    bn_t v = {(uint32_t *)limb, _trim(limb, size), 0, false};
+    return v;
+}
+
+/* v = B^(bn + p) / b to within a few units, for b of bn limbs with its top bit set.
+
+   Newton's iteration for 1/b, v' = v + v (1 - b v), doubles the number of correct limbs
+   each time, so the reciprocal to p limbs comes from one to about p/2 limbs, and so on
+   down to a short one done by long division. Each step only needs as many limbs of b as
+   it has correct limbs of v. */
+static bool _recip(bn_t *v, const bn_t *b, uint32_t p) {
+    uint32_t bn = b->size;
+
+    if (p < BN_NEWTON_THRESHOLD) {
+        uint32_t h = bn < p + 2 ? bn : p + 2;
+        uint32_t n = h + p + 1;
+        uint32_t *q = _reserve(v, p + 2);
+        uint32_t mark = bn_mark();
+        uint32_t *num = _alloc(n);
+        if (!num || !q) return false;
+        memset(num, 0, (n - 1) * sizeof(uint32_t));
+        num[n - 1] = 1;
+        if (!_divrem_school(q, NULL, num, n, b->limb + bn - h, h)) return false;
+        bn_release(mark);
+        v->size = _trim(q, p + 2);
+        v->negative = false;
+        return true;
+    }
+
+    /* Each level keeps only its result, so the levels below cost no memory after */
+    uint32_t mark = bn_mark();
+    uint32_t k = p / 2 + 1;
+    bn_t vk = {0}, e = {0}, t = {0}, result = {0};
+    if (!_recip(&vk, b, k)) return false;
+
+    /* e = B^(h + k) - bt vk, the error of vk against the top h limbs of b */
+    uint32_t h = bn < p + 1 ? bn : p + 1;
+    bn_t bt = _view(b->limb + bn - h, h);
+    if (!bn_mul(&t, &bt, &vk)) return false;
+    uint32_t one = 1;
+    bn_t unit = _view(&one, 1);
+    if (!bn_shift_left(&e, &unit, 32 * (h + k))) return false;
+    if (!bn_sub(&e, &e, &t)) return false;
+
+    /* v = vk B^(p - k) + vk e / B^(h + 2k - p) */
+    bool negative = e.negative;
+    e.negative = false;
+    if (!bn_mul(&t, &vk, &e)) return false;
+    uint32_t drop = h + 2 * k - p;
+    bn_t correction = t.size > drop ? _view(t.limb + drop, t.size - drop) : _view(NULL, 0);
+    correction.negative = negative;
+    if (!bn_shift_left(&result, &vk, 32 * (p - k)) || !bn_add(&result, &result, &correction)) return false;
+    bn_release_keep(mark, &result);
+    *v = result;
+    return true;
+}
+
+/* Newton division: multiply by a reciprocal of b, then correct by a few units.
+
+   The reciprocal is of b shifted to set its top bit, but only its top limbs matter, and
+   only the top limbs of a, shifted the same way, are needed for the estimate; the
+   remainder comes from a and b as they are. */
+static bool _divrem_newton(uint32_t *q, uint32_t *r, const uint32_t *a, uint32_t an, const uint32_t *b, uint32_t bn) {
+    uint32_t mark = bn_mark();
+    uint32_t s = __builtin_clz(b[bn - 1]);
+    uint32_t p = an - bn + 2;  /* one more than the quotient can have limbs */
+    uint32_t h = bn < p + 2 ? bn : p + 2;
+    bn_t av = _view(a, an), bv = _view(b, bn);
+    bn_t bt = {0}, V = {0}, top = {0}, Q = {0}, R = {0};
+
+    /* V ~ B^(h + p) / bt, for bt the top h limbs of b << s */
+    bool ok = h < bn ? bn_shift_right(&bt, &bv, 32 * (bn - h) - s) : bn_shift_left(&bt, &bv, s);
+    if (!ok || !_recip(&V, &bt, p)) return false;
+
+    /* Q ~ ((a << s) / B^(bn - 1)) V / B^(p + 1), within a couple of units */
+    if (!bn_shift_right(&top, &av, 32 * (bn - 1) - s) || !bn_mul(&top, &top, &V)) return false;
+    if (top.size > p + 1) Q = _view(top.limb + p + 1, top.size - p - 1);
+    Q.capacity = Q.size;
+
+    /* R = a - Q b, then correct Q until 0 <= R < b */
+    uint32_t one = 1;
+    bn_t unit = _view(&one, 1);
+    if (!bn_mul(&R, &Q, &bv) || !bn_sub(&R, &av, &R)) return false;
+    while (R.negative) {
+        if (!bn_add(&R, &R, &bv) || !bn_sub(&Q, &Q, &unit)) return false;
+    }
+    while (bn_cmp_abs(&R, &bv) >= 0) {
+        if (!bn_sub(&R, &R, &bv) || !bn_add(&Q, &Q, &unit)) return false;
+    }
+
+    memset(q, 0, (an - bn + 1) * sizeof(uint32_t));
+    memcpy(q, Q.limb, Q.size * sizeof(uint32_t));
+    if (r) {
+        memset(r, 0, bn * sizeof(uint32_t));
+        memcpy(r, R.limb, R.size * sizeof(uint32_t));
+    }
+    bn_release(mark);
+    return true;
+}
+
+/* Setting and reading */
+
+void bn_init(bn_t *a) {
+    memset(a, 0, sizeof(*a));
+}
+
+bool bn_set_u32(bn_t *r, uint32_t value) {
+    uint32_t *limb = _reserve(r, 1);
+    if (!limb) return _fail(r);
+    limb[0] = value;
+    r->size = value ? 1 : 0;
+    r->negative = false;
+    return true;
+}
+
+bool bn_set_decimal(bn_t *r, const char *digits, uint32_t count) {
+    uint32_t *limb = _reserve(r, count / 9 + 1);
+    if (!limb) return _fail(r);
+
+    /* Nine digits at a time: r = r * 10^n + next n digits */
+    uint32_t n = 0;
+    for (uint32_t i = 0; i < count;) {
+        uint32_t chunk = 0, scale = 1;
+        for (uint32_t j = 0; j < 9 && i < count; j++, i++) {
+            chunk = chunk * 10 + (uint32_t)(digits[i] - '0');
+            scale *= 10;
+        }
+        uint32_t top = _mul_1(limb, limb, n, scale);
+        if (top) limb[n++] = top;
+        if (n == 0) {
+            if (chunk) limb[n++] = chunk;
+        } else if (_add_n(limb, limb, n, &chunk, 1)) {
+            limb[n++] = 1;
+        }
+    }
+    r->size = n;
+    r->negative = false;
+    return true;
+}
+
+bool bn_copy(bn_t *r, const bn_t *a) {
+    if (r == a) return true;
+
+    const uint32_t *al = a->limb;
+    uint32_t n = a->size;
+    bool negative = a->negative;
+    uint32_t *limb = _reserve(r, n);
+    if (!limb) return _fail(r);
+    if (limb != al) memmove(limb, al, n * sizeof(uint32_t));
+    r->size = n;
+    r->negative = negative;
+    return true;
+}
+
+bool bn_is_zero(const bn_t *a) {
+    return a->size == 0;
+}
+
+bool bn_to_u32(const bn_t *a, uint32_t *value) {
+    if (a->size > 1 || (a->negative && a->size)) return false;
+    *value = a->size ? a->limb[0] : 0;
+    return true;
+}
+
+uint32_t bn_bits(const bn_t *a) {
+    if (a->size == 0) return 0;
+    return 32 * a->size - __builtin_clz(a->limb[a->size - 1]);
+}
+
+uint32_t bn_decimal_digits(const bn_t *a) {
+    /* 1234 / 4096 is just over log10(2) */
+    return (uint32_t)(((uint64_t)bn_bits(a) * 1234) >> 12) + 1;
+}
+
+/* The width digits of x < 10^width, zero-padded, by repeated division by 10^9 */
+static bool _decimal_school(char *out, const bn_t *x, uint32_t width) {
+    uint32_t mark = bn_mark();
+    uint32_t n = x->size;
+    uint32_t *t = _alloc(n);
+    if (!t) return false;
+    if (n) memcpy(t, x->limb, n * sizeof(uint32_t));  /* zero has no limbs, limb may be NULL */
+
+    char *end = out + width;
+    while (end > out) {
+        uint32_t chunk = _divrem_1(t, t, n, 1000000000);
+        n = _trim(t, n);
+        for (int i = 0; i < 9 && end > out; i++) {
+            *--end = (char)('0' + chunk % 10);
+            chunk /= 10;
+        }
+    }
+    bn_release(mark);
+    return true;
+}
+
+/* The width digits of x < 10^width, zero-padded. Repeated division takes time in the
+   square of the length, so long numbers are split in two first, with powers[level] =
+   10^(9 * 2^level): the quotient gives the top digits and the remainder the rest. With
+   Newton division each split costs a few multiplications. */
+static bool _decimal(char *out, const bn_t *x, uint32_t width, const bn_t *powers, int level) {
+    while (level >= 0 && bn_cmp_abs(x, &powers[level]) < 0) level--;
+    if (level < 0 || x->size < BN_NEWTON_THRESHOLD) return _decimal_school(out, x, width);
+
+    uint32_t digits = 9u << level;
+    uint32_t mark = bn_mark();
+    bn_t q = {0}, r = {0};
+    bool ok = bn_divmod(&q, &r, x, &powers[level]) &&
+              _decimal(out, &q, width - digits, powers, level - 1) &&
+              _decimal(out + width - digits, &r, digits, powers, level - 1);
+    bn_release(mark);
+    return ok;
+}
+
+uint32_t bn_to_decimal(const bn_t *a, char *text) {
+    char *out = text;
+    if (a->negative && a->size) *out++ = '-';
+
+    /* Digits for as many as a could have, then without the leading zeros */
+    uint32_t width = bn_decimal_digits(a);
+    bn_t magnitude = *a;
+    magnitude.negative = false;
+    uint32_t mark = bn_mark();
+    bool was_failed = failed;
+
+    /* 10^9, 10^18, 10^36, ... up to about the square root of a. Splitting needs several
+       times the memory of a, so if it runs out this goes back to repeated division. */
+    bn_t powers[32];
+    int levels = 0;
+    if (a->size >= BN_NEWTON_THRESHOLD) {
+        bn_init(&powers[0]);
+        bn_set_u32(&powers[0], 1000000000);
+        for (levels = 1; levels < 32 && 2 * powers[levels - 1].size <= a->size; levels++) {
+            bn_init(&powers[levels]);
+            if (!bn_mul(&powers[levels], &powers[levels - 1], &powers[levels - 1])) break;
+        }
+    }
+    bool ok = !failed && _decimal(out, &magnitude, width, powers, levels - 1);
+    if (!ok && !was_failed) {
+        failed = false;
+        bn_release(mark);
+        ok = _decimal_school(out, &magnitude, width);
+    }
+    if (!ok) {
+        bn_release(mark);
+        *text = '\0';
+        return 0;
+    }
+    uint32_t zeros = 0;
+    while (zeros + 1 < width && out[zeros] == '0') zeros++;
+    memmove(out, out + zeros, width - zeros);
+    out += width - zeros;
+    *out = '\0';
+    bn_release(mark);
+    return (uint32_t)(out - text);
+}
+
+/* Comparisons */
+
+int bn_cmp_abs(const bn_t *a, const bn_t *b) {
+    return _cmp_n(a->limb, a->size, b->limb, b->size);
+}
+
+int bn_cmp(const bn_t *a, const bn_t *b) {
+    bool an = a->negative && a->size, bneg = b->negative && b->size;
+    if (an != bneg) return an ? -1 : 1;
+    int c = bn_cmp_abs(a, b);
+    return an ? -c : c;
+}
+
+/* Arithmetic */
+
+/* r = a + b, with b taken as negative if b_negative */
+static bool _add_signed(bn_t *r, const bn_t *a, const bn_t *b, bool b_negative) {
+    const uint32_t *x = a->limb, *y = b->limb;
+    uint32_t xn = a->size, yn = b->size;
+    bool x_negative = a->negative, y_negative = b_negative;
+
+    if (xn < yn || (x_negative != y_negative && _cmp_n(x, xn, y, yn) < 0)) {
+        const uint32_t *t = x; x = y; y = t;
+        uint32_t tn = xn; xn = yn; yn = tn;
+        bool tneg = x_negative; x_negative = y_negative; y_negative = tneg;
+    }
+
+    uint32_t *limb = _reserve(r, xn + 1);
+    if (!limb) return _fail(r);
+
+    uint32_t n;
+    if (x_negative == y_negative) {
+        limb[xn] = _add_n(limb, x, xn, y, yn);
+        n = xn + 1;
+    } else {
+        _sub_n(limb, x, xn, y, yn);
+        n = xn;
+    }
+    r->size = _trim(limb, n);
+    r->negative = r->size ? x_negative : false;
+    return true;
+}
+
+bool bn_add(bn_t *r, const bn_t *a, const bn_t *b) {
+    return _add_signed(r, a, b, b->negative);
+}
+
+bool bn_sub(bn_t *r, const bn_t *a, const bn_t *b) {
+    return _add_signed(r, a, b, !b->negative);
+}
+
+bool bn_add_u32(bn_t *r, const bn_t *a, uint32_t b) {
+    bn_t v = _view(&b, 1);
+    return _add_signed(r, a, &v, false);
+}
+
+bool bn_mul(bn_t *r, const bn_t *a, const bn_t *b) {
+    const uint32_t *al = a->limb, *bl = b->limb;
+    uint32_t an = a->size, bn = b->size;
+    bool negative = a->negative != b->negative;
+    if (an == 0 || bn == 0) return bn_set_u32(r, 0);
+
+    uint32_t *limb = _reserve_apart(r, an + bn, al, bl);
+    if (!limb || !_mul(limb, al, an, bl, bn)) return _fail(r);
+    r->size = _trim(limb, an + bn);
+    r->negative = negative;
+    return true;
+}
+
+bool bn_mul_u32(bn_t *r, const bn_t *a, uint32_t b) {
+    const uint32_t *al = a->limb;
+    uint32_t n = a->size;
+    bool negative = a->negative;
+    if (n == 0 || b == 0) return bn_set_u32(r, 0);
+
+    uint32_t *limb = _reserve(r, n + 1);
+    if (!limb) return _fail(r);
+    limb[n] = _mul_1(limb, al, n, b);
+    r->size = _trim(limb, n + 1);
+    r->negative = negative;
+    return true;
+}
+
+bool bn_div_u32(bn_t *q, const bn_t *a, uint32_t b, uint32_t *rem) {
+    const uint32_t *al = a->limb;
+    uint32_t n = a->size;
+    bool negative = a->negative;
+    if (b == 0) return false;
+
+    uint32_t *limb = _reserve(q, n);
+    if (!limb) return _fail(q);
+    uint32_t r = _divrem_1(limb, al, n, b);
+    if (rem) *rem = r;
+    q->size = _trim(limb, n);
+    q->negative = q->size ? negative : false;
+    return true;
+}
+
+bool bn_divmod(bn_t *q, bn_t *rem, const bn_t *a, const bn_t *b) {
+    const uint32_t *al = a->limb, *bl = b->limb;
+    uint32_t an = a->size, bn = b->size;
+    bool a_negative = a->negative, b_negative = b->negative;
+    if (bn == 0) return false;
+
+    if (_cmp_n(al, an, bl, bn) < 0) {
+        if (rem && !bn_copy(rem, a)) return false;
+        return q ? bn_set_u32(q, 0) : true;
+    }
+
+    /* Fresh limbs for both results, so a and b stay intact until the end */
+    uint32_t qn = an - bn + 1;
+    uint32_t *ql = _alloc(qn);
+    uint32_t *rl = _alloc(bn);
+    bool ok = ql && rl;
+    if (ok && bn == 1) {
+        rl[0] = _divrem_1(ql, al, an, bl[0]);
+    } else if (ok && qn >= BN_NEWTON_THRESHOLD && bn >= BN_NEWTON_THRESHOLD) {
+        ok = _divrem_newton(ql, rl, al, an, bl, bn);
+    } else if (ok) {
+        ok = _divrem_school(ql, rl, al, an, bl, bn);
+    }
+    if (!ok) {
+        if (q) _fail(q);
+        if (rem) _fail(rem);
+        return false;
+    }
+
+    if (q) {
+        *q = (bn_t){ql, _trim(ql, qn), qn, a_negative != b_negative};
+        q->negative = q->size ? q->negative : false;
+    }
+    if (rem) {
+        *rem = (bn_t){rl, _trim(rl, bn), bn, a_negative};
+        rem->negative = rem->size ? rem->negative : false;
+    }
+    return true;
+}
+
+bool bn_shift_left(bn_t *r, const bn_t *a, uint32_t bits) {
+    const uint32_t *al = a->limb;
+    uint32_t n = a->size;
+    bool negative = a->negative;
+    if (n == 0) return bn_set_u32(r, 0);
+
+    uint32_t limbs = bits / 32, s = bits % 32;
+    uint32_t *limb = _reserve(r, n + limbs + 1);
+    if (!limb) return _fail(r);
+
+    /* Top down, so shifting in place reads each limb before it is written over */
+    limb[n + limbs] = s ? al[n - 1] >> (32 - s) : 0;
+    for (uint32_t i = n; i-- > 0;) {
+        limb[i + limbs] = (al[i] << s) | (s && i > 0 ? al[i - 1] >> (32 - s) : 0);
+    }
+    memset(limb, 0, limbs * sizeof(uint32_t));
+    r->size = _trim(limb, n + limbs + 1);
+    r->negative = negative;
+    return true;
+}
+
+bool bn_shift_right(bn_t *r, const bn_t *a, uint32_t bits) {
+    const uint32_t *al = a->limb;
+    uint32_t n = a->size;
+    bool negative = a->negative;
+    uint32_t limbs = bits / 32, s = bits % 32;
+    if (limbs >= n) return bn_set_u32(r, 0);
+
+    n -= limbs;
+    uint32_t *limb = _reserve(r, n);
+    if (!limb) return _fail(r);
+    for (uint32_t i = 0; i < n; i++) {
+        limb[i] = (al[i + limbs] >> s) | (s && i + 1 < n ? al[i + limbs + 1] << (32 - s) : 0);
+    }
+    r->size = _trim(limb, n);
+    r->negative = r->size ? negative : false;
+    return true;
+}
+
+bool bn_pow_u32(bn_t *r, const bn_t *a, uint32_t exponent) {
+    bn_t base = *a;
+    bn_t result = {0};
+    uint32_t mark = bn_mark();
+    if (!bn_set_u32(&result, 1)) return _fail(r);
+
+    /* Square and multiply from the top bit of the exponent down, keeping only the
+       running result each time round */
+    bool started = false;
+    for (int bit = 31; bit >= 0; bit--) {
+        if (started && !bn_mul(&result, &result, &result)) return _fail(r);
+        if (exponent & (1u << bit)) {
+            started = true;
+            if (!bn_mul(&result, &result, &base)) return _fail(r);
+        }
+        bn_release_keep(mark, &result);
+    }
+    *r = result;
+    return true;
+}
+
+bool bn_pow10(bn_t *r, uint32_t exponent) {
+    uint32_t ten = 10;
+    bn_t base = _view(&ten, 1);
+    return bn_pow_u32(r, &base, exponent);
+}
+
+/* Floor square root of a value up to 64 bits */
+static uint32_t _sqrt_64(uint64_t v) {
+    uint64_t x = 0;
+    for (uint64_t bit = (uint64_t)1 << 62; bit; bit >>= 2) {
+        if (v >= x + bit) {
+            v -= x + bit;
+            x = (x >> 1) + bit;
+        } else {
+            x >>= 1;
+        }
+    }
+    return (uint32_t)x;
+}
+
+/* Floor square root by Newton's iteration, from a root of the top half of the bits of
+   a. That root is close enough that one step of x' = (x + a / x) / 2 lands within a
+   unit or two, which the end corrects. */
+static bool _sqrt(bn_t *r, const bn_t *a) {
+    uint32_t bits = bn_bits(a);
+    if (bits <= 64) {
+        uint64_t v = a->size > 1 ? ((uint64_t)a->limb[1] << 32) | a->limb[0] : (a->size ? a->limb[0] : 0);
+        return bn_set_u32(r, _sqrt_64(v));
+    }
+
+    uint32_t t = bits / 4 - 1;
+    bn_t top = {0}, x = {0}, y = {0};
+    uint32_t one = 1;
+    bn_t unit = _view(&one, 1);
+
+    /* x = (sqrt(a / 4^t) + 1) * 2^t, just above the root */
+    if (!bn_shift_right(&top, a, 2 * t) || !_sqrt(&x, &top)) return false;
+    if (!bn_add(&x, &x, &unit) || !bn_shift_left(&x, &x, t)) return false;
+
+    /* x = (x + a / x) / 2 */
+    if (!bn_divmod(&y, NULL, a, &x) || !bn_add(&x, &x, &y) || !bn_shift_right(&x, &x, 1)) return false;
+
+    /* Down to the largest x with x^2 <= a, then up if it overshot */
+    for (;;) {
+        if (!bn_mul(&y, &x, &x)) return false;
+        if (bn_cmp(&y, a) <= 0) break;
+        if (!bn_sub(&x, &x, &unit)) return false;
+    }
+    for (;;) {
+        if (!bn_add(&y, &x, &unit) || !bn_mul(&y, &y, &y)) return false;
+        if (bn_cmp(&y, a) > 0) break;
+        if (!bn_add(&x, &x, &unit)) return false;
+    }
+    *r = x;
+    return true;
+}
+
+bool bn_sqrt(bn_t *r, const bn_t *a) {
+    if (a->negative && a->size) return false;
+
+    bn_t root = {0};
+    uint32_t mark = bn_mark();
+    if (!_sqrt(&root, a)) {
+        bn_release(mark);
+        return _fail(r);
+    }
+    bn_release_keep(mark, &root);
+    *r = root;
+    return true;
+}
+
+/* Product of lo to hi, as a balanced tree so the big multiplications are between
+   numbers of about the same size, where Karatsuba does best */
+static bool _product(bn_t *r, uint32_t lo, uint32_t hi) {
+    if (hi - lo < 16) {
+        uint32_t acc = 1;
+        if (!bn_set_u32(r, 1)) return false;
+        for (uint64_t k = lo; k <= hi; k++) {
+            if (acc > UINT32_MAX / k) {
+                if (!bn_mul_u32(r, r, acc)) return false;
+                acc = 1;
+            }
+            acc *= (uint32_t)k;
+        }
+        return bn_mul_u32(r, r, acc);
+    }
+
+    uint32_t mid = lo + (hi - lo) / 2;
+    uint32_t mark = bn_mark();
+    bn_t left = {0}, right = {0}, product = {0};
+    if (!_product(&left, lo, mid) || !_product(&right, mid + 1, hi)) return false;
+    if (!bn_mul(&product, &left, &right)) return false;
+    bn_release_keep(mark, &product);
+    *r = product;
+    return true;
+}
+
+bool bn_factorial(bn_t *r, uint32_t n) {
+    bn_t product = {0};
+    uint32_t mark = bn_mark();
+    bool ok = n < 2 ? bn_set_u32(&product, 1) : _product(&product, 2, n);
+    if (!ok) {
+        bn_release(mark);
+        return _fail(r);
+    }
+    bn_release_keep(mark, &product);
+    *r = product;
+    return true;
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "drivers/scratch.h"
+
+/*
+  Arbitrary-precision integers for the calculator
+  - A sign and a magnitude in 32-bit limbs, least significant first
+  - All limbs come from one scratch arena (bn_use_arena). Nothing is freed one at a time:
+    bn_mark() notes how much of the arena is in use and bn_release() gives back everything
+    allocated since, so an expression never calls malloc. bn_release_keep() does the same
+    but first moves one result down to the mark, for values that outlive their temporaries.
+  - Multiplication is schoolbook below BN_KARATSUBA_THRESHOLD limbs and Karatsuba above
+  - Division is schoolbook (Knuth's algorithm D) for short quotients or divisors, and
+    above BN_NEWTON_THRESHOLD limbs multiplies by a reciprocal found by Newton iteration
+  - Square roots are found by Newton iteration, doubling the precision at each step
+  - When the arena runs out, the operation gives zero and bn_failed() turns true; it stays
+    true until the next bn_use_arena(), so a whole calculation can be checked once
+*/
+
+#ifndef BN_KARATSUBA_THRESHOLD
+#define BN_KARATSUBA_THRESHOLD 32  /* limbs of the shorter factor */
+#endif
+
+#ifndef BN_NEWTON_THRESHOLD
+#define BN_NEWTON_THRESHOLD 64     /* limbs of the divisor and of the quotient */
+#endif
+
+typedef struct {
+    uint32_t *limb;      /* least significant first */
+    uint32_t size;       /* limbs in use; 0 for zero, and the top limb is never 0 */
+    uint32_t capacity;   /* limbs allocated */
+    bool negative;
+} bn_t;
+
+/* Arena */
+void bn_use_arena(scratch_arena_t *arena);
+uint32_t bn_mark(void);
+void bn_release(uint32_t mark);
+void bn_release_keep(uint32_t mark, bn_t *keep);
+bool bn_failed(void);
+
+/* Multiplications of at least this many limbs use Karatsuba (for tuning) */
+void bn_set_karatsuba_threshold(uint32_t limbs);
+
+/* Setting and reading */
+void bn_init(bn_t *a);
+bool bn_set_u32(bn_t *r, uint32_t value);
+bool bn_set_decimal(bn_t *r, const char *digits, uint32_t count);  /* '0'-'9' only */
+bool bn_copy(bn_t *r, const bn_t *a);
+bool bn_is_zero(const bn_t *a);
+bool bn_to_u32(const bn_t *a, uint32_t *value);  /* false if negative or too big */
+uint32_t bn_bits(const bn_t *a);                   /* bits in the magnitude */
+uint32_t bn_decimal_digits(const bn_t *a);         /* digits in the magnitude, or a little over */
+
+/* Decimal digits of a, with a leading '-' if negative, into text (which has room for
+   bn_decimal_digits(a) + 2 characters). Returns the length. */
+uint32_t bn_to_decimal(const bn_t *a, char *text);
+
+/* Comparisons: negative, zero or positive as a < b, a == b or a > b */
+int bn_cmp(const bn_t *a, const bn_t *b);
+int bn_cmp_abs(const bn_t *a, const bn_t *b);
+
+/* Arithmetic. The result can be one of the operands. Division rounds towards zero and
+   the remainder has the sign of a; q or rem can be NULL. */
+bool bn_add(bn_t *r, const bn_t *a, const bn_t *b);
+bool bn_sub(bn_t *r, const bn_t *a, const bn_t *b);
+bool bn_mul(bn_t *r, const bn_t *a, const bn_t *b);
+bool bn_mul_u32(bn_t *r, const bn_t *a, uint32_t b);
+bool bn_add_u32(bn_t *r, const bn_t *a, uint32_t b);
+bool bn_divmod(bn_t *q, bn_t *rem, const bn_t *a, const bn_t *b);
+bool bn_div_u32(bn_t *q, const bn_t *a, uint32_t b, uint32_t *rem);
+bool bn_shift_left(bn_t *r, const bn_t *a, uint32_t bits);
+bool bn_shift_right(bn_t *r, const bn_t *a, uint32_t bits);  /* of the magnitude */
+bool bn_pow_u32(bn_t *r, const bn_t *a, uint32_t exponent);
+bool bn_pow10(bn_t *r, uint32_t exponent);
+bool bn_sqrt(bn_t *r, const bn_t *a);  /* floor of the square root of a >= 0 */
+bool bn_factorial(bn_t *r, uint32_t n);
@@ -0,0 +1,585 @@
+#include "calc.h"
+#include "bignum.h"
+#include <ctype.h>
+#include <math.h>
+#include <string.h>
+
+/* Calculator
+
+   A value is an integer m and a scale s standing for m / 10^s. Whole numbers have s = 0
+   and stay exact; a decimal is rounded to the precision when an operation would give it
+   more digits after the point than that. Results are always written into new limbs, so
+   an operand (ans, in particular) is never changed by an operation on it.
+
+   The parser works out each part as it reads it. Each term and expression marks the
+   arena where it started and, after each operation, moves the result down to the mark,
+   so the operands are given back straight away and a long expression only holds a few
+   values at once.
+
+   ans is kept at the very start of the arena, and the text of the last result above it.
+*/
+
+typedef struct {
+    bn_t m;
+    uint32_t scale;  /* digits after the decimal point */
+} value_t;
+
+typedef struct {
+    const char *text;
+    const char *pos;
+    const char *error;
+    uint16_t error_pos;
+    uint8_t depth;  /* unary expressions being parsed, one inside the other */
+} parser_t;
+
+static scratch_arena_t *arena = NULL;
+static uint32_t precision = CALC_DEFAULT_PRECISION;
+static value_t ans;
+static uint32_t ans_end;  /* arena offset just past ans */
+
+/* Values */
+
+static void _fail(parser_t *p, const char *error) {
+    if (!p->error) {
+        p->error = error;
+        p->error_pos = p->pos - p->text;
+    }
+}
+
+/* True if the arena ran out; reports it once */
+static bool _out_of_memory(parser_t *p) {
+    if (!bn_failed()) return false;
+    _fail(p, "Out of memory");
+    return true;
+}
+
+/* Fail early on a result of about this many bits that could not fit anyway, rather than
+   after working most of it out */
+static bool _too_big(parser_t *p, double bits) {
+    if (bits / 8 < (double)(arena->size - arena->used) / 2) return false;
+    _fail(p, "Result too big");
+    return true;
+}
+
+static void _keep(uint32_t mark, value_t *v) {
+    bn_release_keep(mark, &v->m);
+}
+
+/* r = a * 10^digits */
+static bool _shift_up(bn_t *r, const bn_t *a, uint32_t digits) {
+    if (digits == 0) return bn_copy(r, a);
+    if (digits <= 9) {
+        static const uint32_t powers[10] = {1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000};
+        return bn_mul_u32(r, a, powers[digits]);
+    }
+    bn_t power = {0};
+    return bn_pow10(&power, digits) && bn_mul(r, a, &power);
+}
+
+/* r = a / 10^digits, rounded half away from zero */
+static bool _shift_down(bn_t *r, const bn_t *a, uint32_t digits) {
+    if (digits == 0) return bn_copy(r, a);
+
+    /* Leave one digit to round on: round(x) = trunc((trunc(10x) + 5) / 10) */
+    bn_t power = {0}, q = {0};
+    if (digits == 1) {
+        if (!bn_copy(&q, a)) return false;
+    } else if (digits <= 10) {
+        static const uint32_t powers[10] = {1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000};
+        if (!bn_div_u32(&q, a, powers[digits - 1], NULL)) return false;
+    } else {
+        if (!bn_pow10(&power, digits - 1) || !bn_divmod(&q, NULL, a, &power)) return false;
+    }
+    bool negative = q.negative;
+    q.negative = false;
+    if (!bn_add_u32(&q, &q, 5) || !bn_div_u32(r, &q, 10, NULL)) return false;
+    r->negative = negative && r->size;
+    return true;
+}
+
+/* Round to the precision if there are more digits after the point than that */
+static void _round(parser_t *p, value_t *v) {
+    if (v->scale <= precision) return;
+    bn_t m = {0};
+    _shift_down(&m, &v->m, v->scale - precision);
+    v->m = m;
+    v->scale = precision;
+    _out_of_memory(p);
+}
+
+/* If v has nothing after the point, make it a whole number (scale 0) and return true */
+static bool _whole(parser_t *p, value_t *v) {
+    if (v->scale == 0) return true;
+
+    bn_t power = {0}, q = {0}, rem = {0};
+    if (!bn_pow10(&power, v->scale) || !bn_divmod(&q, &rem, &v->m, &power)) {
+        _out_of_memory(p);
+        return false;
+    }
+    if (!bn_is_zero(&rem)) return false;
+    v->m = q;
+    v->scale = 0;
+    return true;
+}
+
+/* A whole number that fits 32 bits, for exponents and factorials */
+static bool _small_whole(parser_t *p, value_t *v, uint32_t *n, bool *negative) {
+    if (!_whole(p, v)) {
+        _fail(p, "Needs a whole number");
+        return false;
+    }
+    *negative = v->m.negative;
+    bn_t magnitude = v->m;
+    magnitude.negative = false;
+    if (!bn_to_u32(&magnitude, n)) {
+        _fail(p, "Number too big");
+        return false;
+    }
+    return true;
+}
+
+/* Operations */
+
+static value_t _add(parser_t *p, value_t a, value_t b, bool subtract) {
+    /* Line up the decimal points */
+    value_t r = {{0}, a.scale > b.scale ? a.scale : b.scale};
+    bn_t x = {0}, y = {0};
+    _shift_up(&x, &a.m, r.scale - a.scale);
+    _shift_up(&y, &b.m, r.scale - b.scale);
+    if (subtract) {
+        bn_sub(&r.m, &x, &y);
+    } else {
+        bn_add(&r.m, &x, &y);
+    }
+    _out_of_memory(p);
+    return r;
+}
+
+static value_t _mul(parser_t *p, value_t a, value_t b) {
+    value_t r = {{0}, a.scale + b.scale};
+    _too_big(p, (double)bn_bits(&a.m) + bn_bits(&b.m));
+    if (p->error) return r;
+    bn_mul(&r.m, &a.m, &b.m);
+    _out_of_memory(p);
+    _round(p, &r);
+    return r;
+}
+
+static value_t _div(parser_t *p, value_t a, value_t b) {
+    value_t r = {{0}, 0};
+    if (bn_is_zero(&b.m)) {
+        _fail(p, "Division by zero");
+        return r;
+    }
+
+    /* Whole numbers that divide exactly stay whole */
+    if (_whole(p, &a) && _whole(p, &b)) {
+        bn_t rem = {0};
+        bn_divmod(&r.m, &rem, &a.m, &b.m);
+        if (_out_of_memory(p) || bn_is_zero(&rem)) return r;
+    }
+
+    /* Otherwise to the precision, from one more digit: (a * 10^(P + 1 + sb - sa)) / b.
+       (a can have more digits than that if it is ans from before the precision changed.) */
+    _round(p, &a);
+    bn_t n = {0}, q = {0};
+    _shift_up(&n, &a.m, precision + 1 + b.scale - a.scale);
+    bn_divmod(&q, NULL, &n, &b.m);
+    _shift_down(&r.m, &q, 1);
+    r.scale = precision;
+    _out_of_memory(p);
+    return r;
+}
+
+static value_t _mod(parser_t *p, value_t a, value_t b) {
+    value_t r = {{0}, 0};
+    if (!_whole(p, &a) || !_whole(p, &b)) {
+        _fail(p, "% needs whole numbers");
+        return r;
+    }
+    if (bn_is_zero(&b.m)) {
+        _fail(p, "Division by zero");
+        return r;
+    }
+    bn_divmod(NULL, &r.m, &a.m, &b.m);
+    _out_of_memory(p);
+    return r;
+}
+
+static value_t _pow(parser_t *p, value_t a, value_t b) {
+    value_t r = {{0}, 0};
+    uint32_t n;
+    bool negative;
+    if (!_small_whole(p, &b, &n, &negative)) return r;
+
+    if (_whole(p, &a)) {
+        /* Exact */
+        if (bn_bits(&a.m) > 1 && _too_big(p, (double)bn_bits(&a.m) * n)) return r;
+        bn_pow_u32(&r.m, &a.m, n);
+        _out_of_memory(p);
+    } else {
+        /* Rounded after each step, from the top bit of the exponent down */
+        bn_set_u32(&r.m, 1);
+        for (int bit = 31; bit >= 0 && !p->error; bit--) {
+            r = _mul(p, r, r);
+            if (n & (1u << bit)) r = _mul(p, r, a);
+        }
+    }
+
+    if (negative && !p->error) {
+        value_t one = {{0}, 0};
+        bn_set_u32(&one.m, 1);
+        r = _div(p, one, r);
+    }
+    return r;
+}
+
+static value_t _factorial(parser_t *p, value_t a) {
+    value_t r = {{0}, 0};
+    uint32_t n;
+    bool negative;
+    if (!_small_whole(p, &a, &n, &negative)) return r;
+    if (negative) {
+        _fail(p, "! needs a whole number >= 0");
+        return r;
+    }
+
+    /* log2(n!) is about n log2(n / e) */
+    if (n > 2 && _too_big(p, n * log2(n / M_E))) return r;
+    bn_factorial(&r.m, n);
+    _out_of_memory(p);
+    return r;
+}
+
+static value_t _sqrt(parser_t *p, value_t a) {
+    value_t r = {{0}, 0};
+    if (a.m.negative) {
+        _fail(p, "Square root of a negative number");
+        return r;
+    }
+
+    /* Whole if it is a perfect square */
+    if (_whole(p, &a)) {
+        bn_t square = {0};
+        bn_sqrt(&r.m, &a.m);
+        bn_mul(&square, &r.m, &r.m);
+        if (_out_of_memory(p) || bn_cmp(&square, &a.m) == 0) return r;
+    }
+
+    /* Otherwise to one more digit than the precision: sqrt(a * 10^(2P + 2)) / 10^(P + 1) */
+    _round(p, &a);
+    bn_t n = {0}, root = {0};
+    _shift_up(&n, &a.m, 2 * precision + 2 - a.scale);
+    bn_sqrt(&root, &n);
+    _shift_down(&r.m, &root, 1);
+    r.scale = precision;
+    _out_of_memory(p);
+    return r;
+}
+
+/* Constants */
+
+/* sum = unity * atan(1 / x), from the series 1/x - 1/(3 x^3) + 1/(5 x^5) - ... */
+static void _atan_inverse(bn_t *sum, const bn_t *unity, uint32_t x) {
+    bn_t power = {0}, term = {0};
+    uint32_t x2 = x * x;
+    bn_div_u32(&power, unity, x, NULL);
+    bn_copy(sum, &power);
+    for (uint32_t k = 1; !bn_is_zero(&power) && !bn_failed(); k++) {
+        bn_div_u32(&power, &power, x2, NULL);
+        bn_div_u32(&term, &power, 2 * k + 1, NULL);
+        if (k & 1) {
+            bn_sub(sum, sum, &term);
+        } else {
+            bn_add(sum, sum, &term);
+        }
+    }
+}
+
+/* Worked out with this many extra digits, more than the rounding in the series loses */
+#define GUARD_DIGITS 10
+
+/* pi = 16 atan(1/5) - 4 atan(1/239) (Machin) */
+static value_t _pi(parser_t *p) {
+    value_t r = {{0}, precision + GUARD_DIGITS};
+    bn_t unity = {0}, a = {0}, b = {0};
+    bn_pow10(&unity, r.scale);
+    _atan_inverse(&a, &unity, 5);
+    _atan_inverse(&b, &unity, 239);
+    bn_mul_u32(&a, &a, 16);
+    bn_mul_u32(&b, &b, 4);
+    bn_sub(&r.m, &a, &b);
+    if (!_out_of_memory(p)) _round(p, &r);
+    return r;
+}
+
+/* e = 1 + 1/1! + 1/2! + ... */
+static value_t _e(parser_t *p) {
+    value_t r = {{0}, precision + GUARD_DIGITS};
+    bn_t term = {0};
+    bn_pow10(&term, r.scale);
+    bn_copy(&r.m, &term);
+    for (uint32_t k = 1; !bn_is_zero(&term) && !bn_failed(); k++) {
+        bn_div_u32(&term, &term, k, NULL);
+        bn_add(&r.m, &r.m, &term);
+    }
+    if (!_out_of_memory(p)) _round(p, &r);
+    return r;
+}
+
+/* Parsing */
+
+static void _skip_spaces(parser_t *p) {
+    while (*p->pos == ' ' || *p->pos == '\t') p->pos++;
+}
+
+static bool _accept(parser_t *p, char ch) {
+    _skip_spaces(p);
+    if (*p->pos != ch) return false;
+    p->pos++;
+    return true;
+}
+
+static value_t _expression(parser_t *p);
+static value_t _unary(parser_t *p);
+
+static value_t _number(parser_t *p) {
+    value_t v = {{0}, 0};
+    const char *start = p->pos;
+    uint32_t count = 0;
+    bool point = false;
+    for (; isdigit((unsigned char)*p->pos) || (*p->pos == '.' && !point); p->pos++) {
+        if (*p->pos == '.') {
+            point = true;
+        } else {
+            count++;
+            v.scale += point;
+        }
+    }
+    if (count == 0) {
+        p->pos = start;
+        _fail(p, "Bad number");
+        return v;
+    }
+
+    /* The digits without the point */
+    char *digits = scratch_arena_alloc(arena, count);
+    if (!digits) {
+        _fail(p, "Out of memory");
+        return v;
+    }
+    uint32_t n = 0;
+    for (const char *c = start; c < p->pos; c++) {
+        if (*c != '.') digits[n++] = *c;
+    }
+    bn_set_decimal(&v.m, digits, count);
+    if (!_out_of_memory(p)) _round(p, &v);
+    return v;
+}
+
+static value_t _primary(parser_t *p) {
+    _skip_spaces(p);
+
+    if (_accept(p, '(')) {
+        value_t v = _expression(p);
+        if (!_accept(p, ')')) _fail(p, "Expected )");
+        return v;
+    }
+
+    if (isdigit((unsigned char)*p->pos) || *p->pos == '.') return _number(p);
+
+    if (isalpha((unsigned char)*p->pos)) {
+        const char *start = p->pos;
+        while (isalnum((unsigned char)*p->pos)) p->pos++;
+        size_t length = p->pos - start;
+
+        if (length == 2 && strncmp(start, "pi", 2) == 0) return _pi(p);
+        if (length == 1 && *start == 'e') return _e(p);
+        if (length == 3 && strncmp(start, "ans", 3) == 0) return ans;
+        if (length == 4 && strncmp(start, "sqrt", 4) == 0) {
+            if (!_accept(p, '(')) {
+                _fail(p, "Expected (");
+                return (value_t){{0}, 0};
+            }
+            value_t v = _expression(p);
+            if (!_accept(p, ')')) _fail(p, "Expected )");
+            return p->error ? v : _sqrt(p, v);
+        }
+        p->pos = start;
+        _fail(p, "Unknown name");
+        return (value_t){{0}, 0};
+    }
+
+    _fail(p, *p->pos ? "Expected a number or (" : "Unexpected end");
+    return (value_t){{0}, 0};
+}
+
+/* postfix: primary {!} */
+static value_t _postfix(parser_t *p) {
+    uint32_t mark = bn_mark();
+    value_t v = _primary(p);
+    while (!p->error && _accept(p, '!')) {
+        v = _factorial(p, v);
+        _keep(mark, &v);
+    }
+    return v;
+}
+
+/* power: postfix [^ unary], so 2^-3 works and a^b^c is a^(b^c) */
+static value_t _power(parser_t *p) {
+    uint32_t mark = bn_mark();
+    value_t v = _postfix(p);
+    if (!p->error && _accept(p, '^')) {
+        value_t exponent = _unary(p);
+        if (!p->error) v = _pow(p, v, exponent);
+        _keep(mark, &v);
+    }
+    return v;
+}
+
+/* unary: -unary | +unary | power, so -2^2 is -(2^2). Every bracket, sign and power nests
+   through here, so the depth is limited here: each level takes a few hundred bytes of stack. */
+static value_t _unary(parser_t *p) {
+    if (p->depth == CALC_MAX_DEPTH) {
+        _fail(p, "Too deeply nested");
+        return (value_t){{0}, 0};
+    }
+    p->depth++;
+
+    value_t v;
+    if (_accept(p, '-')) {
+        v = _unary(p);
+        if (v.m.size) v.m.negative = !v.m.negative;
+    } else if (_accept(p, '+')) {
+        v = _unary(p);
+    } else {
+        v = _power(p);
+    }
+    p->depth--;
+    return v;
+}
+
+/* term: unary {(* | / | %) unary} */
+static value_t _term(parser_t *p) {
+    uint32_t mark = bn_mark();
+    value_t v = _unary(p);
+    while (!p->error) {
+        _skip_spaces(p);
+        char op = *p->pos;
+        if (op != '*' && op != '/' && op != '%') break;
+        p->pos++;
+        value_t right = _unary(p);
+        if (p->error) break;
+        v = op == '*' ? _mul(p, v, right) : op == '/' ? _div(p, v, right) : _mod(p, v, right);
+        _keep(mark, &v);
+    }
+    return v;
+}
+
+/* expression: term {(+ | -) term} */
+static value_t _expression(parser_t *p) {
+    uint32_t mark = bn_mark();
+    value_t v = _term(p);
+    while (!p->error) {
+        _skip_spaces(p);
+        char op = *p->pos;
+        if (op != '+' && op != '-') break;
+        p->pos++;
+        value_t right = _term(p);
+        if (p->error) break;
+        v = _add(p, v, right, op == '-');
+        _keep(mark, &v);
+    }
+    return v;
+}
+
+/* Results */
+
+/* Decimal text of v, without trailing zeros after the point. The digits are written one
+   place in, leaving room for a sign, and then moved apart for the point. */
+static char *_text(const value_t *v, uint32_t *length) {
+    bn_t magnitude = v->m;
+    magnitude.negative = false;
+    uint32_t scale = v->scale;
+    char *text = scratch_arena_alloc(arena, bn_decimal_digits(&magnitude) + scale + 4);
+    if (!text) return NULL;
+
+    char *digits = text + 1;
+    uint32_t count = bn_to_decimal(&magnitude, digits);
+    if (count == 0) return NULL;
+    while (scale > 0 && count > 1 && digits[count - 1] == '0') {
+        count--;
+        scale--;
+    }
+    if (count == 1 && digits[0] == '0') scale = 0;
+
+    if (scale > 0 && count > scale) {
+        /* 123.45 */
+        memmove(digits + count - scale + 1, digits + count - scale, scale);
+        digits[count - scale] = '.';
+        count++;
+    } else if (scale > 0) {
+        /* 0.0012345 */
+        memmove(digits + 2 + scale - count, digits, count);
+        digits[0] = '0';
+        digits[1] = '.';
+        memset(digits + 2, '0', scale - count);
+        count = scale + 2;
+    }
+    digits[count] = '\0';
+
+    if (v->m.negative && v->m.size) {
+        text[0] = '-';
+        *length = count + 1;
+        return text;
+    }
+    *length = count;
+    return digits;
+}
+
+void calc_init(scratch_arena_t *new_arena) {
+    arena = new_arena;
+    arena->used = 0;
+    ans = (value_t){{0}, 0};
+    ans_end = 0;
+}
+
+void calc_set_precision(uint32_t digits) {
+    precision = digits > CALC_MAX_PRECISION ? CALC_MAX_PRECISION : digits;
+}
+
+uint32_t calc_get_precision(void) {
+    return precision;
+}
+
+bool calc_evaluate(const char *text, calc_result_t *result) {
+    memset(result, 0, sizeof(*result));
+    parser_t p = {.text = text, .pos = text};
+
+    /* Everything above ans is free again, including the text of the last result */
+    bn_use_arena(arena);
+    arena->used = ans_end;
+
+    value_t v = _expression(&p);
+    _skip_spaces(&p);
+    if (!p.error && *p.pos) _fail(&p, "Unexpected character");
+
+    /* The text first, above the result, then the result down to become ans */
+    char *out = NULL;
+    if (!p.error) {
+        out = _text(&v, &result->length);
+        if (!out) _fail(&p, "Out of memory");
+    }
+    if (p.error) {
+        arena->used = ans_end;
+        result->error = p.error;
+        result->error_pos = p.error_pos;
+        return false;
+    }
+
+    bn_release_keep(0, &v.m);
+    ans = v;
+    ans_end = arena->used;
+    result->text = out;
+    return true;
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "drivers/scratch.h"
+
+/*
+  Arbitrary-precision calculator (used by calc)
+  - Whole numbers of any size, and decimals to a set number of digits after the point
+    (calc_set_precision, 30 by default). Whole numbers stay exact through + - * % ^ ! and
+    any division that comes out even.
+  - + - * / % (remainder of whole numbers), ^ (power, right to left, whole exponents),
+    ! (factorial), unary minus, brackets, sqrt(), pi, e, and ans for the last result
+  - Built on bignum.h: every value and temporary lives in one scratch arena, which holds
+    ans at its start between calculations
+*/
+
+#define CALC_DEFAULT_PRECISION 30     /* digits after the decimal point */
+#define CALC_MAX_PRECISION     100000
+#define CALC_MAX_DEPTH         16     /* brackets, signs and powers nested inside each other */
+
+typedef struct {
+    const char *text;    /* the result in decimal, valid until the next calc_evaluate */
+    uint32_t length;     /* characters in text */
+    const char *error;   /* why it failed, NULL if it did not */
+    uint16_t error_pos;  /* offset in the expression where it failed */
+} calc_result_t;
+
+/* Start a session in an open arena, with ans = 0 */
+void calc_init(scratch_arena_t *arena);
+
+void calc_set_precision(uint32_t digits);
+uint32_t calc_get_precision(void);
+
+/* Work out an expression. Returns false with error and error_pos set if it is not a
+   valid expression, or cannot be worked out (division by zero, out of memory). */
+bool calc_evaluate(const char *text, calc_result_t *result);
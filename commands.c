@@ -1,4 +1,5 @@
 #include <stdio.h>
+#include <stddef.h>
 #include <math.h>
 #include <stdlib.h>
 #include <string.h>
@@ -10,6 +11,8 @@
 #include "pico/float.h"
 #include "pico/util/datetime.h"
 #include "pico/time.h"
+#include "hardware/clocks.h"
+#include "hardware/spi.h"
 
 #include "drivers/southbridge.h"
 #include "drivers/audio.h"
@@ -18,11 +21,21 @@
 #include "drivers/lcd.h"
 #include "drivers/keyboard.h"
 #include "drivers/ds3231.h"
+#include "drivers/memstat.h"
+#include "drivers/idle.h"
+#include "drivers/governor.h"
+#include "drivers/boottime.h"
+#include "drivers/dpm.h"
+#include "drivers/scratch.h"
 #include "songs.h"
 #include "tests.h"
 #include "commands.h"
 #include "gfx.h"
 #include "gfx_core.h"
+#include "gfx_game.h"
+#include "gfx_draw.h"
+#include "expr.h"
+#include "calc.h"
 #include "sprites.h"
 #include "tiles.h"
 
@@ -33,6 +46,7 @@ static gfx_sprite_t s;
 
 volatile bool user_interrupt = false;
 extern void readline(char *buffer, size_t size);
+extern void str_to_lower(char *s);
 uint8_t columns = 40;
 
 // Command table - map of command names to functions
@@ -40,26 +54,36 @@ static const command_t commands[] = {
     {"backlight", backlight, "Show/set the backlight"},
     {"battery", battery, "Show the battery level"},
     {"beep", beep, "Play a simple beep sound"},
+    {"boot", boot_time, "Show boot timing per stage"},
     {"box", box, "Draw a box on the screen"},
     {"bye", bye, "Reboot into BOOTSEL mode"},
+    {"calc", calc, "Arbitrary-precision calculator"},
+    {"clock", clock_profile, "Show/set the clock profile"},
     {"cls", clearscreen, "Clear the screen"},
     {"cd", cd, "Change directory ('/' path sep.)"},
+    {"defrag", sd_defrag, "Defragment files on the SD card"},
     {"dir", dir, "List files on the SD card"},
     {"free", sd_free, "Show free space on the SD card"},
+    {"fsck", sd_fsck, "Check the SD card for errors"},
     {"hexdump", hexdump, "Show hex dump of a file"},
+    {"idle", idle, "Show CPU idle time per core"},
+    {"mem", mem, "Show memory usage"},
     {"mkdir", sd_mkdir, "Create a new directory"},
     {"mkfile", sd_mkfile, "Create a new file"},
     {"mv", sd_mv, "Move or rename a file/directory"},
     {"more", sd_more, "Page through a file"},
     {"play", play, "Play a song"},
+    {"plot", plot, "Plot y = f(x) on the screen"},
     {"poweroff", power_off, "Power off the device"},
     {"pwd", sd_pwd, "Print working directory"},
     {"reset", reset, "Reset the device"},
     {"rm", sd_rm, "Remove a file"},
     {"rmdir", sd_rmdir, "Remove a directory"},
+    {"screen", screen, "Show/set display power timeouts"},
     {"sdcard", sd_status, "Show SD card status"},
     {"showimg", showimg, "Display image from SD card"},
     {"songs", show_song_library, "Show song library"},
+    {"standby", standby, "Low-power always-on clock"},
     {"ted", ted, "Text editor"},
     {"test", test, "Run a test"},
     {"tests", show_test_library, "Show test library"},
@@ -239,6 +263,14 @@ void run_command(const char *command)
             {
                 cd_dirname(condense(cmd_args[1]));
             }
+            else if (strcmp(cmd_args[0], "defrag") == 0 && cmd_args[1] != NULL)
+            {
+                sd_defrag_path(condense(cmd_args[1]));
+            }
+            else if (strcmp(cmd_args[0], "fsck") == 0 && cmd_args[1] != NULL)
+            {
+                sd_fsck_option(condense(cmd_args[1]));
+            }
             else if (strcmp(cmd_args[0], "mkfile") == 0 && cmd_args[1] != NULL)
             {
                 sd_mkfile_filename(condense(cmd_args[1]));
@@ -263,6 +295,10 @@ void run_command(const char *command)
             {
                 width_set(condense(cmd_args[1]));
             }
+            else if (strcmp(cmd_args[0], "clock") == 0 && cmd_args[1] != NULL)
+            {
+                clock_profile_set(condense(cmd_args[1]));
+            }
             else if (strcmp(cmd_args[0], "poweroff") == 0 && cmd_args[1] != NULL)
             {
                 power_off_set(condense(cmd_args[1]));
@@ -275,6 +311,10 @@ void run_command(const char *command)
             {
                 backlight_set(condense(cmd_args[1]), condense(cmd_args[2]));
             }
+            else if (strcmp(cmd_args[0], "screen") == 0 && cmd_args[1] != NULL && cmd_args[2] != NULL)
+            {
+                screen_set(condense(cmd_args[1]), condense(cmd_args[2]));
+            }
             else if (strcmp(cmd_args[0], "time") == 0 && cmd_args[1] != NULL && cmd_args[2] != NULL)
             {
                 rtc_time_set(condense(cmd_args[1]), condense(cmd_args[2]));
@@ -283,6 +323,16 @@ void run_command(const char *command)
             {
                 hexdump_filename(condense(cmd_args[1]));
             }
+            else if (strcmp(cmd_args[0], "calc") == 0 && cmd_args[1] != NULL)
+            {
+                // The expression can have spaces, so it gets the rest of the line
+                calc_expression(command + (cmd_args[1] - cmd_copy));
+            }
+            else if (strcmp(cmd_args[0], "plot") == 0 && cmd_args[1] != NULL)
+            {
+                // The expression can have spaces, so it gets the rest of the line
+                plot_expression(command + (cmd_args[1] - cmd_copy));
+            }
             else if (strcmp(cmd_args[0], "showimg") == 0 && cmd_args[1] != NULL)
             {
                 showimg_filename(condense(cmd_args[1]));
@@ -424,6 +474,20 @@ void beep()
     printf("Beep complete.\n");
 }
 
+void boot_time()
+{
+    printf("Boot stage      Done at   Took\n");
+
+    uint32_t previous_us = 0;
+    for (int i = 0; i < boot_get_stage_count(); i++)
+    {
+        const boot_stage_t *stage = boot_get_stage(i);
+        printf("  %-12s %6.1fms %6.1fms\n", stage->name,
+               stage->time_us / 1000.0f, (stage->time_us - previous_us) / 1000.0f);
+        previous_us = stage->time_us;
+    }
+}
+
 void box()
 {
     printf("A box using the DEC Special Character\nSet:\n\n");
@@ -541,6 +605,114 @@ void power_off_set(const char *seconds)
     }
 }
 
+void idle()
+{
+    // Report the period since the last 'idle' command (or boot) and start a new one
+    printf("Idle time since last check:\n");
+    for (uint core = 0; core < IDLE_NUM_CORES; core++)
+    {
+        printf("  Core %u: %3u%% (%llu ms)\n", core, idle_get_percent(core),
+               (unsigned long long)(idle_get_time_us(core) / 1000));
+    }
+    idle_reset_stats();
+}
+
+void clock_profile()
+{
+    const governor_profile_info_t *info = governor_get_profile_info(governor_get_profile());
+
+    printf("Clock profile: %s\n", info->name);
+    printf("  System:     %6.1f MHz\n", clock_get_hz(clk_sys) / 1000000.0f);
+    printf("  Peripheral: %6.1f MHz\n", clock_get_hz(clk_peri) / 1000000.0f);
+    printf("  LCD SPI:    %6.1f MHz\n", spi_get_baudrate(LCD_SPI) / 1000000.0f);
+    printf("  SD SPI:     %6.1f MHz\n", spi_get_baudrate(SD_SPI) / 1000000.0f);
+
+    printf("\nProfiles:");
+    for (int i = 0; i < GOVERNOR_NUM_PROFILES; i++)
+    {
+        info = governor_get_profile_info((governor_profile_t)i);
+        printf(" %s (%lu MHz)", info->name, info->sys_khz / 1000);
+    }
+    printf("\n");
+}
+
+void clock_profile_set(const char *name)
+{
+    governor_profile_t profile;
+    if (!governor_find_profile(name, &profile))
+    {
+        printf("Error: Unknown clock profile '%s'.\n", name);
+        printf("Usage: clock [low|normal|fast]\n");
+        return;
+    }
+
+    if (!governor_set_profile(profile))
+    {
+        printf("Error: Cannot switch to the '%s' clock.\n", name);
+        return;
+    }
+    clock_profile();
+}
+
+void screen()
+{
+    printf("Display power timeouts:\n");
+    printf("  Idle:  %u s\n", dpm_get_idle_timeout());
+    printf("  Sleep: %u s\n", dpm_get_sleep_timeout());
+    printf("(0 = never)\n");
+}
+
+void screen_set(const char *idle_seconds, const char *sleep_seconds)
+{
+    char *end_idle, *end_sleep;
+    long idle_s = strtol(idle_seconds, &end_idle, 10);
+    long sleep_s = strtol(sleep_seconds, &end_sleep, 10);
+
+    if (*end_idle || *end_sleep || idle_s < 0 || idle_s > 65535 || sleep_s < 0 || sleep_s > 65535)
+    {
+        printf("Error: Invalid timeouts.\n");
+        printf("Usage: screen <idle s> <sleep s>\n");
+        return;
+    }
+
+    dpm_set_timeouts((uint16_t)idle_s, (uint16_t)sleep_s);
+    screen();
+}
+
+void mem()
+{
+    mem_info_t info;
+    mem_get_info(&info);
+
+    printf("\033[4mStatic\033[0m\n");
+    printf("  Flash image:    %8u bytes\n", info.flash_size);
+    printf("  .data:          %8u bytes\n", info.data_size);
+    printf("  .bss:           %8u bytes\n", info.bss_size);
+    for (int i = 0; i < mem_get_region_count(); i++)
+    {
+        const mem_region_t *region = mem_get_region(i);
+        printf("    %-20s %8u\n", region->name, region->size);
+    }
+
+    printf("\033[4mHeap\033[0m (%u bytes)\n", info.heap_total);
+    printf("  Used:           %8u bytes\n", info.heap_used);
+    printf("  Free:           %8u bytes\n", info.heap_free);
+    printf("  Peak:           %8u bytes\n", info.heap_peak);
+    printf("  Largest block:  %8u bytes\n", info.heap_largest);
+
+    printf("\033[4mScratch\033[0m (%u bytes)\n", SCRATCH_SIZE);
+    scratch_lease_t lease;
+    for (int i = 0; scratch_get_lease(i, &lease); i++)
+    {
+        printf("    %-20s %8lu\n", lease.owner, lease.size);
+    }
+    printf("  Largest free:   %8lu bytes\n", scratch_get_largest_free());
+
+    printf("\033[4mStack\033[0m (peak/size)\n");
+    printf("  Core 0:         %5u/%u bytes\n", info.stack0_peak, info.stack0_size);
+    printf("  Core 1:         %5u/%u bytes\n", info.stack1_peak, info.stack1_size);
+}
+
 void reset()
 {
     printf("Resetting the device in one second...\n");
@@ -628,6 +800,7 @@ void sd_status()
     printf("  Capacity: %s\n", buffer);
     bool is_sdhc = sd_is_sdhc();
     printf("  Type: %s\n", is_sdhc ? "SDHC" : "SDSC");
+    printf("  File system: %s\n", fat32_is_exfat() ? "exFAT" : "FAT32");
     get_str_size(buffer, sizeof(buffer), fat32_get_cluster_size());
     printf("  Cluster size: %s\n", buffer);
 }
@@ -1020,6 +1193,271 @@ void sd_mv_filename(const char *oldname, const char *newname)
     printf("'%s' moved to '%s'.\n", oldname, newname);
 }
 
+//
+// Defragmenter
+//
+
+#define DEFRAG_BUFFER_SIZE (64 * 1024) // bytes moved per multi-block read
+#define DEFRAG_MAX_DEPTH (16)          // directories below the starting one
+
+// The walk is iterative, with one open directory per level, so deep trees do not use
+// the stack; all of it lives in the scratch memory with the copy buffer
+typedef struct
+{
+    char path[FAT32_MAX_PATH_LEN + 1];
+    uint16_t path_length[DEFRAG_MAX_DEPTH + 1];
+    fat32_file_t dirs[DEFRAG_MAX_DEPTH + 1];
+    fat32_entry_t entry;
+    uint32_t files;
+    uint32_t fragmented[2];    // fragmented files before and after
+    uint32_t clusters;         // clusters after the first of every file
+    uint32_t breaks[2];        // fragments after the first of every file, before and after
+    uint8_t buffer[DEFRAG_BUFFER_SIZE] __attribute__((aligned(4)));
+} defrag_t;
+
+// Percentage of a file's (or every file's) clusters that start a new fragment: 0% is in one
+// piece, 100% is no two clusters next to each other
+static uint32_t defrag_score(uint32_t breaks, uint32_t clusters)
+{
+    return clusters ? (uint32_t)(((uint64_t)breaks * 100 + clusters / 2) / clusters) : 0;
+}
+
+// Move one file into a single fragment if it is in more than one
+static void defrag_file(defrag_t *d)
+{
+    fat32_file_t file;
+    uint32_t clusters = 0;
+    uint32_t fragments = 0;
+    fat32_error_t result = fat32_open(&file, d->path);
+    if (result == FAT32_OK)
+    {
+        result = fat32_get_fragments(&file, &clusters, &fragments);
+    }
+    if (result != FAT32_OK)
+    {
+        printf("%s: %s\n", d->path, fat32_error_string(result));
+        fat32_close(&file);
+        return;
+    }
+
+    d->files++;
+    if (clusters < 2)
+    {
+        fat32_close(&file);
+        return;
+    }
+    d->clusters += clusters - 1;
+    d->breaks[0] += fragments - 1;
+    d->fragmented[0] += fragments > 1;
+
+    if (fragments > 1)
+    {
+        printf("%s: %lu pieces, %lu%%", d->path, fragments, defrag_score(fragments - 1, clusters - 1));
+        result = fat32_defrag(&file, d->buffer, DEFRAG_BUFFER_SIZE);
+        if (result == FAT32_OK)
+        {
+            result = fat32_get_fragments(&file, &clusters, &fragments);
+        }
+        if (result == FAT32_OK)
+        {
+            printf(" -> %lu\n", fragments);
+        }
+        else
+        {
+            printf("\n  %s\n", fat32_error_string(result));
+        }
+    }
+    d->breaks[1] += fragments - 1;
+    d->fragmented[1] += fragments > 1;
+    fat32_close(&file);
+}
+
+// Defragment a file, or every file in a directory and the directories in it
+static void defrag_walk(defrag_t *d)
+{
+    fat32_error_t result = fat32_open(&d->dirs[0], d->path);
+    if (result != FAT32_OK)
+    {
+        printf("Error: %s\n", fat32_error_string(result));
+        return;
+    }
+    if (!(d->dirs[0].attributes & FAT32_ATTR_DIRECTORY))
+    {
+        fat32_close(&d->dirs[0]);
+        defrag_file(d);
+        return;
+    }
+
+    int depth = 0;
+    d->path_length[0] = strlen(d->path);
+    while (depth >= 0)
+    {
+        result = fat32_dir_read(&d->dirs[depth], &d->entry);
+        if (result != FAT32_OK || !d->entry.filename[0])
+        {
+            // This directory is done, carry on with its parent
+            if (result != FAT32_OK)
+            {
+                printf("%s: %s\n", d->path, fat32_error_string(result));
+            }
+            fat32_close(&d->dirs[depth]);
+            if (--depth >= 0)
+            {
+                d->path[d->path_length[depth]] = '\0';
+            }
+            continue;
+        }
+
+        if ((d->entry.attr & FAT32_ATTR_VOLUME_ID) ||
+            strcmp(d->entry.filename, ".") == 0 || strcmp(d->entry.filename, "..") == 0)
+        {
+            continue;
+        }
+
+        uint16_t length = d->path_length[depth];
+        const char *separator = (length > 0 && d->path[length - 1] != '/') ? "/" : "";
+        if (length + strlen(separator) + strlen(d->entry.filename) > FAT32_MAX_PATH_LEN)
+        {
+            printf("%s/%s: Path too long\n", d->path, d->entry.filename);
+            continue;
+        }
+        snprintf(d->path + length, sizeof(d->path) - length, "%s%s", separator, d->entry.filename);
+
+        if (!(d->entry.attr & FAT32_ATTR_DIRECTORY))
+        {
+            defrag_file(d);
+        }
+        else if (depth == DEFRAG_MAX_DEPTH)
+        {
+            printf("%s: Skipped, too deep\n", d->path);
+        }
+        else if ((result = fat32_open(&d->dirs[depth + 1], d->path)) != FAT32_OK)
+        {
+            printf("%s: %s\n", d->path, fat32_error_string(result));
+        }
+        else
+        {
+            depth++;
+            d->path_length[depth] = strlen(d->path);
+            continue;
+        }
+        d->path[length] = '\0';
+    }
+}
+
+void sd_defrag(void)
+{
+    sd_defrag_path("/");
+}
+
+void sd_defrag_path(const char *path)
+{
+    if (strlen(path) > FAT32_MAX_PATH_LEN)
+    {
+        printf("Error: %s\n", fat32_error_string(FAT32_ERROR_INVALID_PATH));
+        return;
+    }
+
+    defrag_t *d = scratch_lease_any(sizeof(defrag_t), "defrag");
+    if (d == NULL)
+    {
+        printf("Error: Insufficient memory.\n");
+        return;
+    }
+    memset(d, 0, offsetof(defrag_t, buffer));
+    strcpy(d->path, path);
+
+    absolute_time_t start_time = get_absolute_time();
+    defrag_walk(d);
+    int64_t elapsed_us = absolute_time_diff_us(start_time, get_absolute_time());
+
+    printf("Before: %lu of %lu files in pieces, %lu%%\n", d->fragmented[0], d->files, defrag_score(d->breaks[0], d->clusters));
+    printf("After:  %lu of %lu files in pieces, %lu%%\n", d->fragmented[1], d->files, defrag_score(d->breaks[1], d->clusters));
+    printf("Took %.1fs\n", elapsed_us / 1000000.0f);
+    scratch_release(d);
+}
+
+//
+// File System Check
+//
+
+static void fsck_run(bool repair)
+{
+    // The more memory, the more clusters each pass covers: 200KB is enough for a 32GB card
+    // with 32KB clusters in one pass
+    uint32_t size = scratch_get_largest_free();
+    void *buffer = size ? scratch_lease_any(size, "fsck") : NULL;
+    if (buffer == NULL)
+    {
+        printf("Error: Insufficient memory.\n");
+        return;
+    }
+
+    printf("%s the SD card...\n", repair ? "Checking and repairing" : "Checking");
+    fat32_check_t report;
+    absolute_time_t start_time = get_absolute_time();
+    fat32_error_t result = fat32_check(&report, repair, buffer, size);
+    int64_t elapsed_us = absolute_time_diff_us(start_time, get_absolute_time());
+    scratch_release(buffer);
+
+    if (result != FAT32_OK)
+    {
+        printf("Error: %s\n", fat32_error_string(result));
+        return;
+    }
+
+    bool fsinfo_known = report.fsinfo_free != 0xFFFFFFFF;
+    bool problems = report.lost_clusters || report.cross_links || report.bad_chains || report.size_mismatches ||
+                    (fsinfo_known && report.fsinfo_free != report.free_clusters);
+
+    printf("%lu files in %lu directories\n", report.files, report.directories);
+    printf("Lost clusters:   %lu in %lu chains\n", report.lost_clusters, report.lost_chains);
+    printf("Cross-links:     %lu\n", report.cross_links);
+    printf("Bad chains:      %lu\n", report.bad_chains);
+    printf("Size mismatches: %lu\n", report.size_mismatches);
+    if (fsinfo_known)
+    {
+        printf("Free clusters:   %lu (FSInfo %lu)\n", report.free_clusters, report.fsinfo_free);
+    }
+    else
+    {
+        printf("Free clusters:   %lu (FSInfo unknown)\n", report.free_clusters);
+    }
+    if (report.skipped)
+    {
+        printf("Skipped %lu directories too deep to check, lost clusters are kept\n", report.skipped);
+    }
+
+    if (!problems)
+    {
+        printf("No problems found\n");
+    }
+    else if (report.repaired)
+    {
+        printf("Repaired\n");
+    }
+    else
+    {
+        printf("Run 'fsck repair' to fix them\n");
+    }
+    printf("Took %.1fs in %lu %s\n", elapsed_us / 1000000.0f, report.passes, report.passes == 1 ? "pass" : "passes");
+}
+
+void sd_fsck(void)
+{
+    fsck_run(false);
+}
+
+void sd_fsck_option(const char *option)
+{
+    if (strcmp(option, "repair") != 0)
+    {
+        printf("Usage: fsck [repair]\n");
+        return;
+    }
+    fsck_run(true);
+}
+
 //
 // RTC DS3231 Commands
 //
@@ -1135,6 +1573,45 @@ void rtc_time_set(const char *date, const char *time)
            dt.hours, dt.minutes, dt.seconds);
 }
 
+// Show the time on one row in idle and partial mode until a key is pressed
+void standby(void)
+{
+    ds3231_datetime_t dt;
+    uint8_t row = ROWS / 2;
+    uint8_t column = (columns - 8) / 2;
+
+    printf("\033[?25l\033[2J"); // Hide cursor, clear the screen
+    dpm_set_always_on_rows(row * GLYPH_HEIGHT, (row + 1) * GLYPH_HEIGHT - 1);
+    dpm_set_state(DPM_IDLE);
+
+    while (!keyboard_key_available() && !user_interrupt)
+    {
+        if (ds3231_read_time(&dt))
+        {
+            printf("\033[%d;%dH%02d:%02d:%02d", row + 1, column + 1, dt.hours, dt.minutes, dt.seconds);
+        }
+        else
+        {
+            printf("\033[%d;%dH--:--:--", row + 1, column + 1);
+        }
+
+        // Sleep until the next second or a key press
+        absolute_time_t next_second = make_timeout_time_ms(1000);
+        while (!keyboard_key_available() && !user_interrupt && !time_reached(next_second))
+        {
+            idle_wait();
+        }
+    }
+
+    if (keyboard_key_available())
+    {
+        keyboard_get_key(); // discard the key that ended standby
+    }
+    dpm_clear_always_on();
+    dpm_input_resume();
+    printf("\033[2J\033[H\033[?25h"); // Clear the screen, show cursor
+}
+
 //
 // File Viewer Commands
 //
@@ -1265,109 +1742,149 @@ void sprite_frame(int16_t *sx, int16_t *velocity) {
     // No need to call present - Core 1 renders continuously at 60 FPS
 }
 
+// State of the sprite test between game loop updates
+static const uint16_t *const sprite_palettes[] = {sprite1_palette_green, sprite1_palette_flash, sprite1_palette_red};
+static struct
+{
+    int16_t sx, sy;
+    gfx_sprite_t s2;
+    int palette;
+    float angle;
+} sprite_test;
+
+// One step of the sprite test: the arrow keys move the hero, ESC leaves
+static bool sprite_update(void)
+{
+    // Manually poll keyboard to ensure it's being read
+    keyboard_poll();
+
+    bool moved = false;
+    while (keyboard_key_available())
+    {
+        int key = keyboard_get_key();
+        if (key == KEY_ESC)
+        {
+            return false;
+        }
+        else if (key == ' ') // recolour the second hero
+        {
+            sprite_test.palette = (sprite_test.palette + 1) % (sizeof(sprite_palettes) / sizeof(sprite_palettes[0]));
+            gfx_core_gfx_set_sprite_palette(sprite_test.s2, sprite_palettes[sprite_test.palette]);
+        }
+        else if (key == 'r' || key == 'R') // turn the second hero by 15 degrees
+        {
+            sprite_test.angle = fmodf(sprite_test.angle + 0.2618f, 6.2832f);
+            gfx_core_gfx_set_sprite_transform(sprite_test.s2, sprite_test.angle, 1.0f);
+        }
+        else if (key == KEY_UP)
+        {
+            sprite_test.sy = sprite_test.sy - STEP_Y < 0 ? 0 : sprite_test.sy - STEP_Y;
+            moved = true;
+        }
+        else if (key == KEY_DOWN)
+        {
+            sprite_test.sy = sprite_test.sy + STEP_Y > HEIGHT - 16 ? HEIGHT - 16 : sprite_test.sy + STEP_Y;
+            moved = true;
+        }
+        else if (key == KEY_RIGHT)
+        {
+            sprite_test.sx = sprite_test.sx + STEP_X > WIDTH - 16 ? WIDTH - 16 : sprite_test.sx + STEP_X;
+            moved = true;
+        }
+        else if (key == KEY_LEFT)
+        {
+            sprite_test.sx = sprite_test.sx - STEP_X < 0 ? 0 : sprite_test.sx - STEP_X;
+            moved = true;
+        }
+    }
+
+    // Sent to core 1 with the rest of this frame's changes
+    if (moved)
+    {
+        gfx_core_gfx_move_sprite(s, sprite_test.sx, sprite_test.sy);
+    }
+    return true;
+}
+
 void show_sprite(void)
 {
-    // Local variables for sprite position
-    int16_t sx = 40;
-    int16_t sy = 40;
+    sprite_test.sx = 40;
+    sprite_test.sy = 40;
+    sprite_test.palette = 0;
+    sprite_test.angle = 0.0f;
 
     // Hide cursor and clear LCD hardware completely
     lcd_enable_cursor(false);
     lcd_clear_screen();  // Force LCD hardware to blank state
 
-    /* initialize gfx with tilesheet from tiles.h */
-    gfx_core_gfx_init(my_tilesheet, my_tilesheet_count);
+    /* initialize gfx with the deduplicated tilesheet from tiles.h; the scene below
+       uses the original tile numbers, translated through my_tile_remap */
+    gfx_set_tile_flags(my_tile_flags);
+    if (!gfx_core_gfx_init(my_tilesheet, my_tilesheet_count)) {
+        lcd_enable_cursor(true);
+        printf("Error: Framebuffer is in use.\n");
+        return;
+    }
 
     /* prepare map: create a complete scene */
-    gfx_core_gfx_clear_backmap(34);  // sky as background
+    gfx_core_gfx_clear_backmap(my_tile_remap[34]);  // sky as background
 
     // Create floor at bottom (rows 18-19, screen 320x320 = 20x20 tiles)
     for (uint16_t x = 0; x < 20; x++) {
-        gfx_core_gfx_set_tile(x, 18, 0);  // grass
-        gfx_core_gfx_set_tile(x, 19, 0);  // dirt below grass
+        gfx_core_gfx_set_tile(x, 18, my_tile_remap[0]);  // grass
+        gfx_core_gfx_set_tile(x, 19, my_tile_remap[0]);  // dirt below grass
     }
 
     // Create central platform with brick wall
     for (uint16_t x = 5; x <= 10; x++) {
-        gfx_core_gfx_set_tile(x, 14, 90);  // red bricks
-        gfx_core_gfx_set_tile(x, 15, 90);  // red bricks
+        gfx_core_gfx_set_tile(x, 14, my_tile_remap[90]);  // red bricks
+        gfx_core_gfx_set_tile(x, 15, my_tile_remap[90]);  // red bricks
     }
 
     // Gray floor on platform
     for (uint16_t x = 5; x <= 10; x++) {
-        gfx_core_gfx_set_tile(x, 13, 48);  // gray floor
+        gfx_core_gfx_set_tile(x, 13, my_tile_remap[48]);  // gray floor
     }
 
     // Water on right
     for (uint16_t y = 16; y <= 19; y++) {
         for (uint16_t x = 15; x <= 19; x++) {
-            gfx_core_gfx_set_tile(x, y, 6);  // water
+            gfx_core_gfx_set_tile(x, y, my_tile_remap[6]);  // water
         }
     }
 
     // Sand near water
     for (uint16_t y = 16; y <= 19; y++) {
-        gfx_core_gfx_set_tile(14, y, 122);  // sand
+        gfx_core_gfx_set_tile(14, y, my_tile_remap[122]);  // sand
     }
 
     // Stone wall on left
     for (uint16_t y = 15; y <= 19; y++) {
-        gfx_core_gfx_set_tile(0, y, 30);  // stone wall
-        gfx_core_gfx_set_tile(1, y, 30);  // stone wall
+        gfx_core_gfx_set_tile(0, y, my_tile_remap[30]);  // stone wall
+        gfx_core_gfx_set_tile(1, y, my_tile_remap[30]);  // stone wall
     }
 
     /* create sprite (w=16,h=16) */
-    s = gfx_core_gfx_create_sprite(sprite1_pixels, 16, 16, sx, sy, 0);
+    s = gfx_core_gfx_create_sprite(sprite1_pixels, 16, 16, sprite_test.sx, sprite_test.sy, 0);
+
+    /* a second hero on the platform, drawn from 4-bpp data; SPACE changes its palette, R turns it */
+    sprite_test.s2 = gfx_core_gfx_create_sprite_4bpp(sprite1_4bpp, sprite_palettes[0], 16, 16, 7 * 16, 12 * 16, 0);
 
     // Start continuous rendering now that the scene is ready
     gfx_core_start_rendering();
 
-    // Continuous loop until user presses ESC
-    while (true) {
-        // Manually poll keyboard to ensure it's being read
-        keyboard_poll();
-
-        // Check if a key is pressed from physical keyboard (non-blocking)
-        if (keyboard_key_available()){
-            int key = keyboard_get_key();
-            if (key != -1) {
-                // Handle key press
-                if (key == KEY_ESC) {  // ESC key
-                    break;
-                }
-                // Arrow keys
-                else if (key == KEY_UP) {  // UP arrow
-                    sy -= STEP_Y;
-                    if (sy < 0) sy = 0;
-                }
-                else if (key == KEY_DOWN) {  // DOWN arrow
-                    sy += STEP_Y;
-                    if (sy > HEIGHT - 16) sy = HEIGHT - 16;
-                }
-                else if (key == KEY_RIGHT) {  // RIGHT arrow
-                    sx += STEP_X;
-                    if (sx > WIDTH - 16) sx = WIDTH - 16;
-                }
-                else if (key == KEY_LEFT) {  // LEFT arrow
-                    sx -= STEP_X;
-                    if (sx < 0) sx = 0;
-                }
-
-                // Update sprite position
-                gfx_core_gfx_move_sprite(s, sx, sy);
-                // Core 1 renders continuously - no need to call present
-            }
-        }
-
-        // Small sleep to avoid hogging CPU
-        sleep_ms(10);
-    }
+    // Update in step with the frames until the user presses ESC
+    gfx_game_run(sprite_update, 60);
 
     // Stop continuous rendering FIRST (blocks until Core 1 stops)
     gfx_core_stop_rendering();
 
     // Now safe to destroy sprite and restore text screen
     gfx_core_gfx_destroy_sprite(s);
+    gfx_core_gfx_destroy_sprite(sprite_test.s2);
+
+    // Return the framebuffer to the scratch memory for text-mode apps
+    gfx_core_gfx_release();
 
     // Flush any remaining keyboard input before returning to REPL
     while (keyboard_key_available()) {
@@ -1378,7 +1895,16 @@ void show_sprite(void)
     lcd_clear_screen();
     lcd_enable_cursor(true);
 
-}
+    // How well core 0 kept up with the frames
+    gfx_game_stats_t stats;
+    gfx_game_get_stats(&stats);
+    if (stats.frames > 0)
+    {
+        printf("%lu frames, %lu late, %lu skipped\n", stats.frames, stats.late_frames, stats.skipped_frames);
+        printf("Updates: %lu us max, %lu us mean\n", stats.update_us_max, (uint32_t)(stats.update_us_total / stats.frames));
+        printf("Slack:   %ld us min, %ld us mean\n", stats.slack_us_min, (int32_t)(stats.slack_us_total / stats.frames));
+    }
+}
 
 
 //
@@ -1437,14 +1963,23 @@ void showimg_filename(const char *filename)
         return;
     }
 
-    // Allocate buffer for one line at a time (to save memory)
-    uint16_t *line_buffer = (uint16_t *)malloc(img_width * sizeof(uint16_t));
-    if (line_buffer == NULL)
+    // Lease a read-ahead buffer from the scratch memory, as many rows as fit
+    // (the whole image when the scratch memory is free)
+    scratch_arena_t arena;
+    uint32_t row_bytes = img_width * sizeof(uint16_t);
+    if (!scratch_arena_open(&arena, 0, "showimg") || arena.size < row_bytes)
     {
         printf("Error: Insufficient memory.\n");
+        scratch_arena_close(&arena);
         fclose(fp);
         return;
     }
+    uint16_t chunk_rows = arena.size / row_bytes;
+    if (chunk_rows > img_height)
+    {
+        chunk_rows = img_height;
+    }
+    uint16_t *pixels = (uint16_t *)scratch_arena_alloc(&arena, chunk_rows * row_bytes);
 
     // Center image on screen
     uint16_t x_offset = (WIDTH - img_width) / 2;
@@ -1456,20 +1991,25 @@ void showimg_filename(const char *filename)
     // Clear screen (black)
     lcd_solid_rectangle(0x0000, 0, 0, WIDTH, HEIGHT);
 
-    // Read and draw line by line
-    for (uint16_t y = 0; y < img_height; y++)
+    // Read and draw a chunk of rows at a time
+    for (uint16_t y = 0; y < img_height; y += chunk_rows)
     {
-        size_t pixels_read = fread(line_buffer, sizeof(uint16_t), img_width, fp);
-        if (pixels_read != img_width)
+        uint16_t rows = img_height - y < chunk_rows ? img_height - y : chunk_rows;
+        size_t rows_read = fread(pixels, row_bytes, rows, fp);
+        if (rows_read == 0)
         {
             break;
         }
 
-        // Draw line on screen
-        lcd_blit(line_buffer, x_offset, y_offset + y, img_width, 1);
+        // Draw the rows on screen
+        lcd_blit(pixels, x_offset, y_offset + y, img_width, rows_read);
+        if (rows_read != rows)
+        {
+            break;
+        }
     }
 
-    free(line_buffer);
+    scratch_arena_close(&arena);
     fclose(fp);
 
     // Wait for user input
@@ -1485,6 +2025,494 @@ void showimg_filename(const char *filename)
     lcd_enable_cursor(true);
 }
 
+//
+// Calculator Command
+//
+
+#define CALC_LINE_SIZE (128)
+#define CALC_PROMPT "calc> "
+
+// Work out one expression and print the result, or where and why it failed
+static void calc_show(const char *text, bool echo)
+{
+    calc_result_t result;
+    absolute_time_t start_time = get_absolute_time();
+    bool ok = calc_evaluate(text, &result);
+    int64_t elapsed_us = absolute_time_diff_us(start_time, get_absolute_time());
+
+    if (!ok)
+    {
+        // Point at the problem under the expression, or under the prompt line it was typed on
+        if (echo)
+        {
+            printf("%s\n", text);
+        }
+        int indent = result.error_pos + (echo ? 0 : (int)strlen(CALC_PROMPT));
+        printf("%*s^\n%s\n", indent, "", result.error);
+        return;
+    }
+
+    printf("= %s\n", result.text);
+    if (result.length > columns || elapsed_us >= 100000)
+    {
+        printf("(%lu characters in %.2fs)\n", result.length, elapsed_us / 1000000.0f);
+    }
+}
+
+static bool calc_open(scratch_arena_t *arena)
+{
+    // Every number and temporary comes from the scratch memory
+    if (!scratch_arena_open(arena, 0, "calc"))
+    {
+        printf("Error: Insufficient memory.\n");
+        return false;
+    }
+    calc_init(arena);
+    return true;
+}
+
+static void calc_digits(const char *args)
+{
+    while (*args == ' ')
+    {
+        args++;
+    }
+    if (*args != '\0')
+    {
+        char *end;
+        unsigned long digits = strtoul(args, &end, 10);
+        if (*end != '\0' || digits > CALC_MAX_PRECISION)
+        {
+            printf("Error: digits takes 0 to %d.\n", CALC_MAX_PRECISION);
+            return;
+        }
+        calc_set_precision(digits);
+    }
+    printf("Decimals to %lu digits after the point.\n", calc_get_precision());
+}
+
+void calc(void)
+{
+    scratch_arena_t arena;
+    if (!calc_open(&arena))
+    {
+        return;
+    }
+
+    printf("Whole numbers of any size and decimals\n");
+    printf("to %lu places (digits N changes that).\n", calc_get_precision());
+    printf("+ - * / %% ^ ! ( ) sqrt() pi e ans\n");
+    printf("A blank line leaves.\n");
+
+    char line[CALC_LINE_SIZE];
+    while (true)
+    {
+        printf(CALC_PROMPT);
+        readline(line, sizeof(line));
+        str_to_lower(line);
+        if (line[0] == '\0' || strcmp(line, "quit") == 0 || strcmp(line, "exit") == 0)
+        {
+            break;
+        }
+        if (strncmp(line, "digits", 6) == 0)
+        {
+            calc_digits(line + 6);
+            continue;
+        }
+        calc_show(line, false);
+    }
+
+    scratch_arena_close(&arena);
+}
+
+void calc_expression(const char *args)
+{
+    if (strncmp(args, "digits", 6) == 0)
+    {
+        calc_digits(args + 6);
+        return;
+    }
+
+    scratch_arena_t arena;
+    if (!calc_open(&arena))
+    {
+        return;
+    }
+    calc_show(args, true);
+    scratch_arena_close(&arena);
+}
+
+//
+// Function Plotter Command
+//
+
+#define PLOT_ROWS (HEIGHT - GLYPH_HEIGHT) // plot area, above the status line
+#define PLOT_PAN_COLUMNS (WIDTH / 8)      // columns moved by one press of left or right
+#define PLOT_MAX_ZOOM (16)                // halvings or doublings of the x range
+#define PLOT_AXES_COLOUR RGB(96, 96, 96)
+#define PLOT_CURVE_COLOUR RGB(255, 255, 0)
+
+// The x of every column is x0 + sample * dx, where sample counts from the first column.
+// Panning moves first by whole columns and zooming doubles or halves dx, so columns that
+// stay on screen keep the same x and their y values are not worked out again.
+typedef struct
+{
+    double x0;
+    double dx;
+    int32_t first; // sample of the leftmost column
+    int zoom;      // doublings of dx since the start (negative when zoomed in)
+    float ymin, ymax;
+} plot_view_t;
+
+typedef struct
+{
+    expr_program_t program;
+    plot_view_t view;
+    gfx_canvas_t canvas;
+    float *y;      // y for each column
+    bool *known;   // y has been worked out for the column
+    float *x_new;  // x of the columns to work out, packed together
+    float *y_new;
+} plot_t;
+
+static double plot_column_x(const plot_view_t *view, int column)
+{
+    return view->x0 + (double)(view->first + column) * view->dx;
+}
+
+// Work out y for the columns that do not have it, all in one batch
+static void plot_evaluate(plot_t *plot)
+{
+    int count = 0;
+    for (int column = 0; column < WIDTH; column++)
+    {
+        if (!plot->known[column])
+        {
+            plot->x_new[count++] = (float)plot_column_x(&plot->view, column);
+        }
+    }
+
+    expr_eval(&plot->program, plot->x_new, plot->y_new, count);
+
+    count = 0;
+    for (int column = 0; column < WIDTH; column++)
+    {
+        if (!plot->known[column])
+        {
+            plot->y[column] = plot->y_new[count++];
+            plot->known[column] = true;
+        }
+    }
+}
+
+// Move the view by whole columns, keeping the y values that stay on screen
+static void plot_pan(plot_t *plot, int columns)
+{
+    int keep = WIDTH - abs(columns);
+    if (columns > 0)
+    {
+        memmove(plot->y, plot->y + columns, keep * sizeof(float));
+        memmove(plot->known, plot->known + columns, keep * sizeof(bool));
+        memset(plot->known + keep, 0, columns * sizeof(bool));
+    }
+    else
+    {
+        memmove(plot->y - columns, plot->y, keep * sizeof(float));
+        memmove(plot->known - columns, plot->known, keep * sizeof(bool));
+        memset(plot->known, 0, -columns * sizeof(bool));
+    }
+    plot->view.first += columns;
+}
+
+// Halve (zoom in) or double the x and y ranges about the centre of the screen. Every other
+// sample of the finer grid is a sample of the coarser one, so about half of the columns
+// keep their y values either way.
+static void plot_zoom(plot_t *plot, bool in)
+{
+    plot_view_t *view = &plot->view;
+    int32_t centre = view->first + WIDTH / 2;
+    int32_t old_first = view->first;
+
+    if (in)
+    {
+        view->dx /= 2;
+        view->first = 2 * centre - WIDTH / 2;
+        view->zoom--;
+    }
+    else
+    {
+        view->dx *= 2;
+        view->first = (centre >> 1) - WIDTH / 2;
+        view->zoom++;
+    }
+
+    float y_centre = (view->ymin + view->ymax) / 2;
+    float y_half = (view->ymax - view->ymin) / 2 * (in ? 0.5f : 2.0f);
+    view->ymin = y_centre - y_half;
+    view->ymax = y_centre + y_half;
+
+    // Reuse the old y for columns that land on an old sample: with old samples s, the new
+    // sample is 2s after zooming in, and s/2 (when s is even) after zooming out. The batch
+    // buffers are free between evaluations and hold the old values meanwhile.
+    float *old_y = plot->y_new;
+    bool *old_known = (bool *)plot->x_new;
+    memcpy(old_y, plot->y, WIDTH * sizeof(float));
+    memcpy(old_known, plot->known, WIDTH * sizeof(bool));
+    for (int column = 0; column < WIDTH; column++)
+    {
+        int32_t sample = view->first + column;
+        bool on_old_grid = !in || (sample & 1) == 0;
+        int32_t old_column = (in ? sample / 2 : 2 * sample) - old_first;
+        plot->known[column] = on_old_grid && old_column >= 0 && old_column < WIDTH && old_known[old_column];
+        if (plot->known[column])
+        {
+            plot->y[column] = old_y[old_column];
+        }
+    }
+}
+
+// Row of a y value, kept within what the line clipping can take
+static int16_t plot_row(const plot_view_t *view, float y)
+{
+    float row = (view->ymax - y) * (PLOT_ROWS - 1) / (view->ymax - view->ymin);
+    if (row < -10000.0f)
+    {
+        return -10000;
+    }
+    if (row > 10000.0f)
+    {
+        return 10000;
+    }
+    return (int16_t)lroundf(row);
+}
+
+static void plot_draw(plot_t *plot)
+{
+    const plot_view_t *view = &plot->view;
+    gfx_canvas_t *canvas = &plot->canvas;
+
+    gfx_canvas_clear(canvas, RGB(0, 0, 0));
+
+    // Axes, where they are on screen
+    double axis_column = -view->x0 / view->dx - view->first;
+    if (axis_column > -1 && axis_column < WIDTH)
+    {
+        gfx_draw_vline(canvas, (int16_t)lround(axis_column), 0, PLOT_ROWS, PLOT_AXES_COLOUR);
+    }
+    if (view->ymin <= 0 && view->ymax >= 0)
+    {
+        gfx_draw_hline(canvas, 0, plot_row(view, 0), WIDTH, PLOT_AXES_COLOUR);
+    }
+
+    // The curve, joining each column to the one before. Values that are not numbers leave
+    // a gap, and so does a jump from above the screen to below it (as tan(x) does).
+    int16_t last_row = 0;
+    bool last_valid = false;
+    for (int column = 0; column < WIDTH; column++)
+    {
+        float y = plot->y[column];
+        bool valid = isfinite(y);
+        int16_t row = valid ? plot_row(view, y) : 0;
+        if (valid && last_valid && !((last_row < 0 && row >= PLOT_ROWS) || (row < 0 && last_row >= PLOT_ROWS)))
+        {
+            gfx_draw_line(canvas, column - 1, last_row, column, row, PLOT_CURVE_COLOUR);
+        }
+        else if (valid)
+        {
+            gfx_draw_pixel(canvas, column, row, PLOT_CURVE_COLOUR);
+        }
+        last_row = row;
+        last_valid = valid;
+    }
+
+    // The clear marked the whole canvas, so this is one transfer of the plot area
+    gfx_canvas_flush(canvas, 0, 0);
+}
+
+static void plot_status(const plot_t *plot, int64_t us)
+{
+    const plot_view_t *view = &plot->view;
+    char status[80];
+    int length = snprintf(status, sizeof(status), "x %.4g:%.4g y %.4g:%.4g %lldms",
+                          plot_column_x(view, 0), plot_column_x(view, WIDTH - 1),
+                          view->ymin, view->ymax, (long long)((us + 500) / 1000));
+
+    // Pad to the width of the screen to cover the last status
+    int columns = lcd_get_columns();
+    if (columns > (int)sizeof(status) - 1)
+    {
+        columns = sizeof(status) - 1;
+    }
+    while (length < columns)
+    {
+        status[length++] = ' ';
+    }
+    status[columns] = '\0';
+    lcd_putstr(0, MAX_ROW, status);
+}
+
+void plot(void)
+{
+    printf("Usage: plot <expr> [xmin xmax ymin ymax]\n");
+    printf("Example: plot sin(x)*x -10 10 -8 8\n");
+    printf("\nx, numbers, pi, e, + - * / ^ ( ) and\n");
+    printf("sin cos tan asin acos atan sinh cosh\n");
+    printf("tanh sqrt exp ln log abs floor ceil\n");
+    printf("\nArrows pan, +/- zoom, R resets the\n");
+    printf("view, Esc or Q quits.\n");
+}
+
+void plot_expression(const char *args)
+{
+    // The range is the last four words, if they are all numbers
+    char text[256];
+    strncpy(text, args, sizeof(text) - 1);
+    text[sizeof(text) - 1] = '\0';
+
+    float range[4] = {-10.0f, 10.0f, -10.0f, 10.0f};
+    char *end = text + strlen(text);
+    char *words[4];
+    int found = 0;
+    while (found < 4)
+    {
+        while (end > text && end[-1] == ' ')
+        {
+            end--;
+        }
+        char *start = end;
+        while (start > text && start[-1] != ' ')
+        {
+            start--;
+        }
+        if (start == end)
+        {
+            break;
+        }
+        char *number_end;
+        strtof(start, &number_end);
+        if (number_end != end)
+        {
+            break;
+        }
+        words[3 - found++] = start;
+        end = start;
+    }
+    if (found == 4)
+    {
+        for (int i = 0; i < 4; i++)
+        {
+            range[i] = strtof(words[i], NULL);
+        }
+        *end = '\0';
+    }
+    if (!(range[0] < range[1] && range[2] < range[3]))
+    {
+        printf("Error: The range needs xmin < xmax and\nymin < ymax.\n");
+        return;
+    }
+
+    plot_t plot;
+    if (!expr_compile(&plot.program, text))
+    {
+        printf("%s\n%*s^\n%s\n", text, plot.program.error_pos, "", plot.program.error);
+        return;
+    }
+
+    // The plot area and the columns' values, all from the scratch memory
+    scratch_arena_t arena;
+    uint16_t *frame = NULL;
+    if (scratch_arena_open(&arena, 0, "plot"))
+    {
+        frame = (uint16_t *)scratch_arena_alloc(&arena, WIDTH * PLOT_ROWS * sizeof(uint16_t));
+        plot.y = (float *)scratch_arena_alloc(&arena, WIDTH * sizeof(float));
+        plot.x_new = (float *)scratch_arena_alloc(&arena, WIDTH * sizeof(float));
+        plot.y_new = (float *)scratch_arena_alloc(&arena, WIDTH * sizeof(float));
+        plot.known = (bool *)scratch_arena_alloc(&arena, WIDTH * sizeof(bool));
+    }
+    if (frame == NULL || plot.known == NULL)
+    {
+        printf("Error: Insufficient memory.\n");
+        scratch_arena_close(&arena);
+        return;
+    }
+
+    const plot_view_t start_view = {
+        .x0 = range[0],
+        .dx = (range[1] - range[0]) / (double)(WIDTH - 1),
+        .ymin = range[2],
+        .ymax = range[3],
+    };
+    plot.view = start_view;
+    memset(plot.known, 0, WIDTH * sizeof(bool));
+    gfx_canvas_init(&plot.canvas, frame, WIDTH, PLOT_ROWS);
+
+    lcd_enable_cursor(false);
+    lcd_clear_screen();
+
+    while (true)
+    {
+        absolute_time_t start_time = get_absolute_time();
+        plot_evaluate(&plot);
+        plot_draw(&plot);
+        plot_status(&plot, absolute_time_diff_us(start_time, get_absolute_time()));
+
+        int key = getchar();
+        if (key == KEY_ESC || key == 'q' || key == 'Q')
+        {
+            break;
+        }
+
+        float y_step = (plot.view.ymax - plot.view.ymin) / 8;
+        switch (key)
+        {
+        case KEY_LEFT:
+            plot_pan(&plot, -PLOT_PAN_COLUMNS);
+            break;
+        case KEY_RIGHT:
+            plot_pan(&plot, PLOT_PAN_COLUMNS);
+            break;
+        case KEY_UP:
+            plot.view.ymin += y_step;
+            plot.view.ymax += y_step;
+            break;
+        case KEY_DOWN:
+            plot.view.ymin -= y_step;
+            plot.view.ymax -= y_step;
+            break;
+        case '+':
+        case '=':
+            if (plot.view.zoom > -PLOT_MAX_ZOOM)
+            {
+                plot_zoom(&plot, true);
+            }
+            break;
+        case '-':
+            if (plot.view.zoom < PLOT_MAX_ZOOM)
+            {
+                plot_zoom(&plot, false);
+            }
+            break;
+        case 'r':
+        case 'R':
+            plot.view = start_view;
+            memset(plot.known, 0, WIDTH * sizeof(bool));
+            break;
+        }
+    }
+
+    scratch_arena_close(&arena);
+
+    // Flush any remaining keyboard input to prevent interference with next command
+    while (keyboard_key_available())
+    {
+        keyboard_get_key();
+    }
+
+    // Restore text screen and cursor
+    lcd_clear_screen();
+    lcd_enable_cursor(true);
+}
+
 //
 // Text File Viewer Command
 //
@@ -1528,56 +2556,45 @@ void viewtext_filename(const char *filename)
     // Reset to beginning
     fseek(fp, 0, SEEK_SET);
 
-    // Read all lines into memory
-    char **lines = NULL;
-    int line_capacity = 100;
-    int line_count = 0;
-
-    lines = (char **)malloc(line_capacity * sizeof(char *));
-    if (lines == NULL)
+    // Read all lines into the scratch memory (the line count is known, so
+    // the index is sized exactly and the text is bump-allocated after it)
+    scratch_arena_t arena;
+    if (!scratch_arena_open(&arena, 0, "viewtext"))
     {
         printf("Error: Insufficient memory.\n");
         fclose(fp);
         return;
     }
 
+    // Lines longer than the read buffer are split, so allow for those too
     char buffer[256];
-    while (fgets(buffer, sizeof(buffer), fp) != NULL)
+    int line_count = 0;
+    int max_lines = total_lines + total_chars / (sizeof(buffer) - 1) + 1;
+    char **lines = (char **)scratch_arena_alloc(&arena, max_lines * sizeof(char *));
+    if (lines == NULL)
     {
-        // Expand array if needed
-        if (line_count >= line_capacity)
-        {
-            line_capacity *= 2;
-            char **new_lines = (char **)realloc(lines, line_capacity * sizeof(char *));
-            if (new_lines == NULL)
-            {
-                printf("Error: Insufficient memory.\n");
-                for (int i = 0; i < line_count; i++)
-                    free(lines[i]);
-                free(lines);
-                fclose(fp);
-                return;
-            }
-            lines = new_lines;
-        }
+        printf("Error: Insufficient memory.\n");
+        scratch_arena_close(&arena);
+        fclose(fp);
+        return;
+    }
 
-        // Allocate and copy line
-        size_t len = strlen(buffer);
+    while (line_count < max_lines && fgets(buffer, sizeof(buffer), fp) != NULL)
+    {
         // Remove newline if present
+        size_t len = strlen(buffer);
         if (len > 0 && buffer[len - 1] == '\n')
-            buffer[len - 1] = '\0';
+            buffer[--len] = '\0';
 
-        lines[line_count] = (char *)malloc(strlen(buffer) + 1);
+        lines[line_count] = (char *)scratch_arena_alloc(&arena, len + 1);
         if (lines[line_count] == NULL)
         {
             printf("Error: Insufficient memory.\n");
-            for (int i = 0; i < line_count; i++)
-                free(lines[i]);
-            free(lines);
+            scratch_arena_close(&arena);
             fclose(fp);
             return;
         }
-        strcpy(lines[line_count], buffer);
+        memcpy(lines[line_count], buffer, len + 1);
         line_count++;
     }
 
@@ -1672,9 +2689,7 @@ void viewtext_filename(const char *filename)
     }
 
     // Free memory
-    for (int i = 0; i < line_count; i++)
-        free(lines[i]);
-    free(lines);
+    scratch_arena_close(&arena);
 
     // Restore screen
     lcd_clear_screen();
@@ -1691,6 +2706,8 @@ void viewtext_filename(const char *filename)
 #define TED_SCREEN_COLS 40  // 320 pixels / 8 pixels per char = 40 columns
 
 typedef struct {
+    scratch_arena_t arena;  // Scratch memory holding the line index and line pool
+    char *free_lines;       // Free list of line buffers (linked through the first word)
     char **lines;           // Array of text lines
     int num_lines;          // Number of lines in buffer
     int cursor_row;         // Current cursor row
@@ -1713,15 +2730,41 @@ static bool ted_save_as(ted_buffer_t *buf);
 static bool ted_load(ted_buffer_t *buf);
 static void ted_show_dir(void);
 static bool ted_confirm_exit(ted_buffer_t *buf);
-static void ted_init_buffer(ted_buffer_t *buf, const char *filename);
+static bool ted_init_buffer(ted_buffer_t *buf, const char *filename);
 static void ted_free_buffer(ted_buffer_t *buf);
 
+// Take a line buffer from the pool
+static char *ted_alloc_line(ted_buffer_t *buf)
+{
+    char *line = buf->free_lines;
+    buf->free_lines = *(char **)line;
+    return line;
+}
+
+// Return a line buffer to the pool
+static void ted_free_line(ted_buffer_t *buf, char *line)
+{
+    *(char **)line = buf->free_lines;
+    buf->free_lines = line;
+}
+
 // Initialize editor buffer
-static void ted_init_buffer(ted_buffer_t *buf, const char *filename)
+static bool ted_init_buffer(ted_buffer_t *buf, const char *filename)
 {
-    buf->lines = (char **)malloc(TED_MAX_LINES * sizeof(char *));
+    // The line index and a pool of TED_MAX_LINES fixed-size lines live in the
+    // scratch memory, so editing never fragments the heap
+    uint32_t size = TED_MAX_LINES * (sizeof(char *) + TED_MAX_LINE_LENGTH);
+    if (!scratch_arena_open(&buf->arena, size, "ted")) {
+        return false;
+    }
+    buf->lines = (char **)scratch_arena_alloc(&buf->arena, TED_MAX_LINES * sizeof(char *));
+    buf->free_lines = NULL;
+    for (int i = 0; i < TED_MAX_LINES; i++) {
+        ted_free_line(buf, (char *)scratch_arena_alloc(&buf->arena, TED_MAX_LINE_LENGTH));
+    }
+
     buf->num_lines = 1;
-    buf->lines[0] = (char *)malloc(TED_MAX_LINE_LENGTH);
+    buf->lines[0] = ted_alloc_line(buf);
     buf->lines[0][0] = '\0';
     buf->cursor_row = 0;
     buf->cursor_col = 0;
@@ -1734,15 +2777,15 @@ static void ted_init_buffer(ted_buffer_t *buf, const char *filename)
     } else {
         strcpy(buf->filename, "undefined.txt");
     }
+    return true;
 }
 
 // Free editor buffer
 static void ted_free_buffer(ted_buffer_t *buf)
 {
-    for (int i = 0; i < buf->num_lines; i++) {
-        free(buf->lines[i]);
-    }
-    free(buf->lines);
+    scratch_arena_close(&buf->arena);
+    buf->lines = NULL;
+    buf->free_lines = NULL;
 }
 
 // Draw the entire screen
@@ -1953,7 +2996,7 @@ static void ted_delete_char(ted_buffer_t *buf)
             strcat(prev_line, curr_line);
 
             // Remove current line
-            free(buf->lines[buf->cursor_row]);
+            ted_free_line(buf, buf->lines[buf->cursor_row]);
             for (int i = buf->cursor_row; i < buf->num_lines - 1; i++) {
                 buf->lines[i] = buf->lines[i + 1];
             }
@@ -1985,7 +3028,7 @@ static void ted_newline(ted_buffer_t *buf)
     }
 
     // Create new line with text after cursor
-    buf->lines[buf->cursor_row + 1] = (char *)malloc(TED_MAX_LINE_LENGTH);
+    buf->lines[buf->cursor_row + 1] = ted_alloc_line(buf);
     strcpy(buf->lines[buf->cursor_row + 1], &curr_line[buf->cursor_col]);
 
     // Truncate current line at cursor
@@ -2122,11 +3165,16 @@ static bool ted_load(ted_buffer_t *buf)
         return false;
     }
 
-    // Free current buffer
+    // Free current buffer and reload it (the lease is given back first, so
+    // the new one always fits)
     ted_free_buffer(buf);
-
-    // Reload buffer
-    ted_init_buffer(buf, load_filename);
+    if (!ted_init_buffer(buf, load_filename)) {
+        fclose(fp);
+        printf("\033[32;1H\033[K");
+        printf("Error: Insufficient memory to load '%s'", load_filename);
+        sleep_ms(2000);
+        return false;
+    }
 
     // Read file
     char line_buffer[TED_MAX_LINE_LENGTH];
@@ -2140,7 +3188,7 @@ static bool ted_load(ted_buffer_t *buf)
         }
 
         if (line_idx > 0) {
-            buf->lines[line_idx] = (char *)malloc(TED_MAX_LINE_LENGTH);
+            buf->lines[line_idx] = ted_alloc_line(buf);
         }
 
         strncpy(buf->lines[line_idx], line_buffer, TED_MAX_LINE_LENGTH - 1);
@@ -2246,7 +3294,10 @@ void ted_filename(const char *filename)
     ted_buffer_t buf;
 
     // Initialize buffer
-    ted_init_buffer(&buf, filename);
+    if (!ted_init_buffer(&buf, filename)) {
+        printf("Error: Insufficient memory.\n");
+        return;
+    }
 
     // If filename provided, try to load it
     if (filename != NULL) {
@@ -2268,7 +3319,7 @@ void ted_filename(const char *filename)
                 }
 
                 if (line_idx > 0) {
-                    buf.lines[line_idx] = (char *)malloc(TED_MAX_LINE_LENGTH);
+                    buf.lines[line_idx] = ted_alloc_line(&buf);
                 }
 
                 strncpy(buf.lines[line_idx], line_buffer, TED_MAX_LINE_LENGTH - 1);
@@ -2306,6 +3357,10 @@ void ted_filename(const char *filename)
             else if (key == KEY_F1) {
                 // Load - full screen needs redraw
                 ted_load(&buf);
+                if (buf.lines == NULL) {
+                    // The buffer could not be re-created, nothing left to edit
+                    break;
+                }
                 need_full_redraw = true;
             }
             else if (key == KEY_F2) {
@@ -18,10 +18,13 @@ void backlight(void);
 void backlight_set(const char *display_level, const char *keyboard_level);
 void battery(void);
 void beep(void);
+void boot_time(void);
 void box(void);
 void bye(void);
 void cd(void);
 void clearscreen(void);
+void clock_profile(void);
+void clock_profile_set(const char *name);
 void dir(void);
 void play(void);
 void run_command(const char *command);
@@ -31,6 +34,11 @@ void width(void);
 void width_set(const char *width_str);
 void power_off(void);
 void power_off_set(const char *seconds);
+void idle(void);
+void mem(void);
+void screen(void);
+void screen_set(const char *idle_seconds, const char *sleep_seconds);
+void standby(void);
 void reset();
 void reset_set(const char *seconds);
 
@@ -53,6 +61,10 @@ void sd_rm(void);
 void sd_rm_filename(const char *filename);
 void sd_rmdir(void);
 void sd_rmdir_dirname(const char *dirname);
+void sd_defrag(void);
+void sd_defrag_path(const char *path);
+void sd_fsck(void);
+void sd_fsck_option(const char *option);
 
 // RTC DS3231 commands
 void rtc_time(void);
@@ -68,6 +80,14 @@ void viewtext_filename(const char *filename);
 void showimg(void);
 void showimg_filename(const char *filename);
 
+// Calculator
+void calc(void);
+void calc_expression(const char *args);
+
+// Function plotter
+void plot(void);
+void plot_expression(const char *args);
+
 // Sprite test
 void show_sprite(void);
 void sprite_frame(int16_t *sx, int16_t *velocity);
@@ -0,0 +1,337 @@
+//
+//  Asset packs for the PicoCalc
+//
+//  An asset pack is one file, built by tools/mkpack.py, that holds many
+//  small assets. Opening it reads the table of contents and resolves the
+//  clusters the file occupies into a few runs of consecutive blocks.
+//  After that an asset is found by hashing its name and loaded with one
+//  multi-block read per run it spans (usually one), without any further
+//  directory scans or FAT lookups.
+//
+//  Names are not kept in memory. Each entry holds the FNV-1a hash that
+//  places it in the table, and the length and CRC-32 of its name, which
+//  must all match before a lookup succeeds. A name that is not in the pack
+//  but shares a hash with one that is is reported as missing.
+//
+//  Reopen the pack if the SD card is changed.
+//
+
+#include <string.h>
+
+#include "pico/stdlib.h"
+
+#include "assetpack.h"
+#include "fat32.h"
+#include "sdcard.h"
+#include "memstat.h"
+
+#define PACK_VERSION    (1)
+#define PACK_SLOT_SIZE  (64)
+#define PACK_NO_ASSET   (0xFF)
+
+// On-card header (first sector)
+typedef struct
+{
+    char magic[6];
+    uint8_t version;
+    uint8_t reserved;
+    uint32_t count;
+    uint32_t slots;
+    uint32_t toc_offset;
+    uint32_t data_offset;
+} __attribute__((packed)) pack_header_t;
+
+// On-card table of contents slot
+typedef struct
+{
+    char name[ASSETPACK_NAME_LEN];
+    uint32_t offset;
+    uint32_t size;
+    uint32_t crc32;
+    uint8_t type;
+    uint8_t reserved[3];
+} __attribute__((packed)) pack_slot_t;
+
+// In-memory asset entry
+typedef struct
+{
+    uint32_t hash;
+    uint32_t name_crc;                  // CRC-32 of the name, checked after the hash
+    uint32_t block;                     // first block of the asset within the pack
+    uint32_t size;
+    uint32_t crc32;
+    uint8_t name_length;
+    uint8_t type;
+} pack_entry_t;
+
+static bool pack_open = false;
+static uint32_t slot_count = 0;
+static int entry_count = 0;
+static uint8_t slots[ASSETPACK_MAX_SLOTS];          // slot -> entry index, as laid out by the builder
+static pack_entry_t entries[ASSETPACK_MAX_SLOTS / 2];
+static fat32_extent_t extents[ASSETPACK_MAX_EXTENTS];
+static int extent_count = 0;
+static uint8_t block_buffer[SD_BLOCK_SIZE] __attribute__((aligned(4)));
+static bool memory_registered = false;
+
+
+//
+// Hashing and checksums
+//
+
+// 32-bit FNV-1a hash of an asset name
+uint32_t assetpack_hash(const char *name)
+{
+    uint32_t hash = 0x811C9DC5;
+    while (*name)
+    {
+        hash ^= (uint8_t)*name++;
+        hash *= 0x01000193;
+    }
+    return hash;
+}
+
+// CRC-32 (as zlib), a nibble at a time to keep the table small
+uint32_t assetpack_crc32(const void *data, uint32_t length)
+{
+    static const uint32_t table[16] = {
+        0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+        0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C,
+    };
+
+    const uint8_t *bytes = data;
+    uint32_t crc = 0xFFFFFFFF;
+    for (uint32_t i = 0; i < length; i++)
+    {
+        crc ^= bytes[i];
+        crc = (crc >> 4) ^ table[crc & 0x0F];
+        crc = (crc >> 4) ^ table[crc & 0x0F];
+    }
+    return ~crc;
+}
+
+
+//
+// Block access through the resolved extents
+//
+
+// Read consecutive blocks of the pack file, splitting the read where the file is fragmented
+static bool read_pack_blocks(uint32_t block, uint32_t count, uint8_t *buffer)
+{
+    for (int i = 0; i < extent_count && count > 0; i++)
+    {
+        if (block >= extents[i].count)
+        {
+            block -= extents[i].count;
+            continue;
+        }
+
+        uint32_t run = extents[i].count - block;
+        if (run > count)
+        {
+            run = count;
+        }
+        if (sd_read_blocks(extents[i].block + block, run, buffer) != SD_OK)
+        {
+            return false;
+        }
+        buffer += run * SD_BLOCK_SIZE;
+        count -= run;
+        block = 0;
+    }
+    return count == 0;
+}
+
+static const pack_entry_t *find_entry(const char *name)
+{
+    if (!pack_open)
+    {
+        return NULL;
+    }
+
+    uint32_t hash = assetpack_hash(name);
+    size_t length = strlen(name);
+    if (length >= ASSETPACK_NAME_LEN)
+    {
+        return NULL;
+    }
+
+    uint32_t mask = slot_count - 1;
+    for (uint32_t probe = 0, slot = hash & mask; probe < slot_count; probe++, slot = (slot + 1) & mask)
+    {
+        if (slots[slot] == PACK_NO_ASSET)
+        {
+            return NULL; // An empty slot ends the probe sequence
+        }
+        const pack_entry_t *entry = &entries[slots[slot]];
+        if (entry->hash == hash && entry->name_length == length &&
+            entry->name_crc == assetpack_crc32(name, length))
+        {
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+
+//
+// Pack file
+//
+
+// Open a pack, read its table of contents and resolve where it lives on the card
+bool assetpack_open(const char *path)
+{
+    if (!memory_registered)
+    {
+        mem_register_static("asset pack", sizeof(slots) + sizeof(entries) + sizeof(extents) + sizeof(block_buffer));
+        memory_registered = true;
+    }
+
+    assetpack_close();
+
+    fat32_file_t file;
+    if (fat32_open(&file, path) != FAT32_OK)
+    {
+        return false;
+    }
+
+    bool ok = fat32_get_extents(&file, extents, ASSETPACK_MAX_EXTENTS, &extent_count) == FAT32_OK;
+    fat32_close(&file);
+    if (!ok || extent_count == 0)
+    {
+        extent_count = 0;
+        return false;
+    }
+
+    // Header
+    const pack_header_t *header = (const pack_header_t *)block_buffer;
+    if (!read_pack_blocks(0, 1, block_buffer) ||
+        memcmp(header->magic, "JOBPAK", sizeof(header->magic)) != 0 ||
+        header->version != PACK_VERSION ||
+        header->slots == 0 || header->slots > ASSETPACK_MAX_SLOTS || (header->slots & (header->slots - 1)) ||
+        header->count > ASSETPACK_MAX_SLOTS / 2 ||
+        header->toc_offset % SD_BLOCK_SIZE)
+    {
+        extent_count = 0;
+        return false;
+    }
+    slot_count = header->slots;
+    uint32_t toc_block = header->toc_offset / SD_BLOCK_SIZE;
+
+    // Table of contents, a sector at a time
+    const uint32_t slots_per_block = SD_BLOCK_SIZE / PACK_SLOT_SIZE;
+    memset(slots, PACK_NO_ASSET, sizeof(slots));
+    entry_count = 0;
+    for (uint32_t s = 0; s < slot_count; s++)
+    {
+        if (s % slots_per_block == 0 && !read_pack_blocks(toc_block + s / slots_per_block, 1, block_buffer))
+        {
+            extent_count = 0;
+            return false;
+        }
+
+        const pack_slot_t *slot = (const pack_slot_t *)(block_buffer + (s % slots_per_block) * PACK_SLOT_SIZE);
+        if (slot->name[0] == '\0')
+        {
+            continue;
+        }
+        if (entry_count >= ASSETPACK_MAX_SLOTS / 2 || slot->offset % SD_BLOCK_SIZE)
+        {
+            extent_count = 0;
+            return false;
+        }
+
+        char name[ASSETPACK_NAME_LEN];
+        memcpy(name, slot->name, ASSETPACK_NAME_LEN);
+        name[ASSETPACK_NAME_LEN - 1] = '\0';
+
+        pack_entry_t *entry = &entries[entry_count];
+        entry->hash = assetpack_hash(name);
+        entry->name_length = (uint8_t)strlen(name);
+        entry->name_crc = assetpack_crc32(name, entry->name_length);
+        entry->block = slot->offset / SD_BLOCK_SIZE;
+        entry->size = slot->size;
+        entry->crc32 = slot->crc32;
+        entry->type = slot->type;
+        slots[s] = entry_count++;
+    }
+
+    pack_open = true;
+    return true;
+}
+
+void assetpack_close(void)
+{
+    pack_open = false;
+    slot_count = 0;
+    entry_count = 0;
+    extent_count = 0;
+}
+
+bool assetpack_is_open(void)
+{
+    return pack_open;
+}
+
+int assetpack_get_count(void)
+{
+    return entry_count;
+}
+
+
+//
+// Assets
+//
+
+// Look up an asset, returns false if the pack has no such asset
+bool assetpack_find(const char *name, assetpack_info_t *info)
+{
+    const pack_entry_t *entry = find_entry(name);
+    if (entry == NULL)
+    {
+        return false;
+    }
+
+    info->size = entry->size;
+    info->crc32 = entry->crc32;
+    info->type = (assetpack_type_t)entry->type;
+    return true;
+}
+
+// Load an asset into a buffer, returns false if it is missing, too large or cannot be read
+bool assetpack_load(const char *name, void *buffer, uint32_t buffer_size, uint32_t *size)
+{
+    const pack_entry_t *entry = find_entry(name);
+    if (entry == NULL || entry->size > buffer_size || !fat32_is_ready())
+    {
+        return false;
+    }
+
+    // Whole blocks go straight into the buffer, the last part block through the block buffer
+    uint32_t whole = entry->size / SD_BLOCK_SIZE;
+    uint32_t tail = entry->size % SD_BLOCK_SIZE;
+    if (whole && !read_pack_blocks(entry->block, whole, buffer))
+    {
+        return false;
+    }
+    if (tail)
+    {
+        if (!read_pack_blocks(entry->block + whole, 1, block_buffer))
+        {
+            return false;
+        }
+        memcpy((uint8_t *)buffer + whole * SD_BLOCK_SIZE, block_buffer, tail);
+    }
+
+    if (size)
+    {
+        *size = entry->size;
+    }
+    return true;
+}
+
+// Check loaded data against the checksum in the table of contents
+bool assetpack_check(const void *data, const assetpack_info_t *info)
+{
+    return assetpack_crc32(data, info->size) == info->crc32;
+}
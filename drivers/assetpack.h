@@ -0,0 +1,41 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define ASSETPACK_MAX_SLOTS     (256)   // largest table of contents (half full at most)
+#define ASSETPACK_MAX_EXTENTS   (16)    // runs of consecutive clusters the pack file may use
+#define ASSETPACK_NAME_LEN      (48)    // including the terminating NUL
+
+// Asset types (set by tools/mkpack.py)
+typedef enum
+{
+    ASSETPACK_TYPE_DATA = 0,
+    ASSETPACK_TYPE_IMAGE,               // RAW RGB565 image (tools/img2raw.py)
+    ASSETPACK_TYPE_MAP,                 // tile map (tools/tmx_to_bin_map.py)
+    ASSETPACK_TYPE_TEXT,
+    ASSETPACK_TYPE_AUDIO,
+} assetpack_type_t;
+
+// Description of an asset
+typedef struct
+{
+    uint32_t size;                      // size in bytes
+    uint32_t crc32;                     // CRC-32 of the contents
+    assetpack_type_t type;
+} assetpack_info_t;
+
+// Pack file
+bool assetpack_open(const char *path);
+void assetpack_close(void);
+bool assetpack_is_open(void);
+int assetpack_get_count(void);
+
+// Assets
+bool assetpack_find(const char *name, assetpack_info_t *info);
+bool assetpack_load(const char *name, void *buffer, uint32_t buffer_size, uint32_t *size);
+bool assetpack_check(const void *data, const assetpack_info_t *info);
+
+// Helpers shared with the pack builder
+uint32_t assetpack_hash(const char *name);
+uint32_t assetpack_crc32(const void *data, uint32_t length);
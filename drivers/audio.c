@@ -14,12 +14,14 @@
 
 #include "audio.h"
 #include "audio.pio.h"
+#include "governor.h"
 
 static bool audio_initialised = false;
 PIO pio = pio0;
 
 static bool is_playing = false;
 static alarm_id_t tone_alarm_id = -1;
+static uint32_t channel_frequency[2] = {SILENCE, SILENCE}; // Tone playing on each channel
 
 // Forward declaration for the alarm callback
 static int64_t tone_stop_callback(alarm_id_t id, void *user_data);
@@ -28,9 +30,28 @@ static int64_t tone_stop_callback(alarm_id_t id, void *user_data);
 static void set_pwm_frequency(uint8_t channel, uint32_t frequency)
 {
     audio_pwm_set_frequency(pio, channel, frequency);
+    channel_frequency[channel] = frequency;
     is_playing = true;
 }
 
+// The PWM period is counted in system clock cycles, so restart any tone
+// that is playing when the clock governor changes profile
+static void audio_clock_changed(governor_event_t event, uint32_t sys_hz)
+{
+    if (event != GOVERNOR_POST_CHANGE)
+    {
+        return;
+    }
+
+    for (uint8_t channel = LEFT_CHANNEL; channel <= RIGHT_CHANNEL; channel++)
+    {
+        if (audio_pwm_is_not_silence(channel_frequency[channel]))
+        {
+            audio_pwm_set_frequency(pio, channel, channel_frequency[channel]);
+        }
+    }
+}
+
 // Play a stereo sound for a specific duration (blocking)
 void audio_play_sound_blocking(uint32_t left_frequency, uint32_t right_frequency, uint32_t duration_ms)
 {
@@ -170,10 +191,16 @@ void audio_init(void)
         return; // Already initialized
     }
 
+    // Claim the state machines so drivers initialised later (e.g. the
+    // wireless chip) do not take them
+    pio_sm_claim(pio, LEFT_CHANNEL);
+    pio_sm_claim(pio, RIGHT_CHANNEL);
+
     uint offset = pio_add_program(pio, &audio_pwm_program);
 
     audio_pwm_program_init(pio, LEFT_CHANNEL, offset, 26);
     audio_pwm_program_init(pio, RIGHT_CHANNEL, offset, 27);
+    governor_register(audio_clock_changed);
 
     audio_initialised = true;
 }
@@ -0,0 +1,50 @@
+//
+//  Boot timing for the PicoCalc
+//
+//  Start-up code calls boot_mark() as each stage finishes. The hardware
+//  timer starts counting at reset, so each timestamp is the time from
+//  reset to the end of the stage, including the boot ROM and the C
+//  runtime start-up before main.
+//
+
+#include "pico/stdlib.h"
+
+#include "boottime.h"
+
+static boot_stage_t stages[BOOT_MAX_STAGES];
+static int stage_count = 0;
+
+
+//
+// Recording
+//
+
+// Record that a boot stage has finished (call from core 0)
+void boot_mark(const char *name)
+{
+    if (stage_count < BOOT_MAX_STAGES)
+    {
+        stages[stage_count].name = name;
+        stages[stage_count].time_us = time_us_32();
+        stage_count++;
+    }
+}
+
+
+//
+// Reporting
+//
+
+int boot_get_stage_count(void)
+{
+    return stage_count;
+}
+
+const boot_stage_t *boot_get_stage(int index)
+{
+    if (index < 0 || index >= stage_count)
+    {
+        return NULL;
+    }
+    return &stages[index];
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+#include "pico/stdlib.h"
+
+#define BOOT_MAX_STAGES     (16)        // maximum number of recorded boot stages
+
+// A boot stage and when it finished
+typedef struct
+{
+    const char *name;   // stage name, e.g. "lcd"
+    uint32_t time_us;   // time since reset when the stage finished
+} boot_stage_t;
+
+// Recording
+void boot_mark(const char *name);
+
+// Reporting
+int boot_get_stage_count(void);
+const boot_stage_t *boot_get_stage(int index);
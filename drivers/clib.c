@@ -14,6 +14,7 @@
 #include <errno.h>
 #include "pico/stdlib.h"
 #include "fat32.h"
+#include "memstat.h"
 
 #define FD_FLAG_MASK 0x4000 // Mask to indicate a file descriptor
 #define MAX_OPEN_FILES 16
@@ -29,6 +30,7 @@ static void init(void)
         {
             files[i].is_open = 0;
         }
+        mem_register_static("clib files", sizeof(files));
         initialized = 1;
     }
 }
@@ -63,6 +65,8 @@ static int fat32_error_to_errno(fat32_error_t error)
         return ESPIPE;
     case FAT32_ERROR_INVALID_PARAMETER:
         return EINVAL;
+    case FAT32_ERROR_NOT_SUPPORTED:
+        return ENOTSUP;
     default:
         return EIO; // General I/O error for unknown errors
     }
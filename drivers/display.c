@@ -13,6 +13,7 @@
 //        writing to the display RAM requires the minimum chip select high pulse width of 40ns.
 //
 
+#include <ctype.h>
 #include <stdio.h>
 #include <string.h>
 
@@ -22,6 +23,7 @@
 
 #include "lcd.h"
 #include "display.h"
+#include "memstat.h"
 
 // Colour Palette definitions
 //
@@ -99,16 +101,16 @@ const uint16_t xterm_palette[256] = {
 //  Reference: https://vt100.net/docs/vt100-ug/chapter3.html
 //
 
+#define MAX_PARAMETERS  (16) // parameters kept from a control sequence
+
 bool tab_stops[64] = {0};
-uint8_t debug[64] = {0};
-int debug_index = 0;
 
 uint8_t state = STATE_NORMAL; // initial state of escape sequence processing
 uint8_t column = 0;           // cursor x position
 uint8_t row = 0;              // cursor y position
 
-uint16_t parameters[16]; // buffer for selective parameters
-uint8_t p_index = 0;    // index into the buffer
+uint16_t parameters[MAX_PARAMETERS]; // buffer for selective parameters
+uint8_t p_index = 0;                 // index into the buffer
 
 uint8_t save_column = 0; // saved cursor x position for DECSC/DECRC
 uint8_t save_row = 0;    // saved cursor y position for DECSC/DECRC
@@ -186,645 +188,1106 @@ static void reset_terminal()
 }
 
 //
-// Display API
+//  Escape sequence parser
+//
+//  A table-driven state machine in the style of the DEC parser described at
+//  https://vt100.net/emu/dec_ansi_parser. Each byte is sorted into a class,
+//  and the transition table gives the action to perform and the next state
+//  for that class in the current state. Only the actions below look at the
+//  byte itself, so the common cases (printable characters and parameter
+//  digits) cost two table lookups.
+//
+//  As on the VT100, control characters inside an escape or control sequence
+//  are executed without ending the sequence. CAN and SUB cancel it.
 //
 
-bool display_emit_available()
+// Character classes
+enum
 {
-    return true; // always available for output in this implementation
+    CLASS_CONTROL,      // C0 controls not listed below
+    CLASS_BEL,          // BEL, also ends an OSC string
+    CLASS_CANCEL,       // CAN and SUB
+    CLASS_ESC,          // ESC
+    CLASS_DIGIT,        // 0-9
+    CLASS_SEMICOLON,    // parameter separator
+    CLASS_QUESTION,     // ? DEC private mode
+    CLASS_BANG,         // ! TMC
+    CLASS_CSI,          // [ after ESC
+    CLASS_STRING,       // ] X ^ P after ESC (OSC, SOS, PM, DCS)
+    CLASS_APC,          // _ after ESC (APC)
+    CLASS_G0,           // ( after ESC
+    CLASS_G1,           // ) after ESC
+    CLASS_BACKSLASH,    // \ ends a string after ESC
+    CLASS_PRINTABLE,    // any other printable character
+    CLASS_DELETE,       // DEL
+    CLASS_HIGH,         // 0x80-0xFF
+    CLASS_ST,           // 0x9C String Terminator
+    NUM_CLASSES
+};
+
+// Actions
+enum
+{
+    ACTION_NONE,
+    ACTION_PARAM,       // accumulate a parameter digit
+    ACTION_NEXT_PARAM,  // move to the next parameter
+    ACTION_CLEAR,       // start a new control sequence
+    ACTION_PRINT,       // draw a character
+    ACTION_EXECUTE,     // perform a control character
+    ACTION_ESC,         // final character of an escape sequence
+    ACTION_CSI,         // final character of a control sequence
+    ACTION_DEC,         // final character of a DEC private mode sequence
+    ACTION_TMC,         // final character of a TMC sequence
+    ACTION_G0_SET,      // designate the G0 character set
+    ACTION_G1_SET,      // designate the G1 character set
+    ACTION_CANCEL,      // sequence cancelled by CAN or SUB
+    ACTION_IMAGE_START, // first character of an APC string
+    ACTION_IMAGE,       // control data or payload of an inline image
+    ACTION_IMAGE_END,   // end of an inline image chunk
+};
+
+#define NUM_STATES          (12)
+#define T(action, next)     ((uint8_t)((ACTION_##action << 4) | (next)))
+#define T_ACTION(t)         ((t) >> 4)
+#define T_STATE(t)          ((t) & 0x0F)
+
+static const uint8_t char_class[256] = {
+    [0x00 ... 0x1F] = CLASS_CONTROL,
+    [CHR_BEL] = CLASS_BEL,
+    [CHR_CAN] = CLASS_CANCEL,
+    [CHR_SUB] = CLASS_CANCEL,
+    [CHR_ESC] = CLASS_ESC,
+    [0x20 ... 0x7E] = CLASS_PRINTABLE,
+    ['0' ... '9'] = CLASS_DIGIT,
+    [';'] = CLASS_SEMICOLON,
+    ['?'] = CLASS_QUESTION,
+    ['!'] = CLASS_BANG,
+    ['['] = CLASS_CSI,
+    [']'] = CLASS_STRING,
+    ['X'] = CLASS_STRING,
+    ['^'] = CLASS_STRING,
+    ['_'] = CLASS_APC,
+    ['P'] = CLASS_STRING,
+    ['('] = CLASS_G0,
+    [')'] = CLASS_G1,
+    ['\\'] = CLASS_BACKSLASH,
+    [0x7F] = CLASS_DELETE,
+    [0x80 ... 0xFF] = CLASS_HIGH,
+    [0x9C] = CLASS_ST,
+};
+
+static const uint8_t transitions[NUM_STATES][NUM_CLASSES] = {
+    [STATE_NORMAL] = {
+        [CLASS_CONTROL] = T(EXECUTE, STATE_NORMAL),
+        [CLASS_BEL] = T(EXECUTE, STATE_NORMAL),
+        [CLASS_CANCEL] = T(NONE, STATE_NORMAL),
+        [CLASS_ESC] = T(NONE, STATE_ESCAPE),
+        [CLASS_DIGIT ... CLASS_PRINTABLE] = T(PRINT, STATE_NORMAL),
+        [CLASS_DELETE ... CLASS_ST] = T(NONE, STATE_NORMAL),
+    },
+    [STATE_ESCAPE] = {
+        [CLASS_CONTROL] = T(EXECUTE, STATE_ESCAPE),
+        [CLASS_BEL] = T(EXECUTE, STATE_ESCAPE),
+        [CLASS_CANCEL] = T(CANCEL, STATE_NORMAL),
+        [CLASS_ESC] = T(NONE, STATE_ESCAPE),
+        [CLASS_DIGIT ... CLASS_BANG] = T(ESC, STATE_NORMAL),
+        [CLASS_CSI] = T(CLEAR, STATE_CS),
+        [CLASS_STRING] = T(NONE, STATE_OSC),
+        [CLASS_APC] = T(NONE, STATE_APC),
+        [CLASS_G0] = T(NONE, STATE_G0_SET),
+        [CLASS_G1] = T(NONE, STATE_G1_SET),
+        [CLASS_BACKSLASH ... CLASS_ST] = T(ESC, STATE_NORMAL),
+    },
+    [STATE_CS] = {
+        [CLASS_CONTROL] = T(EXECUTE, STATE_CS),
+        [CLASS_BEL] = T(EXECUTE, STATE_CS),
+        [CLASS_CANCEL] = T(CANCEL, STATE_NORMAL),
+        [CLASS_ESC] = T(NONE, STATE_ESCAPE),
+        [CLASS_DIGIT] = T(PARAM, STATE_CS),
+        [CLASS_SEMICOLON] = T(NEXT_PARAM, STATE_CS),
+        [CLASS_QUESTION] = T(NONE, STATE_DEC),
+        [CLASS_BANG] = T(NONE, STATE_TMC),
+        [CLASS_CSI ... CLASS_PRINTABLE] = T(CSI, STATE_NORMAL),
+        [CLASS_DELETE] = T(NONE, STATE_CS),
+        [CLASS_HIGH ... CLASS_ST] = T(CSI, STATE_NORMAL),
+    },
+    [STATE_DEC] = {
+        [CLASS_CONTROL] = T(EXECUTE, STATE_DEC),
+        [CLASS_BEL] = T(EXECUTE, STATE_DEC),
+        [CLASS_CANCEL] = T(DEC, STATE_NORMAL),
+        [CLASS_ESC] = T(NONE, STATE_ESCAPE),
+        [CLASS_DIGIT] = T(PARAM, STATE_DEC),
+        [CLASS_SEMICOLON] = T(NEXT_PARAM, STATE_DEC),
+        [CLASS_QUESTION ... CLASS_PRINTABLE] = T(DEC, STATE_NORMAL),
+        [CLASS_DELETE] = T(NONE, STATE_DEC),
+        [CLASS_HIGH ... CLASS_ST] = T(DEC, STATE_NORMAL),
+    },
+    [STATE_G0_SET] = {
+        [0 ... NUM_CLASSES - 1] = T(G0_SET, STATE_NORMAL),
+    },
+    [STATE_G1_SET] = {
+        [0 ... NUM_CLASSES - 1] = T(G1_SET, STATE_NORMAL),
+    },
+    [STATE_OSC] = {
+        [0 ... NUM_CLASSES - 1] = T(NONE, STATE_OSC),
+        [CLASS_BEL] = T(NONE, STATE_NORMAL),
+        [CLASS_ESC] = T(NONE, STATE_OSC_ESC),
+        [CLASS_ST] = T(NONE, STATE_NORMAL),
+    },
+    [STATE_OSC_ESC] = {
+        [0 ... NUM_CLASSES - 1] = T(NONE, STATE_OSC),
+        [CLASS_BACKSLASH] = T(NONE, STATE_NORMAL),
+    },
+    [STATE_TMC] = {
+        [0 ... NUM_CLASSES - 1] = T(TMC, STATE_NORMAL),
+    },
+    [STATE_APC] = {
+        [0 ... NUM_CLASSES - 1] = T(NONE, STATE_OSC),
+        [CLASS_BEL] = T(NONE, STATE_NORMAL),
+        [CLASS_ESC] = T(NONE, STATE_OSC_ESC),
+        [CLASS_PRINTABLE] = T(IMAGE_START, STATE_IMAGE), // an image if the character is G
+        [CLASS_ST] = T(NONE, STATE_NORMAL),
+    },
+    [STATE_IMAGE] = {
+        [0 ... NUM_CLASSES - 1] = T(IMAGE, STATE_IMAGE),
+        [CLASS_BEL] = T(IMAGE_END, STATE_NORMAL),
+        [CLASS_CANCEL] = T(IMAGE_END, STATE_NORMAL),
+        [CLASS_ESC] = T(NONE, STATE_IMAGE_ESC),
+        [CLASS_ST] = T(IMAGE_END, STATE_NORMAL),
+    },
+    [STATE_IMAGE_ESC] = {
+        [0 ... NUM_CLASSES - 1] = T(IMAGE_END, STATE_NORMAL),
+    },
+};
+
+// Draw a printable character in the active character set
+static void print_char(uint8_t ch)
+{
+    uint8_t charset = get_charset();
+    if (charset == CHARSET_UK && ch == '#')
+    {
+        // Replace '#' with the pound sign in UK character set
+        ch = 0x1E;
+    }
+    else if (charset == CHARSET_DEC && ch >= 0x5F && ch <= 0x7E)
+    {
+        // Maps characters 0x5F - 0x7E to DEC Special Character Set
+        ch -= 0x5F;
+    }
+
+    lcd_putc(column++, row, ch);
+}
+
+// Perform a control character
+static void execute(uint8_t ch)
+{
+    switch (ch)
+    {
+    case CHR_BS:
+        column = MAX(0, column - 1); // move cursor back one space (but not before the start of the line)
+        break;
+    case CHR_BEL:
+        ring_bell(); // ring the bell
+        break;
+    case CHR_HT:
+        column = MIN(((column + 8) & ~7), lcd_get_columns() - 1); // move cursor to next tabstop (but not beyond the end of the line)
+        break;
+    case CHR_LF:
+    case CHR_VT:
+    case CHR_FF:
+        row++; // move cursor down one line
+        break;
+    case CHR_CR:
+        column = 0; // move cursor to the start of the line
+        break;
+    case CHR_SO: // Shift Out - select G1 character set
+        set_charset(G1_CHARSET);
+        break;
+    case CHR_SI: // Shift In - select G0 character set
+        set_charset(G0_CHARSET);
+        break;
+    default:
+        break; // other control characters are ignored
+    }
+}
+
+// Final character of an escape sequence
+static void esc_dispatch(uint8_t ch)
+{
+    switch (ch)
+    {
+    case '7': // DECSC – Save Cursor
+        save_column = column;
+        save_row = row;
+        break;
+    case '8': // DECRC – Restore Cursor
+        column = save_column;
+        row = save_row;
+        break;
+    case 'D': // IND – Index
+        row++;
+        break;
+    case 'E': // NEL – Next Line
+        column = 0;
+        row++;
+        break;
+    case 'H': // HTS – Horizontal Tabulation Set
+        if (column < sizeof(tab_stops))
+        {
+            tab_stops[column] = true; // Set a tab stop at the current column
+        }
+        break;
+    case 'M':         // RI – Reverse Index
+        if (row == 0) // scroll at top of the screen
+        {
+            lcd_scroll_down();
+        }
+        else
+        {
+            row--;
+        }
+        break;
+    case 'c': // RIS – Reset To Initial State
+        column = row = 0;
+        reset_terminal();
+        break;
+    default:
+        // not a valid escape sequence, should we print an error?
+        break;
+    }
+}
+
+// Select Graphic Rendition
+static void select_graphic_rendition()
+{
+    for (uint8_t i = 0; i <= p_index; i++)
+    {
+        if (parameters[i] == 0) // attributes off
+        {
+            lcd_set_foreground(FOREGROUND);
+            lcd_set_background(BACKGROUND);
+            lcd_set_underscore(false);
+            lcd_set_reverse(false);
+            lcd_set_bold(false);
+        }
+        else if (parameters[i] == 1) // bold
+        {
+            lcd_set_bold(true);
+        }
+        else if (parameters[i] == 2) // dim
+        {
+            lcd_set_foreground(DIM);
+        }
+        // No support for italic (3)
+        else if (parameters[i] == 4) // underline
+        {
+            lcd_set_underscore(true);
+        }
+        // No support for blink (5, 6)
+        else if (parameters[i] == 7) // negative (reverse) image
+        {
+            lcd_set_reverse(true);
+        }
+        else if (parameters[i] == 22) // normal intensity/weight
+        {
+            lcd_set_foreground(FOREGROUND);
+            lcd_set_bold(false);
+        }
+        else if (parameters[i] == 24) // not underlined
+        {
+            lcd_set_underscore(false);
+        }
+        else if (parameters[i] == 27) // positive image
+        {
+            lcd_set_reverse(false);
+        }
+        else if (parameters[i] >= 30 && parameters[i] <= 37) // foreground colour
+        {
+            lcd_set_foreground(palette[parameters[i] - 30]);
+        }
+        else if (parameters[i] == 38 && i + 4 <= p_index && parameters[i + 1] == 2) // foreground truecolor
+        {
+            uint8_t r = parameters[i + 2];
+            uint8_t g = parameters[i + 3];
+            uint8_t b = parameters[i + 4];
+            uint16_t colour = RGB(r, g, b);
+            lcd_set_foreground(colour);
+            i += 4; // Skip the next four parameters (2, r, g, b)
+        }
+        else if (parameters[i] == 38 && i + 2 <= p_index && parameters[i + 1] == 5) // foreground 256-colour
+        {
+            uint8_t colour = parameters[i + 2];
+            lcd_set_foreground(xterm_palette[colour]);
+            i += 2; // Skip the next two parameters (5 and colour)
+        }
+        else if (parameters[i] == 39) // default foreground colour
+        {
+            lcd_set_foreground(FOREGROUND);
+        }
+        else if (parameters[i] >= 40 && parameters[i] <= 47) // background colour
+        {
+            lcd_set_background(palette[parameters[i] - 40]);
+        }
+        else if (parameters[i] == 48 && i + 4 <= p_index && parameters[i + 1] == 2) // background truecolor
+        {
+            uint8_t r = parameters[i + 2];
+            uint8_t g = parameters[i + 3];
+            uint8_t b = parameters[i + 4];
+            uint16_t colour = RGB(r, g, b);
+            lcd_set_background(colour);
+            i += 4; // Skip the next four parameters (2, r, g, b)
+        }
+        else if (parameters[i] == 48 && i + 2 <= p_index && parameters[i + 1] == 5) // background 256-colour
+        {
+            uint8_t colour = parameters[i + 2];
+            lcd_set_background(xterm_palette[colour]);
+            i += 2; // Skip the next two parameters (5 and colour)
+        }
+        else if (parameters[i] == 49) // default background colour
+        {
+            lcd_set_background(BACKGROUND);
+        }
+        else if (parameters[i] >= 90 && parameters[i] <= 97) // bright foreground colour
+        {
+            lcd_set_foreground(bright_palette[parameters[i] - 90]);
+        }
+        else if (parameters[i] >= 100 && parameters[i] <= 107) // bright background colour
+        {
+            lcd_set_background(bright_palette[parameters[i] - 100]);
+        }
+    }
 }
 
-void display_emit(char ch)
+// Final character of a control sequence
+static void csi_dispatch(uint8_t ch)
 {
     int max_row = MAX_ROW;
     int max_col = lcd_get_columns() - 1;
 
-    lcd_erase_cursor(); // erase the cursor before processing the character
+    switch (ch)
+    {
+    case 'A': // CUU – Cursor Up
+        row = MAX(0, row - parameters[0]);
+        break;
+    case 'B': // CUD – Cursor Down
+        row = MIN(row + parameters[0], max_row);
+        break;
+    case 'C': // CUF – Cursor Forward
+        column = MIN(column + parameters[0], max_col);
+        break;
+    case 'D': // CUB - Cursor Backward
+        column = MAX(0, column - parameters[0]);
+        break;
+    case 'E': // CNL – CursorNext Line
+        if (parameters[0] == 0)
+        {
+            parameters[0] = 1; // default to 1 if not specified
+        }
+        row = MIN(row + parameters[0], max_row);
+        column = 0;
+        break;
+    case 'F': // CPL – Cursor Previous Line
+        if (parameters[0] == 0)
+        {
+            parameters[0] = 1; // default to 1 if not specified
+        }
+        row = MAX(0, row - parameters[0]);
+        column = 0;
+        break;
+    case 'G': // CHA - Cursor Horizontal Absolute
+        if (parameters[0] == 0)
+        {
+            parameters[0] = 1; // default to 1 if not specified
+        }
+        column = MIN(parameters[0] - 1, max_col);
+        column = MAX(0, column);
+        break;
 
-    // State machine for processing incoming characters
-    switch (state)
-    {
-    case STATE_ESCAPE:        // ESC character received, process the next character
-        state = STATE_NORMAL; // reset state by default
-        switch (ch)
-        {
-        case CHR_CAN:                      // cancel the current escape sequence
-        case CHR_SUB:                      // same as CAN
-            lcd_putc(column++, row, 0x02); // print a error character
-            break;
-        case CHR_ESC:
-            state = STATE_ESCAPE; // stay in escape state
-            break;
-        case '7': // DECSC – Save Cursor
-            save_column = column;
-            save_row = row;
-            break;
-        case '8': // DECRC – Restore Cursor
-            column = save_column;
-            row = save_row;
-            break;
-        case 'D': // IND – Index
-            row++;
-            break;
-        case 'E': // NEL – Next Line
-            column = 0;
-            row++;
-            break;
-        case 'H': // HTS – Horizontal Tabulation Set
-            if (column < sizeof(tab_stops))
-            {
-                tab_stops[column] = true; // Set a tab stop at the current column
-            }
-            break;
-        case 'M':         // RI – Reverse Index
-            if (row == 0) // scroll at top of the screen
-            {
-                lcd_scroll_down();
-            }
-            else
-            {
-                row--;
-            }
-            break;
-        case 'c': // RIS – Reset To Initial State
-            column = row = 0;
-            reset_terminal();
-            break;
-        case '[': // CSI - Control Sequence Introducer
-            p_index = 0;
-            memset(parameters, 0, sizeof(parameters));
-            memset(debug, 0, sizeof(debug));
-            debug[0] = '\033';
-            debug[1] = ch;
-            debug_index = 2;
-            state = STATE_CS;
-            break;
-        case ']': // OSC - Operating System Command
-        case 'X': // SOS - Start of String (treat as OSC)
-        case '^': // PM - Privacy Message (treat as OSC)
-        case '_': // APC - Application Program Command (treat as OSC)
-        case 'P': // DCS - Device Control String (treat as OSC)
-            state = STATE_OSC;
-            break;
-        case '(': // SCS - G0 character set selection
-            state = STATE_G0_SET;
-            break;
-        case ')': // SCS - G1 character set selection
-            state = STATE_G1_SET;
-            break;
-        default:
-            // not a valid escape sequence, should we print an error?
-            break;
-        }
-        break;
-
-    case STATE_CS: // in Control Sequence
-        debug[debug_index++] = ch;
-        if (ch == CHR_ESC)
-        {
-            state = STATE_ESCAPE;
-            break; // reset to escape state
-        }
-        else if (ch == '?') // DEC private mode
-        {
-            state = STATE_DEC;
-        }
-        else if (ch == '!') // TMC
-        {
-            state = STATE_TMC;
-        }
-        else if (ch >= '0' && ch <= '9')
-        {
-            parameters[p_index] *= 10; // accumulate digits
-            parameters[p_index] += ch - '0';
-        }
-        else if (ch == ';') // delimiter
-        {
-            if (p_index < sizeof(parameters) - 1)
+    case 'H': // CUP – Cursor Position
+    case 'f': // HVP – Horizontal and Vertical Position
+        if (parameters[0] == 0)
+        {
+            parameters[0] = 1; // default to 1 if not specified
+        }
+        if (parameters[1] == 0)
+        {
+            parameters[1] = 1; // default to 1 if not specified
+        }
+        row = MIN(parameters[0] - 1, max_row);
+        column = MIN(parameters[1] - 1, max_col);
+        break;
+    case 'J': // ED – Erase In Display
+        if (parameters[0] == 0)
+        {
+            // Erase from cursor to end of screen
+            lcd_erase_line(row, column, max_col);
+            for (uint8_t r = row + 1; r <= max_row; r++)
             {
-                p_index++;
+                lcd_erase_line(r, 0, max_col);
             }
         }
-        else // final character in control sequence
+        else if (parameters[0] == 1)
         {
-            state = STATE_NORMAL; // reset state after processing the control sequence
-            switch (ch)
+            // Erase from start of screen to cursor
+            for (uint8_t r = 0; r < row; r++)
             {
-            case 'A': // CUU – Cursor Up
-                row = MAX(0, row - parameters[0]);
-                break;
-            case 'B': // CUD – Cursor Down
-                row = MIN(row + parameters[0], max_row);
-                break;
-            case 'C': // CUF – Cursor Forward
-                column = MIN(column + parameters[0], max_col);
-                break;
-            case 'D': // CUB - Cursor Backward
-                column = MAX(0, column - parameters[0]);
-                break;
-            case 'E': // CNL – CursorNext Line
-                if (parameters[0] == 0)
-                {
-                    parameters[0] = 1; // default to 1 if not specified
-                }
-                row = MIN(row + parameters[0], max_row);
-                column = 0;
-                break;
-            case 'F': // CPL – Cursor Previous Line
-                if (parameters[0] == 0)
-                {
-                    parameters[0] = 1; // default to 1 if not specified
-                }
-                row = MAX(0, row - parameters[0]);
-                column = 0;
-                break;
-            case 'G': // CHA - Cursor Horizontal Absolute
-                if (parameters[0] == 0)
-                {
-                    parameters[0] = 1; // default to 1 if not specified
-                }
-                column = MIN(parameters[0] - 1, max_col);
-                column = MAX(0, column);
-                break;
-
-            case 'H': // CUP – Cursor Position
-            case 'f': // HVP – Horizontal and Vertical Position
-                if (parameters[0] == 0)
-                {
-                    parameters[0] = 1; // default to 1 if not specified
-                }
-                if (parameters[1] == 0)
-                {
-                    parameters[1] = 1; // default to 1 if not specified
-                }
-                row = MIN(parameters[0] - 1, max_row);
-                column = MIN(parameters[1] - 1, max_col);
-                break;
-            case 'J': // ED – Erase In Display
-                if (parameters[0] == 0)
-                {
-                    // Erase from cursor to end of screen
-                    lcd_erase_line(row, column, max_col);
-                    for (uint8_t r = row + 1; r <= max_row; r++)
-                    {
-                        lcd_erase_line(r, 0, max_col);
-                    }
-                }
-                else if (parameters[0] == 1)
-                {
-                    // Erase from start of screen to cursor
-                    for (uint8_t r = 0; r < row; r++)
-                    {
-                        lcd_erase_line(r, 0, max_col);
-                    }
-                    lcd_erase_line(row, 0, column);
-                }
-                else if (parameters[0] == 2) // clear entire screen
-                {
-                    lcd_clear_screen();
-                }
-                break;
-            case 'K': // EL – Erase In Line
-                if (parameters[0] == 0)
-                {
-                    // Erase from cursor to end of line
-                    lcd_erase_line(row, column, max_col);
-                }
-                else if (parameters[0] == 1)
-                {
-                    // Erase from start of line to cursor
-                    lcd_erase_line(row, 0, column);
-                }
-                else if (parameters[0] == 2) // clear entire line
-                {
-                    lcd_erase_line(row, 0, max_col);
-                }
-                break;
-            case 'S': // SU - Scroll Up
-                if (parameters[0] == 0)
-                {
-                    parameters[0] = 1; // default to 1 if not specified
-                }
-                while (parameters[0]-- > 0)
-                {
-                    lcd_scroll_up();
-                }
-                break;
-            case 'T': // SD - Scroll Down
-                if (parameters[0] == 0)
-                {
-                    parameters[0] = 1; // default to 1 if not specified
-                }
-                while (parameters[0]-- > 0)
-                {
-                    lcd_scroll_down();
-                }
-                break;
-            case 'c': // DA - Device Attributes
-                report("\033[?1;c");
-                break;
-            case 'd': // VPA - Vertical Position Absolute
-                if (parameters[0] == 0)
-                {
-                    parameters[0] = 1; // default to 1 if not specified
-                }
-                row = MIN(parameters[0] - 1, max_row);
-                break;
-            case 'e': // VPR - Vertical Position Relative
-                if (parameters[0] == 0)
-                {
-                    parameters[0] = 1; // default to 1 if not specified
-                }
-                row = MIN(row + parameters[0], max_row);
-                break;
-            case 'g': // TBC – Tabulation Clear
-                if (parameters[0] == 3)
-                {
-                    // Clear all tab stops
-                    memset(tab_stops, 0, sizeof(tab_stops));
-                }
-                else if (parameters[0] == 0)
-                {
-                    // Clear tab stop at current column
-                    if (column < sizeof(tab_stops))
-                    {
-                        tab_stops[column] = false;
-                    }
-                }
-                break;
-            case 'l': // RM – Reset Mode
-            case 'h': // SM – Set Mode
-                break;
-            case 'm': // SGR – Select Graphic Rendition
-                for (uint8_t i = 0; i <= p_index; i++)
-                {
-                    if (parameters[i] == 0) // attributes off
-                    {
-                        lcd_set_foreground(FOREGROUND);
-                        lcd_set_background(BACKGROUND);
-                        lcd_set_underscore(false);
-                        lcd_set_reverse(false);
-                        lcd_set_bold(false);
-                    }
-                    else if (parameters[i] == 1) // bold
-                    {
-                        lcd_set_bold(true);
-                    }
-                    else if (parameters[i] == 2) // dim
-                    {
-                        lcd_set_foreground(DIM);
-                    }
-                    // No support for italic (3)
-                    else if (parameters[i] == 4) // underline
-                    {
-                        lcd_set_underscore(true);
-                    }
-                    // No support for blink (5, 6)
-                    else if (parameters[i] == 7) // negative (reverse) image
-                    {
-                        lcd_set_reverse(true);
-                    }
-                    else if (parameters[i] == 22) // normal intensity/weight
-                    {
-                        lcd_set_foreground(FOREGROUND);
-                        lcd_set_bold(false);
-                    }
-                    else if (parameters[i] == 24) // not underlined
-                    {
-                        lcd_set_underscore(false);
-                    }
-                    else if (parameters[i] == 27) // positive image
-                    {
-                        lcd_set_reverse(false);
-                    }
-                    else if (parameters[i] >= 30 && parameters[i] <= 37) // foreground colour
-                    {
-                        lcd_set_foreground(palette[parameters[i] - 30]);
-                    }
-                    else if (parameters[i] == 38 && i + 4 <= p_index && parameters[i + 1] == 2) // foreground truecolor
-                    {
-                        uint8_t r = parameters[i + 2];
-                        uint8_t g = parameters[i + 3];
-                        uint8_t b = parameters[i + 4];
-                        uint16_t colour = RGB(r, g, b);
-                        lcd_set_foreground(colour);
-                        i += 4; // Skip the next four parameters (2, r, g, b)
-                    }
-                    else if (parameters[i] == 38 && i + 2 <= p_index && parameters[i + 1] == 5) // foreground 256-colour
-                    {
-                        uint8_t colour = parameters[i + 2];
-                        lcd_set_foreground(xterm_palette[colour]);
-                        i += 2; // Skip the next two parameters (5 and colour)
-                    }
-                    else if (parameters[i] == 39) // default foreground colour
-                    {
-                        lcd_set_foreground(FOREGROUND);
-                    }
-                    else if (parameters[i] >= 40 && parameters[i] <= 47) // background colour
-                    {
-                        lcd_set_background(palette[parameters[i] - 40]);
-                    }
-                    else if (parameters[i] == 48 && i + 4 <= p_index && parameters[i + 1] == 2) // background truecolor
-                    {
-                        uint8_t r = parameters[i + 2];
-                        uint8_t g = parameters[i + 3];
-                        uint8_t b = parameters[i + 4];
-                        uint16_t colour = RGB(r, g, b);
-                        lcd_set_background(colour);
-                        i += 4; // Skip the next four parameters (2, r, g, b)
-                    }
-                    else if (parameters[i] == 48 && i + 2 <= p_index && parameters[i + 1] == 5) // background 256-colour
-                    {
-                        uint8_t colour = parameters[i + 2];
-                        lcd_set_background(xterm_palette[colour]);
-                        i += 2; // Skip the next two parameters (5 and colour)
-                    }
-                    else if (parameters[i] == 49) // default background colour
-                    {
-                        lcd_set_background(BACKGROUND);
-                    }
-                    else if (parameters[i] >= 90 && parameters[i] <= 97) // bright foreground colour
-                    {
-                        uint8_t index = parameters[i] - 90;
-                        if (index < 8) // ensure index is within bounds
-                        {
-                            lcd_set_foreground(bright_palette[index]);
-                        }
-                    }
-                    else if (parameters[i] >= 100 && parameters[i] <= 107) // bright background colour
-                    {
-                        uint8_t index = parameters[i] - 100;
-                        if (index < 8) // ensure index is within bounds
-                        {
-                            lcd_set_background(bright_palette[index]);
-                        }
-                    }
-                }
-                break;
-            case 'n':                   // Device Status Report
-                if (parameters[0] == 5) // DSR - Device Status Report
-                {
-                    report("\033[0n");
-                }
-                else if (parameters[0] == 6) // DSR - Device Status Report
-                {
-                    char buf[16];
-                    snprintf(buf, sizeof(buf), "\033[%d;%dR", row + 1, column + 1);
-                    report(buf);
-                }
-                break;
-            case CHR_CAN:                      // cancel the current escape sequence
-            case CHR_SUB:                      // same as CAN
-                lcd_putc(column++, row, 0x02); // print a error character
-                break;
-            case 'q': // DECLL – Load LEDS (DEC Private)
-                for (uint8_t i = 0; i <= p_index; i++)
-                {
-                    if (parameters[i] == 0) // turn off all LEDs
-                    {
-                        leds = 0; // reset LED state
-                    }
-                    else if (parameters[i] > 0 && parameters[i] <= 8)
-                    {
-                        leds |= (1 << (parameters[i] - 1));
-                    }
-                }
-                update_leds(leds); // update the LEDs
-                break;
-            case 'r': // DECSTBM – Set Top and Bottom Margins
-                if (parameters[0] == 0)
-                {
-                    parameters[0] = 1; // default to 1 if not specified
-                }
-                if (parameters[1] == 0)
-                {
-                    parameters[1] = 1; // default to 1 if not specified
-                }
-                uint8_t top_row = MIN(parameters[0] - 1, max_row);
-                uint8_t bottom_row = MIN(parameters[1] - 1, max_row);
-                if (bottom_row > top_row)
-                {
-                    lcd_define_scrolling(top_row, max_row - bottom_row);
-                }
-                else
-                {
-                    lcd_scroll_reset();
-                }
-                row = top_row;
-                column = 0;
-                break;
-            case 's': // DECSC – Save Cursor (ANSI)
-                save_column = column;
-                save_row = row;
-                break;
-            case 't': // - Lines per page
-                // Not supported, ignore
-                break;
-            case 'u': // DECRC – Restore Cursor (ANSI)
-                column = save_column;
-                row = save_row;
-                break;
-            default:
-                lcd_putc(column++, row, 0x02); // print a error character
-                break;                         // ignore unknown sequences
+                lcd_erase_line(r, 0, max_col);
             }
+            lcd_erase_line(row, 0, column);
+        }
+        else if (parameters[0] == 2) // clear entire screen
+        {
+            lcd_clear_screen();
         }
         break;
-
-    case STATE_TMC:
-        switch (ch)
+    case 'K': // EL – Erase In Line
+        if (parameters[0] == 0)
         {
-        case 'p': // Soft reset
-            reset_terminal();
-
-            break;
+            // Erase from cursor to end of line
+            lcd_erase_line(row, column, max_col);
+        }
+        else if (parameters[0] == 1)
+        {
+            // Erase from start of line to cursor
+            lcd_erase_line(row, 0, column);
+        }
+        else if (parameters[0] == 2) // clear entire line
+        {
+            lcd_erase_line(row, 0, max_col);
         }
-        state = STATE_NORMAL;
         break;
-
-    case STATE_DEC: // in DEC private mode sequence
-        debug[debug_index++] = ch;
-        if (ch == CHR_ESC)
+    case 'S': // SU - Scroll Up
+        if (parameters[0] == 0)
+        {
+            parameters[0] = 1; // default to 1 if not specified
+        }
+        while (parameters[0]-- > 0)
+        {
+            lcd_scroll_up();
+        }
+        break;
+    case 'T': // SD - Scroll Down
+        if (parameters[0] == 0)
         {
-            state = STATE_ESCAPE;
-            break; // reset to escape state
+            parameters[0] = 1; // default to 1 if not specified
         }
-        else if (ch >= '0' && ch <= '9')
+        while (parameters[0]-- > 0)
         {
-            parameters[p_index] *= 10; // accumulate digits
-            parameters[p_index] += ch - '0';
+            lcd_scroll_down();
         }
-        else if (ch == ';') // delimiter
+        break;
+    case 'c': // DA - Device Attributes
+        report("\033[?1;c");
+        break;
+    case 'd': // VPA - Vertical Position Absolute
+        if (parameters[0] == 0)
+        {
+            parameters[0] = 1; // default to 1 if not specified
+        }
+        row = MIN(parameters[0] - 1, max_row);
+        break;
+    case 'e': // VPR - Vertical Position Relative
+        if (parameters[0] == 0)
         {
-            if (p_index < sizeof(parameters) - 1)
+            parameters[0] = 1; // default to 1 if not specified
+        }
+        row = MIN(row + parameters[0], max_row);
+        break;
+    case 'g': // TBC – Tabulation Clear
+        if (parameters[0] == 3)
+        {
+            // Clear all tab stops
+            memset(tab_stops, 0, sizeof(tab_stops));
+        }
+        else if (parameters[0] == 0)
+        {
+            // Clear tab stop at current column
+            if (column < sizeof(tab_stops))
             {
-                p_index++;
+                tab_stops[column] = false;
             }
         }
-        else // final character in DEC private mode sequence
+        break;
+    case 'l': // RM – Reset Mode
+    case 'h': // SM – Set Mode
+        break;
+    case 'm': // SGR – Select Graphic Rendition
+        select_graphic_rendition();
+        break;
+    case 'n':                   // Device Status Report
+        if (parameters[0] == 5) // DSR - Device Status Report
+        {
+            report("\033[0n");
+        }
+        else if (parameters[0] == 6) // DSR - Device Status Report
+        {
+            char buf[16];
+            snprintf(buf, sizeof(buf), "\033[%d;%dR", row + 1, column + 1);
+            report(buf);
+        }
+        break;
+    case 'q': // DECLL – Load LEDS (DEC Private)
+        for (uint8_t i = 0; i <= p_index; i++)
         {
-            state = STATE_NORMAL; // reset state after processing
-            switch (ch)
+            if (parameters[i] == 0) // turn off all LEDs
+            {
+                leds = 0; // reset LED state
+            }
+            else if (parameters[i] > 0 && parameters[i] <= 8)
             {
-            case 'h':                    // DECSET - DEC Private Mode Set
-                if (parameters[0] == 25) // DECTCEM - Text Cursor Enable Mode
-                {
-                    lcd_enable_cursor(true);
-                    lcd_draw_cursor();
-                }
-                else if (parameters[0] == 4264)
-                {
-                    // set 64 column mode
-                    lcd_set_font(&font_5x10);
-                }
-                break;
-            case 'l':                    // DECRST - DEC Private Mode Reset
-                if (parameters[0] == 25) // DECTCEM - Text Cursor Enable Mode
-                {
-                    lcd_enable_cursor(false);
-                    lcd_erase_cursor(); // immediately hide cursor
-                }
-                else if (parameters[0] == 4264)
-                {
-                    // set 64 column mode
-                    lcd_set_font(&font_8x10);
-                }
-                break;
-            case 'm':
-                // Ignore for now
-                break;
-            default:
-                lcd_putc(column++, row, 0x01); // print a error character
-                break;                         // ignore unknown DEC private mode sequences
+                leds |= (1 << (parameters[i] - 1));
             }
         }
+        update_leds(leds); // update the LEDs
         break;
-
-    case STATE_G0_SET:        // Setting G0 character set
-        state = STATE_NORMAL; // return to normal state after processing
-        switch (ch)
+    case 'r': // DECSTBM – Set Top and Bottom Margins
+        if (parameters[0] == 0)
+        {
+            parameters[0] = 1; // default to 1 if not specified
+        }
+        if (parameters[1] == 0)
+        {
+            parameters[1] = 1; // default to 1 if not specified
+        }
+        uint8_t top_row = MIN(parameters[0] - 1, max_row);
+        uint8_t bottom_row = MIN(parameters[1] - 1, max_row);
+        if (bottom_row > top_row)
         {
-        case 'A': // UK character set
-            set_g0_charset(CHARSET_UK);
-            break;
-        case 'B': // ASCII character set
-            set_g0_charset(CHARSET_ASCII);
-            break;
-        case '0': // DEC Special Character Set
-            set_g0_charset(CHARSET_DEC);
-            break;
-        default:
-            // Unknown character set, ignore
-            break;
+            lcd_define_scrolling(top_row, max_row - bottom_row);
         }
+        else
+        {
+            lcd_scroll_reset();
+        }
+        row = top_row;
+        column = 0;
         break;
+    case 's': // DECSC – Save Cursor (ANSI)
+        save_column = column;
+        save_row = row;
+        break;
+    case 't': // - Lines per page
+        // Not supported, ignore
+        break;
+    case 'u': // DECRC – Restore Cursor (ANSI)
+        column = save_column;
+        row = save_row;
+        break;
+    default:
+        lcd_putc(column++, row, 0x02); // print a error character
+        break;                         // ignore unknown sequences
+    }
+}
 
-    case STATE_G1_SET:        // Setting G1 character set
-        state = STATE_NORMAL; // return to normal state after processing
-        switch (ch)
+// Final character of a DEC private mode sequence
+static void dec_dispatch(uint8_t ch)
+{
+    switch (ch)
+    {
+    case 'h':                    // DECSET - DEC Private Mode Set
+        if (parameters[0] == 25) // DECTCEM - Text Cursor Enable Mode
         {
-        case 'A': // UK character set
-            set_g1_charset(CHARSET_UK);
-            break;
-        case 'B': // ASCII character set
-            set_g1_charset(CHARSET_ASCII);
-            break;
-        case '0': // DEC Special Character Set
-            set_g1_charset(CHARSET_DEC);
-            break;
-        default:
-            // Unknown character set, ignore
-            break;
+            lcd_enable_cursor(true); // shown when the output is flushed
+        }
+        else if (parameters[0] == 4264)
+        {
+            // set 64 column mode
+            lcd_set_font(&font_5x10);
         }
         break;
-
-    case STATE_OSC: // in Operating System Command
-        if (ch == CHR_ESC)
+    case 'l':                    // DECRST - DEC Private Mode Reset
+        if (parameters[0] == 25) // DECTCEM - Text Cursor Enable Mode
         {
-            state = STATE_OSC_ESC;
+            lcd_enable_cursor(false); // also hides the cursor immediately
         }
-        else if (ch == '\007' || ch == 0x9C)
+        else if (parameters[0] == 4264)
         {
-            state = STATE_NORMAL; // reset state after processing the OSC sequence
+            // set 64 column mode
+            lcd_set_font(&font_8x10);
         }
         break;
+    case 'm':
+        // Ignore for now
+        break;
+    default:
+        lcd_putc(column++, row, 0x01); // print a error character
+        break;                         // ignore unknown DEC private mode sequences
+    }
+}
+
+// Select a character set from the final character of an SCS sequence
+static uint8_t select_charset(uint8_t ch, uint8_t charset)
+{
+    switch (ch)
+    {
+    case 'A': // UK character set
+        return CHARSET_UK;
+    case 'B': // ASCII character set
+        return CHARSET_ASCII;
+    case '0': // DEC Special Character Set
+        return CHARSET_DEC;
+    default:
+        return charset; // Unknown character set, ignore
+    }
+}
+
+//
+//  Inline images
+//
+//  A subset of the kitty graphics protocol, so that anything that prints to
+//  the console can also draw pictures:
+//
+//      ESC _ G <key>=<value>,... ; <base64 payload> ST
+//
+//  where ST is ESC \ or BEL. Keys:
+//
+//      f   pixel format: 16 (RGB565, little-endian), 24 (RGB) or 32 (RGBA,
+//          alpha ignored), default 32
+//      s   width in pixels
+//      v   height in pixels
+//      o   r if the pixels are run-length encoded (see below)
+//      m   1 if more chunks follow, later chunks carry only m and payload
+//      a   action, only T (transmit and display) is supported, and assumed
+//
+//  A chunk that carries any other key while an image is still expecting
+//  more starts a new image, so an abandoned m=1 transmission does not
+//  swallow the next one. Malformed control data or payload, or a chunk
+//  cancelled with CAN, SUB or a stray ESC, drops the image.
+//
+//  The image is drawn with its top-left corner at the cursor, after
+//  scrolling the screen if it would not fit, and the cursor moves to the
+//  start of the line below it. Pixels are decoded as they arrive and sent
+//  to the LCD a row at a time, so only one row is held in memory. Anything
+//  wider than the screen is clipped. Images that cannot be shown are
+//  skipped.
+//
+//  With o=r the pixels are run-length encoded like the chunks of a tile map:
+//  a control byte n is followed either by one pixel repeated (n & 0x7F) + 1
+//  times if bit 7 is set, or by n + 1 literal pixels.
+//
+
+typedef struct
+{
+    bool active;             // an image is being received, possibly over several chunks
+    bool placed;             // the image has a place on the screen
+    bool payload;            // in the payload of the current chunk
+    bool valid;              // the image can be shown
+    bool more;               // more chunks follow this one
+    bool continued;          // this chunk continues an earlier one
+    char key;                // control key being read, 0 between keys
+    bool assigned;           // the = of the control key has been read
+    uint32_t value;          // value of the control key being read
+    uint8_t format;          // bits per pixel (16, 24 or 32)
+    bool rle;                // pixels are run-length encoded
+    uint16_t width;          // image size in pixels
+    uint16_t height;
+    uint16_t x;              // screen position of the top-left pixel
+    uint16_t y;
+    uint16_t visible_width;  // part of the image that fits on the screen
+    uint16_t visible_height;
+    uint16_t line;           // next pixel to draw
+    uint16_t pixel;
+    uint32_t bits;           // base64 decoder
+    uint8_t bit_count;
+    uint8_t bytes[4];        // bytes of the pixel being received
+    uint8_t byte_count;
+    uint8_t run;             // pixels left in the current run
+    bool repeat;             // the current run repeats one pixel
+} inline_image_t;
+
+static inline_image_t image;
+static uint16_t image_row[WIDTH]; // one row of the image on its way to the LCD
 
-    case STATE_OSC_ESC: // in OSC escape sequence
-        state = ch == '\\' ? STATE_NORMAL : STATE_OSC;
+static int8_t base64_value(uint8_t ch)
+{
+    if (ch >= 'A' && ch <= 'Z')
+        return ch - 'A';
+    if (ch >= 'a' && ch <= 'z')
+        return ch - 'a' + 26;
+    if (ch >= '0' && ch <= '9')
+        return ch - '0' + 52;
+    if (ch == '+')
+        return 62;
+    if (ch == '/')
+        return 63;
+    return -1;
+}
+
+static void image_reset()
+{
+    memset(&image, 0, sizeof(image));
+    image.active = true;
+    image.valid = true;
+    image.format = 32;
+}
+
+// Drop the image and skip the rest of the chunk
+static void image_abort()
+{
+    memset(&image, 0, sizeof(image));
+    image.payload = true; // the rest is ignored as the payload of an invalid image
+}
+
+// ESC _ G: start of a chunk
+static void image_start_chunk()
+{
+    image.continued = image.active;
+    if (!image.active)
+    {
+        image_reset();
+    }
+    image.payload = false;
+    image.more = false;
+    image.key = 0;
+}
+
+static void image_set_key(char key, uint32_t value)
+{
+    if (key == 'm')
+    {
+        image.more = value == 1;
+        return;
+    }
+    if (key == 'q')
+    {
+        return; // quiet mode, there are no responses to suppress
+    }
+    if (image.continued)
+    {
+        // Only m (and q) may follow the first chunk, this is a new image
+        bool more = image.more;
+        image_reset();
+        image.more = more;
+    }
+
+    switch (key)
+    {
+    case 'a':
+        image.valid &= value == 'T';
+        break;
+    case 'f':
+        image.valid &= value <= UINT8_MAX; // before the store, so 272 cannot wrap to 16
+        image.format = value;
         break;
+    case 's':
+        image.width = value;
+        break;
+    case 'v':
+        image.height = value;
+        break;
+    case 'o':
+        image.rle = value == 'r';
+        image.valid &= image.rle; // no other compression is supported
+        break;
+    default:
+        break; // other keys are ignored
+    }
+}
+
+// Start of the payload, the first time through place the image below the cursor
+static void image_begin_payload()
+{
+    image.payload = true;
+    if (image.placed || !image.valid)
+    {
+        return;
+    }
+
+    image.placed = true;
+    if ((image.format != 16 && image.format != 24 && image.format != 32) || image.width == 0 || image.height == 0)
+    {
+        image.valid = false;
+        return;
+    }
+
+    // Make room for the image, leaving a line below it for the cursor
+    lcd_erase_cursor();
+    int rows = MIN((image.height + GLYPH_HEIGHT - 1) / GLYPH_HEIGHT, MAX_ROW);
+    while (row + rows > MAX_ROW)
+    {
+        lcd_scroll_up();
+        row--;
+    }
+
+    image.x = column * lcd_get_glyph_width();
+    image.y = row * GLYPH_HEIGHT;
+    image.visible_width = MIN(image.width, WIDTH - image.x);
+    image.visible_height = MIN(image.height, rows * GLYPH_HEIGHT);
+
+    column = 0;
+    row += rows;
+    lcd_move_cursor(column, row);
+}
+
+static void image_control(uint8_t ch)
+{
+    if (ch == ',' || ch == ';')
+    {
+        if (image.key)
+        {
+            image_set_key(image.key, image.value);
+        }
+        image.key = 0;
+        if (ch == ';')
+        {
+            image_begin_payload();
+        }
+    }
+    else if (image.key == 0)
+    {
+        if (!isalpha(ch))
+        {
+            image_abort(); // keys are single letters
+            return;
+        }
+        image.key = ch;
+        image.value = 0;
+        image.assigned = false;
+    }
+    else if (!image.assigned)
+    {
+        if (ch != '=')
+        {
+            image_abort();
+            return;
+        }
+        image.assigned = true;
+    }
+    else if (ch >= '0' && ch <= '9')
+    {
+        image.value = MIN(image.value * 10 + (ch - '0'), UINT16_MAX);
+    }
+    else if (isalpha(ch))
+    {
+        image.value = ch; // single letter values (a=T, o=r)
+    }
+    else
+    {
+        image_abort();
+    }
+}
+
+static void image_put_pixel(uint16_t colour)
+{
+    if (image.line >= image.height)
+    {
+        return; // extra data is ignored
+    }
+
+    if (image.pixel < image.visible_width)
+    {
+        image_row[image.pixel] = colour;
+    }
+    if (++image.pixel == image.width)
+    {
+        if (image.line < image.visible_height)
+        {
+            lcd_blit(image_row, image.x, image.y + image.line, image.visible_width, 1);
+        }
+        image.pixel = 0;
+        image.line++;
+    }
+}
+
+static void image_put_byte(uint8_t byte)
+{
+    if (image.rle && image.run == 0)
+    {
+        image.repeat = byte & 0x80;
+        image.run = (byte & 0x7F) + 1;
+        return;
+    }
+
+    image.bytes[image.byte_count++] = byte;
+    if (image.byte_count < image.format / 8)
+    {
+        return;
+    }
+    image.byte_count = 0;
 
-    case STATE_NORMAL:
+    uint16_t colour = image.format == 16 ? image.bytes[0] | image.bytes[1] << 8
+                                         : RGB(image.bytes[0], image.bytes[1], image.bytes[2]);
+    if (!image.rle)
+    {
+        image_put_pixel(colour);
+    }
+    else if (image.repeat)
+    {
+        while (image.run > 0)
+        {
+            image_put_pixel(colour);
+            image.run--;
+        }
+    }
+    else
+    {
+        image_put_pixel(colour);
+        image.run--;
+    }
+}
+
+// A character of the control data or the payload
+static void image_put(uint8_t ch)
+{
+    if (!image.payload)
+    {
+        image_control(ch);
+        return;
+    }
+    if (!image.valid)
+    {
+        return;
+    }
+
+    int8_t value = base64_value(ch);
+    if (value < 0)
+    {
+        if (ch == '=')
+        {
+            image.bit_count = 0; // padding ends the data of a chunk
+        }
+        else if (ch != '\r' && ch != '\n')
+        {
+            image_abort(); // line breaks are skipped, anything else is an error
+        }
+        return;
+    }
+
+    image.bits = image.bits << 6 | value;
+    image.bit_count += 6;
+    if (image.bit_count >= 8)
+    {
+        image.bit_count -= 8;
+        image_put_byte(image.bits >> image.bit_count);
+    }
+}
+
+// ESC \ (or BEL or ST): end of a chunk, CAN, SUB or ESC and anything else cancel it
+static void image_end_chunk(uint8_t ch)
+{
+    if (ch != '\\' && ch != CHR_BEL && ch != 0x9C)
+    {
+        image_abort();
+    }
+    if (!image.payload && image.key)
+    {
+        image_set_key(image.key, image.value);
+    }
+    if (!image.more)
+    {
+        image.active = false; // the last chunk
+    }
+}
+
+//
+// Display API
+//
+
+bool display_emit_available()
+{
+    return true; // always available for output in this implementation
+}
+
+void display_emit(char c)
+{
+    uint8_t ch = (uint8_t)c;
+    uint8_t transition = transitions[state][char_class[ch]];
+    uint8_t action = T_ACTION(transition);
+    state = T_STATE(transition);
+
+    // Collecting a sequence does not touch the display, and images place themselves
+    switch (action)
+    {
+    case ACTION_NONE:
+        return;
+    case ACTION_IMAGE_START:
+        if (ch == 'G')
+        {
+            image_start_chunk();
+        }
+        else
+        {
+            state = STATE_OSC; // some other APC string, ignore it
+        }
+        return;
+    case ACTION_IMAGE:
+        image_put(ch);
+        return;
+    case ACTION_IMAGE_END:
+        image_end_chunk(ch);
+        return;
+    case ACTION_PARAM:
+    {
+        uint32_t value = parameters[p_index] * 10 + (ch - '0');
+        parameters[p_index] = MIN(value, UINT16_MAX); // saturate rather than wrap
+        return;
+    }
+    case ACTION_NEXT_PARAM:
+        if (p_index < MAX_PARAMETERS - 1)
+        {
+            p_index++;
+        }
+        parameters[p_index] = 0; // extra parameters overwrite the last one
+        return;
+    case ACTION_CLEAR:
+        p_index = 0;
+        memset(parameters, 0, sizeof(parameters));
+        return;
     default:
-        // Normal/default state, process characters directly
-        switch (ch)
-        {
-        case CHR_BS:
-            column = MAX(0, column - 1); // move cursor back one space (but not before the start of the line)
-            break;
-        case CHR_BEL:
-            ring_bell(); // ring the bell
-            break;
-        case CHR_HT:
-            column = MIN(((column + 8) & ~7), lcd_get_columns() - 1); // move cursor to next tabstop (but not beyond the end of the line)
-            break;
-        case CHR_LF:
-        case CHR_VT:
-        case CHR_FF:
-            row++; // move cursor down one line
-            break;
-        case CHR_CR:
-            column = 0; // move cursor to the start of the line
-            break;
-        case CHR_SO: // Shift Out - select G1 character set
-            set_charset(G1_CHARSET);
-            break;
-        case CHR_SI: // Shift In - select G0 character set
-            set_charset(G0_CHARSET);
-            break;
-        case CHR_ESC:
-            state = STATE_ESCAPE;
-            break;
-        default:
-            if (ch >= 0x20 && ch < 0x7F) // printable characters
-            {
-                // Translate character based on active character set
-                if (get_charset() == CHARSET_UK && ch == '#')
-                {
-                    // Replace '#' with the pound sign in UK character set
-                    ch = 0x1E;
-                }
-                else if (get_charset() == CHARSET_DEC && ch >= 0x5F && ch <= 0x7E)
-                {
-                    // Maps characters 0x5F - 0x7E to DEC Special Character Set
-                    ch -= 0x5F;
-                }
-
-                lcd_putc(column++, row, ch);
-            }
-            break;
+        break;
+    }
+
+    lcd_erase_cursor(); // erase the cursor before processing the character
+
+    switch (action)
+    {
+    case ACTION_PRINT:
+        print_char(ch);
+        break;
+    case ACTION_EXECUTE:
+        execute(ch);
+        break;
+    case ACTION_ESC:
+        esc_dispatch(ch);
+        break;
+    case ACTION_CSI:
+        csi_dispatch(ch);
+        break;
+    case ACTION_DEC:
+        dec_dispatch(ch);
+        break;
+    case ACTION_TMC:
+        if (ch == 'p') // Soft reset
+        {
+            reset_terminal();
         }
         break;
+    case ACTION_G0_SET:
+        set_g0_charset(select_charset(ch, g0_charset));
+        break;
+    case ACTION_G1_SET:
+        set_g1_charset(select_charset(ch, g1_charset));
+        break;
+    case ACTION_CANCEL:
+        lcd_putc(column++, row, 0x02); // print a error character
+        break;
     }
 
     // Handle wrapping and scrolling
-    if (column > max_col) // wrap around at end of the line
+    if (column > lcd_get_columns() - 1) // wrap around at end of the line
     {
         column = 0;
         row++;
     }
 
-    if (row > max_row) // scroll at bottom of the screen
+    while (row > MAX_ROW) // scroll at bottom of the screen until y is within bounds
     {
-        while (row > max_row) // scroll until y is within bounds
-        {
-            lcd_scroll_up(); // scroll up to make space at the bottom
-            row--;
-        }
+        lcd_scroll_up(); // scroll up to make space at the bottom
+        row--;
     }
 
-    // Update cursor position
+    // Update cursor position, the cursor is drawn when the output is flushed or input is awaited
     lcd_move_cursor(column, row);
-    lcd_draw_cursor(); // draw the cursor at the new position
 }
 
 //
@@ -854,6 +1317,7 @@ void display_init()
 {
     // Make sure the LCD is initialized
     lcd_init();
+    mem_register_static("display image row", sizeof(image_row));
 
     // Set tab stops every 8 columns by default
     for (int i = 3; i < 64; i += 8)
@@ -14,6 +14,9 @@
 #define STATE_OSC       (6)             // Operating System Command (OSC)
 #define STATE_OSC_ESC   (7)             // Operating System Command (OSC) ESC
 #define STATE_TMC       (8)             // Terminal Management Control (TMC)
+#define STATE_APC       (9)             // Application Program Command (APC), may be an image
+#define STATE_IMAGE     (10)            // inline image (APC G)
+#define STATE_IMAGE_ESC (11)            // inline image ESC
 
 // Control characters
 #define CHR_BEL         (0x07)          // Bell
@@ -0,0 +1,196 @@
+//
+//  Display power manager for the PicoCalc
+//
+//  Lowers the display power while the device waits for input:
+//
+//    - after the idle timeout the LCD switches to idle mode (8 colours at
+//      a reduced frame rate), and to partial mode if always-on rows are
+//      set, so only those rows stay lit
+//    - after the sleep timeout the LCD controller goes to sleep and the
+//      display and keyboard backlights are turned off
+//    - a key press returns the display to normal
+//
+//  The LCD frame memory is kept in every state, so resuming needs no
+//  redraw. The keyboard driver calls the input hooks while it waits for
+//  a key, so state changes are made by core 0 outside interrupts. The
+//  graphics core inhibits the manager while it is drawing to the LCD.
+//
+
+#include "pico/stdlib.h"
+
+#include "dpm.h"
+#include "lcd.h"
+#include "southbridge.h"
+
+static dpm_state_t state = DPM_ACTIVE;
+static uint16_t idle_timeout_s = DPM_IDLE_TIMEOUT_S;
+static uint16_t sleep_timeout_s = DPM_SLEEP_TIMEOUT_S;
+static bool inhibited = false;
+
+static bool always_on = false;              // show only the always-on rows while idle
+static uint16_t always_on_first_row = 0;
+static uint16_t always_on_last_row = 0;
+
+static uint8_t lcd_backlight = 0;           // backlight levels saved while asleep
+static uint8_t keyboard_backlight = 0;
+
+
+//
+// State changes
+//
+
+static void enter_idle(void)
+{
+    lcd_set_idle_mode(true);
+    if (always_on)
+    {
+        lcd_set_partial_rows(always_on_first_row, always_on_last_row);
+    }
+}
+
+static void leave_idle(void)
+{
+    if (always_on)
+    {
+        lcd_set_normal_mode();
+    }
+    lcd_set_idle_mode(false);
+}
+
+static void enter_sleep(void)
+{
+    lcd_backlight = sb_read_lcd_backlight();
+    keyboard_backlight = sb_read_keyboard_backlight();
+    sb_write_lcd_backlight(0);
+    sb_write_keyboard_backlight(0);
+    lcd_sleep();
+}
+
+static void leave_sleep(void)
+{
+    lcd_wake();
+    sb_write_lcd_backlight(lcd_backlight);
+    sb_write_keyboard_backlight(keyboard_backlight);
+}
+
+// Move to a new state, going through active so each mode is undone
+void dpm_set_state(dpm_state_t new_state)
+{
+    if (new_state == state)
+    {
+        return;
+    }
+
+    if (state == DPM_IDLE)
+    {
+        leave_idle();
+    }
+    else if (state == DPM_SLEEP)
+    {
+        leave_sleep();
+    }
+
+    if (new_state == DPM_IDLE)
+    {
+        enter_idle();
+    }
+    else if (new_state == DPM_SLEEP)
+    {
+        enter_sleep();
+    }
+
+    state = new_state;
+}
+
+dpm_state_t dpm_get_state(void)
+{
+    return state;
+}
+
+
+//
+// Configuration
+//
+
+// Set the timeouts in seconds (0 disables that state)
+void dpm_set_timeouts(uint16_t idle_seconds, uint16_t sleep_seconds)
+{
+    idle_timeout_s = idle_seconds;
+    sleep_timeout_s = sleep_seconds;
+}
+
+uint16_t dpm_get_idle_timeout(void)
+{
+    return idle_timeout_s;
+}
+
+uint16_t dpm_get_sleep_timeout(void)
+{
+    return sleep_timeout_s;
+}
+
+// Stop state changes while another core is drawing to the LCD
+void dpm_inhibit(bool inhibit)
+{
+    inhibited = inhibit;
+}
+
+
+//
+// Always-on display
+//
+
+// Keep the screen rows first_row..last_row (in pixels) lit while idle; the
+// display does not go to sleep while always-on rows are set
+void dpm_set_always_on_rows(uint16_t first_row, uint16_t last_row)
+{
+    always_on_first_row = first_row;
+    always_on_last_row = last_row;
+    always_on = true;
+
+    if (state == DPM_IDLE)
+    {
+        lcd_set_partial_rows(first_row, last_row);
+    }
+}
+
+void dpm_clear_always_on(void)
+{
+    if (always_on && state == DPM_IDLE)
+    {
+        lcd_set_normal_mode();
+    }
+    always_on = false;
+}
+
+
+//
+// Input hooks
+//
+
+// Called while waiting for input, with the time waited so far
+void dpm_input_wait(uint32_t waited_ms)
+{
+    if (inhibited)
+    {
+        return;
+    }
+
+    if (sleep_timeout_s && !always_on && waited_ms >= sleep_timeout_s * 1000u)
+    {
+        dpm_set_state(DPM_SLEEP);
+    }
+    else if (idle_timeout_s && state == DPM_ACTIVE && waited_ms >= idle_timeout_s * 1000u)
+    {
+        dpm_set_state(DPM_IDLE);
+    }
+}
+
+// Called when input arrives, returns true if the display was asleep (the
+// input only woke it up)
+bool dpm_input_resume(void)
+{
+    bool was_asleep = state == DPM_SLEEP;
+    dpm_set_state(DPM_ACTIVE);
+    return was_asleep;
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "pico/stdlib.h"
+
+#define DPM_IDLE_TIMEOUT_S  (60)        // seconds without input before idle mode
+#define DPM_SLEEP_TIMEOUT_S (300)       // seconds without input before sleep
+
+// Display power states
+typedef enum
+{
+    DPM_ACTIVE = 0,                     // full colour, normal frame rate
+    DPM_IDLE,                           // 8 colours, reduced frame rate (partial if always-on rows are set)
+    DPM_SLEEP                           // controller asleep, backlights off
+} dpm_state_t;
+
+// Configuration
+void dpm_set_timeouts(uint16_t idle_seconds, uint16_t sleep_seconds);
+uint16_t dpm_get_idle_timeout(void);
+uint16_t dpm_get_sleep_timeout(void);
+void dpm_inhibit(bool inhibit);
+
+// Always-on display
+void dpm_set_always_on_rows(uint16_t first_row, uint16_t last_row);
+void dpm_clear_always_on(void);
+
+// State
+dpm_state_t dpm_get_state(void);
+void dpm_set_state(dpm_state_t state);
+
+// Input hooks
+void dpm_input_wait(uint32_t waited_ms);
+bool dpm_input_resume(void);
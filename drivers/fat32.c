@@ -20,6 +20,7 @@
 
 #include "sdcard.h"
 #include "fat32.h"
+#include "memstat.h"
 
 #define RETURN_ON_ERROR(expr)        \
     {                                \
@@ -50,27 +51,126 @@ static fat32_boot_sector_t boot_sector;
 static fat32_fsinfo_t fsinfo;
 
 static uint32_t volume_start_block = 0; // First block of the volume
+static uint64_t volume_sectors;         // Size of the volume in sectors
+static uint32_t fat_start_sector;       // First sector of the FAT in use
 static uint32_t first_data_sector;      // First sector of the data region
 static uint32_t data_region_sectors;    // Total sectors in the data region
 static uint32_t cluster_count;          // Total number of clusters in the data region
+static uint32_t sectors_per_cluster;
 static uint32_t bytes_per_cluster;
+static uint32_t root_cluster;           // First cluster of the root directory
+
+// exFAT file system state
+static bool volume_exfat = false;                  // The volume is exFAT rather than FAT32
+static uint32_t exfat_bitmap_cluster;              // First cluster of the allocation bitmap
+static bool exfat_bitmap_contiguous;               // The bitmap clusters follow each other
+static uint32_t exfat_free_count = 0xFFFFFFFF;     // Free clusters, 0xFFFFFFFF until counted
+static uint32_t exfat_next_free = 2;               // Where to start looking for a free cluster
+static char exfat_current_dir[FAT32_MAX_PATH_LEN]; // exFAT directories have no ".." entries
 
 static uint32_t current_dir_cluster = 0; // Current directory cluster
 
 // Working buffers
 static uint8_t sector_buffer[FAT32_SECTOR_SIZE] __attribute__((aligned(4)));
-static fat32_lfn_entry_t lfn_buffer[MAX_LFN_PART]; // Buffer for long file name entries
+static union
+{
+    fat32_lfn_entry_t lfn[MAX_LFN_PART];                // Long file name entries (FAT32)
+    exfat_dir_entry_t exfat_set[EXFAT_MAX_SET_ENTRIES]; // Entry set being read or written (exFAT)
+} entry_buffer;
 
 // Timer for SD card detection
 static repeating_timer_t sd_card_detect_timer;
 
+//
+//  Sector cache
+//
+
+#define CACHE_EMPTY (0xFFFFFFFF)
+
+typedef struct
+{
+    uint32_t block;     // SD card block held, or CACHE_EMPTY
+    uint32_t last_used; // for least-recently-used replacement
+    uint8_t pins;       // mapped windows covering the slot; pinned slots are never replaced
+} cache_slot_t;
+
+typedef struct
+{
+    const uint8_t *ptr; // pointer fat32_map returned, NULL if the entry is free
+    uint8_t slot;       // first slot of the window
+    uint8_t count;      // slots it covers
+} cache_map_t;
+
+// One array, so a window over consecutive sectors can be held in slots next to each other
+static uint8_t cache_data[FAT32_CACHE_SECTORS][FAT32_SECTOR_SIZE] __attribute__((aligned(4)));
+static cache_slot_t cache_slots[FAT32_CACHE_SECTORS];
+static cache_map_t cache_maps[FAT32_MAX_MAPS];
+static uint32_t cache_clock = 0;
+static uint32_t cache_pinned = 0; // slots with at least one pin
+
+static void cache_clear(void)
+{
+    for (int i = 0; i < FAT32_CACHE_SECTORS; i++)
+    {
+        cache_slots[i].block = CACHE_EMPTY;
+        cache_slots[i].last_used = 0;
+        cache_slots[i].pins = 0;
+    }
+    memset(cache_maps, 0, sizeof(cache_maps));
+    cache_pinned = 0;
+}
+
+// Keep the cached copies of blocks being written in step with the card
+static void cache_write(uint32_t block, uint32_t count, const uint8_t *data)
+{
+    for (int i = 0; i < FAT32_CACHE_SECTORS; i++)
+    {
+        uint32_t cached = cache_slots[i].block;
+        if (cached != CACHE_EMPTY && cached - block < count)
+        {
+            memcpy(cache_data[i], data + (cached - block) * FAT32_SECTOR_SIZE, FAT32_SECTOR_SIZE);
+        }
+    }
+}
+
+// Find the cached copy of a block, reading it into the least recently used slot that is
+// not pinned if there is none
+static fat32_error_t cache_read(uint32_t block, const uint8_t **data)
+{
+    int victim = -1;
+    cache_clock++;
+    for (int i = 0; i < FAT32_CACHE_SECTORS; i++)
+    {
+        cache_slot_t *slot = &cache_slots[i];
+        if (slot->block == block)
+        {
+            slot->last_used = cache_clock;
+            *data = cache_data[i];
+            return FAT32_OK;
+        }
+        if (slot->pins == 0 && (victim < 0 || slot->last_used < cache_slots[victim].last_used))
+        {
+            victim = i;
+        }
+    }
+
+    // There is always a victim, as windows pin at most FAT32_MAP_MAX_PINNED slots
+    cache_slot_t *slot = &cache_slots[victim];
+    slot->block = CACHE_EMPTY;
+    RETURN_ON_ERROR(sd_read_block(block, cache_data[victim]));
+    slot->block = block;
+    slot->last_used = cache_clock;
+    *data = cache_data[victim];
+    return FAT32_OK;
+}
+
 //
 //  Sector-level access functions
 //
 
 static inline uint32_t cluster_to_sector(uint32_t cluster)
 {
-    return ((cluster - 2) * boot_sector.sectors_per_cluster) + first_data_sector;
+    return ((cluster - 2) * sectors_per_cluster) + first_data_sector;
 }
 
 static inline fat32_error_t read_sector(uint32_t sector, uint8_t *buffer)
@@ -80,9 +180,17 @@ static inline fat32_error_t read_sector(uint32_t sector, uint8_t *buffer)
 
 static inline fat32_error_t write_sector(uint32_t sector, const uint8_t *buffer)
 {
+    cache_write(volume_start_block + sector, 1, buffer);
     return sd_write_block(volume_start_block + sector, buffer);
 }
 
+// Write consecutive blocks with one command (absolute block numbers, like sd_write_blocks)
+static inline fat32_error_t write_blocks(uint32_t block, uint32_t count, const uint8_t *buffer)
+{
+    cache_write(block, count, buffer);
+    return sd_write_blocks(block, count, buffer);
+}
+
 //
 // FAT32 file system functions
 //
@@ -131,6 +239,12 @@ static bool is_sector_boot_sector(const uint8_t *sector)
     return true;
 }
 
+static bool is_sector_exfat(const uint8_t *sector)
+{
+    // Check for 0x55AA signature and the exFAT file system name
+    return sector[510] == 0x55 && sector[511] == 0xAA && memcmp(sector + 3, "EXFAT   ", 8) == 0;
+}
+
 static fat32_error_t is_valid_fat32_boot_sector(const fat32_boot_sector_t *bs)
 {
     // Check bytes per sector - this is critical
@@ -178,6 +292,19 @@ static fat32_error_t update_fsinfo()
     return write_sector(boot_sector.fat32_info, (const uint8_t *)&fsinfo);
 }
 
+#define FAT_ENTRIES_PER_SECTOR (FAT32_SECTOR_SIZE / 4)
+
+// The value to store in a FAT entry. FAT32 keeps the upper four bits of the old entry,
+// exFAT uses all 32 bits and ends chains with EXFAT_FAT_ENTRY_EOC.
+static inline uint32_t fat_entry_value(uint32_t old_entry, uint32_t value)
+{
+    if (volume_exfat)
+    {
+        return value >= FAT32_FAT_ENTRY_EOC ? EXFAT_FAT_ENTRY_EOC : value;
+    }
+    return (old_entry & 0xF0000000) | (value & 0x0FFFFFFF);
+}
+
 static fat32_error_t read_cluster_fat_entry(uint32_t cluster, uint32_t *value)
 {
     // The first data cluster is 2, less than 2 is invalid
@@ -187,14 +314,14 @@ static fat32_error_t read_cluster_fat_entry(uint32_t cluster, uint32_t *value)
     }
 
     uint32_t fat_offset = cluster * 4; // 4 bytes per entry in FAT32
-    uint32_t fat_sector = boot_sector.reserved_sectors + (fat_offset / FAT32_SECTOR_SIZE);
+    uint32_t fat_sector = fat_start_sector + (fat_offset / FAT32_SECTOR_SIZE);
     uint32_t entry_offset = fat_offset % FAT32_SECTOR_SIZE;
 
     // Read the FAT sector
     RETURN_ON_ERROR(read_sector(fat_sector, sector_buffer));
 
     uint32_t entry = *(uint32_t *)(sector_buffer + entry_offset);
-    *value = entry & 0x0FFFFFFF; // Mask out upper 4 bits for FAT32
+    *value = volume_exfat ? entry : entry & 0x0FFFFFFF; // Mask out upper 4 bits for FAT32
     return FAT32_OK;
 }
 
@@ -207,15 +334,15 @@ static fat32_error_t write_cluster_fat_entry(uint32_t cluster, uint32_t value)
     }
 
     uint32_t fat_offset = cluster * 4; // 4 bytes per entry in FAT32
-    uint32_t fat_sector = boot_sector.reserved_sectors + (fat_offset / FAT32_SECTOR_SIZE);
+    uint32_t fat_sector = fat_start_sector + (fat_offset / FAT32_SECTOR_SIZE);
     uint32_t entry_offset = fat_offset % FAT32_SECTOR_SIZE;
 
     // Read the FAT sector
     RETURN_ON_ERROR(read_sector(fat_sector, sector_buffer));
 
     // Write the FAT entry
-    *(uint32_t *)(sector_buffer + entry_offset) &= 0xF0000000;
-    *(uint32_t *)(sector_buffer + entry_offset) |= value & 0x0FFFFFFF;
+    uint32_t *entry = (uint32_t *)(sector_buffer + entry_offset);
+    *entry = fat_entry_value(*entry, value);
 
     // Write the modified sector back
     RETURN_ON_ERROR(write_sector(fat_sector, sector_buffer));
@@ -306,11 +433,35 @@ static fat32_error_t allocate_and_link_cluster(uint32_t last_cluster, uint32_t *
     return FAT32_OK;
 }
 
+// Link count consecutive clusters from first into one chain, writing each FAT sector once
+static fat32_error_t link_run(uint32_t first, uint32_t count, uint8_t *buffer)
+{
+    uint32_t last = first + count - 1;
+    uint32_t cluster = first;
+    while (cluster <= last)
+    {
+        uint32_t fat_sector = fat_start_sector + cluster / FAT_ENTRIES_PER_SECTOR;
+        RETURN_ON_ERROR(read_sector(fat_sector, buffer));
+
+        uint32_t *entries = (uint32_t *)buffer;
+        do
+        {
+            uint32_t value = cluster == last ? FAT32_FAT_ENTRY_EOC : cluster + 1;
+            uint32_t *entry = &entries[cluster % FAT_ENTRIES_PER_SECTOR];
+            *entry = fat_entry_value(*entry, value);
+            cluster++;
+        } while (cluster <= last && cluster % FAT_ENTRIES_PER_SECTOR != 0);
+
+        RETURN_ON_ERROR(write_sector(fat_sector, buffer));
+    }
+    return FAT32_OK;
+}
+
 static fat32_error_t clear_cluster(uint32_t cluster)
 {
     uint32_t sector = cluster_to_sector(cluster);
     memset(sector_buffer, 0, FAT32_SECTOR_SIZE);
-    for (uint32_t i = 0; i < boot_sector.sectors_per_cluster; i++)
+    for (uint32_t i = 0; i < sectors_per_cluster; i++)
     {
         RETURN_ON_ERROR(write_sector(sector + i, sector_buffer));
     }
@@ -334,1357 +485,3251 @@ static fat32_error_t seek_to_cluster(uint32_t start_cluster, uint32_t offset, ui
     return FAT32_OK;
 }
 
-//
-// Mount the SD Card functions
-//
-
-fat32_error_t fat32_mount(void)
+// Find the cluster after one of a file's clusters. The clusters of a contiguous exFAT
+// file follow each other and their FAT entries are not used.
+static inline fat32_error_t next_file_cluster(const fat32_file_t *file, uint32_t cluster, uint32_t *next_cluster)
 {
-    if (!sd_card_present())
+    if (file->contiguous)
     {
-        fat32_unmount(); // Unmount if card is not present
-        return FAT32_ERROR_NO_CARD;
+        *next_cluster = cluster + 1;
+        return FAT32_OK;
     }
+    return read_cluster_fat_entry(cluster, next_cluster);
+}
 
-    if (fat32_mounted)
+// Find the cluster offset clusters into a file, without following the FAT if it is contiguous
+static inline fat32_error_t seek_to_file_cluster(const fat32_file_t *file, uint32_t offset, uint32_t *result_cluster)
+{
+    if (file->contiguous)
     {
+        *result_cluster = file->start_cluster + offset;
         return FAT32_OK;
     }
+    return seek_to_cluster(file->start_cluster, offset, result_cluster);
+}
 
-    RETURN_ON_ERROR(sd_card_init());
+//
+// exFAT volumes
+//
 
-    // Read boot sector
-    RETURN_ON_ERROR(sd_read_block(0, sector_buffer));
+#define EXFAT_BITS_PER_SECTOR (FAT32_SECTOR_SIZE * 8)
 
-    // Is this a Master Boot Record (MBR)?
-    if (is_sector_mbr(sector_buffer))
+// Find the sector of the allocation bitmap holding the bit of a cluster
+static fat32_error_t exfat_bitmap_sector(uint32_t cluster, uint32_t *sector)
+{
+    uint32_t index = (cluster - 2) / EXFAT_BITS_PER_SECTOR;
+    uint32_t bitmap_cluster = exfat_bitmap_cluster + index / sectors_per_cluster;
+    if (!exfat_bitmap_contiguous)
     {
-        volume_start_block = 0; // Set to zero to detect if no partitions are acceptable
+        RETURN_ON_ERROR(seek_to_cluster(exfat_bitmap_cluster, index / sectors_per_cluster, &bitmap_cluster));
+    }
+    *sector = cluster_to_sector(bitmap_cluster) + index % sectors_per_cluster;
+    return FAT32_OK;
+}
 
-        // Read partition table entries
-        for (int i = 0; i < 4; i++)
+// Count the free clusters in a row from first, up to limit of them
+static fat32_error_t exfat_free_run(uint32_t first, uint32_t limit, uint32_t *run)
+{
+    uint32_t end = cluster_count + 2;
+    uint32_t cluster = first;
+    *run = 0;
+    while (cluster < end && *run < limit)
+    {
+        uint32_t sector;
+        const uint8_t *bits;
+        RETURN_ON_ERROR(exfat_bitmap_sector(cluster, &sector));
+        RETURN_ON_ERROR(cache_read(volume_start_block + sector, &bits));
+        do
         {
-            // Read next partition table entry
-            mbr_partition_entry_t *partition_entry = (mbr_partition_entry_t *)(sector_buffer + 446 + i * 16);
+            uint32_t bit = (cluster - 2) % EXFAT_BITS_PER_SECTOR;
+            if (bits[bit / 8] & (1 << (bit % 8)))
+            {
+                return FAT32_OK; // In use
+            }
+            cluster++;
+            (*run)++;
+        } while (cluster < end && *run < limit && (cluster - 2) % EXFAT_BITS_PER_SECTOR != 0);
+    }
+    return FAT32_OK;
+}
 
-            // Check if this partition is active
-            if (partition_entry->boot_indicator != 0x00 && partition_entry->boot_indicator != 0x80)
+// Find the first free cluster from first up to end, or 0 if there is none. Bytes of the
+// bitmap with every bit set are skipped whole.
+static fat32_error_t exfat_find_free_between(uint32_t first, uint32_t end, uint32_t *cluster)
+{
+    uint32_t next = first;
+    *cluster = 0;
+    while (next < end)
+    {
+        uint32_t sector;
+        const uint8_t *bits;
+        RETURN_ON_ERROR(exfat_bitmap_sector(next, &sector));
+        RETURN_ON_ERROR(cache_read(volume_start_block + sector, &bits));
+        do
+        {
+            uint32_t bit = (next - 2) % EXFAT_BITS_PER_SECTOR;
+            if (bit % 8 == 0 && bits[bit / 8] == 0xFF)
             {
-                continue; // No partition here
+                next += 8;
+                continue;
             }
-            if (partition_entry->partition_type == 0x0B || // FAT32 with CHS addressing
-                partition_entry->partition_type == 0x0C)   // FAT32 with LBA addressing
+            if (!(bits[bit / 8] & (1 << (bit % 8))))
             {
-                // Align disk accesses with the partition we have decided to use
-                volume_start_block = partition_entry->start_lba;
-
-                // Read the boot sector from the partition
-                RETURN_ON_ERROR(sd_read_block(volume_start_block, sector_buffer));
-                break;
+                *cluster = next;
+                return FAT32_OK;
             }
-        }
-        if (volume_start_block == 0)
-        {
-            return FAT32_ERROR_INVALID_FORMAT; // No valid FAT32 partition found
-        }
+            next++;
+        } while (next < end && (next - 2) % EXFAT_BITS_PER_SECTOR != 0);
     }
-    else if (is_sector_boot_sector(sector_buffer))
-    {
-        // No partition table, treat the entire disk as a single partition
-        volume_start_block = 0;
+    return FAT32_OK;
+}
 
-        // We already have the boot sector in sector_buffer, no fat32_read_block needed
-    }
-    else
+// Find a free cluster, from where the last allocation ended to the end of the volume and
+// then from the start
+static fat32_error_t exfat_find_free(uint32_t *cluster)
+{
+    uint32_t end = cluster_count + 2;
+    uint32_t from = exfat_next_free >= 2 && exfat_next_free < end ? exfat_next_free : 2;
+    RETURN_ON_ERROR(exfat_find_free_between(from, end, cluster));
+    if (*cluster == 0)
     {
-        return FAT32_ERROR_INVALID_FORMAT; // This is not a valid FAT32 boot sector
+        RETURN_ON_ERROR(exfat_find_free_between(2, from, cluster));
     }
+    return *cluster ? FAT32_OK : FAT32_ERROR_DISK_FULL;
+}
 
-    // Copy boot sector data
-    memcpy(&boot_sector, sector_buffer, sizeof(fat32_boot_sector_t));
-
-    // Validate boot sector
-    RETURN_ON_ERROR(is_valid_fat32_boot_sector(&boot_sector));
-
-    // Calculate important sectors/clusters
-    bytes_per_cluster = boot_sector.sectors_per_cluster * FAT32_SECTOR_SIZE;
-    first_data_sector = boot_sector.reserved_sectors + (boot_sector.num_fats * boot_sector.fat_size_32);
-    data_region_sectors = boot_sector.total_sectors_32 - (boot_sector.num_fats * boot_sector.fat_size_32);
-    cluster_count = data_region_sectors / boot_sector.sectors_per_cluster;
-    if (cluster_count < 65525)
+// Mark count clusters from first as used or free in the bitmap, writing each sector once
+static fat32_error_t exfat_mark_clusters(uint32_t first, uint32_t count, bool used)
+{
+    if (first < 2 || first >= cluster_count + 2 || count > cluster_count + 2 - first)
     {
-        return FAT32_ERROR_INVALID_FORMAT; // This is FAT12 or FAT16, not FAT32!
+        return FAT32_ERROR_INVALID_PARAMETER;
     }
 
-    current_dir_cluster = boot_sector.root_cluster; // Start at root directory
-
-    // Cache the FSInfo sector
-    RETURN_ON_ERROR(read_sector(boot_sector.fat32_info, sector_buffer));
-    memcpy(&fsinfo, sector_buffer, sizeof(fat32_fsinfo_t));
-
-    if (fsinfo.lead_sig != 0x41615252 ||
-        fsinfo.struc_sig != 0x61417272 ||
-        fsinfo.trail_sig != 0xAA550000)
+    uint32_t end = first + count;
+    uint32_t cluster = first;
+    while (cluster < end)
     {
-        return FAT32_ERROR_INVALID_FORMAT; // FSInfo is not valid
+        uint32_t sector;
+        RETURN_ON_ERROR(exfat_bitmap_sector(cluster, &sector));
+        RETURN_ON_ERROR(read_sector(sector, sector_buffer));
+        do
+        {
+            uint32_t bit = (cluster - 2) % EXFAT_BITS_PER_SECTOR;
+            uint8_t mask = 1 << (bit % 8);
+            if (((sector_buffer[bit / 8] & mask) != 0) != used)
+            {
+                sector_buffer[bit / 8] ^= mask;
+                if (exfat_free_count != 0xFFFFFFFF)
+                {
+                    exfat_free_count = used ? exfat_free_count - 1 : exfat_free_count + 1;
+                }
+            }
+            cluster++;
+        } while (cluster < end && (cluster - 2) % EXFAT_BITS_PER_SECTOR != 0);
+        RETURN_ON_ERROR(write_sector(sector, sector_buffer));
     }
 
-    fat32_mounted = true;
+    if (used)
+    {
+        exfat_next_free = end; // The next file goes after this one
+    }
+    else if (first < exfat_next_free)
+    {
+        exfat_next_free = first;
+    }
     return FAT32_OK;
 }
 
-void fat32_unmount(void)
-{
-    fat32_mounted = false;
-    mount_status = FAT32_ERROR_NO_CARD;
-    volume_start_block = 0;
-    first_data_sector = 0;
-    data_region_sectors = 0;
-    cluster_count = 0;
-    bytes_per_cluster = 0;
-    current_dir_cluster = 0;
-}
-
-bool fat32_is_mounted(void)
-{
-    return fat32_mounted;
-}
-
-bool fat32_is_ready(void)
+// Count the free clusters in the bitmap. exFAT keeps no free count on the card, so this is
+// done once and the count kept up to date as clusters are allocated and freed.
+static fat32_error_t exfat_count_free(void)
 {
-    if (sd_card_present())
+    uint32_t used = 0;
+    for (uint32_t first = 2; first < cluster_count + 2; first += EXFAT_BITS_PER_SECTOR)
     {
-        if (!fat32_mounted)
+        uint32_t sector;
+        RETURN_ON_ERROR(exfat_bitmap_sector(first, &sector));
+        RETURN_ON_ERROR(read_sector(sector, sector_buffer));
+
+        uint32_t bits = cluster_count + 2 - first;
+        if (bits > EXFAT_BITS_PER_SECTOR)
         {
-            mount_status = fat32_mount();
+            bits = EXFAT_BITS_PER_SECTOR;
         }
-    }
-    else
-    {
-        if (fat32_mounted)
+        for (uint32_t i = 0; i < bits / 8; i++)
         {
-            fat32_unmount(); // Unmount if card is not present
+            used += __builtin_popcount(sector_buffer[i]);
+        }
+        if (bits % 8)
+        {
+            used += __builtin_popcount(sector_buffer[bits / 8] & ((1 << (bits % 8)) - 1));
         }
-        mount_status = FAT32_ERROR_NO_CARD; // Set status to no card present
     }
-    return mount_status == FAT32_OK;
-}
-
-fat32_error_t fat32_get_status(void)
-{
-    fat32_is_ready();
-    return mount_status;
+    exfat_free_count = cluster_count - used;
+    return FAT32_OK;
 }
 
-fat32_error_t fat32_get_free_space(uint64_t *free_space)
+// Free the clusters of a file or directory in the bitmap. The FAT entries of a chain are
+// left as they are, as exFAT only goes by the bitmap.
+static fat32_error_t exfat_release(uint32_t start_cluster, uint32_t clusters, bool contiguous)
 {
-    // We can only get free space for FAT32 using FSInfo
-    // Computing free space will be too slow for us
-
-    if (!fat32_is_ready())
+    if (start_cluster < 2 || clusters == 0)
     {
-        return mount_status;
+        return FAT32_OK; // Nothing allocated
     }
-
-    if (fsinfo.free_count != 0xFFFFFFFF &&
-        fsinfo.free_count <= cluster_count)
+    if (contiguous)
     {
-        *free_space = ((uint64_t)fsinfo.free_count) * bytes_per_cluster;
-        return FAT32_OK; // Successfully retrieved free space
+        return exfat_mark_clusters(start_cluster, clusters, false);
     }
 
-    // If FSInfo is not valid, we will count free clusters manually
-    uint64_t free_clusters = 0;
-    for (uint32_t sector = 0; sector < boot_sector.fat_size_32; sector++)
+    // Free the chain a run of consecutive clusters at a time
+    uint32_t run_start = start_cluster;
+    uint32_t run = 1;
+    uint32_t cluster = start_cluster;
+    for (uint32_t i = 1; i < clusters; i++)
     {
-        RETURN_ON_ERROR(read_sector(boot_sector.reserved_sectors + sector, sector_buffer));
-        for (int i = 0; i < FAT32_SECTOR_SIZE; i += 4)
+        uint32_t next_cluster;
+        RETURN_ON_ERROR(read_cluster_fat_entry(cluster, &next_cluster));
+        if (next_cluster < 2 || next_cluster >= cluster_count + 2)
         {
-            uint32_t entry = *(uint32_t *)(sector_buffer + i) & 0x0FFFFFFF;
-            if (entry == 0)
+            break; // Chain shorter than the data
+        }
+        if (next_cluster != cluster + 1)
+        {
+            RETURN_ON_ERROR(exfat_mark_clusters(run_start, run, false));
+            run_start = next_cluster;
+            run = 0;
+        }
+        run++;
+        cluster = next_cluster;
+    }
+    return exfat_mark_clusters(run_start, run, false);
+}
+
+// Give a file count more clusters after the clusters it has, where last is its last
+// cluster (0 if it has none). Clusters are taken from right after the file while they are
+// free, so a file written in order stays contiguous and never touches the FAT. Once it
+// cannot, its clusters are recorded in the FAT as a chain.
+static fat32_error_t exfat_allocate(fat32_file_t *file, uint32_t clusters, uint32_t last, uint32_t count)
+{
+    uint32_t old_last = last;
+    uint32_t first_added = 0;
+    uint32_t added = 0;
+    while (count > 0)
+    {
+        uint32_t first = 0;
+        uint32_t run = 0;
+        if (clusters > 0)
+        {
+            first = last + 1;
+            RETURN_ON_ERROR(exfat_free_run(first, count, &run));
+        }
+        if (run == 0)
+        {
+            fat32_error_t result = exfat_find_free(&first);
+            if (result != FAT32_OK)
             {
-                free_clusters++;
+                // Give back what was taken, so a failed write leaves nothing allocated
+                RETURN_ON_ERROR(exfat_release(first_added, added, file->contiguous));
+                if (clusters == added)
+                {
+                    file->start_cluster = 0;
+                    file->contiguous = false;
+                }
+                else if (added > 0 && !file->contiguous)
+                {
+                    // The chain was linked on into the clusters just freed, end it where it was
+                    RETURN_ON_ERROR(write_cluster_fat_entry(old_last, FAT32_FAT_ENTRY_EOC));
+                }
+                return result;
             }
+            RETURN_ON_ERROR(exfat_free_run(first, count, &run));
         }
-    }
+        RETURN_ON_ERROR(exfat_mark_clusters(first, run, true));
 
-    fsinfo.free_count = free_clusters; // Update FSInfo with counted free clusters
-    RETURN_ON_ERROR(write_sector(boot_sector.fat32_info, (uint8_t *)&fsinfo));
+        if (clusters == 0)
+        {
+            file->start_cluster = first;
+            file->contiguous = true;
+        }
+        else if (file->contiguous && first != last + 1)
+        {
+            RETURN_ON_ERROR(link_run(file->start_cluster, clusters, sector_buffer));
+            file->contiguous = false;
+        }
+        if (!file->contiguous)
+        {
+            if (clusters > 0)
+            {
+                RETURN_ON_ERROR(write_cluster_fat_entry(last, first));
+            }
+            RETURN_ON_ERROR(link_run(first, run, sector_buffer));
+        }
 
-    *free_space = free_clusters * bytes_per_cluster;
+        if (added == 0)
+        {
+            first_added = first;
+        }
+        added += run;
+        clusters += run;
+        last = first + run - 1;
+        count -= run;
+    }
     return FAT32_OK;
 }
 
-fat32_error_t fat32_get_total_space(uint64_t *total_space)
+// Find the sector after one of a directory's sectors, following the FAT at the end of a
+// cluster unless the directory is contiguous
+static fat32_error_t exfat_next_dir_sector(uint32_t sector, bool dir_contiguous, uint32_t *next_sector)
 {
-    if (!fat32_is_ready())
+    if ((sector + 1 - first_data_sector) % sectors_per_cluster != 0)
     {
-        return mount_status;
+        *next_sector = sector + 1;
+        return FAT32_OK;
     }
 
-    // Get the total number of sectors
-    uint64_t total_sectors = boot_sector.total_sectors_32;
-
-    // Calculate total space in bytes
-    *total_space = total_sectors * FAT32_SECTOR_SIZE;
-
+    uint32_t cluster = (sector - first_data_sector) / sectors_per_cluster + 2;
+    uint32_t next_cluster = cluster + 1;
+    if (!dir_contiguous)
+    {
+        RETURN_ON_ERROR(read_cluster_fat_entry(cluster, &next_cluster));
+    }
+    if (next_cluster < 2 || next_cluster >= cluster_count + 2)
+    {
+        return FAT32_ERROR_INVALID_FORMAT; // The entry set runs past the end of the directory
+    }
+    *next_sector = cluster_to_sector(next_cluster);
     return FAT32_OK;
 }
 
-uint32_t fat32_get_cluster_size(void)
+static uint16_t exfat_set_checksum(const uint8_t *set, uint32_t entries)
 {
-    return boot_sector.sectors_per_cluster * FAT32_SECTOR_SIZE;
-}
-
-fat32_error_t fat32_get_volume_name(char *name, size_t name_len)
-{
-    if (!name || name_len < 12)
+    uint16_t checksum = 0;
+    for (uint32_t i = 0; i < entries * FAT32_DIR_ENTRY_SIZE; i++)
     {
-        return FAT32_ERROR_INVALID_PARAMETER; // Name buffer too small
+        if (i == 2 || i == 3)
+        {
+            continue; // The checksum itself
+        }
+        checksum = ((checksum & 1) ? 0x8000 : 0) + (checksum >> 1) + set[i];
     }
+    return checksum;
+}
 
-    if (!fat32_is_ready())
+// Read the entry set whose file entry is at offset in sector into entry_buffer.exfat_set.
+// A set can cross into the next sector, and the next cluster of the directory.
+static fat32_error_t exfat_read_set(uint32_t sector, uint32_t offset, bool dir_contiguous, uint32_t *entries)
+{
+    uint8_t *set = (uint8_t *)entry_buffer.exfat_set;
+    uint32_t size = FAT32_DIR_ENTRY_SIZE; // Until the file entry says how many follow
+    uint32_t done = 0;
+    while (done < size)
     {
-        return mount_status;
-    }
+        if (done > 0)
+        {
+            RETURN_ON_ERROR(exfat_next_dir_sector(sector, dir_contiguous, &sector));
+            offset = 0;
+        }
+        RETURN_ON_ERROR(read_sector(sector, sector_buffer));
 
-    // Read the volume label from the root directory
-    fat32_file_t dir = {0};
-    dir.is_open = true;
-    dir.start_cluster = boot_sector.root_cluster;
-    dir.current_cluster = boot_sector.root_cluster;
-    dir.position = 0;
+        if (done == 0)
+        {
+            // Deleted sets are read too, to rename a file after it is unlinked
+            const exfat_file_entry_t *file = (const exfat_file_entry_t *)(sector_buffer + offset);
+            if ((file->type | EXFAT_ENTRY_IN_USE) != EXFAT_ENTRY_FILE ||
+                file->secondary_count < 2 || file->secondary_count >= EXFAT_MAX_SET_ENTRIES)
+            {
+                return FAT32_ERROR_INVALID_FORMAT;
+            }
+            size = (1 + file->secondary_count) * FAT32_DIR_ENTRY_SIZE;
+        }
 
-    fat32_entry_t entry;
-    while (fat32_dir_read(&dir, &entry) == FAT32_OK && entry.filename[0])
-    {
-        if (entry.attr & FAT32_ATTR_VOLUME_ID)
+        uint32_t part = FAT32_SECTOR_SIZE - offset;
+        if (part > size - done)
         {
-            // Found a volume label entry
-            strncpy(name, entry.filename, name_len - 1);
-            name[name_len - 1] = '\0'; // Ensure null-termination
-            return FAT32_OK;
+            part = size - done;
         }
+        memcpy(set + done, sector_buffer + offset, part);
+        done += part;
     }
-    name[0] = '\0'; // No volume label found
+    *entries = size / FAT32_DIR_ENTRY_SIZE;
     return FAT32_OK;
 }
 
-//
-// File system naming utility functions
-//
-
-static inline char utf16_to_utf8(uint16_t utf16)
+// Write the entry set in entry_buffer.exfat_set with a new checksum
+static fat32_error_t exfat_write_set(uint32_t sector, uint32_t offset, bool dir_contiguous, uint32_t entries)
 {
-    // Convert UTF-16 to UTF-8 (simplified - only handles ASCII range)
-    return utf16 < 0x80 ? (char)utf16 : '?';
-}
+    uint8_t *set = (uint8_t *)entry_buffer.exfat_set;
+    uint32_t size = entries * FAT32_DIR_ENTRY_SIZE;
+    entry_buffer.exfat_set[0].file.set_checksum = exfat_set_checksum(set, entries);
 
-static inline uint16_t utf8_to_utf16(char utf8)
-{
-    // Convert UTF-8 to UTF-16 (simplified - only handles ASCII range)
-    return (uint16_t)(unsigned char)utf8;
+    for (uint32_t done = 0; done < size;)
+    {
+        if (done > 0)
+        {
+            RETURN_ON_ERROR(exfat_next_dir_sector(sector, dir_contiguous, &sector));
+            offset = 0;
+        }
+
+        uint32_t part = FAT32_SECTOR_SIZE - offset;
+        if (part > size - done)
+        {
+            part = size - done;
+        }
+        RETURN_ON_ERROR(read_sector(sector, sector_buffer));
+        memcpy(sector_buffer + offset, set + done, part);
+        RETURN_ON_ERROR(write_sector(sector, sector_buffer));
+        done += part;
+    }
+    return FAT32_OK;
 }
 
-static inline uint16_t utf8_to_lfn_ch(char utf8, uint8_t index, uint8_t len)
+// Record the size and clusters of an open file or directory in its stream extension entry
+static fat32_error_t exfat_update_entry(const fat32_file_t *file)
 {
-    // Convert UTF-8 to long file name entry (simplified - only handles ASCII range)
-    if (index == len)
-    {
-        return 0; // End of name
-    }
-    if (index > len)
+    uint32_t entries;
+    RETURN_ON_ERROR(exfat_read_set(file->dir_entry_sector, file->dir_entry_offset, file->dir_contiguous, &entries));
+
+    exfat_stream_entry_t *stream = &entry_buffer.exfat_set[1].stream;
+    if (stream->type != EXFAT_ENTRY_STREAM)
     {
-        return 0xFFFF; // Invalid index
+        return FAT32_ERROR_INVALID_FORMAT;
     }
-    return utf8_to_utf16(utf8);
+    stream->flags &= ~EXFAT_STREAM_NO_FAT_CHAIN;
+    stream->flags |= EXFAT_STREAM_ALLOCATION_POSSIBLE | (file->contiguous ? EXFAT_STREAM_NO_FAT_CHAIN : 0);
+    stream->first_cluster = file->start_cluster;
+    stream->data_length = file->file_size;
+    stream->valid_data_length = file->file_size;
+
+    return exfat_write_set(file->dir_entry_sector, file->dir_entry_offset, file->dir_contiguous, entries);
 }
 
-static void filename_to_shortname(const char *filename, char *shortname)
+// True once every entry of a directory has been read. Directories other than the root
+// record their length; the root ends with its cluster chain.
+static inline bool exfat_dir_end(const fat32_file_t *dir)
 {
-    memset(shortname, ' ', 11);
-    shortname[11] = '\0';
+    return dir->last_entry_read || (dir->file_size != 0 && dir->position >= dir->file_size);
+}
 
-    const char *dot = strrchr(filename, '.');
-    int name_len = dot ? (dot - filename) : strlen(filename);
+// Copy the entry at the position of a directory and step past it, noting where it was.
+// At the end of the directory, current_cluster is left on its last cluster.
+static fat32_error_t exfat_next_entry(fat32_file_t *dir, exfat_dir_entry_t *entry, uint32_t *sector, uint32_t *offset)
+{
+    *sector = cluster_to_sector(dir->current_cluster) + (dir->position % bytes_per_cluster) / FAT32_SECTOR_SIZE;
+    *offset = dir->position % FAT32_SECTOR_SIZE;
 
-    // Copy name part (max 8 characters)
-    for (int i = 0; i < name_len && i < 8; i++)
-    {
-        shortname[i] = toupper(filename[i]);
-    }
+    const uint8_t *data;
+    RETURN_ON_ERROR(cache_read(volume_start_block + *sector, &data));
+    memcpy(entry, data + *offset, sizeof(exfat_dir_entry_t));
 
-    // Copy extension part (max 3 characters)
-    if (dot && strlen(dot + 1) > 0)
+    dir->position += FAT32_DIR_ENTRY_SIZE;
+    if (dir->position % bytes_per_cluster == 0 && !exfat_dir_end(dir))
     {
-        for (int i = 0; i < 3 && dot[1 + i]; i++)
+        uint32_t next_cluster;
+        RETURN_ON_ERROR(next_file_cluster(dir, dir->current_cluster, &next_cluster));
+        if (next_cluster < 2 || next_cluster >= cluster_count + 2)
         {
-            shortname[8 + i] = toupper(dot[1 + i]);
+            dir->last_entry_read = true; // End of the cluster chain
+        }
+        else
+        {
+            dir->current_cluster = next_cluster;
         }
     }
+    return FAT32_OK;
 }
 
-static void shortname_to_filename(const char *shortname, char *filename)
+// Mount the exFAT volume whose boot sector is in sector_buffer
+static fat32_error_t exfat_mount(void)
 {
-    int pos = 0;
+    exfat_boot_sector_t bs;
+    memcpy(&bs, sector_buffer, sizeof(bs));
 
-    // Copy name part
-    for (int i = 0; i < 8 && shortname[i] != ' '; i++)
+    if (bs.bytes_per_sector_shift != 9 ||     // 512 byte sectors only
+        bs.sectors_per_cluster_shift > 16 ||  // Clusters of at most 32 MB
+        bs.num_fats == 0 || bs.num_fats > 2 ||
+        bs.cluster_count == 0 ||
+        bs.root_cluster < 2 || bs.root_cluster >= bs.cluster_count + 2 ||
+        volume_start_block + bs.volume_length > 0xFFFFFFFF) // Block numbers are 32 bits
     {
-        filename[pos++] = tolower(shortname[i]);
+        return FAT32_ERROR_INVALID_FORMAT;
     }
 
-    // Copy extension part
-    bool has_ext = false;
-    for (int i = 8; i < 11; i++)
-    {
-        if (shortname[i] != ' ')
+    // With two FATs (TexFAT), bit 0 of the volume flags says which one and which bitmap to use
+    uint8_t active_fat = (bs.num_fats == 2 && (bs.volume_flags & 1)) ? 1 : 0;
+
+    volume_exfat = true;
+    volume_sectors = bs.volume_length;
+    fat_start_sector = bs.fat_offset + active_fat * bs.fat_length;
+    first_data_sector = bs.cluster_heap_offset;
+    sectors_per_cluster = 1u << bs.sectors_per_cluster_shift;
+    bytes_per_cluster = sectors_per_cluster * FAT32_SECTOR_SIZE;
+    cluster_count = bs.cluster_count;
+    data_region_sectors = cluster_count * sectors_per_cluster;
+    root_cluster = bs.root_cluster;
+    current_dir_cluster = root_cluster;
+    strcpy(exfat_current_dir, "/");
+    exfat_free_count = 0xFFFFFFFF;
+    exfat_next_free = 2;
+
+    // Find the allocation bitmap in the root directory
+    fat32_file_t root = {0};
+    root.is_open = true;
+    root.attributes = FAT32_ATTR_DIRECTORY;
+    root.start_cluster = root_cluster;
+    root.current_cluster = root_cluster;
+
+    exfat_bitmap_cluster = 0;
+    while (!exfat_dir_end(&root) && exfat_bitmap_cluster == 0)
+    {
+        exfat_dir_entry_t entry;
+        uint32_t sector, offset;
+        RETURN_ON_ERROR(exfat_next_entry(&root, &entry, &sector, &offset));
+        if (entry.type == EXFAT_ENTRY_END)
         {
-            if (!has_ext)
-            {
-                filename[pos++] = '.';
-                has_ext = true;
-            }
-            filename[pos++] = tolower(shortname[i]);
+            break;
+        }
+        if (entry.type == EXFAT_ENTRY_BITMAP && (entry.table.flags & 1) == active_fat &&
+            entry.table.data_length >= (cluster_count + 7) / 8)
+        {
+            exfat_bitmap_cluster = entry.table.first_cluster;
         }
     }
+    if (exfat_bitmap_cluster < 2 || exfat_bitmap_cluster >= cluster_count + 2)
+    {
+        return FAT32_ERROR_INVALID_FORMAT; // No allocation bitmap
+    }
 
-    filename[pos] = '\0';
+    // The bitmap is nearly always contiguous, and then its sectors are found without the FAT
+    uint32_t bitmap_clusters = ((cluster_count + 7) / 8 + bytes_per_cluster - 1) / bytes_per_cluster;
+    uint32_t cluster = exfat_bitmap_cluster;
+    exfat_bitmap_contiguous = true;
+    for (uint32_t i = 1; i < bitmap_clusters && exfat_bitmap_contiguous; i++)
+    {
+        uint32_t next_cluster;
+        RETURN_ON_ERROR(read_cluster_fat_entry(cluster, &next_cluster));
+        exfat_bitmap_contiguous = next_cluster == cluster + 1;
+        cluster = next_cluster;
+    }
+
+    return FAT32_OK;
 }
 
-static bool valid_shortname(const char *filename)
-{
-    // Forbidden ASCII codes for FAT 8.3 names
-    static const char forbidden[] = "\"*+,./:;<=>?[\\]|";
+//
+// Mount the SD Card functions
+//
 
-    if (!filename)
+fat32_error_t fat32_mount(void)
+{
+    if (!sd_card_present())
     {
-        return false;
+        fat32_unmount(); // Unmount if card is not present
+        return FAT32_ERROR_NO_CARD;
     }
 
-    int len = strlen(filename);
-    if (len < 1 || len > 12)
+    if (fat32_mounted)
     {
-        return false; // "FILENAME.EXT" (8+1+3)
+        return FAT32_OK;
     }
 
-    // Only one dot allowed, not at start
-    const char *dot = strchr(filename, '.');
-    if (dot)
+    RETURN_ON_ERROR(sd_card_start());
+
+    // Read boot sector
+    RETURN_ON_ERROR(sd_read_block(0, sector_buffer));
+
+    // An exFAT boot sector has boot code where an MBR has its partition table, so check it first
+    if (is_sector_exfat(sector_buffer))
     {
-        if (dot != strrchr(filename, '.'))
+        // No partition table, the entire disk is one exFAT volume
+        volume_start_block = 0;
+    }
+    // Is this a Master Boot Record (MBR)?
+    else if (is_sector_mbr(sector_buffer))
+    {
+        volume_start_block = 0; // Set to zero to detect if no partitions are acceptable
+
+        // Read partition table entries
+        for (int i = 0; i < 4; i++)
         {
-            return false; // More than one dot
+            // Read next partition table entry
+            mbr_partition_entry_t *partition_entry = (mbr_partition_entry_t *)(sector_buffer + 446 + i * 16);
+
+            // Check if this partition is active
+            if (partition_entry->boot_indicator != 0x00 && partition_entry->boot_indicator != 0x80)
+            {
+                continue; // No partition here
+            }
+            if (partition_entry->partition_type == 0x0B || // FAT32 with CHS addressing
+                partition_entry->partition_type == 0x0C || // FAT32 with LBA addressing
+                partition_entry->partition_type == 0x07)   // exFAT (or NTFS, rejected below)
+            {
+                // Align disk accesses with the partition we have decided to use
+                volume_start_block = partition_entry->start_lba;
+
+                // Read the boot sector from the partition
+                RETURN_ON_ERROR(sd_read_block(volume_start_block, sector_buffer));
+                break;
+            }
         }
-        if (dot == filename)
+        if (volume_start_block == 0)
         {
-            return false; // Dot at start
+            return FAT32_ERROR_INVALID_FORMAT; // No valid FAT32 partition found
         }
     }
-
-    int name_len = dot ? (dot - filename) : len;
-    int ext_len = dot ? (len - name_len - 1) : 0;
-
-    if (name_len < 1 || name_len > 8)
+    else if (is_sector_boot_sector(sector_buffer))
     {
-        return false;
+        // No partition table, treat the entire disk as a single partition
+        volume_start_block = 0;
+
+        // We already have the boot sector in sector_buffer, no fat32_read_block needed
     }
-    if (ext_len < 0 || ext_len > 3)
+    else
     {
-        return false;
+        return FAT32_ERROR_INVALID_FORMAT; // This is not a valid FAT32 boot sector
     }
 
-    // Check name part
-    for (int i = 0; i < name_len; i++)
+    if (is_sector_exfat(sector_buffer))
     {
-        unsigned char c = filename[i];
-        if (c <= 0x20 || strchr(forbidden, c))
-        {
-            return false;
-        }
+        RETURN_ON_ERROR(exfat_mount());
+        fat32_mounted = true;
+        return FAT32_OK;
     }
 
-    // Check extension part
-    if (dot)
+    // Copy boot sector data
+    memcpy(&boot_sector, sector_buffer, sizeof(fat32_boot_sector_t));
+
+    // Validate boot sector
+    RETURN_ON_ERROR(is_valid_fat32_boot_sector(&boot_sector));
+
+    // Calculate important sectors/clusters
+    volume_exfat = false;
+    volume_sectors = boot_sector.total_sectors_32;
+    fat_start_sector = boot_sector.reserved_sectors;
+    sectors_per_cluster = boot_sector.sectors_per_cluster;
+    root_cluster = boot_sector.root_cluster;
+    bytes_per_cluster = sectors_per_cluster * FAT32_SECTOR_SIZE;
+    first_data_sector = fat_start_sector + (boot_sector.num_fats * boot_sector.fat_size_32);
+    data_region_sectors = boot_sector.total_sectors_32 - first_data_sector;
+    cluster_count = data_region_sectors / sectors_per_cluster;
+    if (cluster_count < 65525)
     {
-        for (int i = 0; i < ext_len; i++)
-        {
-            unsigned char c = dot[1 + i];
-            if (c <= 0x20 || strchr(forbidden, c))
-            {
-                return false;
-            }
-        }
+        return FAT32_ERROR_INVALID_FORMAT; // This is FAT12 or FAT16, not FAT32!
     }
 
-    return true;
-}
-
-static uint8_t filename_to_lfn(const char *filename)
-{
-    // Convert filename to long file name entry
-    memset(lfn_buffer, 0, sizeof(fat32_lfn_entry_t) * MAX_LFN_PART);
+    current_dir_cluster = root_cluster; // Start at root directory
 
-    // Split into UTF-16 parts (5 characters per part)
-    int len = strlen(filename);
-    const char *name = filename;
-    fat32_lfn_entry_t *lfn_entry = &lfn_buffer[0];
-    int part_count = (len + 12) / 13; // 13 UTF-16 chars per LFN entry
+    // Cache the FSInfo sector
+    RETURN_ON_ERROR(read_sector(boot_sector.fat32_info, sector_buffer));
+    memcpy(&fsinfo, sector_buffer, sizeof(fat32_fsinfo_t));
 
-    for (int i = 0, j = 0; i < part_count; i++)
+    if (fsinfo.lead_sig != 0x41615252 ||
+        fsinfo.struc_sig != 0x61417272 ||
+        fsinfo.trail_sig != 0xAA550000)
     {
-        // Convert UTF-16 parts to UTF-8
-        lfn_entry->name1[0] = utf8_to_lfn_ch(*(name++), j++, len);
-        lfn_entry->name1[1] = utf8_to_lfn_ch(*(name++), j++, len);
-        lfn_entry->name1[2] = utf8_to_lfn_ch(*(name++), j++, len);
-        lfn_entry->name1[3] = utf8_to_lfn_ch(*(name++), j++, len);
-        lfn_entry->name1[4] = utf8_to_lfn_ch(*(name++), j++, len);
-        lfn_entry->name2[0] = utf8_to_lfn_ch(*(name++), j++, len);
-        lfn_entry->name2[1] = utf8_to_lfn_ch(*(name++), j++, len);
-        lfn_entry->name2[2] = utf8_to_lfn_ch(*(name++), j++, len);
-        lfn_entry->name2[3] = utf8_to_lfn_ch(*(name++), j++, len);
-        lfn_entry->name2[4] = utf8_to_lfn_ch(*(name++), j++, len);
-        lfn_entry->name2[5] = utf8_to_lfn_ch(*(name++), j++, len);
-        lfn_entry->name3[0] = utf8_to_lfn_ch(*(name++), j++, len);
-        lfn_entry->name3[1] = utf8_to_lfn_ch(*(name++), j++, len);
-
-        lfn_entry++;
+        return FAT32_ERROR_INVALID_FORMAT; // FSInfo is not valid
     }
-    return part_count; // Return number of LFN parts created
+
+    fat32_mounted = true;
+    return FAT32_OK;
 }
 
-static bool shortname_exists(const char *shortname, fat32_file_t *dir)
+void fat32_unmount(void)
 {
-    fat32_file_t scan = *dir;
-    fat32_entry_t entry;
-    scan.position = 0;
-    while (fat32_dir_read(&scan, &entry) == FAT32_OK && entry.filename[0])
+    fat32_mounted = false;
+    mount_status = FAT32_ERROR_NO_CARD;
+    volume_start_block = 0;
+    first_data_sector = 0;
+    data_region_sectors = 0;
+    cluster_count = 0;
+    bytes_per_cluster = 0;
+    current_dir_cluster = 0;
+    cache_clear(); // Mapped windows are no longer valid
+}
+
+bool fat32_is_mounted(void)
+{
+    return fat32_mounted;
+}
+
+bool fat32_is_exfat(void)
+{
+    return fat32_mounted && volume_exfat;
+}
+
+bool fat32_is_ready(void)
+{
+    if (sd_card_present())
     {
-        char entry83[12];
-        filename_to_shortname(entry.filename, entry83);
-        if (memcmp(entry83, shortname, 11) == 0)
+        if (!fat32_mounted)
         {
-            return true;
+            mount_status = fat32_mount();
         }
     }
-    return false;
+    else
+    {
+        if (fat32_mounted)
+        {
+            fat32_unmount(); // Unmount if card is not present
+        }
+        mount_status = FAT32_ERROR_NO_CARD; // Set status to no card present
+    }
+    return mount_status == FAT32_OK;
 }
 
-static fat32_error_t unique_shortname(fat32_file_t *dir, const char *longname, char *shortname)
+fat32_error_t fat32_get_status(void)
 {
-    // Generates a unique FAT 8.3 short name for a given long filename in a directory
-    // dir: open directory to check for collisions
-    // longname: input long filename (UTF-8, ASCII only here)
-    // shortname: output buffer, must be at least 12 bytes (11 chars + null terminator)
+    fat32_is_ready();
+    return mount_status;
+}
 
-    // Step 1: Uppercase and Step 2: Convert to OEM (ASCII only here)
-    char upper[FAT32_MAX_FILENAME_LEN + 1];
-    size_t len = strlen(longname);
-    for (size_t i = 0; i < len && i < FAT32_MAX_FILENAME_LEN; ++i)
+fat32_error_t fat32_get_free_space(uint64_t *free_space)
+{
+    // We can only get free space for FAT32 using FSInfo
+    // Computing free space will be too slow for us
+
+    if (!fat32_is_ready())
     {
-        upper[i] = toupper((unsigned char)longname[i]);
+        return mount_status;
     }
-    upper[len] = '\0';
 
-    // Step 3: Strip leading/embedded spaces
-    char temp[FAT32_MAX_FILENAME_LEN + 1];
-    size_t j = 0;
-    for (size_t i = 0; i < len; ++i)
+    if (volume_exfat)
     {
-        if (upper[i] != ' ')
+        if (exfat_free_count == 0xFFFFFFFF)
         {
-            temp[j++] = upper[i];
+            RETURN_ON_ERROR(exfat_count_free());
         }
+        *free_space = ((uint64_t)exfat_free_count) * bytes_per_cluster;
+        return FAT32_OK;
     }
-    temp[j] = '\0';
 
-    // Step 4: Strip leading periods
-    char *p = temp;
-    while (*p == '.')
-        p++;
-
-    // Step 5: Copy up to 8 chars before dot, replace invalids with '_'
-    size_t name_len = 0;
-    size_t ext_len = 0;
-    int lossy = 0;
-    char *dot = strrchr(p, '.');
-    if (dot == p)
-        dot = NULL; // ignore leading dot
+    if (fsinfo.free_count != 0xFFFFFFFF &&
+        fsinfo.free_count <= cluster_count)
+    {
+        *free_space = ((uint64_t)fsinfo.free_count) * bytes_per_cluster;
+        return FAT32_OK; // Successfully retrieved free space
+    }
 
-    char base[9] = {0};
-    for (size_t i = 0; p[i] && &p[i] != dot && name_len < 8; ++i)
+    // If FSInfo is not valid, we will count free clusters manually
+    uint64_t free_clusters = 0;
+    for (uint32_t sector = 0; sector < boot_sector.fat_size_32; sector++)
     {
-        char c = p[i];
-        if ((c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') ||
-            strchr("$%'-_@~`!(){}^#&", c))
+        RETURN_ON_ERROR(read_sector(fat_start_sector + sector, sector_buffer));
+        for (int i = 0; i < FAT32_SECTOR_SIZE; i += 4)
         {
-            base[name_len++] = c;
+            uint32_t entry = *(uint32_t *)(sector_buffer + i) & 0x0FFFFFFF;
+            if (entry == 0)
+            {
+                free_clusters++;
+            }
         }
-        else
+    }
+
+    fsinfo.free_count = free_clusters; // Update FSInfo with counted free clusters
+    RETURN_ON_ERROR(write_sector(boot_sector.fat32_info, (uint8_t *)&fsinfo));
+
+    *free_space = free_clusters * bytes_per_cluster;
+    return FAT32_OK;
+}
+
+fat32_error_t fat32_get_total_space(uint64_t *total_space)
+{
+    if (!fat32_is_ready())
+    {
+        return mount_status;
+    }
+
+    // Get the total number of sectors
+    uint64_t total_sectors = volume_sectors;
+
+    // Calculate total space in bytes
+    *total_space = total_sectors * FAT32_SECTOR_SIZE;
+
+    return FAT32_OK;
+}
+
+uint32_t fat32_get_cluster_size(void)
+{
+    return sectors_per_cluster * FAT32_SECTOR_SIZE;
+}
+
+fat32_error_t fat32_get_volume_name(char *name, size_t name_len)
+{
+    if (!name || name_len < 12)
+    {
+        return FAT32_ERROR_INVALID_PARAMETER; // Name buffer too small
+    }
+
+    if (!fat32_is_ready())
+    {
+        return mount_status;
+    }
+
+    // Read the volume label from the root directory
+    fat32_file_t dir = {0};
+    dir.is_open = true;
+    dir.attributes = FAT32_ATTR_DIRECTORY;
+    dir.start_cluster = root_cluster;
+    dir.current_cluster = root_cluster;
+    dir.position = 0;
+
+    fat32_entry_t entry;
+    while (fat32_dir_read(&dir, &entry) == FAT32_OK && entry.filename[0])
+    {
+        if (entry.attr & FAT32_ATTR_VOLUME_ID)
         {
-            base[name_len++] = '_';
-            lossy = 1;
+            // Found a volume label entry
+            strncpy(name, entry.filename, name_len - 1);
+            name[name_len - 1] = '\0'; // Ensure null-termination
+            return FAT32_OK;
         }
     }
-    base[name_len] = '\0';
+    name[0] = '\0'; // No volume label found
+    return FAT32_OK;
+}
 
-    // Extension
-    char ext[4] = {0};
-    if (dot && *(dot + 1))
+//
+// File system naming utility functions
+//
+
+static inline char utf16_to_utf8(uint16_t utf16)
+{
+    // Convert UTF-16 to UTF-8 (simplified - only handles ASCII range)
+    return utf16 < 0x80 ? (char)utf16 : '?';
+}
+
+static inline uint16_t utf8_to_utf16(char utf8)
+{
+    // Convert UTF-8 to UTF-16 (simplified - only handles ASCII range)
+    return (uint16_t)(unsigned char)utf8;
+}
+
+static inline uint16_t utf8_to_lfn_ch(char utf8, uint8_t index, uint8_t len)
+{
+    // Convert UTF-8 to long file name entry (simplified - only handles ASCII range)
+    if (index == len)
     {
-        for (size_t i = 1; i <= 3 && dot[i]; ++i)
+        return 0; // End of name
+    }
+    if (index > len)
+    {
+        return 0xFFFF; // Invalid index
+    }
+    return utf8_to_utf16(utf8);
+}
+
+static void filename_to_shortname(const char *filename, char *shortname)
+{
+    memset(shortname, ' ', 11);
+    shortname[11] = '\0';
+
+    const char *dot = strrchr(filename, '.');
+    int name_len = dot ? (dot - filename) : strlen(filename);
+
+    // Copy name part (max 8 characters)
+    for (int i = 0; i < name_len && i < 8; i++)
+    {
+        shortname[i] = toupper(filename[i]);
+    }
+
+    // Copy extension part (max 3 characters)
+    if (dot && strlen(dot + 1) > 0)
+    {
+        for (int i = 0; i < 3 && dot[1 + i]; i++)
         {
-            char c = dot[i];
-            if ((c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') ||
-                strchr("$%'-_@~`!(){}^#&", c))
-            {
-                ext[ext_len++] = c;
-            }
-            else
-            {
-                ext[ext_len++] = '_';
-                lossy = 1;
-            }
+            shortname[8 + i] = toupper(dot[1 + i]);
         }
     }
-    ext[ext_len] = '\0';
+}
 
-    // Compose initial candidate
-    char candidate[12];
-    memset(candidate, ' ', 11);
-    memcpy(candidate, base, strlen(base));
-    memcpy(candidate + 8, ext, strlen(ext));
-    candidate[11] = '\0';
+static void shortname_to_filename(const char *shortname, char *filename)
+{
+    int pos = 0;
 
-    // Check if numeric tail is needed
-    bool need_tail = lossy || name_len > 8 || ext_len > 3 || shortname_exists(candidate, dir);
+    // Copy name part
+    for (int i = 0; i < 8 && shortname[i] != ' '; i++)
+    {
+        filename[pos++] = tolower(shortname[i]);
+    }
 
-    if (!need_tail)
+    // Copy extension part
+    bool has_ext = false;
+    for (int i = 8; i < 11; i++)
     {
-        memcpy(shortname, candidate, 12);
-        return FAT32_OK;
+        if (shortname[i] != ' ')
+        {
+            if (!has_ext)
+            {
+                filename[pos++] = '.';
+                has_ext = true;
+            }
+            filename[pos++] = tolower(shortname[i]);
+        }
+    }
+
+    filename[pos] = '\0';
+}
+
+static bool valid_shortname(const char *filename)
+{
+    // Forbidden ASCII codes for FAT 8.3 names
+    static const char forbidden[] = "\"*+,./:;<=>?[\\]|";
+
+    if (!filename)
+    {
+        return false;
+    }
+
+    int len = strlen(filename);
+    if (len < 1 || len > 12)
+    {
+        return false; // "FILENAME.EXT" (8+1+3)
+    }
+
+    // Only one dot allowed, not at start
+    const char *dot = strchr(filename, '.');
+    if (dot)
+    {
+        if (dot != strrchr(filename, '.'))
+        {
+            return false; // More than one dot
+        }
+        if (dot == filename)
+        {
+            return false; // Dot at start
+        }
+    }
+
+    int name_len = dot ? (dot - filename) : len;
+    int ext_len = dot ? (len - name_len - 1) : 0;
+
+    if (name_len < 1 || name_len > 8)
+    {
+        return false;
+    }
+    if (ext_len < 0 || ext_len > 3)
+    {
+        return false;
+    }
+
+    // Check name part
+    for (int i = 0; i < name_len; i++)
+    {
+        unsigned char c = filename[i];
+        if (c <= 0x20 || strchr(forbidden, c))
+        {
+            return false;
+        }
+    }
+
+    // Check extension part
+    if (dot)
+    {
+        for (int i = 0; i < ext_len; i++)
+        {
+            unsigned char c = dot[1 + i];
+            if (c <= 0x20 || strchr(forbidden, c))
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+static uint8_t filename_to_lfn(const char *filename)
+{
+    // Convert filename to long file name entry
+    memset(entry_buffer.lfn, 0, sizeof(entry_buffer.lfn));
+
+    // Split into UTF-16 parts (5 characters per part)
+    int len = strlen(filename);
+    const char *name = filename;
+    fat32_lfn_entry_t *lfn_entry = &entry_buffer.lfn[0];
+    int part_count = (len + 12) / 13; // 13 UTF-16 chars per LFN entry
+
+    for (int i = 0, j = 0; i < part_count; i++)
+    {
+        // Convert UTF-16 parts to UTF-8
+        lfn_entry->name1[0] = utf8_to_lfn_ch(*(name++), j++, len);
+        lfn_entry->name1[1] = utf8_to_lfn_ch(*(name++), j++, len);
+        lfn_entry->name1[2] = utf8_to_lfn_ch(*(name++), j++, len);
+        lfn_entry->name1[3] = utf8_to_lfn_ch(*(name++), j++, len);
+        lfn_entry->name1[4] = utf8_to_lfn_ch(*(name++), j++, len);
+        lfn_entry->name2[0] = utf8_to_lfn_ch(*(name++), j++, len);
+        lfn_entry->name2[1] = utf8_to_lfn_ch(*(name++), j++, len);
+        lfn_entry->name2[2] = utf8_to_lfn_ch(*(name++), j++, len);
+        lfn_entry->name2[3] = utf8_to_lfn_ch(*(name++), j++, len);
+        lfn_entry->name2[4] = utf8_to_lfn_ch(*(name++), j++, len);
+        lfn_entry->name2[5] = utf8_to_lfn_ch(*(name++), j++, len);
+        lfn_entry->name3[0] = utf8_to_lfn_ch(*(name++), j++, len);
+        lfn_entry->name3[1] = utf8_to_lfn_ch(*(name++), j++, len);
+
+        lfn_entry++;
+    }
+    return part_count; // Return number of LFN parts created
+}
+
+static bool shortname_exists(const char *shortname, fat32_file_t *dir)
+{
+    fat32_file_t scan = *dir;
+    fat32_entry_t entry;
+    scan.position = 0;
+    while (fat32_dir_read(&scan, &entry) == FAT32_OK && entry.filename[0])
+    {
+        char entry83[12];
+        filename_to_shortname(entry.filename, entry83);
+        if (memcmp(entry83, shortname, 11) == 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+static fat32_error_t unique_shortname(fat32_file_t *dir, const char *longname, char *shortname)
+{
+    // Generates a unique FAT 8.3 short name for a given long filename in a directory
+    // dir: open directory to check for collisions
+    // longname: input long filename (UTF-8, ASCII only here)
+    // shortname: output buffer, must be at least 12 bytes (11 chars + null terminator)
+
+    // Step 1: Uppercase and Step 2: Convert to OEM (ASCII only here)
+    char upper[FAT32_MAX_FILENAME_LEN + 1];
+    size_t len = strlen(longname);
+    for (size_t i = 0; i < len && i < FAT32_MAX_FILENAME_LEN; ++i)
+    {
+        upper[i] = toupper((unsigned char)longname[i]);
+    }
+    upper[len] = '\0';
+
+    // Step 3: Strip leading/embedded spaces
+    char temp[FAT32_MAX_FILENAME_LEN + 1];
+    size_t j = 0;
+    for (size_t i = 0; i < len; ++i)
+    {
+        if (upper[i] != ' ')
+        {
+            temp[j++] = upper[i];
+        }
+    }
+    temp[j] = '\0';
+
+    // Step 4: Strip leading periods
+    char *p = temp;
+    while (*p == '.')
+        p++;
+
+    // Step 5: Copy up to 8 chars before dot, replace invalids with '_'
+    size_t name_len = 0;
+    size_t ext_len = 0;
+    int lossy = 0;
+    char *dot = strrchr(p, '.');
+    if (dot == p)
+        dot = NULL; // ignore leading dot
+
+    char base[9] = {0};
+    for (size_t i = 0; p[i] && &p[i] != dot && name_len < 8; ++i)
+    {
+        char c = p[i];
+        if ((c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') ||
+            strchr("$%'-_@~`!(){}^#&", c))
+        {
+            base[name_len++] = c;
+        }
+        else
+        {
+            base[name_len++] = '_';
+            lossy = 1;
+        }
+    }
+    base[name_len] = '\0';
+
+    // Extension
+    char ext[4] = {0};
+    if (dot && *(dot + 1))
+    {
+        for (size_t i = 1; i <= 3 && dot[i]; ++i)
+        {
+            char c = dot[i];
+            if ((c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') ||
+                strchr("$%'-_@~`!(){}^#&", c))
+            {
+                ext[ext_len++] = c;
+            }
+            else
+            {
+                ext[ext_len++] = '_';
+                lossy = 1;
+            }
+        }
+    }
+    ext[ext_len] = '\0';
+
+    // Compose initial candidate
+    char candidate[12];
+    memset(candidate, ' ', 11);
+    memcpy(candidate, base, strlen(base));
+    memcpy(candidate + 8, ext, strlen(ext));
+    candidate[11] = '\0';
+
+    // Check if numeric tail is needed
+    bool need_tail = lossy || name_len > 8 || ext_len > 3 || shortname_exists(candidate, dir);
+
+    if (!need_tail)
+    {
+        memcpy(shortname, candidate, 12);
+        return FAT32_OK;
+    }
+
+    // Numeric tail generation: try ~1 to ~999999
+    for (int n = 1; n < 1000000; n++)
+    {
+        char tail[8];
+        snprintf(tail, sizeof(tail), "~%d", n);
+        size_t tail_len = strlen(tail);
+
+        size_t base_len = 8 - tail_len;
+        if (base_len > strlen(base))
+            base_len = strlen(base);
+
+        memset(candidate, ' ', 11);
+        memcpy(candidate, base, base_len);
+        memcpy(candidate + base_len, tail, tail_len);
+        memcpy(candidate + 8, ext, strlen(ext));
+        candidate[11] = '\0';
+
+        if (!shortname_exists(candidate, dir))
+        {
+            memcpy(shortname, candidate, 12);
+            return FAT32_OK;
+        }
+    }
+
+    // If we get here, we failed to generate a unique name
+    return FAT32_ERROR_DISK_FULL;
+}
+
+static uint8_t shortname_checksum(const char *shortname)
+{
+    // Calculate checksum for 8.3 filename
+    uint8_t sum = 0;
+    for (uint8_t i = 11; i > 0; i--)
+    {
+        // NOTE: The operation is an unsigned char rotate right
+        sum = ((sum & 1) ? 0x80 : 0) + (sum >> 1) + (uint8_t)*shortname++;
+    }
+    return sum;
+}
+
+static void lfn_to_str(fat32_lfn_entry_t *lfn_entry, char *buffer)
+{
+    // Convert UTF-16 parts to UTF-8
+    *(buffer++) = utf16_to_utf8(lfn_entry->name1[0]);
+    *(buffer++) = utf16_to_utf8(lfn_entry->name1[1]);
+    *(buffer++) = utf16_to_utf8(lfn_entry->name1[2]);
+    *(buffer++) = utf16_to_utf8(lfn_entry->name1[3]);
+    *(buffer++) = utf16_to_utf8(lfn_entry->name1[4]);
+    *(buffer++) = utf16_to_utf8(lfn_entry->name2[0]);
+    *(buffer++) = utf16_to_utf8(lfn_entry->name2[1]);
+    *(buffer++) = utf16_to_utf8(lfn_entry->name2[2]);
+    *(buffer++) = utf16_to_utf8(lfn_entry->name2[3]);
+    *(buffer++) = utf16_to_utf8(lfn_entry->name2[4]);
+    *(buffer++) = utf16_to_utf8(lfn_entry->name2[5]);
+    *(buffer++) = utf16_to_utf8(lfn_entry->name3[0]);
+    *(buffer++) = utf16_to_utf8(lfn_entry->name3[1]);
+}
+
+//
+// exFAT directory entries
+//
+
+// Fill in a directory entry from the entry set in entry_buffer.exfat_set, returning false
+// if the set is damaged
+static bool exfat_parse_set(uint32_t entries, fat32_entry_t *dir_entry)
+{
+    const exfat_dir_entry_t *set = entry_buffer.exfat_set;
+    const exfat_stream_entry_t *stream = &set[1].stream;
+    if (set[0].file.set_checksum != exfat_set_checksum(set[0].raw, entries) ||
+        stream->type != EXFAT_ENTRY_STREAM || stream->name_length == 0 ||
+        stream->name_length > (entries - 2) * EXFAT_NAME_PART_SIZE)
+    {
+        return false;
+    }
+
+    for (uint32_t i = 0; i < stream->name_length; i++)
+    {
+        const exfat_name_entry_t *name = &set[2 + i / EXFAT_NAME_PART_SIZE].name;
+        if (name->type != EXFAT_ENTRY_NAME)
+        {
+            return false;
+        }
+        dir_entry->filename[i] = utf16_to_utf8(name->name[i % EXFAT_NAME_PART_SIZE]);
+    }
+    dir_entry->filename[stream->name_length] = '\0';
+
+    dir_entry->attr = set[0].file.attributes & 0xFF;
+    // Sizes are 32 bits here; files of 4 GB or more can be read up to there but not written
+    dir_entry->size = stream->data_length > UINT32_MAX ? UINT32_MAX : (uint32_t)stream->data_length;
+    dir_entry->start_cluster = stream->first_cluster;
+    dir_entry->contiguous = (stream->flags & EXFAT_STREAM_NO_FAT_CHAIN) != 0;
+    dir_entry->date = set[0].file.modify_timestamp >> 16;
+    dir_entry->time = set[0].file.modify_timestamp & 0xFFFF;
+    return true;
+}
+
+// Read the next file, directory or volume label from an exFAT directory. Entry sets with a
+// bad checksum are skipped.
+static fat32_error_t exfat_dir_read(fat32_file_t *dir, fat32_entry_t *dir_entry)
+{
+    exfat_dir_entry_t *set = entry_buffer.exfat_set;
+    uint32_t expected = 0; // Entries in the set being read
+    uint32_t count = 0;    // Entries of it read so far
+    uint32_t set_sector = 0;
+    uint32_t set_offset = 0;
+
+    while (!exfat_dir_end(dir))
+    {
+        exfat_dir_entry_t entry;
+        uint32_t sector, offset;
+        RETURN_ON_ERROR(exfat_next_entry(dir, &entry, &sector, &offset));
+
+        if (entry.type == EXFAT_ENTRY_END)
+        {
+            dir->last_entry_read = true;
+        }
+        else if (entry.type == EXFAT_ENTRY_FILE)
+        {
+            // Start of an entry set: the file entry, a stream extension entry and the name
+            expected = 1 + entry.file.secondary_count;
+            count = 0;
+            if (expected >= 3 && expected <= EXFAT_MAX_SET_ENTRIES)
+            {
+                set[count++] = entry;
+                set_sector = sector;
+                set_offset = offset;
+            }
+        }
+        else if (count > 0 && (entry.type & EXFAT_ENTRY_SECONDARY) && (entry.type & EXFAT_ENTRY_IN_USE))
+        {
+            set[count++] = entry;
+            if (count == expected)
+            {
+                count = 0;
+                if (exfat_parse_set(expected, dir_entry))
+                {
+                    dir_entry->sector = set_sector;
+                    dir_entry->offset = set_offset;
+                    dir_entry->dir_contiguous = dir->contiguous;
+                    return FAT32_OK;
+                }
+            }
+        }
+        else
+        {
+            count = 0; // Not part of a set, so any set being read was cut short
+            if (entry.type == EXFAT_ENTRY_LABEL)
+            {
+                uint8_t length = entry.label.length;
+                if (length > 11)
+                {
+                    length = 11;
+                }
+                for (uint8_t i = 0; i < length; i++)
+                {
+                    dir_entry->filename[i] = utf16_to_utf8(entry.label.label[i]);
+                }
+                dir_entry->filename[length] = '\0';
+                dir_entry->attr = FAT32_ATTR_VOLUME_ID;
+                return FAT32_OK;
+            }
+        }
+    }
+    return FAT32_OK; // End of directory, filename is empty
+}
+
+// Hash of a file name, stored in its stream extension entry to speed up searches. The
+// hash is of the up-cased name; names are ASCII, so only a to z change.
+static uint16_t exfat_name_hash(const char *name)
+{
+    uint16_t hash = 0;
+    for (; *name; name++)
+    {
+        uint16_t ch = utf8_to_utf16((*name >= 'a' && *name <= 'z') ? *name - 'a' + 'A' : *name);
+        hash = ((hash & 1) ? 0x8000 : 0) + (hash >> 1) + (ch & 0xFF);
+        hash = ((hash & 1) ? 0x8000 : 0) + (hash >> 1) + (ch >> 8);
+    }
+    return hash;
+}
+
+// Turn a path into an absolute one without "." or ".." components. exFAT directories have
+// no "." and ".." entries, so these are resolved from the path instead of on the card.
+static fat32_error_t exfat_absolute_path(const char *path, char *absolute, size_t absolute_len)
+{
+    size_t length = 0;
+    if (path[0] != '/' && strcmp(exfat_current_dir, "/") != 0)
+    {
+        length = strlen(exfat_current_dir);
+        if (length >= absolute_len)
+        {
+            return FAT32_ERROR_INVALID_PATH;
+        }
+        memcpy(absolute, exfat_current_dir, length);
+    }
+    absolute[length] = '\0';
+
+    char path_copy[FAT32_MAX_PATH_LEN];
+    strncpy(path_copy, path, sizeof(path_copy) - 1);
+    path_copy[sizeof(path_copy) - 1] = '\0';
+
+    char *saveptr = NULL;
+    for (char *token = strtok_r(path_copy, "/", &saveptr); token; token = strtok_r(NULL, "/", &saveptr))
+    {
+        if (strcmp(token, ".") == 0)
+        {
+            continue;
+        }
+        if (strcmp(token, "..") == 0)
+        {
+            char *slash = strrchr(absolute, '/');
+            length = slash ? slash - absolute : 0;
+            absolute[length] = '\0';
+            continue;
+        }
+
+        size_t token_len = strlen(token);
+        if (length + 1 + token_len >= absolute_len)
+        {
+            return FAT32_ERROR_INVALID_PATH;
+        }
+        absolute[length++] = '/';
+        memcpy(absolute + length, token, token_len + 1);
+        length += token_len;
+    }
+
+    if (length == 0)
+    {
+        strcpy(absolute, "/");
+    }
+    return FAT32_OK;
+}
+
+// Give a directory one more cleared cluster, with current_cluster left on it. The root
+// directory has no entry set; other directories record their length in theirs.
+static fat32_error_t exfat_grow_dir(fat32_file_t *dir)
+{
+    uint32_t clusters = dir->position / bytes_per_cluster;
+    uint32_t last = dir->current_cluster;
+    uint32_t cluster;
+    RETURN_ON_ERROR(exfat_allocate(dir, clusters, last, 1));
+    RETURN_ON_ERROR(next_file_cluster(dir, last, &cluster));
+    RETURN_ON_ERROR(clear_cluster(cluster));
+
+    dir->current_cluster = cluster;
+    dir->last_entry_read = false;
+    if (dir->dir_entry_sector != 0)
+    {
+        dir->file_size += bytes_per_cluster;
+        RETURN_ON_ERROR(exfat_update_entry(dir));
+    }
+    return FAT32_OK;
+}
+
+// Add an entry set for a file or directory to an exFAT directory. New directories get one
+// cleared cluster; new files get none until they are written. An entry that already has a
+// location is being renamed, and keeps the attributes, times and length of its old set.
+static fat32_error_t exfat_link_entry(fat32_file_t *dir, const char *filename, fat32_entry_t *entry)
+{
+    size_t length = strlen(filename);
+    if (length == 0 || length > FAT32_MAX_FILENAME_LEN)
+    {
+        return FAT32_ERROR_INVALID_PATH;
+    }
+    uint32_t entries = 2 + (length + EXFAT_NAME_PART_SIZE - 1) / EXFAT_NAME_PART_SIZE;
+
+    exfat_dir_entry_t head[2]; // File and stream extension entries
+    if (entry->sector != 0)
+    {
+        uint32_t old_entries;
+        RETURN_ON_ERROR(exfat_read_set(entry->sector, entry->offset, entry->dir_contiguous, &old_entries));
+        memcpy(head, entry_buffer.exfat_set, sizeof(head));
+    }
+    else
+    {
+        if ((entry->attr & FAT32_ATTR_DIRECTORY) && entry->start_cluster == 0)
+        {
+            fat32_file_t new_dir = {0};
+            RETURN_ON_ERROR(exfat_allocate(&new_dir, 0, 0, 1));
+            RETURN_ON_ERROR(clear_cluster(new_dir.start_cluster));
+            entry->start_cluster = new_dir.start_cluster;
+            entry->contiguous = true;
+            entry->size = bytes_per_cluster;
+        }
+
+        memset(head, 0, sizeof(head));
+        head[0].file.attributes = entry->attr;
+        head[1].stream.flags = EXFAT_STREAM_ALLOCATION_POSSIBLE | (entry->contiguous ? EXFAT_STREAM_NO_FAT_CHAIN : 0);
+        head[1].stream.first_cluster = entry->start_cluster;
+        head[1].stream.data_length = entry->size;
+        head[1].stream.valid_data_length = entry->size;
+    }
+    head[0].type = EXFAT_ENTRY_FILE;
+    head[0].file.secondary_count = entries - 1;
+    head[1].type = EXFAT_ENTRY_STREAM;
+    head[1].stream.name_length = length;
+    head[1].stream.name_hash = exfat_name_hash(filename);
+
+    // Find enough unused entries in a row, growing the directory if it runs out
+    uint32_t run = 0;
+    uint32_t run_sector = 0;
+    uint32_t run_offset = 0;
+    dir->position = 0;
+    dir->current_cluster = dir->start_cluster;
+    dir->last_entry_read = false;
+    while (run < entries)
+    {
+        if (exfat_dir_end(dir))
+        {
+            RETURN_ON_ERROR(exfat_grow_dir(dir));
+        }
+
+        exfat_dir_entry_t dir_entry;
+        uint32_t sector, offset;
+        RETURN_ON_ERROR(exfat_next_entry(dir, &dir_entry, &sector, &offset));
+        if (dir_entry.type & EXFAT_ENTRY_IN_USE)
+        {
+            run = 0;
+        }
+        else if (run++ == 0)
+        {
+            run_sector = sector;
+            run_offset = offset;
+        }
+    }
+
+    // Build and write the entry set
+    exfat_dir_entry_t *set = entry_buffer.exfat_set;
+    memset(set, 0, entries * sizeof(exfat_dir_entry_t));
+    memcpy(set, head, sizeof(head));
+    for (size_t i = 0; i < length; i++)
+    {
+        exfat_name_entry_t *name = &set[2 + i / EXFAT_NAME_PART_SIZE].name;
+        name->type = EXFAT_ENTRY_NAME;
+        name->name[i % EXFAT_NAME_PART_SIZE] = utf8_to_utf16(filename[i]);
+    }
+    RETURN_ON_ERROR(exfat_write_set(run_sector, run_offset, dir->contiguous, entries));
+
+    entry->sector = run_sector;
+    entry->offset = run_offset;
+    entry->dir_contiguous = dir->contiguous;
+    return FAT32_OK;
+}
+
+// Mark the entry set of a file or directory as unused, setting *clusters to the number of
+// clusters it held (from its 64-bit length, which fat32_entry_t cannot hold)
+static fat32_error_t exfat_unlink_entry(const fat32_entry_t *entry, uint32_t *clusters)
+{
+    if (entry->sector == 0)
+    {
+        return FAT32_ERROR_INVALID_PARAMETER; // The root directory
+    }
+
+    uint32_t entries;
+    RETURN_ON_ERROR(exfat_read_set(entry->sector, entry->offset, entry->dir_contiguous, &entries));
+
+    uint64_t data_length = entry_buffer.exfat_set[1].stream.data_length;
+    *clusters = (data_length + bytes_per_cluster - 1) / bytes_per_cluster;
+    for (uint32_t i = 0; i < entries; i++)
+    {
+        entry_buffer.exfat_set[i].type &= ~EXFAT_ENTRY_IN_USE;
+    }
+    return exfat_write_set(entry->sector, entry->offset, entry->dir_contiguous, entries);
+}
+
+//
+// Directory entries
+//
+
+static fat32_error_t find_entry(fat32_entry_t *dir_entry, const char *path)
+{
+    if (!dir_entry || !path)
+    {
+        return FAT32_ERROR_INVALID_PARAMETER;
+    }
+
+    memset(dir_entry, 0, sizeof(fat32_entry_t));
+
+    char absolute[FAT32_MAX_PATH_LEN];
+    if (volume_exfat)
+    {
+        // Searched from the root, as directories are only found by name on exFAT
+        RETURN_ON_ERROR(exfat_absolute_path(path, absolute, sizeof(absolute)));
+        path = absolute;
+    }
+
+    // Determine starting cluster: root or current
+    uint32_t cluster = current_dir_cluster;
+
+    if (strcmp(path, "/") == 0)
+    {
+        // If path is empty, return current directory
+        dir_entry->start_cluster = root_cluster;
+        dir_entry->attr = FAT32_ATTR_DIRECTORY;
+        return FAT32_OK;
+    }
+
+    // If the path is empty, or refers to the current or parent directory of the root directory
+    if (path[0] == '\0' || ((strcmp(path, ".") == 0 || strcmp(path, "..") == 0) &&
+                            current_dir_cluster == root_cluster))
+    {
+        // Special case: current directory or parent directory of the root directory
+        dir_entry->start_cluster = current_dir_cluster;
+        dir_entry->attr = FAT32_ATTR_DIRECTORY;
+        return FAT32_OK;
+    }
+
+    if (path[0] == '/')
+    {
+        cluster = root_cluster;
+    }
+
+    // Copy path and tokenize
+    char path_copy[FAT32_MAX_PATH_LEN];
+    strncpy(path_copy, path + (path[0] == '/' ? 1 : 0), sizeof(path_copy) - 1);
+    path_copy[sizeof(path_copy) - 1] = '\0';
+
+    char *saveptr = NULL;
+    char *token = strtok_r(path_copy, "/", &saveptr);
+    char *next_token = NULL;
+    uint32_t dir_size = 0;        // Length of the directory (exFAT)
+    bool dir_contiguous = false;  // Directory has no FAT chain (exFAT)
+
+    while (token)
+    {
+        next_token = strtok_r(NULL, "/", &saveptr);
+
+        // Open the current directory cluster
+        fat32_file_t dir = {0};
+        dir.is_open = true;
+        dir.attributes = FAT32_ATTR_DIRECTORY;
+        dir.start_cluster = cluster;
+        dir.current_cluster = cluster;
+        dir.position = 0;
+        dir.file_size = dir_size;
+        dir.contiguous = dir_contiguous;
+
+        bool found = false;
+        fat32_entry_t entry;
+        while (fat32_dir_read(&dir, &entry) == FAT32_OK && entry.filename[0])
+        {
+            if (strcasecmp(entry.filename, token) == 0)
+            {
+                // If this is the last component, return the entry
+                if (!next_token)
+                {
+                    memcpy(dir_entry, &entry, sizeof(fat32_entry_t));
+                    fat32_close(&dir);
+                    return FAT32_OK;
+                }
+                // If not last, must be a directory
+                if (entry.attr & FAT32_ATTR_DIRECTORY)
+                {
+                    cluster = entry.start_cluster ? entry.start_cluster : root_cluster;
+                    dir_size = volume_exfat ? entry.size : 0;
+                    dir_contiguous = entry.contiguous;
+                    found = true;
+                    break;
+                }
+            }
+        }
+        fat32_close(&dir);
+        if (!found && next_token)
+        {
+            return FAT32_ERROR_DIR_NOT_FOUND; // Intermediate directory not found
+        }
+        token = next_token;
+    }
+
+    return FAT32_ERROR_FILE_NOT_FOUND; // Not found
+}
+
+static fat32_error_t unlink_entry(fat32_entry_t *entry)
+{
+    if (entry && volume_exfat)
+    {
+        uint32_t clusters;
+        return exfat_unlink_entry(entry, &clusters); // Empty files have no clusters on exFAT
+    }
+
+    if (!entry || entry->start_cluster == 0)
+    {
+        return FAT32_ERROR_INVALID_PARAMETER;
+    }
+
+    // Mark the entry as deleted
+    uint32_t sector = entry->sector;
+    uint32_t offset = entry->offset;
+
+    RETURN_ON_ERROR(read_sector(sector, sector_buffer));
+
+    // Scan backwards for LFN entries
+    int lfn_count = 0;
+    for (int i = 1; i <= MAX_LFN_PART; i++)
+    {
+        if (offset < i * 32)
+        {
+            break;
+        }
+        fat32_dir_entry_t *lfn_entry = (fat32_dir_entry_t *)(sector_buffer + offset - i * 32);
+        if (lfn_entry->attr == FAT32_ATTR_LONG_NAME)
+        {
+            lfn_entry->shortname[0] = FAT32_DIR_ENTRY_FREE;
+            lfn_count++;
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    // Mark 8.3 entry as deleted
+    fat32_dir_entry_t *dir_entry = (fat32_dir_entry_t *)(sector_buffer + offset);
+    dir_entry->shortname[0] = FAT32_DIR_ENTRY_FREE;
+
+    RETURN_ON_ERROR(write_sector(sector, sector_buffer));
+
+    return FAT32_OK;
+}
+
+static fat32_error_t link_entry(fat32_entry_t *entry, const char *path)
+{
+    if (!entry || !path)
+    {
+        return FAT32_ERROR_INVALID_PARAMETER;
+    }
+
+    if (!fat32_is_ready())
+    {
+        return mount_status;
+    }
+
+    fat32_entry_t temp_entry;
+    fat32_error_t result = find_entry(&temp_entry, path);
+    if (result != FAT32_ERROR_FILE_NOT_FOUND)
+    {
+        if (result == FAT32_OK)
+        {
+            return FAT32_ERROR_FILE_EXISTS;
+        }
+        return result;
+    }
+
+    // Split path into parent and filename
+    char path_copy[FAT32_MAX_PATH_LEN];
+    strncpy(path_copy, path, sizeof(path_copy) - 1);
+    path_copy[sizeof(path_copy) - 1] = '\0';
+    char *filename = strrchr(path_copy, '/');
+    char *parent_path = path_copy;
+    if (filename)
+    {
+        *filename = '\0';
+        filename++;
+    }
+    else
+    {
+        filename = path_copy;
+        parent_path = "";
+    }
+
+    // Open parent directory
+    fat32_file_t dir;
+    RETURN_ON_ERROR(fat32_open(&dir, parent_path));
+
+    if (volume_exfat)
+    {
+        result = (dir.attributes & FAT32_ATTR_DIRECTORY) ? exfat_link_entry(&dir, filename, entry)
+                                                        : FAT32_ERROR_NOT_A_DIRECTORY;
+        fat32_close(&dir);
+        return result;
+    }
+
+    // Prepare short and long file names
+    // We always use long files names to preserve case and special characters
+    char shortname[12];
+    size_t needed_entries = filename_to_lfn(filename);
+
+    if (valid_shortname(filename))
+    {
+        filename_to_shortname(filename, shortname);
+    }
+    else
+    {
+        CLOSE_AND_RETURN_ON_ERROR(unique_shortname(&dir, filename, shortname));
+    }
+
+    // Find enough free directory entries (LFN + 8.3)
+    uint32_t free_entry_pos = 0;
+    uint32_t free_entry_cluster = dir.current_cluster;
+    size_t free_count = 0;
+    bool found = false;
+    dir.position = 0;
+    uint32_t entry_pos = 0;
+    uint32_t cluster = dir.current_cluster;
+    while (!found)
+    {
+        uint32_t cluster_offset = entry_pos % bytes_per_cluster;
+        uint32_t sector_in_cluster = cluster_offset / FAT32_SECTOR_SIZE;
+        uint32_t sector = cluster_to_sector(cluster) + sector_in_cluster;
+
+        CLOSE_AND_RETURN_ON_ERROR(read_sector(sector, sector_buffer));
+
+        for (uint32_t i = 0; i < FAT32_SECTOR_SIZE; i += 32)
+        {
+            fat32_dir_entry_t *entry_ptr = (fat32_dir_entry_t *)(sector_buffer + i);
+            if (entry_ptr->shortname[0] == FAT32_DIR_ENTRY_FREE || entry_ptr->shortname[0] == FAT32_DIR_ENTRY_END_MARKER)
+            {
+                if (free_count == 0)
+                {
+                    free_entry_pos = entry_pos + i;
+                    free_entry_cluster = cluster;
+                }
+                free_count++;
+                if (free_count > needed_entries)
+                {
+                    found = true;
+                    break;
+                }
+            }
+            else
+            {
+                free_count = 0;
+            }
+        }
+        if (found)
+        {
+            break;
+        }
+
+        entry_pos += FAT32_SECTOR_SIZE;
+        if ((entry_pos % bytes_per_cluster) == 0)
+        {
+            uint32_t next_cluster;
+            result = read_cluster_fat_entry(cluster, &next_cluster);
+            if (result != FAT32_OK || next_cluster >= FAT32_FAT_ENTRY_EOC)
+            {
+                // Allocate a new cluster for the directory
+                uint32_t new_dir_cluster = 0;
+                CLOSE_AND_RETURN_ON_ERROR(allocate_and_link_cluster(cluster, &new_dir_cluster));
+                CLOSE_AND_RETURN_ON_ERROR(clear_cluster(new_dir_cluster));
+                cluster = new_dir_cluster;
+            }
+            else
+            {
+                cluster = next_cluster;
+            }
+        }
+    }
+
+    // Update the directory entry with the new cluster
+    uint8_t checksum = shortname_checksum(shortname);
+
+    // Write LFN entries in reverse order (last entry first)
+    for (int i = 0; i < needed_entries; i++)
+    {
+        uint8_t index = needed_entries - i - 1;
+
+        // Calculate position for this LFN entry
+        uint32_t entry_offset = free_entry_pos + (i * 32);
+        uint32_t entry_cluster_offset = entry_offset % bytes_per_cluster;
+        uint32_t entry_sector_in_cluster = entry_cluster_offset / FAT32_SECTOR_SIZE;
+        uint32_t entry_byte_in_sector = entry_cluster_offset % FAT32_SECTOR_SIZE;
+        uint32_t current_cluster = free_entry_cluster;
+
+        // Check if we need to move to next cluster
+        while (entry_sector_in_cluster >= sectors_per_cluster)
+        {
+            uint32_t next_cluster;
+            result = read_cluster_fat_entry(current_cluster, &next_cluster);
+            if (result != FAT32_OK || next_cluster >= FAT32_FAT_ENTRY_EOC)
+            {
+                fat32_close(&dir);
+                return FAT32_ERROR_DISK_FULL;
+            }
+            current_cluster = next_cluster;
+            entry_sector_in_cluster -= sectors_per_cluster;
+        }
+
+        uint32_t entry_sector = cluster_to_sector(current_cluster) + entry_sector_in_cluster;
+
+        // Read the sector if needed
+        CLOSE_AND_RETURN_ON_ERROR(read_sector(entry_sector, sector_buffer));
+
+        // Set up the LFN entry with checksum and sequence number
+        fat32_lfn_entry_t *lfn_entry = &entry_buffer.lfn[index];
+        lfn_entry->seq = (i == 0) ? (index + 1) | 0x40 : (index + 1); // Set last entry flag
+        lfn_entry->attr = FAT32_ATTR_LONG_NAME;
+        lfn_entry->type = 0;
+        lfn_entry->checksum = checksum;
+        lfn_entry->first_clus = 0;
+
+        // Copy LFN entry to sector buffer
+        memcpy(sector_buffer + entry_byte_in_sector, lfn_entry, sizeof(fat32_lfn_entry_t));
+
+        // Write the sector back
+        CLOSE_AND_RETURN_ON_ERROR(write_sector(entry_sector, sector_buffer));
+    }
+
+    // Allocate a new cluster for the file, if needed
+    if (entry->start_cluster == 0)
+    {
+        CLOSE_AND_RETURN_ON_ERROR(get_next_free_cluster(&entry->start_cluster));
+        CLOSE_AND_RETURN_ON_ERROR(write_cluster_fat_entry(entry->start_cluster, FAT32_FAT_ENTRY_EOC));
+
+        if (fsinfo.free_count != 0xFFFFFFFF)
+        {
+            fsinfo.free_count--;
+            update_fsinfo();
+        }
+    }
+
+    // Write 8.3 entry
+    fat32_dir_entry_t dir_entry = {0};
+    memcpy(dir_entry.shortname, shortname, 11);
+    dir_entry.attr = entry->attr; // Normal file
+    dir_entry.nt_res = 0;
+    dir_entry.crt_time_tenth = 0;
+    dir_entry.crt_time = 0;
+    dir_entry.crt_date = 0;
+    dir_entry.lst_acc_date = 0;
+    dir_entry.fst_clus_hi = entry->start_cluster >> 16;
+    dir_entry.wrt_time = 0;
+    dir_entry.wrt_date = 0;
+    dir_entry.fst_clus_lo = entry->start_cluster & 0xFFFF;
+    dir_entry.file_size = entry->size;
+
+    uint32_t raw_offset = free_entry_pos + (needed_entries * 32);
+    entry->sector = cluster_to_sector(free_entry_cluster) + ((raw_offset % bytes_per_cluster) / FAT32_SECTOR_SIZE);
+    entry->offset = (raw_offset % FAT32_SECTOR_SIZE);
+    CLOSE_AND_RETURN_ON_ERROR(read_sector(entry->sector, sector_buffer));
+    memcpy(sector_buffer + entry->offset, &dir_entry, sizeof(dir_entry));
+    CLOSE_AND_RETURN_ON_ERROR(write_sector(entry->sector, sector_buffer));
+
+    fat32_close(&dir);
+
+    return FAT32_OK; // Successfully linked the entry
+}
+
+static fat32_error_t new_entry(fat32_file_t *file, const char *path, uint8_t attr)
+{
+    if (!file || !path)
+    {
+        return FAT32_ERROR_INVALID_PARAMETER;
+    }
+
+    memset(file, 0, sizeof(fat32_file_t));
+
+    fat32_entry_t entry;
+    memset(&entry, 0, sizeof(fat32_entry_t));
+    entry.attr = attr;
+
+    RETURN_ON_ERROR(link_entry(&entry, path));
+
+    file->is_open = true;
+    file->start_cluster = entry.start_cluster;
+    file->current_cluster = file->start_cluster;
+    file->attributes = entry.attr;
+    file->file_size = entry.size;
+    file->dir_entry_sector = entry.sector;
+    file->dir_entry_offset = entry.offset;
+    file->contiguous = entry.contiguous;
+    file->dir_contiguous = entry.dir_contiguous;
+
+    return FAT32_OK; // Successfully created new file
+}
+
+static fat32_error_t delete_entry(const char *path)
+{
+    fat32_entry_t entry;
+    RETURN_ON_ERROR(find_entry(&entry, path));
+
+    if (entry.attr & FAT32_ATTR_DIRECTORY)
+    {
+        // Check if directory is empty (only "." and ".." allowed)
+        fat32_file_t dir;
+        RETURN_ON_ERROR(fat32_open(&dir, path));
+
+        fat32_entry_t sub_entry;
+        int entry_count = 0;
+        while (fat32_dir_read(&dir, &sub_entry) == FAT32_OK && sub_entry.filename[0])
+        {
+            if (strcmp(sub_entry.filename, ".") != 0 && strcmp(sub_entry.filename, "..") != 0)
+            {
+                fat32_close(&dir);
+                return FAT32_ERROR_DIR_NOT_EMPTY;
+            }
+            entry_count++;
+        }
+        fat32_close(&dir);
+    }
+
+    if (volume_exfat)
+    {
+        uint32_t clusters;
+        RETURN_ON_ERROR(exfat_unlink_entry(&entry, &clusters));
+        return exfat_release(entry.start_cluster, clusters, entry.contiguous);
+    }
+
+    // Unlink the entry
+    RETURN_ON_ERROR(unlink_entry(&entry));
+
+    // Free the clusters used by the entry
+    RETURN_ON_ERROR(release_cluster_chain(entry.start_cluster));
+
+    return FAT32_OK;
+}
+
+//
+// File operations (simplified implementation)
+//
+
+fat32_error_t fat32_open(fat32_file_t *file, const char *path)
+{
+    if (!file || !path)
+    {
+        return FAT32_ERROR_INVALID_PARAMETER;
+    }
+
+    if (strlen(path) > FAT32_MAX_PATH_LEN)
+    {
+        return FAT32_ERROR_INVALID_PATH; // Path too long
     }
 
-    // Numeric tail generation: try ~1 to ~999999
-    for (int n = 1; n < 1000000; n++)
+    if (!fat32_is_ready())
     {
-        char tail[8];
-        snprintf(tail, sizeof(tail), "~%d", n);
-        size_t tail_len = strlen(tail);
+        return mount_status;
+    }
 
-        size_t base_len = 8 - tail_len;
-        if (base_len > strlen(base))
-            base_len = strlen(base);
+    memset(file, 0, sizeof(fat32_file_t));
 
-        memset(candidate, ' ', 11);
-        memcpy(candidate, base, base_len);
-        memcpy(candidate + base_len, tail, tail_len);
-        memcpy(candidate + 8, ext, strlen(ext));
-        candidate[11] = '\0';
+    fat32_entry_t entry;
+    RETURN_ON_ERROR(find_entry(&entry, path));
 
-        if (!shortname_exists(candidate, dir))
-        {
-            memcpy(shortname, candidate, 12);
-            return FAT32_OK;
-        }
+    if (entry.attr & FAT32_ATTR_VOLUME_ID)
+    {
+        return FAT32_ERROR_NOT_A_FILE; // Not a valid file
+    }
+    if (entry.attr & FAT32_ATTR_DIRECTORY)
+    {
+        file->start_cluster = entry.start_cluster ? entry.start_cluster : root_cluster;
+        file->file_size = volume_exfat ? entry.size : 0; // Directories have no size in FAT32
+    }
+    else
+    {
+        // Found the file
+        file->start_cluster = entry.start_cluster;
+        file->file_size = entry.size;
     }
+    file->is_open = true;
+    file->current_cluster = file->start_cluster;
+    file->position = 0;
+    file->attributes = entry.attr;
+    file->dir_entry_sector = entry.sector;
+    file->dir_entry_offset = entry.offset;
+    file->contiguous = entry.contiguous;
+    file->dir_contiguous = entry.dir_contiguous;
 
-    // If we get here, we failed to generate a unique name
-    return FAT32_ERROR_DISK_FULL;
+    return FAT32_OK;
 }
 
-static uint8_t shortname_checksum(const char *shortname)
+fat32_error_t fat32_create(fat32_file_t *file, const char *path)
 {
-    // Calculate checksum for 8.3 filename
-    uint8_t sum = 0;
-    for (uint8_t i = 11; i > 0; i--)
-    {
-        // NOTE: The operation is an unsigned char rotate right
-        sum = ((sum & 1) ? 0x80 : 0) + (sum >> 1) + (uint8_t)*shortname++;
-    }
-    return sum;
+    return new_entry(file, path, FAT32_ATTR_ARCHIVE);
 }
 
-static void lfn_to_str(fat32_lfn_entry_t *lfn_entry, char *buffer)
+fat32_error_t fat32_close(fat32_file_t *file)
 {
-    // Convert UTF-16 parts to UTF-8
-    *(buffer++) = utf16_to_utf8(lfn_entry->name1[0]);
-    *(buffer++) = utf16_to_utf8(lfn_entry->name1[1]);
-    *(buffer++) = utf16_to_utf8(lfn_entry->name1[2]);
-    *(buffer++) = utf16_to_utf8(lfn_entry->name1[3]);
-    *(buffer++) = utf16_to_utf8(lfn_entry->name1[4]);
-    *(buffer++) = utf16_to_utf8(lfn_entry->name2[0]);
-    *(buffer++) = utf16_to_utf8(lfn_entry->name2[1]);
-    *(buffer++) = utf16_to_utf8(lfn_entry->name2[2]);
-    *(buffer++) = utf16_to_utf8(lfn_entry->name2[3]);
-    *(buffer++) = utf16_to_utf8(lfn_entry->name2[4]);
-    *(buffer++) = utf16_to_utf8(lfn_entry->name2[5]);
-    *(buffer++) = utf16_to_utf8(lfn_entry->name3[0]);
-    *(buffer++) = utf16_to_utf8(lfn_entry->name3[1]);
+    if (file && file->is_open)
+    {
+        memset(file, 0, sizeof(fat32_file_t));
+    }
+
+    return FAT32_OK;
 }
 
-static fat32_error_t find_entry(fat32_entry_t *dir_entry, const char *path)
+fat32_error_t fat32_read(fat32_file_t *file, void *buffer, size_t size, size_t *bytes_read)
 {
-    if (!dir_entry || !path)
+    if (!file || !file->is_open || !buffer)
     {
         return FAT32_ERROR_INVALID_PARAMETER;
     }
 
-    memset(dir_entry, 0, sizeof(fat32_entry_t));
+    if (file->attributes & FAT32_ATTR_DIRECTORY)
+    {
+        return FAT32_ERROR_NOT_A_FILE; // Cannot read from a directory
+    }
 
-    // Determine starting cluster: root or current
-    uint32_t cluster = current_dir_cluster;
+    if (!fat32_is_ready())
+    {
+        return mount_status;
+    }
 
-    if (strcmp(path, "/") == 0)
+    if (bytes_read)
     {
-        // If path is empty, return current directory
-        dir_entry->start_cluster = boot_sector.root_cluster;
-        dir_entry->attr = FAT32_ATTR_DIRECTORY;
-        return FAT32_OK;
+        *bytes_read = 0;
     }
 
-    // If the path is empty, or refers to the current or parent directory of the root directory
-    if (path[0] == '\0' || ((strcmp(path, ".") == 0 || strcmp(path, "..") == 0) &&
-                            current_dir_cluster == boot_sector.root_cluster))
+    if (file->position >= file->file_size)
     {
-        // Special case: current directory or parent directory of the root directory
-        dir_entry->start_cluster = current_dir_cluster;
-        dir_entry->attr = FAT32_ATTR_DIRECTORY;
-        return FAT32_OK;
+        return FAT32_OK; // EOF
     }
 
-    if (path[0] == '/')
+    size_t remaining = file->file_size - file->position;
+    if (size > remaining)
     {
-        cluster = boot_sector.root_cluster;
+        size = remaining;
     }
 
-    // Copy path and tokenize
-    char path_copy[FAT32_MAX_PATH_LEN];
-    strncpy(path_copy, path + (path[0] == '/' ? 1 : 0), sizeof(path_copy) - 1);
-    path_copy[sizeof(path_copy) - 1] = '\0';
+    // Ensure current_cluster is correct for current file position
+    uint32_t cluster = 0;
+    uint32_t cluster_offset = file->position / bytes_per_cluster;
+    RETURN_ON_ERROR(seek_to_file_cluster(file, cluster_offset, &cluster));
+    file->current_cluster = cluster;
 
-    char *saveptr = NULL;
-    char *token = strtok_r(path_copy, "/", &saveptr);
-    char *next_token = NULL;
+    size_t total_read = 0;
+    uint8_t *dest = (uint8_t *)buffer;
 
-    while (token)
+    while (total_read < size)
     {
-        next_token = strtok_r(NULL, "/", &saveptr);
+        uint32_t cluster_offset = file->position % bytes_per_cluster;
+        uint32_t sector_in_cluster = cluster_offset / FAT32_SECTOR_SIZE;
+        uint32_t byte_in_sector = cluster_offset % FAT32_SECTOR_SIZE;
 
-        // Open the current directory cluster
-        fat32_file_t dir = {0};
-        dir.is_open = true;
-        dir.attributes = FAT32_ATTR_DIRECTORY;
-        dir.start_cluster = cluster;
-        dir.current_cluster = cluster;
-        dir.position = 0;
+        uint32_t sector = cluster_to_sector(file->current_cluster) + sector_in_cluster;
 
-        bool found = false;
-        fat32_entry_t entry;
-        while (fat32_dir_read(&dir, &entry) == FAT32_OK && entry.filename[0])
+        // Whole sectors of a contiguous file come in one command, straight into the buffer
+        if (file->contiguous && byte_in_sector == 0 && size - total_read >= FAT32_SECTOR_SIZE)
         {
-            if (strcasecmp(entry.filename, token) == 0)
-            {
-                // If this is the last component, return the entry
-                if (!next_token)
-                {
-                    memcpy(dir_entry, &entry, sizeof(fat32_entry_t));
-                    fat32_close(&dir);
-                    return FAT32_OK;
-                }
-                // If not last, must be a directory
-                if (entry.attr & FAT32_ATTR_DIRECTORY)
-                {
-                    cluster = entry.start_cluster ? entry.start_cluster : boot_sector.root_cluster;
-                    found = true;
-                    break;
-                }
-            }
+            uint32_t sectors = (size - total_read) / FAT32_SECTOR_SIZE;
+            RETURN_ON_ERROR(sd_read_blocks(volume_start_block + sector, sectors, dest + total_read));
+            total_read += sectors * FAT32_SECTOR_SIZE;
+            file->position += sectors * FAT32_SECTOR_SIZE;
+            file->current_cluster = file->start_cluster + file->position / bytes_per_cluster;
+            continue;
         }
-        fat32_close(&dir);
-        if (!found && next_token)
+
+        // Small reads in a row take the same sector from the cache
+        const uint8_t *data;
+        RETURN_ON_ERROR(cache_read(volume_start_block + sector, &data));
+
+        size_t bytes_to_copy = FAT32_SECTOR_SIZE - byte_in_sector;
+        if (bytes_to_copy > size - total_read)
         {
-            return FAT32_ERROR_DIR_NOT_FOUND; // Intermediate directory not found
+            bytes_to_copy = size - total_read;
+        }
+
+        memcpy(dest + total_read, data + byte_in_sector, bytes_to_copy);
+        total_read += bytes_to_copy;
+        file->position += bytes_to_copy;
+
+        // Check if we need to move to the next cluster
+        if ((file->position % bytes_per_cluster) == 0 && total_read < size)
+        {
+            uint32_t next_cluster;
+            RETURN_ON_ERROR(next_file_cluster(file, file->current_cluster, &next_cluster));
+            if (next_cluster >= FAT32_FAT_ENTRY_EOC)
+            {
+                // End of cluster chain or error
+                break;
+            }
+            file->current_cluster = next_cluster;
         }
-        token = next_token;
     }
 
-    return FAT32_ERROR_FILE_NOT_FOUND; // Not found
+    if (bytes_read)
+    {
+        *bytes_read = total_read;
+    }
+    return FAT32_OK;
 }
 
-static fat32_error_t unlink_entry(fat32_entry_t *entry)
+// Pin the sectors holding part of a file in the cache and return a pointer into them. The
+// sectors go in slots next to each other, so the window reads as one piece of memory.
+fat32_error_t fat32_map(fat32_file_t *file, uint32_t offset, uint32_t length, const void **ptr)
 {
-    if (!entry || entry->start_cluster == 0)
+    if (!file || !file->is_open || !ptr || length == 0)
     {
         return FAT32_ERROR_INVALID_PARAMETER;
     }
+    if (file->attributes & FAT32_ATTR_DIRECTORY)
+    {
+        return FAT32_ERROR_NOT_A_FILE;
+    }
+    if (!fat32_is_ready())
+    {
+        return mount_status;
+    }
+    if ((uint64_t)offset + length > file->file_size)
+    {
+        return FAT32_ERROR_INVALID_POSITION;
+    }
 
-    // Mark the entry as deleted
-    uint32_t sector = entry->sector;
-    uint32_t offset = entry->offset;
+    uint32_t first = offset / FAT32_SECTOR_SIZE;
+    uint32_t count = (offset + length - 1) / FAT32_SECTOR_SIZE - first + 1;
+    if (count > FAT32_MAP_MAX_SECTORS)
+    {
+        return FAT32_ERROR_MAP_TOO_LARGE;
+    }
 
-    RETURN_ON_ERROR(read_sector(sector, sector_buffer));
+    cache_map_t *map = NULL;
+    for (int i = 0; i < FAT32_MAX_MAPS && !map; i++)
+    {
+        if (!cache_maps[i].ptr)
+        {
+            map = &cache_maps[i];
+        }
+    }
+    if (!map)
+    {
+        return FAT32_ERROR_CACHE_FULL;
+    }
 
-    // Scan backwards for LFN entries
-    int lfn_count = 0;
-    for (int i = 1; i <= MAX_LFN_PART; i++)
+    // Blocks of the sectors in the window
+    uint32_t blocks[FAT32_MAP_MAX_SECTORS];
+    uint32_t cluster;
+    RETURN_ON_ERROR(seek_to_file_cluster(file, first / sectors_per_cluster, &cluster));
+    for (uint32_t i = 0; i < count; i++)
     {
-        if (offset < i * 32)
+        uint32_t sector = first + i;
+        if (i > 0 && sector % sectors_per_cluster == 0)
         {
-            break;
+            RETURN_ON_ERROR(next_file_cluster(file, cluster, &cluster));
+            if (cluster < 2 || cluster >= FAT32_FAT_ENTRY_EOC)
+            {
+                return FAT32_ERROR_INVALID_POSITION;
+            }
         }
-        fat32_dir_entry_t *lfn_entry = (fat32_dir_entry_t *)(sector_buffer + offset - i * 32);
-        if (lfn_entry->attr == FAT32_ATTR_LONG_NAME)
+        blocks[i] = volume_start_block + cluster_to_sector(cluster) + sector % sectors_per_cluster;
+    }
+
+    // Slots already holding the window, or else the least recently used run without pins
+    int best = -1;
+    bool hit = false;
+    uint32_t best_used = 0xFFFFFFFF;
+    for (uint32_t s = 0; s + count <= FAT32_CACHE_SECTORS && !hit; s++)
+    {
+        bool match = true;
+        bool pinned = false;
+        uint32_t used = 0;
+        for (uint32_t i = 0; i < count; i++)
         {
-            lfn_entry->shortname[0] = FAT32_DIR_ENTRY_FREE;
-            lfn_count++;
+            const cache_slot_t *slot = &cache_slots[s + i];
+            match = match && slot->block == blocks[i];
+            pinned = pinned || slot->pins > 0;
+            used = slot->last_used > used ? slot->last_used : used;
         }
-        else
+        if (match || (!pinned && used < best_used))
         {
-            break;
+            best = s;
+            best_used = used;
+            hit = match;
         }
     }
+    if (best < 0)
+    {
+        return FAT32_ERROR_CACHE_FULL; // Pinned slots break up every run
+    }
 
-    // Mark 8.3 entry as deleted
-    fat32_dir_entry_t *dir_entry = (fat32_dir_entry_t *)(sector_buffer + offset);
-    dir_entry->shortname[0] = FAT32_DIR_ENTRY_FREE;
+    uint32_t new_pins = 0;
+    for (uint32_t i = 0; i < count; i++)
+    {
+        new_pins += cache_slots[best + i].pins == 0;
+    }
+    if (cache_pinned + new_pins > FAT32_MAP_MAX_PINNED)
+    {
+        return FAT32_ERROR_CACHE_FULL;
+    }
 
-    RETURN_ON_ERROR(write_sector(sector, sector_buffer));
+    // Read each run of consecutive blocks with one command
+    for (uint32_t i = 0; i < count && !hit;)
+    {
+        uint32_t run = 1;
+        while (i + run < count && blocks[i + run] == blocks[i] + run)
+        {
+            run++;
+        }
+        for (uint32_t r = 0; r < run; r++)
+        {
+            cache_slots[best + i + r].block = CACHE_EMPTY;
+        }
+        RETURN_ON_ERROR(sd_read_blocks(blocks[i], run, cache_data[best + i]));
+        for (uint32_t r = 0; r < run; r++)
+        {
+            cache_slots[best + i + r].block = blocks[i + r];
+        }
+        i += run;
+    }
 
+    cache_clock++;
+    for (uint32_t i = 0; i < count; i++)
+    {
+        cache_slot_t *slot = &cache_slots[best + i];
+        cache_pinned += slot->pins++ == 0;
+        slot->last_used = cache_clock;
+    }
+    map->ptr = cache_data[best] + offset % FAT32_SECTOR_SIZE;
+    map->slot = best;
+    map->count = count;
+    *ptr = map->ptr;
     return FAT32_OK;
 }
 
-static fat32_error_t link_entry(fat32_entry_t *entry, const char *path)
+fat32_error_t fat32_unmap(const void *ptr)
+{
+    for (int i = 0; i < FAT32_MAX_MAPS && ptr; i++)
+    {
+        cache_map_t *map = &cache_maps[i];
+        if (map->ptr == ptr)
+        {
+            for (uint32_t s = map->slot; s < map->slot + map->count; s++)
+            {
+                cache_pinned -= --cache_slots[s].pins == 0;
+            }
+            map->ptr = NULL;
+            return FAT32_OK;
+        }
+    }
+    return FAT32_ERROR_INVALID_PARAMETER; // Not mapped, or the card was removed since
+}
+
+fat32_error_t fat32_write(fat32_file_t *file, const void *buffer, size_t size, size_t *bytes_written)
 {
-    if (!entry || !path)
+    if (!file || !file->is_open || !buffer)
     {
         return FAT32_ERROR_INVALID_PARAMETER;
     }
 
-    if (!fat32_is_ready())
+    if (file->attributes & FAT32_ATTR_DIRECTORY)
     {
-        return mount_status;
+        return FAT32_ERROR_NOT_A_FILE; // Cannot write to a directory
     }
 
-    fat32_entry_t temp_entry;
-    fat32_error_t result = find_entry(&temp_entry, path);
-    if (result != FAT32_ERROR_FILE_NOT_FOUND)
+    if (!fat32_is_ready())
     {
-        if (result == FAT32_OK)
-        {
-            return FAT32_ERROR_FILE_EXISTS;
-        }
-        return result;
+        return mount_status;
     }
 
-    // Split path into parent and filename
-    char path_copy[FAT32_MAX_PATH_LEN];
-    strncpy(path_copy, path, sizeof(path_copy) - 1);
-    path_copy[sizeof(path_copy) - 1] = '\0';
-    char *filename = strrchr(path_copy, '/');
-    char *parent_path = path_copy;
-    if (filename)
+    if (bytes_written)
     {
-        *filename = '\0';
-        filename++;
+        *bytes_written = 0;
     }
-    else
+
+    if (volume_exfat && file->file_size == UINT32_MAX)
     {
-        filename = path_copy;
-        parent_path = "";
+        return FAT32_ERROR_INVALID_POSITION; // 4 GB or more, past what a 32-bit size can reach
     }
 
-    // Open parent directory
-    fat32_file_t dir;
-    RETURN_ON_ERROR(fat32_open(&dir, parent_path));
+    uint32_t old_file_size = file->file_size;
+    uint32_t old_start_cluster = file->start_cluster;
+    bool old_contiguous = file->contiguous;
 
-    // Prepare short and long file names
-    // We always use long files names to preserve case and special characters
-    char shortname[12];
-    size_t needed_entries = filename_to_lfn(filename);
+    size_t total_written = 0;
+    const uint8_t *src = (const uint8_t *)buffer;
 
-    if (valid_shortname(filename))
+    // Calculate how many clusters are needed for the write
+    uint32_t end_pos = file->position + size;
+    uint32_t needed_clusters = (end_pos + bytes_per_cluster - 1) / bytes_per_cluster;
+    uint32_t current_clusters = file->file_size == 0 ? 1 : (file->file_size + bytes_per_cluster - 1) / bytes_per_cluster;
+    uint32_t cluster = file->start_cluster;
+    uint32_t last_cluster = cluster;
+
+    if (volume_exfat)
     {
-        filename_to_shortname(filename, shortname);
+        if (file->file_size == 0 && file->start_cluster != 0 && file->dir_entry_sector != 0)
+        {
+            // Emptied by the caller (O_TRUNC), so free the clusters the entry still records
+            uint32_t entries;
+            RETURN_ON_ERROR(exfat_read_set(file->dir_entry_sector, file->dir_entry_offset, file->dir_contiguous, &entries));
+            uint64_t data_length = entry_buffer.exfat_set[1].stream.data_length;
+            RETURN_ON_ERROR(exfat_release(file->start_cluster, (data_length + bytes_per_cluster - 1) / bytes_per_cluster,
+                                          file->contiguous));
+            file->start_cluster = 0;
+            file->contiguous = false;
+        }
+
+        // exFAT files have no clusters until they are first written
+        current_clusters = (file->file_size + bytes_per_cluster - 1) / bytes_per_cluster;
+        if (needed_clusters > current_clusters)
+        {
+            last_cluster = 0;
+            if (current_clusters > 0)
+            {
+                RETURN_ON_ERROR(seek_to_file_cluster(file, current_clusters - 1, &last_cluster));
+            }
+            RETURN_ON_ERROR(exfat_allocate(file, current_clusters, last_cluster, needed_clusters - current_clusters));
+        }
+        current_clusters = needed_clusters; // Nothing left for the FAT32 allocation below
     }
-    else
+    else if (current_clusters > 0)
     {
-        CLOSE_AND_RETURN_ON_ERROR(unique_shortname(&dir, filename, shortname));
+        // Find last cluster in chain
+        RETURN_ON_ERROR(find_last_cluster(cluster, current_clusters, &last_cluster));
     }
 
-    // Find enough free directory entries (LFN + 8.3)
-    uint32_t free_entry_pos = 0;
-    uint32_t free_entry_cluster = dir.current_cluster;
-    size_t free_count = 0;
-    bool found = false;
-    dir.position = 0;
-    uint32_t entry_pos = 0;
-    uint32_t cluster = dir.current_cluster;
-    while (!found)
+    // Allocate clusters if needed
+    for (uint32_t i = current_clusters; i < needed_clusters; i++)
     {
-        uint32_t cluster_offset = entry_pos % bytes_per_cluster;
-        uint32_t sector_in_cluster = cluster_offset / FAT32_SECTOR_SIZE;
-        uint32_t sector = cluster_to_sector(cluster) + sector_in_cluster;
-
-        CLOSE_AND_RETURN_ON_ERROR(read_sector(sector, sector_buffer));
+        uint32_t new_cluster = 0;
 
-        for (uint32_t i = 0; i < FAT32_SECTOR_SIZE; i += 32)
+        if (current_clusters > 0 || i > 0)
         {
-            fat32_dir_entry_t *entry_ptr = (fat32_dir_entry_t *)(sector_buffer + i);
-            if (entry_ptr->shortname[0] == FAT32_DIR_ENTRY_FREE || entry_ptr->shortname[0] == FAT32_DIR_ENTRY_END_MARKER)
-            {
-                if (free_count == 0)
-                {
-                    free_entry_pos = entry_pos + i;
-                    free_entry_cluster = cluster;
-                }
-                free_count++;
-                if (free_count > needed_entries)
-                {
-                    found = true;
-                    break;
-                }
-            }
-            else
-            {
-                free_count = 0;
-            }
+            RETURN_ON_ERROR(allocate_and_link_cluster(last_cluster, &new_cluster));
         }
-        if (found)
+        else
         {
-            break;
-        }
+            // First cluster for empty file
+            RETURN_ON_ERROR(get_next_free_cluster(&new_cluster));
+            RETURN_ON_ERROR(write_cluster_fat_entry(new_cluster, FAT32_FAT_ENTRY_EOC));
 
-        entry_pos += FAT32_SECTOR_SIZE;
-        if ((entry_pos % bytes_per_cluster) == 0)
-        {
-            uint32_t next_cluster;
-            result = read_cluster_fat_entry(cluster, &next_cluster);
-            if (result != FAT32_OK || next_cluster >= FAT32_FAT_ENTRY_EOC)
-            {
-                // Allocate a new cluster for the directory
-                uint32_t new_dir_cluster = 0;
-                CLOSE_AND_RETURN_ON_ERROR(allocate_and_link_cluster(cluster, &new_dir_cluster));
-                CLOSE_AND_RETURN_ON_ERROR(clear_cluster(new_dir_cluster));
-                cluster = new_dir_cluster;
-            }
-            else
+            if (fsinfo.free_count != 0xFFFFFFFF)
             {
-                cluster = next_cluster;
+                fsinfo.free_count--;
+                update_fsinfo();
             }
+
+            file->start_cluster = new_cluster;
         }
+        last_cluster = new_cluster;
     }
 
-    // Update the directory entry with the new cluster
-    uint8_t checksum = shortname_checksum(shortname);
+    // Find cluster for file->position
+    cluster = 0;
+    uint32_t cluster_offset = file->position / bytes_per_cluster;
+    RETURN_ON_ERROR(seek_to_file_cluster(file, cluster_offset, &cluster));
+    file->current_cluster = cluster;
 
-    // Write LFN entries in reverse order (last entry first)
-    for (int i = 0; i < needed_entries; i++)
+    size_t pos_in_file = file->position;
+    while (total_written < size)
     {
-        uint8_t index = needed_entries - i - 1;
+        uint32_t offset_in_cluster = pos_in_file % bytes_per_cluster;
+        uint32_t sector_in_cluster = offset_in_cluster / FAT32_SECTOR_SIZE;
+        uint32_t byte_in_sector = offset_in_cluster % FAT32_SECTOR_SIZE;
+        uint32_t sector = cluster_to_sector(cluster) + sector_in_cluster;
 
-        // Calculate position for this LFN entry
-        uint32_t entry_offset = free_entry_pos + (i * 32);
-        uint32_t entry_cluster_offset = entry_offset % bytes_per_cluster;
-        uint32_t entry_sector_in_cluster = entry_cluster_offset / FAT32_SECTOR_SIZE;
-        uint32_t entry_byte_in_sector = entry_cluster_offset % FAT32_SECTOR_SIZE;
-        uint32_t current_cluster = free_entry_cluster;
+        // Whole sectors of a contiguous file go in one command, straight from the buffer
+        if (file->contiguous && byte_in_sector == 0 && size - total_written >= FAT32_SECTOR_SIZE)
+        {
+            uint32_t sectors = (size - total_written) / FAT32_SECTOR_SIZE;
+            RETURN_ON_ERROR(write_blocks(volume_start_block + sector, sectors, src + total_written));
+            total_written += sectors * FAT32_SECTOR_SIZE;
+            pos_in_file += sectors * FAT32_SECTOR_SIZE;
+            cluster = file->start_cluster + pos_in_file / bytes_per_cluster;
+            file->current_cluster = cluster;
+            continue;
+        }
 
-        // Check if we need to move to next cluster
-        while (entry_sector_in_cluster >= boot_sector.sectors_per_cluster)
+        RETURN_ON_ERROR(read_sector(sector, sector_buffer));
+
+        size_t bytes_to_write = FAT32_SECTOR_SIZE - byte_in_sector;
+        if (bytes_to_write > size - total_written)
+        {
+            bytes_to_write = size - total_written;
+        }
+
+        memcpy(sector_buffer + byte_in_sector, src + total_written, bytes_to_write);
+
+        RETURN_ON_ERROR(write_sector(sector, sector_buffer));
+
+        total_written += bytes_to_write;
+        pos_in_file += bytes_to_write;
+
+        // Move to next cluster if needed
+        if ((pos_in_file % bytes_per_cluster) == 0 && total_written < size)
         {
             uint32_t next_cluster;
-            result = read_cluster_fat_entry(current_cluster, &next_cluster);
-            if (result != FAT32_OK || next_cluster >= FAT32_FAT_ENTRY_EOC)
+            fat32_error_t fat_res = next_file_cluster(file, cluster, &next_cluster);
+            if (fat_res != FAT32_OK || next_cluster >= FAT32_FAT_ENTRY_EOC)
             {
-                fat32_close(&dir);
                 return FAT32_ERROR_DISK_FULL;
             }
-            current_cluster = next_cluster;
-            entry_sector_in_cluster -= boot_sector.sectors_per_cluster;
+            cluster = next_cluster;
+            file->current_cluster = cluster;
         }
+    }
 
-        uint32_t entry_sector = cluster_to_sector(current_cluster) + entry_sector_in_cluster;
-
-        // Read the sector if needed
-        CLOSE_AND_RETURN_ON_ERROR(read_sector(entry_sector, sector_buffer));
-
-        // Set up the LFN entry with checksum and sequence number
-        fat32_lfn_entry_t *lfn_entry = &lfn_buffer[index];
-        lfn_entry->seq = (i == 0) ? (index + 1) | 0x40 : (index + 1); // Set last entry flag
-        lfn_entry->attr = FAT32_ATTR_LONG_NAME;
-        lfn_entry->type = 0;
-        lfn_entry->checksum = checksum;
-        lfn_entry->first_clus = 0;
-
-        // Copy LFN entry to sector buffer
-        memcpy(sector_buffer + entry_byte_in_sector, lfn_entry, sizeof(fat32_lfn_entry_t));
+    file->position = pos_in_file;
+    if (file->position > file->file_size)
+    {
+        file->file_size = file->position;
+    }
 
-        // Write the sector back
-        CLOSE_AND_RETURN_ON_ERROR(write_sector(entry_sector, sector_buffer));
+    if (bytes_written)
+    {
+        *bytes_written = total_written;
     }
 
-    // Allocate a new cluster for the file, if needed
-    if (entry->start_cluster == 0)
+    // --- Truncate cluster chain if file shrank ---
+    if (file->file_size < old_file_size)
     {
-        CLOSE_AND_RETURN_ON_ERROR(get_next_free_cluster(&entry->start_cluster));
-        CLOSE_AND_RETURN_ON_ERROR(write_cluster_fat_entry(entry->start_cluster, FAT32_FAT_ENTRY_EOC));
+        // Calculate clusters needed for new size
+        uint32_t needed_clusters = (file->file_size == 0) ? 0 : (file->file_size + bytes_per_cluster - 1) / bytes_per_cluster;
+        uint32_t current_clusters = (old_file_size == 0) ? 0 : (old_file_size + bytes_per_cluster - 1) / bytes_per_cluster;
 
-        if (fsinfo.free_count != 0xFFFFFFFF)
+        if (needed_clusters < current_clusters && file->start_cluster >= 2)
         {
-            fsinfo.free_count--;
-            update_fsinfo();
+            uint32_t last_cluster_to_keep = file->start_cluster;
+            if (needed_clusters > 0)
+            {
+                // Seek to last cluster to keep
+                fat32_error_t seek_res = seek_to_cluster(file->start_cluster, needed_clusters - 1, &last_cluster_to_keep);
+                if (seek_res == FAT32_OK)
+                {
+                    uint32_t first_cluster_to_free = 0;
+                    if (read_cluster_fat_entry(last_cluster_to_keep, &first_cluster_to_free) == FAT32_OK)
+                    {
+                        // Mark end of chain
+                        write_cluster_fat_entry(last_cluster_to_keep, FAT32_FAT_ENTRY_EOC);
+                        // Free the rest
+                        release_cluster_chain(first_cluster_to_free);
+                    }
+                }
+            }
+            else
+            {
+                // File is now empty, free entire chain
+                release_cluster_chain(file->start_cluster);
+                file->start_cluster = 0;
+            }
         }
     }
 
-    // Write 8.3 entry
-    fat32_dir_entry_t dir_entry = {0};
-    memcpy(dir_entry.shortname, shortname, 11);
-    dir_entry.attr = entry->attr; // Normal file
-    dir_entry.nt_res = 0;
-    dir_entry.crt_time_tenth = 0;
-    dir_entry.crt_time = 0;
-    dir_entry.crt_date = 0;
-    dir_entry.lst_acc_date = 0;
-    dir_entry.fst_clus_hi = entry->start_cluster >> 16;
-    dir_entry.wrt_time = 0;
-    dir_entry.wrt_date = 0;
-    dir_entry.fst_clus_lo = entry->start_cluster & 0xFFFF;
-    dir_entry.file_size = entry->size;
+    // Update directory entry file size on disk
+    // After updating file->file_size:
+    if (volume_exfat)
+    {
+        if (file->dir_entry_sector && (file->file_size != old_file_size || file->start_cluster != old_start_cluster ||
+                                       file->contiguous != old_contiguous))
+        {
+            RETURN_ON_ERROR(exfat_update_entry(file));
+        }
+    }
+    else if (file->dir_entry_sector && file->dir_entry_offset < FAT32_SECTOR_SIZE)
+    {
+        RETURN_ON_ERROR(read_sector(file->dir_entry_sector, sector_buffer));
 
-    uint32_t raw_offset = free_entry_pos + (needed_entries * 32);
-    entry->sector = cluster_to_sector(free_entry_cluster) + ((raw_offset % bytes_per_cluster) / FAT32_SECTOR_SIZE);
-    entry->offset = (raw_offset % FAT32_SECTOR_SIZE);
-    CLOSE_AND_RETURN_ON_ERROR(read_sector(entry->sector, sector_buffer));
-    memcpy(sector_buffer + entry->offset, &dir_entry, sizeof(dir_entry));
-    CLOSE_AND_RETURN_ON_ERROR(write_sector(entry->sector, sector_buffer));
+        fat32_dir_entry_t *dir_entry = (fat32_dir_entry_t *)(sector_buffer + file->dir_entry_offset);
+        dir_entry->file_size = file->file_size;
 
-    fat32_close(&dir);
+        RETURN_ON_ERROR(write_sector(file->dir_entry_sector, sector_buffer));
+    }
 
-    return FAT32_OK; // Successfully linked the entry
+    return FAT32_OK;
 }
 
-static fat32_error_t new_entry(fat32_file_t *file, const char *path, uint8_t attr)
+fat32_error_t fat32_seek(fat32_file_t *file, uint32_t position)
 {
-    if (!file || !path)
+    if (!file || !file->is_open)
     {
         return FAT32_ERROR_INVALID_PARAMETER;
     }
 
-    memset(file, 0, sizeof(fat32_file_t));
+    file->position = position;
 
-    fat32_entry_t entry;
-    memset(&entry, 0, sizeof(fat32_entry_t));
-    entry.attr = attr;
+    return FAT32_OK;
+}
 
-    RETURN_ON_ERROR(link_entry(&entry, path));
+inline uint32_t fat32_tell(fat32_file_t *file)
+{
+    return file ? file->position : 0;
+}
 
-    file->is_open = true;
-    file->start_cluster = entry.start_cluster;
-    file->current_cluster = file->start_cluster;
-    file->attributes = entry.attr;
-    file->dir_entry_sector = entry.sector;
-    file->dir_entry_offset = entry.offset;
+inline uint32_t fat32_size(fat32_file_t *file)
+{
+    return file ? file->file_size : 0;
+}
 
-    return FAT32_OK; // Successfully created new file
+inline bool fat32_eof(fat32_file_t *file)
+{
+    return file ? (file->position >= file->file_size) : true;
 }
 
-static fat32_error_t delete_entry(const char *path)
+// Find the runs of consecutive blocks that hold a file, so it can be read
+// later with sd_read_blocks() and no more FAT lookups. The extents are only
+// valid until the file is written or the card is changed.
+fat32_error_t fat32_get_extents(fat32_file_t *file, fat32_extent_t *extents, int max_extents, int *extent_count)
 {
-    fat32_entry_t entry;
-    RETURN_ON_ERROR(find_entry(&entry, path));
+    if (!file || !file->is_open || !extents || !extent_count)
+    {
+        return FAT32_ERROR_INVALID_PARAMETER;
+    }
+    if (!fat32_is_ready())
+    {
+        return mount_status;
+    }
 
-    if (entry.attr & FAT32_ATTR_DIRECTORY)
+    *extent_count = 0;
+    uint32_t clusters = (file->file_size + bytes_per_cluster - 1) / bytes_per_cluster;
+    uint32_t cluster = file->start_cluster;
+    int count = 0;
+
+    for (uint32_t i = 0; i < clusters; i++)
     {
-        // Check if directory is empty (only "." and ".." allowed)
-        fat32_file_t dir;
-        RETURN_ON_ERROR(fat32_open(&dir, path));
+        if (cluster < 2 || cluster >= FAT32_FAT_ENTRY_EOC)
+        {
+            return FAT32_ERROR_INVALID_POSITION; // Chain shorter than the file
+        }
 
-        fat32_entry_t sub_entry;
-        int entry_count = 0;
-        while (fat32_dir_read(&dir, &sub_entry) == FAT32_OK && sub_entry.filename[0])
+        uint32_t block = volume_start_block + cluster_to_sector(cluster);
+        if (count > 0 && extents[count - 1].block + extents[count - 1].count == block)
         {
-            if (strcmp(sub_entry.filename, ".") != 0 && strcmp(sub_entry.filename, "..") != 0)
+            extents[count - 1].count += sectors_per_cluster;
+        }
+        else
+        {
+            if (count >= max_extents)
             {
-                fat32_close(&dir);
-                return FAT32_ERROR_DIR_NOT_EMPTY;
+                return FAT32_ERROR_TOO_FRAGMENTED;
             }
-            entry_count++;
+            extents[count].block = block;
+            extents[count].count = sectors_per_cluster;
+            count++;
         }
-        fat32_close(&dir);
-    }
-
-    // Unlink the entry
-    RETURN_ON_ERROR(unlink_entry(&entry));
 
-    // Free the clusters used by the entry
-    RETURN_ON_ERROR(release_cluster_chain(entry.start_cluster));
+        if (i + 1 < clusters)
+        {
+            RETURN_ON_ERROR(next_file_cluster(file, cluster, &cluster));
+        }
+    }
 
+    *extent_count = count;
     return FAT32_OK;
 }
 
 //
-// File operations (simplified implementation)
+// Defragmentation
 //
 
-fat32_error_t fat32_open(fat32_file_t *file, const char *path)
+// Count the clusters holding a file and the runs of consecutive clusters they are in
+static fat32_error_t count_fragments(const fat32_file_t *file, uint32_t *clusters, uint32_t *fragments)
 {
-    if (!file || !path)
+    *clusters = (file->file_size + bytes_per_cluster - 1) / bytes_per_cluster;
+    *fragments = 0;
+
+    uint32_t cluster = file->start_cluster;
+    uint32_t previous = 0;
+    for (uint32_t i = 0; i < *clusters; i++)
     {
-        return FAT32_ERROR_INVALID_PARAMETER;
+        if (cluster < 2 || cluster >= FAT32_FAT_ENTRY_EOC)
+        {
+            return FAT32_ERROR_INVALID_POSITION; // Chain shorter than the file
+        }
+        if (cluster != previous + 1)
+        {
+            (*fragments)++;
+        }
+        previous = cluster;
+        if (i + 1 < *clusters)
+        {
+            RETURN_ON_ERROR(next_file_cluster(file, cluster, &cluster));
+        }
     }
+    return FAT32_OK;
+}
 
-    if (strlen(path) > FAT32_MAX_PATH_LEN)
+// Find the first run of count free clusters, reading as much of the FAT at a time as fits
+// in the buffer
+static fat32_error_t find_free_run(uint32_t count, uint8_t *buffer, size_t buffer_size, uint32_t *first)
+{
+    uint32_t end = cluster_count + 2;
+    uint32_t sectors_per_read = buffer_size / FAT32_SECTOR_SIZE;
+    uint32_t run_start = 0;
+    uint32_t run = 0;
+
+    for (uint32_t base = 0; base < end; base += sectors_per_read * FAT_ENTRIES_PER_SECTOR)
     {
-        return FAT32_ERROR_INVALID_PATH; // Path too long
+        uint32_t sectors = (end - base + FAT_ENTRIES_PER_SECTOR - 1) / FAT_ENTRIES_PER_SECTOR;
+        if (sectors > sectors_per_read)
+        {
+            sectors = sectors_per_read;
+        }
+        uint32_t fat_sector = fat_start_sector + base / FAT_ENTRIES_PER_SECTOR;
+        RETURN_ON_ERROR(sd_read_blocks(volume_start_block + fat_sector, sectors, buffer));
+
+        const uint32_t *entries = (const uint32_t *)buffer;
+        for (uint32_t i = 0; i < sectors * FAT_ENTRIES_PER_SECTOR && base + i < end; i++)
+        {
+            uint32_t cluster = base + i;
+            if (cluster >= 2 && (entries[i] & 0x0FFFFFFF) == FAT32_FAT_ENTRY_FREE)
+            {
+                if (run++ == 0)
+                {
+                    run_start = cluster;
+                }
+                if (run == count)
+                {
+                    *first = run_start;
+                    return FAT32_OK;
+                }
+            }
+            else
+            {
+                run = 0;
+            }
+        }
     }
+    return FAT32_ERROR_NO_CONTIGUOUS_SPACE;
+}
 
-    if (!fat32_is_ready())
+// Copy the clusters of a chain to consecutive clusters from first, reading each run of
+// consecutive source clusters in as few multi-block reads as the buffer allows
+static fat32_error_t copy_chain(uint32_t start_cluster, uint32_t clusters, uint32_t first, uint8_t *buffer, size_t buffer_size)
+{
+    uint32_t buffer_blocks = buffer_size / FAT32_SECTOR_SIZE;
+    uint32_t to = volume_start_block + cluster_to_sector(first);
+    uint32_t cluster = start_cluster;
+    uint32_t done = 0;
+
+    while (done < clusters)
     {
-        return mount_status;
-    }
+        // Follow the chain while the clusters are consecutive
+        uint32_t run_start = cluster;
+        uint32_t run = 1;
+        while (done + run < clusters)
+        {
+            RETURN_ON_ERROR(read_cluster_fat_entry(cluster, &cluster));
+            if (cluster < 2 || cluster >= FAT32_FAT_ENTRY_EOC)
+            {
+                return FAT32_ERROR_INVALID_POSITION;
+            }
+            if (cluster != run_start + run)
+            {
+                break;
+            }
+            run++;
+        }
 
-    memset(file, 0, sizeof(fat32_file_t));
+        uint32_t from = volume_start_block + cluster_to_sector(run_start);
+        uint32_t blocks = run * sectors_per_cluster;
+        while (blocks > 0)
+        {
+            uint32_t count = blocks < buffer_blocks ? blocks : buffer_blocks;
+            RETURN_ON_ERROR(sd_read_blocks(from, count, buffer));
+            RETURN_ON_ERROR(write_blocks(to, count, buffer));
+            from += count;
+            to += count;
+            blocks -= count;
+        }
+        done += run;
+    }
+    return FAT32_OK;
+}
 
-    fat32_entry_t entry;
-    RETURN_ON_ERROR(find_entry(&entry, path));
+// Free a cluster chain like release_cluster_chain, but write each FAT sector once for
+// every stretch of the chain that stays in it
+static fat32_error_t free_chain(uint32_t start_cluster, uint8_t *buffer)
+{
+    uint32_t loaded = 0; // FAT sector in the buffer (0 is the boot sector, never a FAT sector)
+    uint32_t freed = 0;
+    uint32_t lowest_cluster = 0xFFFFFFFF;
 
-    if (entry.attr & FAT32_ATTR_VOLUME_ID)
+    uint32_t cluster = start_cluster;
+    while (cluster >= 2 && cluster < FAT32_FAT_ENTRY_EOC && freed < cluster_count)
     {
-        return FAT32_ERROR_NOT_A_FILE; // Not a valid file
+        uint32_t fat_sector = fat_start_sector + cluster / FAT_ENTRIES_PER_SECTOR;
+        if (fat_sector != loaded)
+        {
+            if (loaded)
+            {
+                RETURN_ON_ERROR(write_sector(loaded, buffer));
+            }
+            RETURN_ON_ERROR(read_sector(fat_sector, buffer));
+            loaded = fat_sector;
+        }
+
+        uint32_t *entry = &((uint32_t *)buffer)[cluster % FAT_ENTRIES_PER_SECTOR];
+        uint32_t next_cluster = *entry & 0x0FFFFFFF;
+        *entry &= 0xF0000000;
+        freed++;
+        if (cluster < lowest_cluster)
+        {
+            lowest_cluster = cluster;
+        }
+        cluster = next_cluster;
     }
-    if (entry.attr & FAT32_ATTR_DIRECTORY)
+    if (loaded)
     {
-        file->start_cluster = entry.start_cluster ? entry.start_cluster : boot_sector.root_cluster;
-        file->file_size = 0; // Directories have no size in FAT32
+        RETURN_ON_ERROR(write_sector(loaded, buffer));
     }
-    else
+
+    if (fsinfo.next_free > lowest_cluster)
     {
-        // Found the file
-        file->start_cluster = entry.start_cluster;
-        file->file_size = entry.size;
+        fsinfo.next_free = lowest_cluster;
     }
-    file->is_open = true;
-    file->current_cluster = file->start_cluster;
-    file->position = 0;
-    file->attributes = entry.attr;
-    file->dir_entry_sector = entry.sector;
-    file->dir_entry_offset = entry.offset;
-
     return FAT32_OK;
 }
 
-fat32_error_t fat32_create(fat32_file_t *file, const char *path)
-{
-    return new_entry(file, path, FAT32_ATTR_ARCHIVE);
-}
-
-fat32_error_t fat32_close(fat32_file_t *file)
+fat32_error_t fat32_get_fragments(fat32_file_t *file, uint32_t *clusters, uint32_t *fragments)
 {
-    if (file && file->is_open)
+    if (!file || !file->is_open || !clusters || !fragments)
     {
-        memset(file, 0, sizeof(fat32_file_t));
+        return FAT32_ERROR_INVALID_PARAMETER;
     }
-
-    return FAT32_OK;
+    if (file->attributes & FAT32_ATTR_DIRECTORY)
+    {
+        return FAT32_ERROR_NOT_A_FILE;
+    }
+    if (!fat32_is_ready())
+    {
+        return mount_status;
+    }
+    return count_fragments(file, clusters, fragments);
 }
 
-fat32_error_t fat32_read(fat32_file_t *file, void *buffer, size_t size, size_t *bytes_read)
+// Move a fragmented file into one run of free clusters. The steps are ordered so that
+// the file is whole whenever the card is removed: the data is copied to free clusters,
+// those are linked into a chain, the directory entry is switched to the new chain in a
+// single sector write, and only then is the old chain freed. An interruption loses at
+// most the free space of one chain, which fsck can give back.
+fat32_error_t fat32_defrag(fat32_file_t *file, void *buffer, size_t buffer_size)
 {
-    if (!file || !file->is_open || !buffer)
+    if (!file || !file->is_open || !buffer || buffer_size < FAT32_SECTOR_SIZE)
     {
         return FAT32_ERROR_INVALID_PARAMETER;
     }
-
     if (file->attributes & FAT32_ATTR_DIRECTORY)
     {
-        return FAT32_ERROR_NOT_A_FILE; // Cannot read from a directory
+        return FAT32_ERROR_NOT_A_FILE;
     }
-
     if (!fat32_is_ready())
     {
         return mount_status;
     }
 
-    if (bytes_read)
+    uint32_t clusters, fragments;
+    RETURN_ON_ERROR(count_fragments(file, &clusters, &fragments));
+    if (fragments <= 1)
     {
-        *bytes_read = 0;
+        return FAT32_OK; // Already in one piece
+    }
+    if (volume_exfat)
+    {
+        return FAT32_ERROR_NOT_SUPPORTED; // Free space is in the bitmap, not the FAT
     }
 
-    if (file->position >= file->file_size)
+    uint32_t first;
+    RETURN_ON_ERROR(find_free_run(clusters, buffer, buffer_size, &first));
+    RETURN_ON_ERROR(copy_chain(file->start_cluster, clusters, first, buffer, buffer_size));
+    RETURN_ON_ERROR(link_run(first, clusters, buffer));
+
+    // Switch the directory entry to the new chain
+    RETURN_ON_ERROR(read_sector(file->dir_entry_sector, sector_buffer));
+    fat32_dir_entry_t *dir_entry = (fat32_dir_entry_t *)(sector_buffer + file->dir_entry_offset);
+    dir_entry->fst_clus_hi = (first >> 16) & 0xFFFF;
+    dir_entry->fst_clus_lo = first & 0xFFFF;
+    RETURN_ON_ERROR(write_sector(file->dir_entry_sector, sector_buffer));
+
+    uint32_t old_start = file->start_cluster;
+    file->start_cluster = first;
+    file->current_cluster = first + file->position / bytes_per_cluster;
+    if (file->current_cluster >= first + clusters)
     {
-        return FAT32_OK; // EOF
+        file->current_cluster = first + clusters - 1;
     }
 
-    size_t remaining = file->file_size - file->position;
-    if (size > remaining)
+    // The new chain is as long as the old one, so the free count does not change
+    RETURN_ON_ERROR(free_chain(old_start, buffer));
+    return update_fsinfo();
+}
+
+//
+// Consistency check
+//
+
+#define CHECK_FAT_SECTORS (16)                             // FAT sectors read or written at a time
+#define CHECK_MAX_DEPTH (128)                              // deeper than any path fat32_open takes
+#define CHECK_MAX_DIR_SIZE (65536 * FAT32_DIR_ENTRY_SIZE)  // a directory holds at most 65536 entries
+#define CHECK_FAT_ENTRY_BAD (0x0FFFFFF7)                   // cluster marked bad
+
+// How a walk along a cluster chain ended
+typedef enum
+{
+    CHAIN_END,     // end of chain marker
+    CHAIN_LONGER,  // the limit was reached before the end
+    CHAIN_BROKEN,  // a free, bad or out-of-range cluster
+    CHAIN_CROSSED, // a cluster another chain already owns
+    CHAIN_LOOPED,  // a cluster this chain already passed through
+} check_chain_end_t;
+
+// A directory being read, one per level of the tree
+typedef struct
+{
+    uint32_t cluster;  // cluster being read
+    uint32_t clusters; // clusters of the directory from this one on that belong to it
+    uint16_t entry;    // next entry in the cluster
+} check_level_t;
+
+typedef struct
+{
+    fat32_check_t *report;
+    bool repair;
+    uint32_t pass;           // passes over the tree so far, over every round
+    uint32_t round;          // 1 when going over the card again after repairs
+    bool cut;                // a repair after the first window cut clusters loose in an earlier one
+    uint32_t window_start;   // clusters the bitmap covers in this pass
+    uint32_t window_end;
+    uint32_t *owned;         // one bit per cluster in the window, set when a chain claims it
+    uint8_t *fat;            // CHECK_FAT_SECTORS sectors of the FAT
+    uint32_t fat_loaded;     // first sector of them (0 if none, which is never a FAT sector)
+    bool fat_dirty;
+    uint8_t *dir;            // a directory sector
+    uint32_t dir_loaded;     // sector in dir (0 if none)
+    check_level_t *levels;
+    uint32_t freed;          // lost clusters freed
+    uint32_t lowest_free;
+} check_t;
+
+static uint32_t check_fat_sectors(uint32_t first)
+{
+    uint32_t end = fat_start_sector + boot_sector.fat_size_32;
+    return end - first < CHECK_FAT_SECTORS ? end - first : CHECK_FAT_SECTORS;
+}
+
+static fat32_error_t check_flush_fat(check_t *c)
+{
+    if (c->fat_dirty)
     {
-        size = remaining;
+        RETURN_ON_ERROR(write_blocks(volume_start_block + c->fat_loaded, check_fat_sectors(c->fat_loaded), c->fat));
+        c->fat_dirty = false;
     }
+    return FAT32_OK;
+}
 
-    // Ensure current_cluster is correct for current file position
-    uint32_t cluster = 0;
-    uint32_t cluster_offset = file->position / bytes_per_cluster;
-    RETURN_ON_ERROR(seek_to_cluster(file->start_cluster, cluster_offset, &cluster));
-    file->current_cluster = cluster;
+// Find the FAT entry of a cluster, reading the group of sectors that holds it if it is not
+// the one loaded. Changes are written back when another group is loaded.
+static fat32_error_t check_fat_entry(check_t *c, uint32_t cluster, uint32_t **entry)
+{
+    uint32_t sector = cluster / FAT_ENTRIES_PER_SECTOR;
+    uint32_t first = fat_start_sector + sector - sector % CHECK_FAT_SECTORS;
+    if (first != c->fat_loaded)
+    {
+        RETURN_ON_ERROR(check_flush_fat(c));
+        RETURN_ON_ERROR(sd_read_blocks(volume_start_block + first, check_fat_sectors(first), c->fat));
+        c->fat_loaded = first;
+    }
+    *entry = &((uint32_t *)c->fat)[cluster - (sector - sector % CHECK_FAT_SECTORS) * FAT_ENTRIES_PER_SECTOR];
+    return FAT32_OK;
+}
 
-    size_t total_read = 0;
-    uint8_t *dest = (uint8_t *)buffer;
+static fat32_error_t check_set_fat_entry(check_t *c, uint32_t cluster, uint32_t value)
+{
+    uint32_t *entry;
+    RETURN_ON_ERROR(check_fat_entry(c, cluster, &entry));
+    *entry = (*entry & 0xF0000000) | value;
+    c->fat_dirty = true;
+    return FAT32_OK;
+}
 
-    while (total_read < size)
+// Mark a cluster as owned, returning true if it already was. Clusters outside the window
+// are not tracked in this pass.
+static bool check_claim(check_t *c, uint32_t cluster)
+{
+    if (cluster < c->window_start || cluster >= c->window_end)
     {
-        uint32_t cluster_offset = file->position % bytes_per_cluster;
-        uint32_t sector_in_cluster = cluster_offset / FAT32_SECTOR_SIZE;
-        uint32_t byte_in_sector = cluster_offset % FAT32_SECTOR_SIZE;
+        return false;
+    }
+    uint32_t bit = cluster - c->window_start;
+    uint32_t mask = 1u << (bit % 32);
+    bool owned = c->owned[bit / 32] & mask;
+    c->owned[bit / 32] |= mask;
+    return owned;
+}
 
-        uint32_t sector = cluster_to_sector(file->current_cluster) + sector_in_cluster;
+static fat32_error_t check_next(check_t *c, uint32_t cluster, uint32_t *next)
+{
+    uint32_t *entry;
+    RETURN_ON_ERROR(check_fat_entry(c, cluster, &entry));
+    *next = *entry & 0x0FFFFFFF;
+    return FAT32_OK;
+}
 
-        RETURN_ON_ERROR(read_sector(sector, sector_buffer));
+// Given the length of a loop in a chain, count the clusters before it starts repeating and
+// find the last of them
+static fat32_error_t check_loop(check_t *c, uint32_t start, uint32_t loop, uint32_t *clusters, uint32_t *last)
+{
+    uint32_t behind = start;
+    uint32_t ahead = start;
+    for (uint32_t i = 0; i < loop; i++)
+    {
+        RETURN_ON_ERROR(check_next(c, ahead, &ahead));
+    }
+    *clusters = loop;
+    while (behind != ahead)
+    {
+        RETURN_ON_ERROR(check_next(c, behind, &behind));
+        RETURN_ON_ERROR(check_next(c, ahead, &ahead));
+        (*clusters)++;
+    }
+
+    *last = start;
+    for (uint32_t i = 1; i < *clusters; i++)
+    {
+        RETURN_ON_ERROR(check_next(c, *last, last));
+    }
+    return FAT32_OK;
+}
 
-        size_t bytes_to_copy = FAT32_SECTOR_SIZE - byte_in_sector;
-        if (bytes_to_copy > size - total_read)
+// Follow a chain, claiming up to limit clusters. clusters is set to the number that belong
+// to the chain, and last to the last of them. A chain that goes on past the limit, or into a
+// cluster already claimed, is followed to its end to find out whether it loops.
+static fat32_error_t check_chain(check_t *c, uint32_t start, uint32_t limit, uint32_t *clusters, uint32_t *last, check_chain_end_t *end)
+{
+    *clusters = 0;
+    *last = 0;
+    bool crossed = false;
+
+    // With the whole card in the window, the bitmap finds a loop where the chain first comes
+    // back to a cluster. Otherwise that cluster may be outside the window, so loops are found
+    // with Brent's cycle detection: it keeps one cluster, doubling the steps before it is
+    // replaced, until the chain comes back to it.
+    uint32_t saved = 0;
+    uint32_t power = 1;
+    uint32_t steps = 0;
+
+    uint32_t cluster = start;
+    while (true)
+    {
+        // Free (0) and bad clusters fail this test too
+        if (cluster < 2 || cluster >= cluster_count + 2)
         {
-            bytes_to_copy = size - total_read;
+            *end = crossed ? CHAIN_CROSSED : *clusters < limit ? CHAIN_BROKEN : CHAIN_LONGER;
+            return FAT32_OK;
+        }
+        if (cluster == saved)
+        {
+            uint32_t looped, looped_last;
+            RETURN_ON_ERROR(check_loop(c, start, steps, &looped, &looped_last));
+            if (looped <= *clusters)
+            {
+                // The chain ran into itself, not another chain or the limit
+                *clusters = looped;
+                *last = looped_last;
+                *end = CHAIN_LOOPED;
+            }
+            else
+            {
+                *end = crossed ? CHAIN_CROSSED : CHAIN_LONGER;
+            }
+            return FAT32_OK;
+        }
+        if (steps == power)
+        {
+            saved = cluster;
+            power *= 2;
+            steps = 0;
         }
 
-        memcpy(dest + total_read, sector_buffer + byte_in_sector, bytes_to_copy);
-        total_read += bytes_to_copy;
-        file->position += bytes_to_copy;
-
-        // Check if we need to move to the next cluster
-        if ((file->position % bytes_per_cluster) == 0 && total_read < size)
+        if (!crossed && *clusters < limit)
         {
-            uint32_t next_cluster;
-            RETURN_ON_ERROR(read_cluster_fat_entry(file->current_cluster, &next_cluster));
-            if (next_cluster >= FAT32_FAT_ENTRY_EOC)
+            crossed = check_claim(c, cluster);
+            if (!crossed)
             {
-                // End of cluster chain or error
-                break;
+                (*clusters)++;
+                *last = cluster;
             }
-            file->current_cluster = next_cluster;
         }
-    }
 
-    if (bytes_read)
-    {
-        *bytes_read = total_read;
+        uint32_t next;
+        RETURN_ON_ERROR(check_next(c, cluster, &next));
+        if (next >= FAT32_FAT_ENTRY_EOC)
+        {
+            *end = crossed ? CHAIN_CROSSED : *last == cluster ? CHAIN_END : CHAIN_LONGER;
+            return FAT32_OK;
+        }
+        cluster = next;
+        steps++;
     }
-    return FAT32_OK;
 }
 
-fat32_error_t fat32_write(fat32_file_t *file, const void *buffer, size_t size, size_t *bytes_written)
+// Check the chain of a directory entry in c->dir against its size, and repair the two to
+// match. usable is set to the clusters of the chain that can be read.
+static fat32_error_t check_entry(check_t *c, fat32_dir_entry_t *entry, uint32_t *usable)
 {
-    if (!file || !file->is_open || !buffer)
+    fat32_check_t *report = c->report;
+    bool first_pass = c->pass == 0;
+    bool directory = entry->attr & FAT32_ATTR_DIRECTORY;
+    uint32_t start = ((uint32_t)entry->fst_clus_hi << 16) | entry->fst_clus_lo;
+    uint32_t limit = directory ? CHECK_MAX_DIR_SIZE / bytes_per_cluster
+                               : (uint32_t)(((uint64_t)entry->file_size + bytes_per_cluster - 1) / bytes_per_cluster);
+    if (limit == 0 && start != 0)
     {
-        return FAT32_ERROR_INVALID_PARAMETER;
+        limit = 1; // Files are created with a cluster, empty files elsewhere have none
     }
 
-    if (file->attributes & FAT32_ATTR_DIRECTORY)
+    uint32_t clusters = 0;
+    uint32_t last = 0;
+    check_chain_end_t end = CHAIN_END;
+    if (start != 0)
     {
-        return FAT32_ERROR_NOT_A_FILE; // Cannot write to a directory
+        RETURN_ON_ERROR(check_chain(c, start, limit, &clusters, &last, &end));
     }
-
-    if (!fat32_is_ready())
+    else if (directory)
     {
-        return mount_status;
+        end = CHAIN_BROKEN; // Only the root, which has no entry, can start at 0
     }
 
-    if (bytes_written)
+    bool problem = true;
+    if (end == CHAIN_CROSSED)
     {
-        *bytes_written = 0;
+        report->cross_links++; // Each pass finds the ones in its window
+    }
+    else if (end == CHAIN_LOOPED)
+    {
+        report->cross_links += first_pass; // Every pass finds a loop
+    }
+    else if (end == CHAIN_BROKEN || (end == CHAIN_LONGER && directory))
+    {
+        report->bad_chains += first_pass;
+    }
+    else if (end == CHAIN_LONGER || (!directory && clusters != limit))
+    {
+        report->size_mismatches += first_pass;
+    }
+    else
+    {
+        problem = false;
     }
 
-    uint32_t old_file_size = file->file_size;
+    *usable = clusters;
+    if (!problem || !c->repair)
+    {
+        return FAT32_OK;
+    }
 
-    // Ensure current_cluster is correct for current file position
-    uint32_t cluster = file->start_cluster;
-    uint32_t cluster_offset = file->position / bytes_per_cluster;
-    for (uint32_t i = 0; i < cluster_offset; i++)
+    // Keep the clusters that belong to the entry, and let the sweep free the rest
+    if (clusters == 0 && directory)
     {
-        uint32_t next_cluster;
-        RETURN_ON_ERROR(read_cluster_fat_entry(cluster, &next_cluster));
-        if (next_cluster >= FAT32_FAT_ENTRY_EOC)
+        entry->shortname[0] = FAT32_DIR_ENTRY_FREE;
+    }
+    else if (clusters == 0)
+    {
+        entry->fst_clus_hi = 0;
+        entry->fst_clus_lo = 0;
+        entry->file_size = 0;
+    }
+    else
+    {
+        if (end != CHAIN_END)
         {
-            // Allocate a new cluster and link it
-            uint32_t new_cluster = 0;
-            RETURN_ON_ERROR(allocate_and_link_cluster(cluster, &new_cluster));
-            next_cluster = new_cluster;
+            RETURN_ON_ERROR(check_set_fat_entry(c, last, FAT32_FAT_ENTRY_EOC));
+        }
+        if (!directory && entry->file_size > (uint64_t)clusters * bytes_per_cluster)
+        {
+            entry->file_size = clusters * bytes_per_cluster;
         }
-        cluster = next_cluster;
     }
-    file->current_cluster = cluster;
-
-    size_t total_written = 0;
-    const uint8_t *src = (const uint8_t *)buffer;
+    RETURN_ON_ERROR(write_sector(c->dir_loaded, c->dir));
+    report->repaired = true;
+    c->cut |= c->pass > 0;
+    return FAT32_OK;
+}
 
-    // Calculate how many clusters are needed for the write
-    uint32_t end_pos = file->position + size;
-    uint32_t needed_clusters = (end_pos + bytes_per_cluster - 1) / bytes_per_cluster;
-    uint32_t current_clusters = file->file_size == 0 ? 1 : (file->file_size + bytes_per_cluster - 1) / bytes_per_cluster;
+// Check every file and directory from the root, one level of the tree at a time
+static fat32_error_t check_tree(check_t *c)
+{
+    fat32_check_t *report = c->report;
+    bool first_pass = c->pass == 0;
+    uint32_t entries_per_cluster = bytes_per_cluster / FAT32_DIR_ENTRY_SIZE;
 
-    // Find last cluster in chain
-    cluster = file->start_cluster;
-    uint32_t last_cluster = cluster;
-    if (current_clusters > 0)
+    uint32_t clusters, last;
+    check_chain_end_t end;
+    RETURN_ON_ERROR(check_chain(c, root_cluster, CHECK_MAX_DIR_SIZE / bytes_per_cluster, &clusters, &last, &end));
+    if (clusters == 0)
     {
-        RETURN_ON_ERROR(find_last_cluster(cluster, current_clusters, &last_cluster));
+        return FAT32_ERROR_INVALID_FORMAT;
     }
-
-    // Allocate clusters if needed
-    for (uint32_t i = current_clusters; i < needed_clusters; i++)
+    if (end != CHAIN_END)
     {
-        uint32_t new_cluster = 0;
-
-        if (current_clusters > 0 || i > 0)
+        report->bad_chains += first_pass;
+        if (c->repair)
         {
-            RETURN_ON_ERROR(allocate_and_link_cluster(last_cluster, &new_cluster));
+            RETURN_ON_ERROR(check_set_fat_entry(c, last, FAT32_FAT_ENTRY_EOC));
+            report->repaired = true;
         }
-        else
-        {
-            // First cluster for empty file
-            RETURN_ON_ERROR(get_next_free_cluster(&new_cluster));
-            RETURN_ON_ERROR(write_cluster_fat_entry(new_cluster, FAT32_FAT_ENTRY_EOC));
+    }
+    report->directories += first_pass;
 
-            if (fsinfo.free_count != 0xFFFFFFFF)
+    int depth = 1;
+    c->levels[0] = (check_level_t){root_cluster, clusters, 0};
+    c->dir_loaded = 0;
+    while (depth > 0)
+    {
+        check_level_t *level = &c->levels[depth - 1];
+        if (level->entry == entries_per_cluster)
+        {
+            // On to the next cluster of the directory
+            uint32_t *entry;
+            if (--level->clusters == 0)
             {
-                fsinfo.free_count--;
-                update_fsinfo();
+                depth--;
+                continue;
             }
-
-            file->start_cluster = new_cluster;
+            RETURN_ON_ERROR(check_fat_entry(c, level->cluster, &entry));
+            level->cluster = *entry & 0x0FFFFFFF;
+            level->entry = 0;
+            continue;
         }
-        last_cluster = new_cluster;
-    }
-
-    // Find cluster for file->position
-    cluster = 0;
-    cluster_offset = file->position / bytes_per_cluster;
-    RETURN_ON_ERROR(seek_to_cluster(file->start_cluster, cluster_offset, &cluster));
-    file->current_cluster = cluster;
-
-    size_t pos_in_file = file->position;
-    while (total_written < size)
-    {
-        uint32_t offset_in_cluster = pos_in_file % bytes_per_cluster;
-        uint32_t sector_in_cluster = offset_in_cluster / FAT32_SECTOR_SIZE;
-        uint32_t byte_in_sector = offset_in_cluster % FAT32_SECTOR_SIZE;
-        uint32_t sector = cluster_to_sector(cluster) + sector_in_cluster;
-
-        RETURN_ON_ERROR(read_sector(sector, sector_buffer));
 
-        size_t bytes_to_write = FAT32_SECTOR_SIZE - byte_in_sector;
-        if (bytes_to_write > size - total_written)
+        uint32_t offset = level->entry * FAT32_DIR_ENTRY_SIZE;
+        uint32_t sector = cluster_to_sector(level->cluster) + offset / FAT32_SECTOR_SIZE;
+        if (sector != c->dir_loaded)
         {
-            bytes_to_write = size - total_written;
+            RETURN_ON_ERROR(read_sector(sector, c->dir));
+            c->dir_loaded = sector;
         }
+        fat32_dir_entry_t *entry = (fat32_dir_entry_t *)(c->dir + offset % FAT32_SECTOR_SIZE);
+        level->entry++;
 
-        memcpy(sector_buffer + byte_in_sector, src + total_written, bytes_to_write);
-
-        RETURN_ON_ERROR(write_sector(sector, sector_buffer));
-
-        total_written += bytes_to_write;
-        pos_in_file += bytes_to_write;
-
-        // Move to next cluster if needed
-        if ((pos_in_file % bytes_per_cluster) == 0 && total_written < size)
+        if (entry->shortname[0] == FAT32_DIR_ENTRY_END_MARKER)
         {
-            uint32_t next_cluster;
-            fat32_error_t fat_res = read_cluster_fat_entry(cluster, &next_cluster);
-            if (fat_res != FAT32_OK || next_cluster >= FAT32_FAT_ENTRY_EOC)
-            {
-                return FAT32_ERROR_DISK_FULL;
-            }
-            cluster = next_cluster;
-            file->current_cluster = cluster;
+            depth--;
+            continue;
+        }
+        if ((uint8_t)entry->shortname[0] == FAT32_DIR_ENTRY_FREE ||
+            entry->attr == FAT32_ATTR_LONG_NAME || (entry->attr & FAT32_ATTR_VOLUME_ID) ||
+            memcmp(entry->shortname, ".          ", 11) == 0 || memcmp(entry->shortname, "..         ", 11) == 0)
+        {
+            continue;
         }
-    }
 
-    file->position = pos_in_file;
-    if (file->position > file->file_size)
-    {
-        file->file_size = file->position;
+        uint32_t usable;
+        RETURN_ON_ERROR(check_entry(c, entry, &usable));
+        if (!(entry->attr & FAT32_ATTR_DIRECTORY))
+        {
+            report->files += first_pass;
+            continue;
+        }
+        report->directories += first_pass;
+        if (usable == 0)
+        {
+            continue;
+        }
+        if (depth == CHECK_MAX_DEPTH)
+        {
+            report->skipped += first_pass;
+            continue;
+        }
+        uint32_t start = ((uint32_t)entry->fst_clus_hi << 16) | entry->fst_clus_lo;
+        c->levels[depth++] = (check_level_t){start, usable, 0};
     }
+    return FAT32_OK;
+}
 
-    if (bytes_written)
-    {
-        *bytes_written = total_written;
-    }
+// Go through the FAT entries of the window in order: count the free clusters, and find the
+// lost ones, which no chain claimed
+static fat32_error_t check_sweep(check_t *c)
+{
+    fat32_check_t *report = c->report;
+    bool keep_lost = !c->repair || report->skipped > 0;
 
-    // --- Truncate cluster chain if file shrank ---
-    if (file->file_size < old_file_size)
+    for (uint32_t cluster = c->window_start; cluster < c->window_end; cluster++)
     {
-        // Calculate clusters needed for new size
-        uint32_t needed_clusters = (file->file_size == 0) ? 0 : (file->file_size + bytes_per_cluster - 1) / bytes_per_cluster;
-        uint32_t current_clusters = (old_file_size == 0) ? 0 : (old_file_size + bytes_per_cluster - 1) / bytes_per_cluster;
-
-        if (needed_clusters < current_clusters && file->start_cluster >= 2)
+        uint32_t *entry;
+        RETURN_ON_ERROR(check_fat_entry(c, cluster, &entry));
+        uint32_t value = *entry & 0x0FFFFFFF;
+        uint32_t bit = cluster - c->window_start;
+        if (value == FAT32_FAT_ENTRY_FREE)
         {
-            uint32_t last_cluster_to_keep = file->start_cluster;
-            if (needed_clusters > 0)
+            report->free_clusters += c->round == 0;
+        }
+        else if (value == CHECK_FAT_ENTRY_BAD || (c->owned[bit / 32] & (1u << (bit % 32))))
+        {
+            continue;
+        }
+        else
+        {
+            if (c->round == 0)
             {
-                // Seek to last cluster to keep
-                fat32_error_t seek_res = seek_to_cluster(file->start_cluster, needed_clusters - 1, &last_cluster_to_keep);
-                if (seek_res == FAT32_OK)
-                {
-                    uint32_t first_cluster_to_free = 0;
-                    if (read_cluster_fat_entry(last_cluster_to_keep, &first_cluster_to_free) == FAT32_OK)
-                    {
-                        // Mark end of chain
-                        write_cluster_fat_entry(last_cluster_to_keep, FAT32_FAT_ENTRY_EOC);
-                        // Free the rest
-                        release_cluster_chain(first_cluster_to_free);
-                    }
-                }
+                report->lost_clusters++;
+                report->lost_chains += value >= FAT32_FAT_ENTRY_EOC;
             }
-            else
+            if (keep_lost)
             {
-                // File is now empty, free entire chain
-                release_cluster_chain(file->start_cluster);
-                file->start_cluster = 0;
+                continue;
             }
+            *entry &= 0xF0000000;
+            c->fat_dirty = true;
+            c->freed++;
+            report->repaired = true;
+        }
+        if (cluster < c->lowest_free)
+        {
+            c->lowest_free = cluster;
         }
     }
-
-    // Update directory entry file size on disk
-    // After updating file->file_size:
-    if (file->dir_entry_sector && file->dir_entry_offset < FAT32_SECTOR_SIZE)
-    {
-        RETURN_ON_ERROR(read_sector(file->dir_entry_sector, sector_buffer));
-
-        fat32_dir_entry_t *dir_entry = (fat32_dir_entry_t *)(sector_buffer + file->dir_entry_offset);
-        dir_entry->file_size = file->file_size;
-
-        RETURN_ON_ERROR(write_sector(file->dir_entry_sector, sector_buffer));
-    }
-
-    return FAT32_OK;
+    return check_flush_fat(c);
 }
 
-fat32_error_t fat32_seek(fat32_file_t *file, uint32_t position)
+// Check the file system as fsck does. Every chain is followed once per pass, claiming its
+// clusters in a bitmap, so a cluster claimed twice is a cross-link and one that is in use but
+// never claimed is lost. The bitmap takes what is left of the buffer after the FAT and
+// directory sectors; if it cannot cover every cluster, the tree is walked once for each
+// window of clusters it can (and without repair, a problem that spans windows can be counted
+// in each). With repair, chains are cut where they go wrong, sizes are made to match, lost
+// clusters are freed and FSInfo is rewritten.
+fat32_error_t fat32_check(fat32_check_t *report, bool repair, void *buffer, size_t buffer_size)
 {
-    if (!file || !file->is_open)
+    size_t fixed = (CHECK_FAT_SECTORS + 1) * FAT32_SECTOR_SIZE + CHECK_MAX_DEPTH * sizeof(check_level_t);
+    if (!report || !buffer || buffer_size < fixed + sizeof(uint32_t))
     {
         return FAT32_ERROR_INVALID_PARAMETER;
     }
+    if (!fat32_is_ready())
+    {
+        return mount_status;
+    }
+    if (volume_exfat)
+    {
+        return FAT32_ERROR_NOT_SUPPORTED;
+    }
 
-    file->position = position;
-
-    return FAT32_OK;
-}
+    check_t c = {0};
+    c.report = report;
+    c.repair = repair;
+    c.fat = buffer;
+    c.dir = c.fat + CHECK_FAT_SECTORS * FAT32_SECTOR_SIZE;
+    c.levels = (check_level_t *)(c.dir + FAT32_SECTOR_SIZE);
+    c.owned = (uint32_t *)(c.levels + CHECK_MAX_DEPTH);
+    c.lowest_free = 0xFFFFFFFF;
+    uint32_t window = (buffer_size - fixed) / sizeof(uint32_t) * 32;
 
-inline uint32_t fat32_tell(fat32_file_t *file)
-{
-    return file ? file->position : 0;
-}
+    memset(report, 0, sizeof(fat32_check_t));
+    report->fsinfo_free = fsinfo.free_count;
 
-inline uint32_t fat32_size(fat32_file_t *file)
-{
-    return file ? file->file_size : 0;
-}
+    // A chain cut in a later window can leave clusters in an earlier one that were claimed
+    // when they were swept, so after such a repair the card is gone over once more
+    do
+    {
+        c.cut = false;
+        for (uint32_t start = 2; start < cluster_count + 2; start += window)
+        {
+            c.window_start = start;
+            c.window_end = cluster_count + 2 - start > window ? start + window : cluster_count + 2;
+            memset(c.owned, 0, (window / 32) * sizeof(uint32_t));
+            RETURN_ON_ERROR(check_tree(&c));
+            RETURN_ON_ERROR(check_sweep(&c));
+            c.pass++;
+        }
+    } while (c.cut && c.round++ == 0);
+    report->passes = c.pass;
 
-inline bool fat32_eof(fat32_file_t *file)
-{
-    return file ? (file->position >= file->file_size) : true;
+    if (repair && (report->repaired || fsinfo.free_count != report->free_clusters))
+    {
+        fsinfo.free_count = report->free_clusters + c.freed;
+        fsinfo.next_free = c.lowest_free;
+        RETURN_ON_ERROR(update_fsinfo());
+        report->repaired = true;
+    }
+    return FAT32_OK;
 }
 
 fat32_error_t fat32_delete(const char *path)
@@ -1754,6 +3799,18 @@ fat32_error_t fat32_set_current_dir(const char *path)
     fat32_file_t dir;
     RETURN_ON_ERROR(fat32_open(&dir, path));
 
+    if (volume_exfat)
+    {
+        // There are no ".." entries to find the path from later, so keep it
+        char absolute[FAT32_MAX_PATH_LEN];
+        if (!(dir.attributes & FAT32_ATTR_DIRECTORY))
+        {
+            return FAT32_ERROR_NOT_A_DIRECTORY;
+        }
+        RETURN_ON_ERROR(exfat_absolute_path(path, absolute, sizeof(absolute)));
+        strcpy(exfat_current_dir, absolute);
+    }
+
     // Update current directory cluster and name
     current_dir_cluster = dir.start_cluster;
     fat32_close(&dir); // Close the directory
@@ -1773,8 +3830,15 @@ fat32_error_t fat32_get_current_dir(char *path, size_t path_len)
         return mount_status;
     }
 
+    if (volume_exfat)
+    {
+        strncpy(path, exfat_current_dir, path_len);
+        path[path_len - 1] = '\0';
+        return FAT32_OK;
+    }
+
     // Special case: root
-    if (current_dir_cluster == boot_sector.root_cluster)
+    if (current_dir_cluster == root_cluster)
     {
         strncpy(path, "/", path_len);
         path[path_len - 1] = '\0';
@@ -1786,7 +3850,7 @@ fat32_error_t fat32_get_current_dir(char *path, size_t path_len)
     int depth = 0;
     uint32_t cluster = current_dir_cluster;
 
-    while (cluster != boot_sector.root_cluster && depth < 16)
+    while (cluster != root_cluster && depth < 16)
     {
         // Open current directory and read ".." entry to get parent cluster
         fat32_file_t dir = {0};
@@ -1797,7 +3861,7 @@ fat32_error_t fat32_get_current_dir(char *path, size_t path_len)
         dir.position = 0;
 
         fat32_entry_t entry;
-        uint32_t parent_cluster = boot_sector.root_cluster;
+        uint32_t parent_cluster = root_cluster;
         int entry_count = 0;
         bool found_parent = false;
 
@@ -1806,7 +3870,7 @@ fat32_error_t fat32_get_current_dir(char *path, size_t path_len)
         {
             if ((entry.attr & FAT32_ATTR_DIRECTORY) && strcmp(entry.filename, "..") == 0)
             {
-                parent_cluster = entry.start_cluster ? entry.start_cluster : boot_sector.root_cluster;
+                parent_cluster = entry.start_cluster ? entry.start_cluster : root_cluster;
                 found_parent = true;
                 break;
             }
@@ -1888,7 +3952,7 @@ fat32_error_t fat32_dir_read(fat32_file_t *dir, fat32_entry_t *dir_entry)
         return mount_status;
     }
 
-    memset(dir_entry, 0, sizeof(fat32_dir_entry_t));
+    memset(dir_entry, 0, sizeof(fat32_entry_t));
 
     if (dir->last_entry_read)
     {
@@ -1896,6 +3960,11 @@ fat32_error_t fat32_dir_read(fat32_file_t *dir, fat32_entry_t *dir_entry)
         return FAT32_OK;
     }
 
+    if (volume_exfat)
+    {
+        return exfat_dir_read(dir, dir_entry);
+    }
+
     char filename[FAT32_MAX_FILENAME_LEN + 1];
     uint8_t expected_checksum = 0;
     uint32_t current_sector = 0xFFFFFFFF; // Invalid sector to start with
@@ -1927,7 +3996,7 @@ fat32_error_t fat32_dir_read(fat32_file_t *dir, fat32_entry_t *dir_entry)
             // End of directory
             dir->last_entry_read = true; // Mark that we reached the end
         }
-        else if (entry->attr == FAT32_ATTR_LONG_NAME)
+        else if (entry->attr == FAT32_ATTR_LONG_NAME && entry->shortname[0] != FAT32_DIR_ENTRY_FREE)
         {
             // Populate long filename buffer with this entry's name contents
             fat32_lfn_entry_t *lfn_entry = (fat32_lfn_entry_t *)entry;
@@ -1939,10 +4008,11 @@ fat32_error_t fat32_dir_read(fat32_file_t *dir, fat32_entry_t *dir_entry)
                 expected_checksum = lfn_entry->checksum; // Save checksum for later comparison
             }
 
-            if (lfn_entry->checksum == expected_checksum)
+            // Copy this entry's part of the long filename into the filename buffer
+            int offset = ((lfn_entry->seq & 0x3F) - 1) * FAT32_DIR_LFN_PART_SIZE;
+            if (lfn_entry->checksum == expected_checksum && offset >= 0 &&
+                offset + FAT32_DIR_LFN_PART_SIZE <= FAT32_MAX_FILENAME_LEN)
             {
-                // Copy this entry's part of the long filename into the filename buffer
-                int offset = ((lfn_entry->seq & 0x3F) - 1) * FAT32_DIR_LFN_PART_SIZE;
                 lfn_to_str(lfn_entry, filename + offset);
             }
         }
@@ -1999,6 +4069,13 @@ fat32_error_t fat32_dir_create(fat32_file_t *dir, const char *path)
         return result; // Error creating directory
     }
 
+    if (volume_exfat)
+    {
+        // The cluster was cleared when it was allocated, and there are no "." and ".." entries
+        *dir = file;
+        return FAT32_OK;
+    }
+
     // Initialize directory struct
     dir->is_open = true;
     dir->start_cluster = file.start_cluster;
@@ -2011,7 +4088,7 @@ fat32_error_t fat32_dir_create(fat32_file_t *dir, const char *path)
     uint32_t parent_cluster = current_dir_cluster;
     if (path[0] == '/')
     {
-        parent_cluster = boot_sector.root_cluster;
+        parent_cluster = root_cluster;
     }
 
     // For non-root paths, find the actual parent
@@ -2029,7 +4106,7 @@ fat32_error_t fat32_dir_create(fat32_file_t *dir, const char *path)
             result = find_entry(&parent_entry, path_copy);
             if (result == FAT32_OK && (parent_entry.attr & FAT32_ATTR_DIRECTORY))
             {
-                parent_cluster = parent_entry.start_cluster ? parent_entry.start_cluster : boot_sector.root_cluster;
+                parent_cluster = parent_entry.start_cluster ? parent_entry.start_cluster : root_cluster;
             }
         }
     }
@@ -2050,7 +4127,7 @@ fat32_error_t fat32_dir_create(fat32_file_t *dir, const char *path)
     dotdot_entry.shortname[1] = '.';
     dotdot_entry.attr = FAT32_ATTR_DIRECTORY;
     // For root directory parent, cluster should be 0
-    if (parent_cluster == boot_sector.root_cluster)
+    if (parent_cluster == root_cluster)
     {
         dotdot_entry.fst_clus_hi = 0;
         dotdot_entry.fst_clus_lo = 0;
@@ -2119,6 +4196,16 @@ const char *fat32_error_string(fat32_error_t error)
         return "Invalid FAT size";
     case FAT32_ERROR_INVALID_RESERVED_SECTORS:
         return "Invalid reserved sectors";
+    case FAT32_ERROR_TOO_FRAGMENTED:
+        return "File too fragmented";
+    case FAT32_ERROR_NO_CONTIGUOUS_SPACE:
+        return "No contiguous free space";
+    case FAT32_ERROR_MAP_TOO_LARGE:
+        return "Mapped window too large";
+    case FAT32_ERROR_CACHE_FULL:
+        return "Sector cache full";
+    case FAT32_ERROR_NOT_SUPPORTED:
+        return "Not supported on this file system";
     default:
         return "Unknown error";
     }
@@ -2158,5 +4245,8 @@ void fat32_init(void)
     // Check if a SD card is present
     add_repeating_timer_ms(500, on_sd_card_detect, NULL, &sd_card_detect_timer);
 
+    mem_register_static("fat32 buffers", sizeof(sector_buffer) + sizeof(entry_buffer));
+    mem_register_static("fat32 sector cache", sizeof(cache_data) + sizeof(cache_slots) + sizeof(cache_maps));
+
     fat32_initialised = true;
 }
\ No newline at end of file
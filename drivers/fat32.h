@@ -25,6 +25,30 @@
 #define FAT32_DIR_ENTRY_END_MARKER (0x00) // End of directory entry marker
 #define FAT32_DIR_LFN_PART_SIZE (13)      // Size of each LFN part in bytes
 
+// exFAT constants
+#define EXFAT_FAT_ENTRY_EOC (0xFFFFFFFF) // End of cluster chain
+#define EXFAT_MAX_SET_ENTRIES (19)       // File, stream extension and up to 17 file name entries
+#define EXFAT_NAME_PART_SIZE (15)        // Characters in each file name entry
+
+#define EXFAT_ENTRY_END (0x00)    // End of directory marker
+#define EXFAT_ENTRY_IN_USE (0x80) // Clear in deleted entries
+#define EXFAT_ENTRY_SECONDARY (0x40)
+#define EXFAT_ENTRY_BITMAP (0x81) // Allocation bitmap
+#define EXFAT_ENTRY_UPCASE (0x82) // Up-case table
+#define EXFAT_ENTRY_LABEL (0x83)  // Volume label
+#define EXFAT_ENTRY_FILE (0x85)   // File or directory, followed by its secondary entries
+#define EXFAT_ENTRY_STREAM (0xC0) // Stream extension: size and first cluster
+#define EXFAT_ENTRY_NAME (0xC1)   // Part of the file name
+
+#define EXFAT_STREAM_ALLOCATION_POSSIBLE (0x01)
+#define EXFAT_STREAM_NO_FAT_CHAIN (0x02) // Clusters are consecutive and the FAT is not used
+
+// Sector cache, used by fat32_read and by the windows fat32_map returns
+#define FAT32_CACHE_SECTORS (16)  // Sectors the cache holds
+#define FAT32_MAP_MAX_SECTORS (8) // Most sectors one window can cover
+#define FAT32_MAP_MAX_PINNED (12) // Most sectors windows can pin at once, so reads always find a slot
+#define FAT32_MAX_MAPS (8)        // Windows mapped at once
+
 // Error codes
 typedef enum
 {
@@ -49,6 +73,11 @@ typedef enum
     FAT32_ERROR_INVALID_CLUSTER_SIZE,
     FAT32_ERROR_INVALID_FATS,
     FAT32_ERROR_INVALID_RESERVED_SECTORS,
+    FAT32_ERROR_TOO_FRAGMENTED,
+    FAT32_ERROR_NO_CONTIGUOUS_SPACE,
+    FAT32_ERROR_MAP_TOO_LARGE,
+    FAT32_ERROR_CACHE_FULL,
+    FAT32_ERROR_NOT_SUPPORTED,
 } fat32_error_t;
 
 // File handle structure
@@ -63,6 +92,8 @@ typedef struct
     uint32_t position;
     uint32_t dir_entry_sector; // Sector containing the directory entry
     uint32_t dir_entry_offset; // Byte offset within the sector
+    bool contiguous;           // exFAT: the clusters follow each other and are not in the FAT
+    bool dir_contiguous;       // exFAT: the same, for the directory holding the entry
 } fat32_file_t;
 
 // Directory entry structure
@@ -76,8 +107,34 @@ typedef struct
     uint8_t attr;
     uint32_t sector;
     uint32_t offset;
+    bool contiguous;     // exFAT: the clusters follow each other and are not in the FAT
+    bool dir_contiguous; // exFAT: the same, for the directory holding the entry
 } fat32_entry_t;
 
+// A run of consecutive blocks on the SD card holding part of a file
+typedef struct
+{
+    uint32_t block;  // first SD card block (absolute, usable with sd_read_blocks)
+    uint32_t count;  // number of blocks
+} fat32_extent_t;
+
+// Results of fat32_check
+typedef struct
+{
+    uint32_t files;           // files checked
+    uint32_t directories;     // directories checked, including the root
+    uint32_t lost_clusters;   // clusters marked in use that no file or directory owns
+    uint32_t lost_chains;     // chains of lost clusters (counted by their ends)
+    uint32_t cross_links;     // chains that run into a cluster of another chain, or loop
+    uint32_t bad_chains;      // chains that reach a free, bad or out-of-range cluster
+    uint32_t size_mismatches; // files whose size does not match the length of their chain
+    uint32_t skipped;         // directories too deep to check (their files look lost)
+    uint32_t free_clusters;   // free clusters in the FAT, not counting lost ones a repair freed
+    uint32_t fsinfo_free;     // free count in the FSInfo sector, before any repair
+    uint32_t passes;          // passes over the tree, more than one if the bitmap did not fit
+    bool repaired;            // something was written to the card
+} fat32_check_t;
+
 // Partition entry structure
 typedef struct
 {
@@ -165,15 +222,108 @@ typedef struct
     uint16_t name3[2];   // Last 2 characters (UTF-16)
 } __attribute__((packed)) fat32_lfn_entry_t;
 
+// exFAT boot sector (the fields before the boot code)
+typedef struct
+{
+    uint8_t jump[3];                   // 0xEB 0x76 0x90
+    char file_system_name[8];          // "EXFAT   "
+    uint8_t must_be_zero[53];          // Where the FAT32 BIOS parameter block would be
+    uint64_t partition_offset;         // Sectors before the volume (ignored)
+    uint64_t volume_length;            // Size of the volume in sectors
+    uint32_t fat_offset;               // First sector of the first FAT
+    uint32_t fat_length;               // Size of each FAT in sectors
+    uint32_t cluster_heap_offset;      // First sector of cluster 2
+    uint32_t cluster_count;            // Number of clusters in the cluster heap
+    uint32_t root_cluster;             // First cluster of the root directory
+    uint32_t volume_serial;            // Volume serial number (ignored)
+    uint16_t revision;                 // File system revision (1.00 is 0x0100)
+    uint16_t volume_flags;             // Bit 0 selects the active FAT and bitmap
+    uint8_t bytes_per_sector_shift;    // log2 of the sector size (must be 9)
+    uint8_t sectors_per_cluster_shift; // log2 of the sectors per cluster
+    uint8_t num_fats;                  // Number of FATs (1, or 2 for TexFAT)
+    uint8_t drive_select;              // Drive number (ignored)
+    uint8_t percent_in_use;            // Share of clusters allocated (not kept up to date)
+    uint8_t reserved[7];
+} __attribute__((packed)) exfat_boot_sector_t;
+
+typedef struct
+{
+    uint8_t type;                // EXFAT_ENTRY_FILE
+    uint8_t secondary_count;     // Entries that follow in the set
+    uint16_t set_checksum;       // Checksum of the whole set
+    uint16_t attributes;         // FAT32_ATTR_* bits
+    uint16_t reserved1;
+    uint32_t create_timestamp;   // Date in the upper 16 bits, time in the lower 16
+    uint32_t modify_timestamp;
+    uint32_t access_timestamp;
+    uint8_t create_10ms;
+    uint8_t modify_10ms;
+    uint8_t create_utc_offset;
+    uint8_t modify_utc_offset;
+    uint8_t access_utc_offset;
+    uint8_t reserved2[7];
+} __attribute__((packed)) exfat_file_entry_t;
+
+typedef struct
+{
+    uint8_t type;               // EXFAT_ENTRY_STREAM
+    uint8_t flags;              // EXFAT_STREAM_* bits
+    uint8_t reserved1;
+    uint8_t name_length;        // Characters in the file name
+    uint16_t name_hash;         // Hash of the up-cased file name
+    uint16_t reserved2;
+    uint64_t valid_data_length; // Bytes written; the rest of the data reads as zeros
+    uint32_t reserved3;
+    uint32_t first_cluster;     // 0 if nothing is allocated
+    uint64_t data_length;       // Size of the file or directory in bytes
+} __attribute__((packed)) exfat_stream_entry_t;
+
+typedef struct
+{
+    uint8_t type;                        // EXFAT_ENTRY_NAME
+    uint8_t flags;
+    uint16_t name[EXFAT_NAME_PART_SIZE]; // UTF-16
+} __attribute__((packed)) exfat_name_entry_t;
+
+typedef struct
+{
+    uint8_t type;         // EXFAT_ENTRY_BITMAP or EXFAT_ENTRY_UPCASE
+    uint8_t flags;        // Bitmap: bit 0 is the FAT the bitmap belongs to
+    uint8_t reserved[18]; // Up-case table: checksum in bytes 4 to 7
+    uint32_t first_cluster;
+    uint64_t data_length;
+} __attribute__((packed)) exfat_table_entry_t;
+
+typedef struct
+{
+    uint8_t type;       // EXFAT_ENTRY_LABEL
+    uint8_t length;     // Characters in the label
+    uint16_t label[11]; // UTF-16
+    uint8_t reserved[8];
+} __attribute__((packed)) exfat_label_entry_t;
+
+typedef union
+{
+    uint8_t type;
+    uint8_t raw[FAT32_DIR_ENTRY_SIZE];
+    exfat_file_entry_t file;
+    exfat_stream_entry_t stream;
+    exfat_name_entry_t name;
+    exfat_table_entry_t table;
+    exfat_label_entry_t label;
+} exfat_dir_entry_t;
+
 // File system functions
 bool fat32_is_ready(void);
 fat32_error_t fat32_mount(void);
 void fat32_unmount(void);
 bool fat32_is_mounted(void);
+bool fat32_is_exfat(void);
 fat32_error_t fat32_get_status(void);
 fat32_error_t fat32_get_free_space(uint64_t *free_space);
 fat32_error_t fat32_get_total_space(uint64_t *total_space);
 fat32_error_t fat32_get_volume_name(char *name, size_t name_len);
+fat32_error_t fat32_check(fat32_check_t *report, bool repair, void *buffer, size_t buffer_size);
 uint32_t fat32_get_cluster_size(void);
 
 // File operations
@@ -181,11 +331,16 @@ fat32_error_t fat32_open(fat32_file_t *file, const char *path);
 fat32_error_t fat32_create(fat32_file_t *file, const char *path);
 fat32_error_t fat32_close(fat32_file_t *file);
 fat32_error_t fat32_read(fat32_file_t *file, void *buffer, size_t size, size_t *bytes_read);
+fat32_error_t fat32_map(fat32_file_t *file, uint32_t offset, uint32_t length, const void **ptr);
+fat32_error_t fat32_unmap(const void *ptr);
 fat32_error_t fat32_write(fat32_file_t *file, const void *buffer, size_t size, size_t *bytes_written);
 fat32_error_t fat32_seek(fat32_file_t *file, uint32_t position);
 uint32_t fat32_tell(fat32_file_t *file);
 uint32_t fat32_size(fat32_file_t *file);
 bool fat32_eof(fat32_file_t *file);
+fat32_error_t fat32_get_extents(fat32_file_t *file, fat32_extent_t *extents, int max_extents, int *extent_count);
+fat32_error_t fat32_get_fragments(fat32_file_t *file, uint32_t *clusters, uint32_t *fragments);
+fat32_error_t fat32_defrag(fat32_file_t *file, void *buffer, size_t buffer_size);
 fat32_error_t fat32_delete(const char *path);
 fat32_error_t fat32_rename(const char *old_path, const char *new_path);
 
@@ -0,0 +1,187 @@
+//
+//  Clock governor for the PicoCalc
+//
+//  Switches the system clock between a small set of profiles: a low
+//  clock for long idle periods, the default clock for text-mode work and
+//  a fast clock for graphics and decoding.
+//
+//  The SPI, I2C and UART dividers and the PIO audio periods are all
+//  derived from the system clock, so every driver that computes one
+//  registers a callback with governor_register(). Callbacks are told
+//  before the change, so transfers in flight can finish, and again
+//  after it, so dividers can be recomputed. The hardware timer (and so
+//  every alarm, repeating timer and sleep) runs from clk_ref, which the
+//  governor does not touch.
+//
+//  While core 0 waits a long time for input at the normal clock, it
+//  drops to the low clock and returns to the normal clock on the next
+//  key press. Graphics runs at the fast clock, so it is never slowed down.
+//
+//  Change profiles from core 0 while core 1 is not drawing to the LCD.
+//
+
+#include <string.h>
+
+#include "pico/stdlib.h"
+#include "hardware/clocks.h"
+#include "hardware/vreg.h"
+
+#include "governor.h"
+
+static const governor_profile_info_t profiles[GOVERNOR_NUM_PROFILES] = {
+    {"low", 48000, VREG_VOLTAGE_DEFAULT},
+    {"normal", 150000, VREG_VOLTAGE_DEFAULT},
+    {"fast", 200000, VREG_VOLTAGE_1_15},
+};
+
+static governor_callback_t callbacks[GOVERNOR_MAX_CALLBACKS];
+static int callback_count = 0;
+
+static governor_profile_t current_profile = GOVERNOR_NORMAL;
+static enum vreg_voltage current_voltage = VREG_VOLTAGE_DEFAULT;
+static bool idle_lowered = false;   // dropped to the low clock by governor_idle_begin
+
+
+//
+// Peripheral registration
+//
+
+// Register a callback to be told about clock changes, returns false if the table is full
+bool governor_register(governor_callback_t callback)
+{
+    for (int i = 0; i < callback_count; i++)
+    {
+        if (callbacks[i] == callback)
+        {
+            return true; // Already registered
+        }
+    }
+
+    if (callback_count >= GOVERNOR_MAX_CALLBACKS)
+    {
+        return false;
+    }
+
+    callbacks[callback_count++] = callback;
+    return true;
+}
+
+static void notify(governor_event_t event, uint32_t sys_hz)
+{
+    for (int i = 0; i < callback_count; i++)
+    {
+        callbacks[i](event, sys_hz);
+    }
+}
+
+
+//
+// Profiles
+//
+
+// Switch to a clock profile, returns false if the clock cannot be generated
+bool governor_set_profile(governor_profile_t profile)
+{
+    if (profile >= GOVERNOR_NUM_PROFILES)
+    {
+        return false;
+    }
+    if (profile == current_profile)
+    {
+        return true;
+    }
+
+    const governor_profile_info_t *info = &profiles[profile];
+    uint vco_freq, post_div1, post_div2;
+    if (!check_sys_clock_khz(info->sys_khz, &vco_freq, &post_div1, &post_div2))
+    {
+        return false;
+    }
+
+    // Let drivers finish transfers that rely on interrupts to complete
+    notify(GOVERNOR_PRE_CHANGE, clock_get_hz(clk_sys));
+
+    uint32_t irq_state = save_and_disable_interrupts();
+
+    // Raise the core voltage before raising the clock
+    if (info->voltage > current_voltage)
+    {
+        vreg_set_voltage(info->voltage);
+        busy_wait_us(1000); // allow the regulator to settle
+    }
+
+    set_sys_clock_pll(vco_freq, post_div1, post_div2);
+
+    // Lower the core voltage after lowering the clock
+    if (info->voltage < current_voltage)
+    {
+        vreg_set_voltage(info->voltage);
+    }
+    current_voltage = info->voltage;
+    current_profile = profile;
+
+    notify(GOVERNOR_POST_CHANGE, clock_get_hz(clk_sys));
+
+    restore_interrupts(irq_state);
+    return true;
+}
+
+governor_profile_t governor_get_profile(void)
+{
+    return current_profile;
+}
+
+const governor_profile_info_t *governor_get_profile_info(governor_profile_t profile)
+{
+    if (profile >= GOVERNOR_NUM_PROFILES)
+    {
+        return NULL;
+    }
+    return &profiles[profile];
+}
+
+// Look up a profile by name, returns false if there is no such profile
+bool governor_find_profile(const char *name, governor_profile_t *profile)
+{
+    for (int i = 0; i < GOVERNOR_NUM_PROFILES; i++)
+    {
+        if (strcmp(profiles[i].name, name) == 0)
+        {
+            *profile = (governor_profile_t)i;
+            return true;
+        }
+    }
+    return false;
+}
+
+uint32_t governor_get_sys_hz(void)
+{
+    return clock_get_hz(clk_sys);
+}
+
+
+//
+// Long idle periods
+//
+
+// Drop to the low clock while waiting for input (only from the normal clock)
+void governor_idle_begin(void)
+{
+    if (!idle_lowered && current_profile == GOVERNOR_NORMAL)
+    {
+        idle_lowered = governor_set_profile(GOVERNOR_LOW);
+    }
+}
+
+// Return to the normal clock if governor_idle_begin lowered it
+void governor_idle_end(void)
+{
+    if (idle_lowered)
+    {
+        idle_lowered = false;
+        if (current_profile == GOVERNOR_LOW)
+        {
+            governor_set_profile(GOVERNOR_NORMAL);
+        }
+    }
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "pico/stdlib.h"
+#include "hardware/vreg.h"
+
+#define GOVERNOR_MAX_CALLBACKS  (8)     // maximum number of registered peripherals
+#define GOVERNOR_IDLE_TIMEOUT_MS (30000) // wait for input this long before dropping to the low clock
+
+// Clock profiles, slowest first
+typedef enum
+{
+    GOVERNOR_LOW = 0,                   // long idle periods, text at the prompt
+    GOVERNOR_NORMAL,                    // default clock, text-mode applications
+    GOVERNOR_FAST,                      // graphics and decoding
+    GOVERNOR_NUM_PROFILES
+} governor_profile_t;
+
+// System clock and core voltage for a profile
+typedef struct
+{
+    const char *name;                   // short name, e.g. "fast"
+    uint32_t sys_khz;                   // system clock in kHz
+    enum vreg_voltage voltage;          // core voltage
+} governor_profile_info_t;
+
+// Clock change events
+typedef enum
+{
+    GOVERNOR_PRE_CHANGE,                // about to change, finish any transfer in flight
+    GOVERNOR_POST_CHANGE                // changed, recompute dividers (interrupts disabled)
+} governor_event_t;
+
+typedef void (*governor_callback_t)(governor_event_t event, uint32_t sys_hz);
+
+// Peripheral registration
+bool governor_register(governor_callback_t callback);
+
+// Profiles
+bool governor_set_profile(governor_profile_t profile);
+governor_profile_t governor_get_profile(void);
+const governor_profile_info_t *governor_get_profile_info(governor_profile_t profile);
+bool governor_find_profile(const char *name, governor_profile_t *profile);
+uint32_t governor_get_sys_hz(void);
+
+// Long idle periods
+void governor_idle_begin(void);
+void governor_idle_end(void);
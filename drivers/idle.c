@@ -0,0 +1,77 @@
+//
+//  Event-driven idle for the PicoCalc
+//
+//  Code that waits for something to happen (a key press, a received
+//  character, a DMA transfer, a command from the other core) sleeps
+//  with __wfe() instead of spinning. Interrupt handlers that make a
+//  waiter's condition true call idle_signal() to wake it up; any taken
+//  interrupt also wakes a sleeping core, so the wake latency is at most
+//  one keyboard poll period.
+//
+//  The time each core spends asleep is counted so the idle percentage
+//  can be measured.
+//
+
+#include "pico/stdlib.h"
+
+#include "idle.h"
+
+static volatile uint64_t idle_time_us[IDLE_NUM_CORES];
+static volatile uint64_t stats_start_us = 0;
+
+// Sleep until the next event (interrupt or idle_signal on either core)
+void idle_wait(void)
+{
+    uint core = get_core_num();
+    uint64_t start = time_us_64();
+
+    __wfe();
+
+    idle_time_us[core] += time_us_64() - start;
+}
+
+// Sleep until the target time, counting the time as idle
+void idle_sleep_until(absolute_time_t target)
+{
+    uint core = get_core_num();
+    uint64_t start = time_us_64();
+
+    sleep_until(target);
+
+    idle_time_us[core] += time_us_64() - start;
+}
+
+// Wake any core waiting in idle_wait (safe to call from interrupt handlers)
+void idle_signal(void)
+{
+    __sev();
+}
+
+// Start a new measurement period
+void idle_reset_stats(void)
+{
+    for (int i = 0; i < IDLE_NUM_CORES; i++)
+    {
+        idle_time_us[i] = 0;
+    }
+    stats_start_us = time_us_64();
+}
+
+// Percentage of the measurement period the core spent asleep
+uint8_t idle_get_percent(uint core)
+{
+    uint64_t elapsed = time_us_64() - stats_start_us;
+    if (core >= IDLE_NUM_CORES || elapsed == 0)
+    {
+        return 0;
+    }
+
+    uint64_t percent = idle_time_us[core] * 100 / elapsed;
+    return percent > 100 ? 100 : (uint8_t)percent;
+}
+
+// Time the core spent asleep in the measurement period
+uint64_t idle_get_time_us(uint core)
+{
+    return core < IDLE_NUM_CORES ? idle_time_us[core] : 0;
+}
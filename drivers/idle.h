@@ -0,0 +1,15 @@
+#pragma once
+
+#include "pico/stdlib.h"
+
+#define IDLE_NUM_CORES  (2)             // idle time is tracked per core
+
+// Waiting for events
+void idle_wait(void);
+void idle_sleep_until(absolute_time_t target);
+void idle_signal(void);
+
+// Idle statistics
+void idle_reset_stats(void);
+uint8_t idle_get_percent(uint core);
+uint64_t idle_get_time_us(uint core);
@@ -10,6 +10,7 @@
 //  buffer the key events for when needed, except for the user interrupt
 //  where we process it immediately. We use a semaphore to protect access
 //  to the I2C bus and a repeating timer to poll for the key events.
+//  Waiting for a key sleeps the core until the timer wakes it.
 //
 //  We also provide functions to interact with other features in the system,
 //  such as reading the battery level.
@@ -19,6 +20,10 @@
 
 #include "keyboard.h"
 #include "southbridge.h"
+#include "idle.h"
+#include "governor.h"
+#include "dpm.h"
+#include "lcd.h"
 
 extern volatile bool user_interrupt;
 keyboard_key_available_callback_t keyboard_key_available_callback = NULL;
@@ -98,6 +103,9 @@ void keyboard_poll()
                 rx_buffer[rx_head] = ch;
                 rx_head = next_head;
 
+                // Wake anyone sleeping in keyboard_get_key
+                idle_signal();
+
                 // Notify that characters are available
                 if (keyboard_key_available_callback)
                 {
@@ -142,14 +150,31 @@ bool keyboard_key_available()
 
 char keyboard_get_key()
 {
-    while (!keyboard_key_available())
+    while (true)
     {
-        tight_loop_contents();
-    }
+        absolute_time_t wait_start = get_absolute_time();
+        while (!keyboard_key_available())
+        {
+            uint32_t waited_ms = (uint32_t)(absolute_time_diff_us(wait_start, get_absolute_time()) / 1000);
+            if (waited_ms >= GOVERNOR_IDLE_TIMEOUT_MS)
+            {
+                governor_idle_begin(); // long wait, drop to the low clock
+            }
+            dpm_input_wait(waited_ms); // dim or sleep the display
+            lcd_update_cursor();       // show the blink phase set by the cursor timer
+            idle_wait();               // woken by the keyboard or cursor timer
+        }
+        governor_idle_end();
+
+        char ch = rx_buffer[rx_tail];
+        rx_tail = (rx_tail + 1) & (KBD_BUFFER_SIZE - 1);
 
-    char ch = rx_buffer[rx_tail];
-    rx_tail = (rx_tail + 1) & (KBD_BUFFER_SIZE - 1);
-    return ch;
+        if (!dpm_input_resume())
+        {
+            return ch;
+        }
+        // The key only woke the display, wait for the next one
+    }
 }
 
 
@@ -20,12 +20,15 @@
 #include "hardware/dma.h"
 
 #include "lcd.h"
+#include "memstat.h"
+#include "idle.h"
+#include "governor.h"
 
 static bool lcd_initialised = false; // flag to indicate if the LCD is initialised
 
 // DMA channels for SPI transfers
 static int lcd_dma_channel = -1;     // DMA channel for LCD transfers
-static bool lcd_dma_busy = false;    // flag to indicate if DMA transfer is in progress
+static volatile bool lcd_dma_busy = false; // flag to indicate if DMA transfer is in progress
 static volatile uint32_t lcd_dma_irq_count = 0;  // DEBUG: count interrupt calls
 
 // Callback for DMA completion (for async buffer management)
@@ -91,8 +94,9 @@ static void lcd_dma_handler()
     // Now it's safe to deassert chip select
     gpio_put(LCD_CSX, 1);
 
-    // Mark DMA as not busy
+    // Mark DMA as not busy and wake anyone waiting for it
     lcd_dma_busy = false;
+    idle_signal();
 
     // Restore SPI format to 8-bit for commands
     spi_set_format(LCD_SPI, 8, 0, 0, SPI_MSB_FIRST);
@@ -110,7 +114,7 @@ static void lcd_dma_handler()
 static inline void lcd_dma_wait()
 {
     while (lcd_dma_busy) {
-        tight_loop_contents();
+        idle_wait(); // woken by the DMA interrupt or the other core
     }
 }
 
@@ -311,6 +315,7 @@ void lcd_write16_buf(const uint16_t *buffer, size_t len)
         // Release chip select and restore SPI format
         gpio_put(LCD_CSX, 1);
         lcd_dma_busy = false;
+        idle_signal(); // the other core may be waiting in lcd_dma_wait
         spi_set_format(LCD_SPI, 8, 0, 0, SPI_MSB_FIRST);
 
         // Call completion callback to release buffer (if from pool)
@@ -368,12 +373,17 @@ void lcd_blit(const uint16_t *pixels, uint16_t x, uint16_t y, uint16_t width, ui
     {
         // Adjust y for vertical scroll offset and wrap within memory height
         uint16_t y_virtual = (lcd_y_offset + y) % lcd_memory_scroll_height;
-        uint16_t y_end = lcd_scroll_top + y_virtual + height - 1;
-        if (y_end >= lcd_scroll_top + lcd_memory_scroll_height)
+        uint16_t rows_to_end = lcd_memory_scroll_height - y_virtual;
+        if (height > rows_to_end)
         {
-            y_end = lcd_scroll_top + lcd_memory_scroll_height - 1;
+            // The block wraps around the end of the scroll area, draw the part before the wrap first
+            lcd_set_window(x, lcd_scroll_top + y_virtual, x + width - 1, lcd_scroll_top + lcd_memory_scroll_height - 1);
+            lcd_write16_buf((uint16_t *)pixels, width * rows_to_end);
+            pixels += width * rows_to_end;
+            height -= rows_to_end;
+            y_virtual = 0;
         }
-        lcd_set_window(x, lcd_scroll_top + y_virtual, x + width - 1, y_end);
+        lcd_set_window(x, lcd_scroll_top + y_virtual, x + width - 1, lcd_scroll_top + y_virtual + height - 1);
     }
     else
     {
@@ -666,15 +676,31 @@ void lcd_putstr(uint8_t column, uint8_t row, const char *str)
 // Except for the box drawing glyphs who do extend into that row. Disable the
 // cursor when printing these if you want to see the box drawing glyphs
 // uncorrupted.
-
-static uint8_t cursor_column = 0;  // cursor x position for drawing
-static uint8_t cursor_row = 0;     // cursor y position for drawing
-static bool cursor_enabled = true; // cursor visibility state
+//
+// The cursor is an overlay kept as state: the blink timer only flips the
+// blink phase and wakes the foreground, which draws or erases the cursor
+// with lcd_update_cursor() while it waits for input. No SPI traffic happens
+// in interrupt context, and output only erases the cursor once, the first
+// time it finds it on the display.
+
+static uint8_t cursor_column = 0;           // cursor x position for drawing
+static uint8_t cursor_row = 0;              // cursor y position for drawing
+static bool cursor_enabled = true;          // cursor visibility state
+static bool cursor_drawn = false;           // the cursor is on the display
+static volatile bool cursor_blink_on = true; // blink phase, flipped by the cursor timer
+
+static void lcd_paint_cursor(uint16_t colour)
+{
+    lcd_solid_rectangle(colour, cursor_column * font->width, ((cursor_row + 1) * GLYPH_HEIGHT) - 1, font->width, 1);
+}
 
 // Enable or disable the cursor
 void lcd_enable_cursor(bool cursor_on)
 {
-    // Cursor visibility is not implemented, but we can toggle the state
+    if (!cursor_on)
+    {
+        lcd_erase_cursor();
+    }
     cursor_enabled = cursor_on;
 }
 
@@ -690,6 +716,10 @@ bool lcd_cursor_enabled()
 void lcd_move_cursor(uint8_t column, uint8_t row)
 {
     uint8_t max_col = lcd_get_columns() - 1;
+
+    // Take the cursor off the display before it moves
+    lcd_erase_cursor();
+
     // Move the cursor to the specified position
     cursor_column = column;
     cursor_row = row;
@@ -699,23 +729,41 @@ void lcd_move_cursor(uint8_t column, uint8_t row)
         cursor_column = max_col;
     if (cursor_row > MAX_ROW)
         cursor_row = MAX_ROW;
+
+    // Show the cursor straight away at its new position
+    cursor_blink_on = true;
 }
 
 // Draw the cursor at the current position
 void lcd_draw_cursor()
 {
-    if (cursor_enabled)
+    if (cursor_enabled && !cursor_drawn)
     {
-        lcd_solid_rectangle(foreground, cursor_column * font->width, ((cursor_row + 1) * GLYPH_HEIGHT) - 1, font->width, 1);
+        lcd_paint_cursor(foreground);
+        cursor_drawn = true;
     }
 }
 
 // Erase the cursor at the current position
 void lcd_erase_cursor()
 {
-    if (cursor_enabled)
+    if (cursor_drawn)
     {
-        lcd_solid_rectangle(background, cursor_column * font->width, ((cursor_row + 1) * GLYPH_HEIGHT) - 1, font->width, 1);
+        lcd_paint_cursor(background);
+        cursor_drawn = false;
+    }
+}
+
+// Bring the display up to date with the blink phase (call from the foreground)
+void lcd_update_cursor()
+{
+    if (cursor_enabled && cursor_blink_on)
+    {
+        lcd_draw_cursor();
+    }
+    else
+    {
+        lcd_erase_cursor();
     }
 }
 
@@ -750,41 +798,143 @@ void lcd_display_off()
     lcd_enable_interrupts();
 }
 
+//
+//  Power states
+//
+//  The frame memory keeps its contents in idle, partial and sleep mode, so
+//  nothing needs to be redrawn when the display returns to normal.
+//
+
+static absolute_time_t sleep_in_time; // when the last sleep in command was sent
+
+// Idle mode shows 8 colours (the top bit of each channel) at the reduced idle frame rate
+void lcd_set_idle_mode(bool idle)
+{
+    lcd_disable_interrupts();
+    lcd_write_cmd(idle ? LCD_CMD_IDMON : LCD_CMD_IDMOFF);
+    lcd_enable_interrupts();
+}
+
+// Show only the screen rows first_row..last_row (in pixels), the rest of the panel is dark
+void lcd_set_partial_rows(uint16_t first_row, uint16_t last_row)
+{
+    lcd_disable_interrupts();
+    lcd_write_cmd(LCD_CMD_PTLAR);
+    lcd_write_data(4,
+                   UPPER8(first_row), LOWER8(first_row),
+                   UPPER8(last_row), LOWER8(last_row));
+    lcd_write_cmd(LCD_CMD_PTLON);
+    lcd_enable_interrupts();
+}
+
+// Leave partial mode and show the whole panel again
+void lcd_set_normal_mode()
+{
+    lcd_disable_interrupts();
+    lcd_write_cmd(LCD_CMD_NORON);
+    lcd_enable_interrupts();
+}
+
+// Turn off the panel and put the controller to sleep (frame memory is kept)
+void lcd_sleep()
+{
+    lcd_disable_interrupts();
+    lcd_write_cmd(LCD_CMD_DISPOFF);
+    lcd_write_cmd(LCD_CMD_SLPIN);
+    lcd_enable_interrupts();
+
+    sleep_in_time = get_absolute_time();
+}
+
+// Wake the controller and turn the panel back on
+void lcd_wake()
+{
+    // Sleep out must not follow sleep in within 120ms
+    sleep_until(delayed_by_ms(sleep_in_time, 120));
+
+    lcd_disable_interrupts();
+    lcd_write_cmd(LCD_CMD_SLPOUT);
+    lcd_enable_interrupts();
+
+    sleep_ms(5); // required to wait at least 5ms
+
+    lcd_display_on();
+}
+
 //
 //  Background processing
 //
 //  Handle background tasks such as blinking the cursor
 //
 
-// Blink the cursor at regular intervals
+// Blink the cursor at regular intervals (only the phase changes here, see lcd_update_cursor)
 bool on_cursor_timer(repeating_timer_t *rt)
 {
-    static bool cursor_visible = false;
-
-    if (!lcd_cursor_enabled())
+    if (cursor_enabled)
     {
-        return true; // if the SPI bus is not available or cursor is disabled, do not toggle cursor
+        cursor_blink_on = !cursor_blink_on;
+        idle_signal(); // wake the foreground so it can redraw the cursor
     }
+    return true; // Keep the timer running
+}
+
+//
+//  Clock changes
+//
+//  The SPI divider is derived from the system clock, so recompute it
+//  when the clock governor changes profile.
+//
 
-    if (cursor_visible)
+static void lcd_clock_changed(governor_event_t event, uint32_t sys_hz)
+{
+    if (event == GOVERNOR_PRE_CHANGE)
     {
-        lcd_erase_cursor();
+        // Let the current transfer drain at the old baud rate
+        lcd_dma_wait();
+        while (spi_is_busy(LCD_SPI))
+        {
+            tight_loop_contents();
+        }
     }
     else
     {
-        lcd_draw_cursor();
+        spi_set_baudrate(LCD_SPI, LCD_BAUDRATE);
     }
-
-    cursor_visible = !cursor_visible; // Toggle cursor visibility
-    return true;                      // Keep the timer running
 }
 
-// Initialize the LCD display
-void lcd_init()
+//
+//  Initialisation
+//
+//  The controller needs long waits after reset and after sleep out. So
+//  that the rest of the system can start up during these waits,
+//  initialisation is split into lcd_init_start(), which resets the
+//  controller, and lcd_init_poll(), which does the next step whenever
+//  its wait is over. lcd_init() does both and blocks.
+//
+//  The frame memory is cleared while the controller is still asleep, so
+//  the clear overlaps the wait before sleep out.
+//
+
+typedef enum
 {
-    if (lcd_initialised)
+    LCD_INIT_IDLE,          // lcd_init_start not called yet
+    LCD_INIT_RESET,         // hardware reset, waiting to send the software reset
+    LCD_INIT_SWRESET,       // software reset, waiting to configure
+    LCD_INIT_CONFIGURED,    // configured and cleared, waiting for sleep out
+    LCD_INIT_SLEEP_OUT,     // awake, waiting to turn on the display
+    LCD_INIT_DONE
+} lcd_init_state_t;
+
+static lcd_init_state_t init_state = LCD_INIT_IDLE;
+static absolute_time_t reset_time;   // when the hardware reset was released
+static absolute_time_t init_wait;    // when the current step may run
+
+// Reset the controller and start initialisation (returns immediately)
+void lcd_init_start()
+{
+    if (init_state != LCD_INIT_IDLE)
     {
-        return; // already initialized
+        return; // already started
     }
 
     // initialise GPIO
@@ -835,48 +985,116 @@ void lcd_init()
     gpio_put(LCD_CSX, 1);
     gpio_put(LCD_RST, 1);
 
-    lcd_disable_interrupts();
+    // Blip the reset pin to reset the LCD controller
+    gpio_put(LCD_RST, 0);
+    busy_wait_us(20); // 20µs reset pulse (10µs minimum)
+    gpio_put(LCD_RST, 1);
+
+    reset_time = get_absolute_time();
+    init_wait = delayed_by_ms(reset_time, 5); // 5ms required after reset
+    init_state = LCD_INIT_RESET;
+}
+
+// Do the next initialisation step if its wait is over, returns true when the LCD is ready
+bool lcd_init_poll()
+{
+    if (init_state == LCD_INIT_DONE)
+    {
+        return true;
+    }
+    if (init_state == LCD_INIT_IDLE || !time_reached(init_wait))
+    {
+        return false;
+    }
 
-    lcd_reset(); // reset the LCD controller
+    switch (init_state)
+    {
+    case LCD_INIT_RESET:
+        lcd_disable_interrupts();
+        lcd_write_cmd(LCD_CMD_SWRESET); // reset the commands and parameters to their S/W Reset default values
+        lcd_enable_interrupts();
 
-    lcd_write_cmd(LCD_CMD_SWRESET); // reset the commands and parameters to their S/W Reset default values
-    busy_wait_us(10000);                   // required to wait at least 5ms
+        init_wait = make_timeout_time_ms(10); // required to wait at least 5ms
+        init_state = LCD_INIT_SWRESET;
+        break;
 
-    lcd_write_cmd(LCD_CMD_COLMOD); // pixel format set
-    lcd_write_data(1, 0x55);       // 16 bit/pixel (RGB565)
+    case LCD_INIT_SWRESET:
+        lcd_disable_interrupts();
 
-    lcd_write_cmd(LCD_CMD_MADCTL); // memory access control
-    lcd_write_data(1, 0x48);       // BGR colour filter panel, top to bottom, left to right
+        lcd_write_cmd(LCD_CMD_COLMOD); // pixel format set
+        lcd_write_data(1, 0x55);       // 16 bit/pixel (RGB565)
 
-    lcd_write_cmd(LCD_CMD_INVON); // display inversion on
+        lcd_write_cmd(LCD_CMD_MADCTL); // memory access control
+        lcd_write_data(1, 0x48);       // BGR colour filter panel, top to bottom, left to right
 
-    lcd_write_cmd(LCD_CMD_EMS); // entry mode set
-    lcd_write_data(1, 0xC6);    // normal display, 16-bit (RGB) to 18-bit (rgb) colour
-                                //   conversion: r(0) = b(0) = G(0)
+        lcd_write_cmd(LCD_CMD_INVON); // display inversion on
 
-    lcd_write_cmd(LCD_CMD_VSCRDEF); // vertical scroll definition
-    lcd_write_data(6,
-                   0x00, 0x00, // top fixed area of 0 pixels
-                   0x01, 0x40, // scroll area height of 320 pixels
-                   0x00, 0x00  // bottom fixed area of 0 pixels
-    );
+        lcd_write_cmd(LCD_CMD_FRMCTR2); // frame rate control in idle mode
+        lcd_write_data(2, 0x03, 0x1F);  // fosc/8, 31 clocks per line (lowest frame rate)
 
-    lcd_write_cmd(LCD_CMD_SLPOUT); // sleep out
-    lcd_enable_interrupts();
+        lcd_write_cmd(LCD_CMD_EMS); // entry mode set
+        lcd_write_data(1, 0xC6);    // normal display, 16-bit (RGB) to 18-bit (rgb) colour
+                                    //   conversion: r(0) = b(0) = G(0)
 
-    busy_wait_us(10000);                  // required to wait at least 5ms
+        lcd_write_cmd(LCD_CMD_VSCRDEF); // vertical scroll definition
+        lcd_write_data(6,
+                       0x00, 0x00, // top fixed area of 0 pixels
+                       0x01, 0x40, // scroll area height of 320 pixels
+                       0x00, 0x00  // bottom fixed area of 0 pixels
+        );
 
-    // Clear the screen
-    lcd_clear_screen();
+        lcd_enable_interrupts();
 
-    // Now that the display is initialized, display RAM garbage is cleared,
-    // turn on the display
-    lcd_display_on();
+        // Clear the display RAM garbage while the controller is still asleep
+        lcd_clear_screen();
+
+        init_wait = delayed_by_ms(reset_time, 120); // 120ms needed before sleep out command
+        init_state = LCD_INIT_CONFIGURED;
+        break;
+
+    case LCD_INIT_CONFIGURED:
+        lcd_disable_interrupts();
+        lcd_write_cmd(LCD_CMD_SLPOUT); // sleep out
+        lcd_enable_interrupts();
+
+        init_wait = make_timeout_time_ms(10); // required to wait at least 5ms
+        init_state = LCD_INIT_SLEEP_OUT;
+        break;
+
+    case LCD_INIT_SLEEP_OUT:
+        // Now that the display RAM is cleared, turn on the display
+        lcd_display_on();
+
+        // Blink the cursor every second (500 ms on, 500 ms off)
+        add_repeating_timer_ms(-500, on_cursor_timer, NULL, &cursor_timer);
 
-    // Blink the cursor every second (500 ms on, 500 ms off)
-    add_repeating_timer_ms(-500, on_cursor_timer, NULL, &cursor_timer);
+        mem_register_static("lcd line_buffer", sizeof(line_buffer) + sizeof(char_buffer));
+        governor_register(lcd_clock_changed);
 
-    lcd_initialised = true; // Set the initialised flag
+        init_state = LCD_INIT_DONE;
+        lcd_initialised = true; // Set the initialised flag
+        break;
+
+    default:
+        break;
+    }
+
+    return init_state == LCD_INIT_DONE;
+}
+
+// Initialize the LCD display (blocks until it is ready)
+void lcd_init()
+{
+    if (lcd_initialised)
+    {
+        return; // already initialized
+    }
+
+    lcd_init_start();
+    while (!lcd_init_poll())
+    {
+        tight_loop_contents();
+    }
 }
 
 // Check if DMA is currently busy
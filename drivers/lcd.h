@@ -25,6 +25,8 @@
 #define LCD_CMD_SWRESET (0x01)          // software reset
 #define LCD_CMD_SLPIN   (0x10)          // sleep in
 #define LCD_CMD_SLPOUT  (0x11)          // sleep out
+#define LCD_CMD_PTLON   (0x12)          // partial mode on
+#define LCD_CMD_NORON   (0x13)          // normal display mode on
 #define LCD_CMD_INVOFF  (0x20)          // display inversion off
 #define LCD_CMD_INVON   (0x21)          // display inversion on
 #define LCD_CMD_DISPOFF (0x28)          // display off
@@ -33,9 +35,12 @@
 #define LCD_CMD_RASET   (0x2B)          // row address set
 #define LCD_CMD_RAMWR   (0x2C)          // memory write
 #define LCD_CMD_RAMRD   (0x2E)          // memory read
+#define LCD_CMD_PTLAR   (0x30)          // partial area
 #define LCD_CMD_VSCRDEF (0x33)          // vertical scroll definition
 #define LCD_CMD_MADCTL  (0x36)          // memory access control
 #define LCD_CMD_VSCSAD  (0x37)          // vertical scroll start address of RAM
+#define LCD_CMD_IDMOFF  (0x38)          // idle mode off
+#define LCD_CMD_IDMON   (0x39)          // idle mode on (8 colours)
 #define LCD_CMD_COLMOD  (0x3A)          // pixel format set
 #define LCD_CMD_IFMODE  (0xB0)          // interface mode control
 #define LCD_CMD_FRMCTR1 (0xB1)          // frame rate control (in normal mode)
@@ -87,6 +92,13 @@ void lcd_reset(void);
 void lcd_display_on(void);
 void lcd_display_off(void);
 
+// Power states
+void lcd_set_idle_mode(bool idle);
+void lcd_set_partial_rows(uint16_t first_row, uint16_t last_row);
+void lcd_set_normal_mode(void);
+void lcd_sleep(void);
+void lcd_wake(void);
+
 // Low-level SPI functions
 void lcd_write_cmd(uint8_t cmd);
 void lcd_write_data(uint8_t len, ...);
@@ -112,11 +124,14 @@ void lcd_draw_cursor(void);
 void lcd_erase_cursor(void);
 void lcd_enable_cursor(bool cursor_on);
 bool lcd_cursor_enabled(void);
+void lcd_update_cursor(void);
 
 // Initialization
 void lcd_clear_screen(void);
 void lcd_erase_line(uint8_t row, uint8_t col_start, uint8_t col_end);
 void lcd_init(void);
+void lcd_init_start(void);
+bool lcd_init_poll(void);
 
 // Debug functions
 uint32_t lcd_get_dma_irq_count(void);
@@ -0,0 +1,243 @@
+//
+//  Memory statistics for the PicoCalc
+//
+//  Reports static section sizes from the linker symbols, heap usage from
+//  the C library, and stack high-water marks for both cores. Stacks are
+//  painted with a known pattern at start-up, and the high-water mark is
+//  the lowest word that no longer holds the pattern.
+//
+//  Modules with large static buffers register them with
+//  mem_register_static() so they can be reported by name.
+//
+
+#include <stdlib.h>
+#include <malloc.h>
+
+#include "pico/stdlib.h"
+
+#include "memstat.h"
+
+// Linker symbols (see memmap_default.ld in the Pico SDK)
+extern char __flash_binary_start;
+extern char __flash_binary_end;
+extern char __data_start__;
+extern char __data_end__;
+extern char __bss_start__;
+extern char __bss_end__;
+extern char __end__;            // start of the heap
+extern char __StackLimit;       // maximum heap pointer
+extern char __StackBottom;      // core 0 stack
+extern char __StackTop;
+extern char __StackOneBottom;   // core 1 stack
+extern char __StackOneTop;
+
+static mem_region_t regions[MEM_MAX_REGIONS];
+static int region_count = 0;
+
+static char *heap_break = NULL;  // current program break
+static char *heap_peak = NULL;   // highest program break since the last reset
+
+
+//
+// Heap
+//
+
+// Replaces the weak _sbrk in the Pico SDK so the heap high-water mark can be tracked
+void *_sbrk(int incr)
+{
+    if (heap_break == NULL)
+    {
+        heap_break = &__end__;
+        heap_peak = heap_break;
+    }
+
+    char *prev_break = heap_break;
+    char *next_break = heap_break + incr;
+
+    if (next_break > &__StackLimit)
+    {
+#if PICO_USE_OPTIMISTIC_SBRK
+        if (heap_break == &__StackLimit)
+        {
+            return (void *)-1;
+        }
+        next_break = &__StackLimit;
+#else
+        return (void *)-1;
+#endif
+    }
+
+    heap_break = next_break;
+    if (heap_break > heap_peak)
+    {
+        heap_peak = heap_break;
+    }
+    return prev_break;
+}
+
+static char *get_heap_break(void)
+{
+    return heap_break ? heap_break : &__end__;
+}
+
+// Estimate the largest block malloc can return without allocating. The top
+// chunk of the arena (keepcost in newlib) can grow into the space not yet
+// claimed with _sbrk, so together they form one contiguous block. Free
+// chunks inside the arena are not walked; when fragmented, their total
+// (fordblks) only bounds them, so the top block is what is reported.
+static size_t get_largest_free_block(const struct mallinfo *mi)
+{
+    size_t top = mi->keepcost + (size_t)(&__StackLimit - get_heap_break());
+    size_t overhead = 2 * sizeof(size_t); // chunk header kept by malloc
+
+    return top > overhead ? top - overhead : 0;
+}
+
+
+//
+// Stacks
+//
+
+static void paint_stack(uint32_t *bottom, uint32_t *top)
+{
+    while (bottom < top)
+    {
+        *bottom++ = MEM_STACK_PAINT;
+    }
+}
+
+static size_t get_stack_usage(const uint32_t *bottom, const uint32_t *top)
+{
+    const uint32_t *p = bottom;
+    while (p < top && *p == MEM_STACK_PAINT)
+    {
+        p++;
+    }
+    return (size_t)((const char *)top - (const char *)p);
+}
+
+// Paint the unused part of the core 0 stack, below the caller's frame
+static void __attribute__((noinline)) paint_core0_stack(void)
+{
+    // Leave some headroom below this frame for the painting loop itself
+    uint32_t *limit = (uint32_t *)((uintptr_t)__builtin_frame_address(0) - 64);
+    paint_stack((uint32_t *)&__StackBottom, limit);
+}
+
+// Paint the core 1 stack (call before launching core 1)
+void mem_paint_core1_stack(void)
+{
+    paint_stack((uint32_t *)&__StackOneBottom, (uint32_t *)&__StackOneTop);
+}
+
+// Return the stack high-water mark for a core
+size_t mem_get_stack_peak(uint8_t core)
+{
+    if (core == 0)
+    {
+        return get_stack_usage((uint32_t *)&__StackBottom, (uint32_t *)&__StackTop);
+    }
+    return get_stack_usage((uint32_t *)&__StackOneBottom, (uint32_t *)&__StackOneTop);
+}
+
+
+//
+// Static regions
+//
+
+// Register a static buffer so it can be reported by name
+void mem_register_static(const char *name, size_t size)
+{
+    for (int i = 0; i < region_count; i++)
+    {
+        if (regions[i].name == name)
+        {
+            return; // Already registered
+        }
+    }
+
+    if (region_count < MEM_MAX_REGIONS)
+    {
+        regions[region_count].name = name;
+        regions[region_count].size = size;
+        region_count++;
+    }
+}
+
+int mem_get_region_count(void)
+{
+    return region_count;
+}
+
+const mem_region_t *mem_get_region(int index)
+{
+    if (index < 0 || index >= region_count)
+    {
+        return NULL;
+    }
+    return &regions[index];
+}
+
+
+//
+// Memory state
+//
+
+void mem_get_info(mem_info_t *info)
+{
+    struct mallinfo mi = mallinfo();
+    char *brk = get_heap_break();
+
+    info->flash_size = (size_t)(&__flash_binary_end - &__flash_binary_start);
+    info->data_size = (size_t)(&__data_end__ - &__data_start__);
+    info->bss_size = (size_t)(&__bss_end__ - &__bss_start__);
+
+    info->heap_total = (size_t)(&__StackLimit - &__end__);
+    info->heap_used = mi.uordblks;
+    info->heap_free = mi.fordblks + (size_t)(&__StackLimit - brk);
+    info->heap_peak = (size_t)((heap_peak ? heap_peak : brk) - &__end__);
+    info->heap_largest = get_largest_free_block(&mi);
+
+    info->stack0_size = (size_t)(&__StackTop - &__StackBottom);
+    info->stack0_peak = mem_get_stack_peak(0);
+    info->stack1_size = (size_t)(&__StackOneTop - &__StackOneBottom);
+    info->stack1_peak = mem_get_stack_peak(1);
+}
+
+
+//
+// Benchmark support
+//
+
+// Start recording peak memory usage for a benchmark run
+void mem_bench_begin(void)
+{
+    heap_peak = get_heap_break();
+    paint_core0_stack();
+}
+
+// Stop recording and return the peak memory usage of the run
+void mem_bench_end(mem_usage_t *usage)
+{
+    struct mallinfo mi = mallinfo();
+
+    usage->heap_used = mi.uordblks;
+    usage->heap_peak = (size_t)(heap_peak - &__end__);
+    usage->stack0_peak = mem_get_stack_peak(0);
+    usage->stack1_peak = mem_get_stack_peak(1);
+}
+
+
+//
+// Initialisation
+//
+
+void mem_init(void)
+{
+    if (heap_peak == NULL)
+    {
+        heap_break = &__end__;
+        heap_peak = heap_break;
+    }
+    paint_core0_stack();
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#define MEM_MAX_REGIONS     (16)        // maximum number of registered static regions
+#define MEM_STACK_PAINT     (0xDEADBEEF) // pattern used to paint unused stack
+
+// A static buffer registered by a module so it can be reported by name
+typedef struct
+{
+    const char *name;   // module and buffer name, e.g. "gfx framebuffer"
+    size_t size;        // size in bytes
+} mem_region_t;
+
+// Snapshot of the memory state
+typedef struct
+{
+    size_t flash_size;      // flash image size (text, rodata and data load image)
+    size_t data_size;       // initialised data (.data)
+    size_t bss_size;        // zero-initialised data (.bss)
+    size_t heap_total;      // heap region size (end of bss to heap limit)
+    size_t heap_used;       // heap bytes currently allocated
+    size_t heap_free;       // heap bytes free (arena free + not yet claimed)
+    size_t heap_peak;       // heap high-water mark (highest program break)
+    size_t heap_largest;    // largest block that malloc can return from the heap top
+    size_t stack0_size;     // core 0 stack size
+    size_t stack0_peak;     // core 0 stack high-water mark
+    size_t stack1_size;     // core 1 stack size
+    size_t stack1_peak;     // core 1 stack high-water mark
+} mem_info_t;
+
+// Peak memory usage recorded over one benchmark run
+typedef struct
+{
+    size_t heap_used;       // heap in use at the end of the run
+    size_t heap_peak;       // heap high-water mark reached during the run
+    size_t stack0_peak;     // core 0 stack high-water mark reached during the run
+    size_t stack1_peak;     // core 1 stack high-water mark (since boot)
+} mem_usage_t;
+
+// Initialisation (call first thing in main)
+void mem_init(void);
+void mem_paint_core1_stack(void);
+
+// Static buffer registration
+void mem_register_static(const char *name, size_t size);
+int mem_get_region_count(void);
+const mem_region_t *mem_get_region(int index);
+
+// Memory state
+void mem_get_info(mem_info_t *info);
+size_t mem_get_stack_peak(uint8_t core);
+
+// Benchmark support
+void mem_bench_begin(void);
+void mem_bench_end(mem_usage_t *usage);
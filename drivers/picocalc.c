@@ -7,6 +7,10 @@
 #include "keyboard.h"
 #include "fat32.h"
 #include "southbridge.h"
+#include "scratch.h"
+#include "idle.h"
+#include "lcd.h"
+#include "boottime.h"
 
 // Callback for when characters become available
 static void (*chars_available_callback)(void *) = NULL;
@@ -22,7 +26,8 @@ static void picocalc_out_chars(const char *buf, int length)
 
 static void picocalc_out_flush(void)
 {
-    // No flush needed for this driver
+    // Output is written straight away, just bring the cursor back
+    lcd_update_cursor();
 }
 
 static int picocalc_in_chars(char *buf, int length)
@@ -62,16 +67,120 @@ stdio_driver_t picocalc_stdio_driver = {
     .next = NULL,
 };
 
-void picocalc_init()
+//
+// Initialisation
+//
+// Initialisation is a small dependency graph. A stage runs once the stages
+// it depends on have finished. A stage that is waiting on slow hardware
+// returns false and is polled again, so the other stages run during the
+// wait instead of after it. Each stage is timestamped as it finishes.
+//
+
+typedef enum
+{
+    STAGE_SCRATCH,
+    STAGE_LCD_RESET,
+    STAGE_SOUTHBRIDGE,
+    STAGE_KEYBOARD,
+    STAGE_AUDIO,
+    STAGE_FAT32,
+    STAGE_LCD,
+    STAGE_DISPLAY,
+    STAGE_STDIO,
+    NUM_STAGES
+} init_stage_id_t;
+
+#define AFTER(stage) (1u << (stage))
+
+typedef struct
+{
+    const char *name;       // name recorded in the boot timing
+    uint32_t depends;       // stages that must finish first
+    bool (*run)(void);      // returns false while waiting on hardware
+} init_stage_t;
+
+static bool init_scratch(void)
+{
+    scratch_init();
+    return true;
+}
+
+static bool init_lcd_reset(void)
+{
+    lcd_init_start();
+    return true;
+}
+
+static bool init_southbridge(void)
 {
     sb_init();
-    display_init();
+    return true;
+}
+
+static bool init_keyboard(void)
+{
     keyboard_init();
     keyboard_set_key_available_callback(picocalc_chars_available_notify);
     keyboard_set_background_poll(true);
+    return true;
+}
+
+static bool init_audio(void)
+{
     audio_init();
-    fat32_init();
+    return true;
+}
+
+static bool init_fat32(void)
+{
+    fat32_init(); // the file system is mounted on first access
+    return true;
+}
+
+static bool init_display(void)
+{
+    display_init();
+    return true;
+}
 
+static bool init_stdio(void)
+{
     stdio_set_driver_enabled(&picocalc_stdio_driver, true);
     stdio_set_translate_crlf(&picocalc_stdio_driver, true);
-}
\ No newline at end of file
+    return true;
+}
+
+static const init_stage_t init_stages[NUM_STAGES] = {
+    [STAGE_SCRATCH] = {"scratch", 0, init_scratch},
+    [STAGE_LCD_RESET] = {"lcd reset", 0, init_lcd_reset},
+    [STAGE_SOUTHBRIDGE] = {"southbridge", 0, init_southbridge},
+    [STAGE_KEYBOARD] = {"keyboard", AFTER(STAGE_SOUTHBRIDGE), init_keyboard},
+    [STAGE_AUDIO] = {"audio", 0, init_audio},
+    [STAGE_FAT32] = {"fat32", 0, init_fat32},
+    [STAGE_LCD] = {"lcd", AFTER(STAGE_LCD_RESET), lcd_init_poll},
+    [STAGE_DISPLAY] = {"display", AFTER(STAGE_LCD), init_display},
+    [STAGE_STDIO] = {"stdio", AFTER(STAGE_DISPLAY) | AFTER(STAGE_KEYBOARD), init_stdio},
+};
+
+void picocalc_init()
+{
+    idle_reset_stats();
+
+    uint32_t done = 0;
+    while (done != (1u << NUM_STAGES) - 1)
+    {
+        for (int i = 0; i < NUM_STAGES; i++)
+        {
+            const init_stage_t *stage = &init_stages[i];
+            if ((done & AFTER(i)) || (done & stage->depends) != stage->depends)
+            {
+                continue; // Already done or not ready to run
+            }
+            if (stage->run())
+            {
+                done |= AFTER(i);
+                boot_mark(stage->name);
+            }
+        }
+    }
+}
@@ -0,0 +1,297 @@
+//
+//  Scratch memory manager for the PicoCalc
+//
+//  Owns a single large block of RAM that is big enough for a full-screen
+//  RGB565 frame. The graphics module leases the whole block as its
+//  framebuffer while it is rendering; the rest of the time text-mode
+//  applications can lease ranges of it for line indexes, read-ahead and
+//  decode buffers instead of fragmenting the heap.
+//
+//  Every lease is checked against the active leases, so two users can
+//  never be handed overlapping memory. Leases can be taken from either
+//  core.
+//
+
+#include <string.h>
+
+#include "pico/stdlib.h"
+#include "pico/critical_section.h"
+
+#include "scratch.h"
+#include "memstat.h"
+
+static bool scratch_initialised = false;
+static critical_section_t scratch_lock;
+
+static uint8_t scratch_memory[SCRATCH_SIZE] __attribute__((aligned(SCRATCH_ALIGN)));
+static scratch_lease_t leases[SCRATCH_MAX_LEASES];
+
+#define ALIGN_UP(x) (((x) + (SCRATCH_ALIGN - 1)) & ~(uint32_t)(SCRATCH_ALIGN - 1))
+
+
+//
+// Lease table helpers (call with the lock held)
+//
+
+static bool overlaps_lease(uint32_t offset, uint32_t size, uint32_t *lease_end)
+{
+    for (int i = 0; i < SCRATCH_MAX_LEASES; i++)
+    {
+        if (leases[i].size == 0)
+        {
+            continue;
+        }
+        uint32_t start = leases[i].offset;
+        uint32_t end = start + leases[i].size;
+        if (offset < end && start < offset + size)
+        {
+            if (lease_end)
+            {
+                *lease_end = end;
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+static scratch_lease_t *find_free_slot(void)
+{
+    for (int i = 0; i < SCRATCH_MAX_LEASES; i++)
+    {
+        if (leases[i].size == 0)
+        {
+            return &leases[i];
+        }
+    }
+    return NULL;
+}
+
+// Lowest offset at which a range of the given size fits, or SCRATCH_SIZE if none
+static uint32_t find_free_range(uint32_t size)
+{
+    uint32_t offset = 0;
+    uint32_t lease_end;
+
+    while (offset + size <= SCRATCH_SIZE)
+    {
+        if (!overlaps_lease(offset, size, &lease_end))
+        {
+            return offset;
+        }
+        offset = ALIGN_UP(lease_end);
+    }
+    return SCRATCH_SIZE;
+}
+
+static void *add_lease(uint32_t offset, uint32_t size, const char *owner)
+{
+    scratch_lease_t *lease = find_free_slot();
+    if (lease == NULL)
+    {
+        return NULL;
+    }
+    lease->offset = offset;
+    lease->size = size;
+    lease->owner = owner;
+    return &scratch_memory[offset];
+}
+
+
+//
+// Leases
+//
+
+// Lease a specific range of the scratch memory, returns NULL if any part is in use
+void *scratch_lease(uint32_t offset, uint32_t size, const char *owner)
+{
+    if (size == 0 || offset >= SCRATCH_SIZE || size > SCRATCH_SIZE - offset || offset != ALIGN_UP(offset))
+    {
+        return NULL;
+    }
+    size = ALIGN_UP(size);
+
+    scratch_init();
+    critical_section_enter_blocking(&scratch_lock);
+    void *ptr = NULL;
+    if (!overlaps_lease(offset, size, NULL))
+    {
+        ptr = add_lease(offset, size, owner);
+    }
+    critical_section_exit(&scratch_lock);
+
+    return ptr;
+}
+
+// Lease the first free range of the given size, returns NULL if none is large enough
+void *scratch_lease_any(uint32_t size, const char *owner)
+{
+    if (size == 0 || size > SCRATCH_SIZE)
+    {
+        return NULL;
+    }
+    size = ALIGN_UP(size);
+
+    scratch_init();
+    critical_section_enter_blocking(&scratch_lock);
+    void *ptr = NULL;
+    uint32_t offset = find_free_range(size);
+    if (offset < SCRATCH_SIZE)
+    {
+        ptr = add_lease(offset, size, owner);
+    }
+    critical_section_exit(&scratch_lock);
+
+    return ptr;
+}
+
+// Release a lease given the pointer returned when it was taken
+bool scratch_release(const void *ptr)
+{
+    if (ptr == NULL)
+    {
+        return false;
+    }
+
+    scratch_init();
+    critical_section_enter_blocking(&scratch_lock);
+    bool released = false;
+    for (int i = 0; i < SCRATCH_MAX_LEASES; i++)
+    {
+        if (leases[i].size && &scratch_memory[leases[i].offset] == ptr)
+        {
+            leases[i].size = 0;
+            leases[i].owner = NULL;
+            released = true;
+            break;
+        }
+    }
+    critical_section_exit(&scratch_lock);
+
+    return released;
+}
+
+// Size of the largest range that can currently be leased
+uint32_t scratch_get_largest_free(void)
+{
+    scratch_init();
+    critical_section_enter_blocking(&scratch_lock);
+    uint32_t largest = 0;
+    uint32_t offset = 0;
+    while (offset < SCRATCH_SIZE)
+    {
+        // Find the nearest lease at or after this offset
+        uint32_t next_start = SCRATCH_SIZE;
+        uint32_t next_end = SCRATCH_SIZE;
+        for (int i = 0; i < SCRATCH_MAX_LEASES; i++)
+        {
+            if (leases[i].size && leases[i].offset + leases[i].size > offset && leases[i].offset < next_start)
+            {
+                next_start = leases[i].offset;
+                next_end = leases[i].offset + leases[i].size;
+            }
+        }
+        if (next_start > offset && next_start - offset > largest)
+        {
+            largest = next_start - offset;
+        }
+        offset = ALIGN_UP(next_end);
+    }
+    critical_section_exit(&scratch_lock);
+
+    return largest;
+}
+
+int scratch_get_lease_count(void)
+{
+    int count = 0;
+    for (int i = 0; i < SCRATCH_MAX_LEASES; i++)
+    {
+        if (leases[i].size)
+        {
+            count++;
+        }
+    }
+    return count;
+}
+
+// Copy the index'th active lease, returns false if there is no such lease
+bool scratch_get_lease(int index, scratch_lease_t *lease)
+{
+    for (int i = 0; i < SCRATCH_MAX_LEASES; i++)
+    {
+        if (leases[i].size && index-- == 0)
+        {
+            *lease = leases[i];
+            return true;
+        }
+    }
+    return false;
+}
+
+
+//
+// Arenas
+//
+
+// Lease a range for bump allocation; a size of 0 leases the largest free range
+bool scratch_arena_open(scratch_arena_t *arena, uint32_t size, const char *owner)
+{
+    if (size == 0)
+    {
+        size = scratch_get_largest_free();
+    }
+
+    arena->base = scratch_lease_any(size, owner);
+    arena->size = arena->base ? ALIGN_UP(size) : 0;
+    arena->used = 0;
+    return arena->base != NULL;
+}
+
+// Allocate from the arena, returns NULL if the arena is exhausted
+void *scratch_arena_alloc(scratch_arena_t *arena, uint32_t size)
+{
+    size = ALIGN_UP(size);
+    if (arena->base == NULL || size > arena->size - arena->used)
+    {
+        return NULL;
+    }
+
+    void *ptr = arena->base + arena->used;
+    arena->used += size;
+    return ptr;
+}
+
+// Discard all allocations but keep the lease
+void scratch_arena_reset(scratch_arena_t *arena)
+{
+    arena->used = 0;
+}
+
+// Discard all allocations and release the lease
+void scratch_arena_close(scratch_arena_t *arena)
+{
+    scratch_release(arena->base);
+    arena->base = NULL;
+    arena->size = 0;
+    arena->used = 0;
+}
+
+
+//
+// Initialisation
+//
+
+void scratch_init(void)
+{
+    if (scratch_initialised)
+    {
+        return; // Already initialised
+    }
+
+    critical_section_init(&scratch_lock);
+    memset(leases, 0, sizeof(leases));
+    mem_register_static("scratch memory", sizeof(scratch_memory));
+
+    scratch_initialised = true;
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#define SCRATCH_SIZE        (320 * 320 * 2) // one full-screen RGB565 frame
+#define SCRATCH_MAX_LEASES  (8)             // maximum number of simultaneous leases
+#define SCRATCH_ALIGN       (4)             // alignment of leases and arena allocations
+
+// An active lease on part of the scratch memory
+typedef struct
+{
+    uint32_t offset;    // offset from the start of the scratch memory
+    uint32_t size;      // size in bytes (0 if the slot is free)
+    const char *owner;  // name of the lease holder
+} scratch_lease_t;
+
+// A bump allocator over a leased range of the scratch memory
+typedef struct
+{
+    uint8_t *base;      // start of the leased range (NULL if not open)
+    uint32_t size;      // size of the leased range
+    uint32_t used;      // bytes allocated so far
+} scratch_arena_t;
+
+// Initialisation
+void scratch_init(void);
+
+// Leases
+void *scratch_lease(uint32_t offset, uint32_t size, const char *owner);
+void *scratch_lease_any(uint32_t size, const char *owner);
+bool scratch_release(const void *ptr);
+uint32_t scratch_get_largest_free(void);
+int scratch_get_lease_count(void);
+bool scratch_get_lease(int index, scratch_lease_t *lease);
+
+// Arenas
+bool scratch_arena_open(scratch_arena_t *arena, uint32_t size, const char *owner);
+void *scratch_arena_alloc(scratch_arena_t *arena, uint32_t size);
+void scratch_arena_reset(scratch_arena_t *arena);
+void scratch_arena_close(scratch_arena_t *arena);
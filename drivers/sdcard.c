@@ -18,10 +18,15 @@
 #include "hardware/spi.h"
 
 #include "sdcard.h"
+#include "governor.h"
+#include "idle.h"
 
 // Global state
 static bool sd_initialised = false;
+static uint32_t sd_baudrate = 0;                                                  // Requested SPI clock (0 until sd_card_init)
 static bool is_sdhc = false;                                                      // Set this in sd_card_init()
+static volatile uint8_t prepare_state = SD_PREPARE_NONE;                          // Power-up started by sd_card_prepare()
+static volatile sd_error_t prepare_result = SD_OK;
 static uint8_t dummy_bytes[8] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}; // Dummy bytes for SPI read/write
 
 //
@@ -117,6 +122,35 @@ static uint8_t sd_send_command(uint8_t cmd, uint32_t arg)
     return response;
 }
 
+// Wait for the token that starts a block of read data
+static bool sd_wait_data_token(void)
+{
+    uint8_t response;
+    uint32_t timeout = 100000;
+    do
+    {
+        response = sd_spi_write_read(0xFF);
+        timeout--;
+    } while (response != SD_DATA_START_BLOCK && timeout > 0);
+
+    return timeout > 0;
+}
+
+// End a multiple block read (CS stays selected)
+static void sd_stop_transmission(void)
+{
+    uint8_t packet[6] = {0x40 | SD_CMD12, 0, 0, 0, 0, 0xFF};
+    sd_spi_write_buf(packet, 6);
+    sd_spi_write_read(0xFF); // stuff byte
+
+    uint8_t retry = 0;
+    while ((sd_spi_write_read(0xFF) & 0x80) && (retry++ < 64))
+    {
+        // Wait for the R1 response
+    }
+    sd_wait_ready(); // the card is busy until it has stopped
+}
+
 //
 // Card detection and initialisation
 //
@@ -145,15 +179,7 @@ sd_error_t sd_read_block(uint32_t block, uint8_t *buffer)
         return SD_ERROR_READ_FAILED;
     }
 
-    // Wait for data token
-    uint32_t timeout = 100000;
-    do
-    {
-        response = sd_spi_write_read(0xFF);
-        timeout--;
-    } while (response != SD_DATA_START_BLOCK && timeout > 0);
-
-    if (timeout == 0)
+    if (!sd_wait_data_token())
     {
         sd_cs_deselect();
         return SD_ERROR_READ_FAILED;
@@ -207,17 +233,40 @@ sd_error_t sd_write_block(uint32_t block, const uint8_t *buffer)
     return SD_OK;
 }
 
+// Read consecutive blocks with a single READ_MULTIPLE_BLOCK command
 sd_error_t sd_read_blocks(uint32_t start_block, uint32_t num_blocks, uint8_t *buffer)
 {
+    if (num_blocks <= 1)
+    {
+        return num_blocks ? sd_read_block(start_block, buffer) : SD_OK;
+    }
+
+    uint32_t addr = is_sdhc ? start_block : start_block * SD_BLOCK_SIZE;
+    uint8_t response = sd_send_command(SD_CMD18, addr);
+    if (response != 0)
+    {
+        sd_cs_deselect();
+        return SD_ERROR_READ_FAILED;
+    }
+
+    sd_error_t result = SD_OK;
     for (uint32_t i = 0; i < num_blocks; i++)
     {
-        sd_error_t result = sd_read_block(start_block + i, buffer + (i * SD_BLOCK_SIZE));
-        if (result != SD_OK)
+        if (!sd_wait_data_token())
         {
-            return result;
+            result = SD_ERROR_READ_FAILED;
+            break;
         }
+        sd_spi_read_buf(buffer + (i * SD_BLOCK_SIZE), SD_BLOCK_SIZE);
+
+        // Read CRC (ignore it)
+        sd_spi_write_read(0xFF);
+        sd_spi_write_read(0xFF);
     }
-    return SD_OK;
+
+    sd_stop_transmission();
+    sd_cs_deselect();
+    return result;
 }
 
 sd_error_t sd_write_blocks(uint32_t start_block, uint32_t num_blocks, const uint8_t *buffer)
@@ -264,6 +313,7 @@ sd_error_t sd_card_init(void)
 {
     // Start with lower SPI speed for initialization (400kHz)
     spi_init(SD_SPI, SD_INIT_BAUDRATE);
+    sd_baudrate = SD_INIT_BAUDRATE;
 
     // Ensure CS is high and wait for card to stabilize
     sd_cs_deselect();
@@ -375,10 +425,60 @@ sd_error_t sd_card_init(void)
 
     // Switch to higher speed for normal operation
     spi_set_baudrate(SD_SPI, SD_BAUDRATE);
+    sd_baudrate = SD_BAUDRATE;
 
     return SD_OK;
 }
 
+// Recompute the SPI divider when the clock governor changes profile
+static void sd_clock_changed(governor_event_t event, uint32_t sys_hz)
+{
+    // Transfers are blocking, so only a power-up on the other core can be in flight
+    if (event == GOVERNOR_PRE_CHANGE)
+    {
+        while (prepare_state == SD_PREPARE_RUNNING)
+        {
+            tight_loop_contents();
+        }
+    }
+    else if (sd_baudrate)
+    {
+        spi_set_baudrate(SD_SPI, sd_baudrate);
+    }
+}
+
+// Power up the card ahead of the first mount so its slow start-up overlaps
+// other work. Call after sd_init(); it may run on either core.
+void sd_card_prepare(void)
+{
+    if (prepare_state != SD_PREPARE_NONE || !sd_card_present())
+    {
+        return;
+    }
+
+    prepare_state = SD_PREPARE_RUNNING;
+    prepare_result = sd_card_init();
+    prepare_state = SD_PREPARE_DONE;
+    idle_signal(); // wake sd_card_start if it is waiting
+}
+
+// Initialise the card, taking the result of sd_card_prepare() if it ran
+sd_error_t sd_card_start(void)
+{
+    while (prepare_state == SD_PREPARE_RUNNING)
+    {
+        idle_wait();
+    }
+
+    if (prepare_state == SD_PREPARE_DONE)
+    {
+        prepare_state = SD_PREPARE_NONE;
+        return prepare_result;
+    }
+
+    return sd_card_init();
+}
+
 void sd_init(void)
 {
     if (sd_initialised)
@@ -401,5 +501,7 @@ void sd_init(void)
     gpio_set_function(SD_SCK, GPIO_FUNC_SPI);
     gpio_set_function(SD_MOSI, GPIO_FUNC_SPI);
 
+    governor_register(sd_clock_changed);
+
     sd_initialised = true;
 }
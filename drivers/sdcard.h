@@ -60,11 +60,21 @@ typedef enum
     SD_ERROR_WRITE_FAILED,
 } sd_error_t;
 
+// Card power-up state (see sd_card_prepare)
+typedef enum
+{
+    SD_PREPARE_NONE = 0,
+    SD_PREPARE_RUNNING,
+    SD_PREPARE_DONE,
+} sd_prepare_state_t;
+
 
 // Function prototypes
 
 // Low-level SD card functions
 sd_error_t sd_card_init(void);
+void sd_card_prepare(void);
+sd_error_t sd_card_start(void);
 bool sd_card_present(void);
 void sd_init(void);
 bool sd_is_sdhc(void);
@@ -17,6 +17,8 @@
 // #define ENABLE_USER_INTERRUPT
 
 #include "serial.h"
+#include "idle.h"
+#include "governor.h"
 
 extern volatile bool user_interrupt;
 
@@ -26,6 +28,8 @@ static volatile uint8_t rx_buffer[UART_BUFFER_SIZE];
 static volatile uint16_t rx_head = 0;
 static volatile uint16_t rx_tail = 0;
 
+static uint serial_baudrate = 0;
+
 static void (*chars_available_callback)(void *) = NULL;
 static void *chars_available_param = NULL;
 
@@ -46,6 +50,7 @@ static void on_uart_rx()
         uint16_t next_head = (rx_head + 1) & (UART_BUFFER_SIZE - 1);
         rx_buffer[rx_head] = ch;
         rx_head = next_head;
+        idle_signal(); // wake anyone sleeping in serial_get_char
         serial_chars_available_notify();
     }
 }
@@ -58,7 +63,7 @@ bool serial_input_available()
 char serial_get_char()
 {
     while (!serial_input_available()) {
-        tight_loop_contents();
+        idle_wait(); // woken by the UART interrupt
     }
         
     uint8_t ch = rx_buffer[rx_tail];
@@ -126,10 +131,25 @@ stdio_driver_t serial_stdio_driver = {
     .next = NULL,
 };
 
+// Recompute the UART divider when the clock governor changes profile
+static void serial_clock_changed(governor_event_t event, uint32_t sys_hz)
+{
+    if (event == GOVERNOR_PRE_CHANGE)
+    {
+        uart_tx_wait_blocking(UART_PORT); // let the last character go out at the old rate
+    }
+    else
+    {
+        uart_set_baudrate(UART_PORT, serial_baudrate);
+    }
+}
+
 void serial_init(uint baudrate, uint databits, uint stopbits, uart_parity_t parity)
 {
     // Set up our UART
     uart_init(UART_PORT, baudrate);
+    serial_baudrate = baudrate;
+    governor_register(serial_clock_changed);
 
     // Set the TX and RX pins by using the function select on the GPIO
     // Set datasheet for more information on function select
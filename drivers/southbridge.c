@@ -14,6 +14,7 @@
 #include "hardware/i2c.h"
 
 #include "southbridge.h"
+#include "governor.h"
 
 static bool sb_initialised = false;
 volatile atomic_bool sb_i2c_in_use = false; // flag to indicate if I2C bus is in use
@@ -263,6 +264,17 @@ bool sb_reset(uint8_t delay_seconds)
     return true;
 }
 
+// Recompute the I2C divider when the clock governor changes profile
+static void sb_clock_changed(governor_event_t event, uint32_t sys_hz)
+{
+    // Transfers are blocking (keyboard polls run to completion in the timer
+    // interrupt), so there is nothing in flight before a change
+    if (event == GOVERNOR_POST_CHANGE)
+    {
+        i2c_set_baudrate(SB_I2C, SB_BAUDRATE);
+    }
+}
+
 // Initialize the southbridge
 void sb_init()
 {
@@ -277,6 +289,8 @@ void sb_init()
     gpio_pull_up(SB_SCL);
     gpio_pull_up(SB_SDA);
 
+    governor_register(sb_clock_changed);
+
     // Set the initialised flag
     sb_initialised = true;
 }
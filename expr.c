@@ -0,0 +1,394 @@
+#include "expr.h"
+#include "drivers/memstat.h"
+#include <ctype.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Expression compiler
+
+   A recursive descent parser that emits code as it goes. Each part of the expression it
+   has parsed is an operand: a constant, or a register holding a value for each x. When
+   both sides of an operation are constants the result is worked out there and then (by
+   running the same instruction on one value), so no code is emitted for it.
+
+   Registers are used as a stack: the value of a part always ends up in the lowest
+   register the part used, and the others are free again, so an operation on two
+   registers can write over the left one and free the right one, which is the top.
+*/
+
+enum {
+    OP_LOADK,                                   /* dst = k[a] */
+    OP_ADD, OP_SUB, OP_MUL, OP_DIV, OP_POW,     /* dst = a op b */
+    OP_ADDK, OP_MULK, OP_POWK,                  /* dst = a op k[b] */
+    OP_KSUB, OP_KDIV, OP_KPOW,                  /* dst = k[a] op b */
+    OP_NEG, OP_SQUARE,                          /* dst = op a */
+    OP_SIN, OP_COS, OP_TAN, OP_ASIN, OP_ACOS, OP_ATAN,
+    OP_SINH, OP_COSH, OP_TANH,
+    OP_SQRT, OP_EXP, OP_LN, OP_LOG10,
+    OP_ABS, OP_FLOOR, OP_CEIL,
+};
+
+static const struct {
+    const char *name;
+    uint8_t op;
+} functions[] = {
+    {"sin", OP_SIN}, {"cos", OP_COS}, {"tan", OP_TAN},
+    {"asin", OP_ASIN}, {"acos", OP_ACOS}, {"atan", OP_ATAN},
+    {"sinh", OP_SINH}, {"cosh", OP_COSH}, {"tanh", OP_TANH},
+    {"sqrt", OP_SQRT}, {"exp", OP_EXP}, {"ln", OP_LN}, {"log", OP_LOG10},
+    {"abs", OP_ABS}, {"floor", OP_FLOOR}, {"ceil", OP_CEIL},
+};
+
+/* A value while compiling: a constant, or a register (0 is x) */
+typedef struct {
+    bool constant;
+    float value;
+    uint8_t reg;
+} operand_t;
+
+typedef struct {
+    expr_program_t *program;
+    const char *text;
+    const char *pos;
+    uint8_t next_reg;  /* first free register */
+    uint8_t depth;     /* unary expressions being compiled, one inside the other */
+} compiler_t;
+
+/* Register values for one batch (register 0 is the x values themselves) */
+static float registers[EXPR_MAX_REGS][EXPR_BATCH];
+static bool memory_registered = false;
+
+/* Evaluation */
+
+/* Run one instruction over n values */
+static void _execute(const expr_instr_t *in, float *const *reg, const float *k, uint32_t n) {
+    float *d = reg[in->dst];
+    const float *a = reg[in->a];
+    const float *b = reg[in->b];
+
+#define EACH(expression) for (uint32_t i = 0; i < n; i++) d[i] = (expression); break
+
+    switch (in->op) {
+    case OP_LOADK: { float v = k[in->a]; EACH(v); }
+    case OP_ADD: EACH(a[i] + b[i]);
+    case OP_SUB: EACH(a[i] - b[i]);
+    case OP_MUL: EACH(a[i] * b[i]);
+    case OP_DIV: EACH(a[i] / b[i]);
+    case OP_POW: EACH(powf(a[i], b[i]));
+    case OP_ADDK: { float v = k[in->b]; EACH(a[i] + v); }
+    case OP_MULK: { float v = k[in->b]; EACH(a[i] * v); }
+    case OP_POWK: { float v = k[in->b]; EACH(powf(a[i], v)); }
+    case OP_KSUB: { float v = k[in->a]; EACH(v - b[i]); }
+    case OP_KDIV: { float v = k[in->a]; EACH(v / b[i]); }
+    case OP_KPOW: { float v = k[in->a]; EACH(powf(v, b[i])); }
+    case OP_NEG: EACH(-a[i]);
+    case OP_SQUARE: EACH(a[i] * a[i]);
+    case OP_SIN: EACH(sinf(a[i]));
+    case OP_COS: EACH(cosf(a[i]));
+    case OP_TAN: EACH(tanf(a[i]));
+    case OP_ASIN: EACH(asinf(a[i]));
+    case OP_ACOS: EACH(acosf(a[i]));
+    case OP_ATAN: EACH(atanf(a[i]));
+    case OP_SINH: EACH(sinhf(a[i]));
+    case OP_COSH: EACH(coshf(a[i]));
+    case OP_TANH: EACH(tanhf(a[i]));
+    case OP_SQRT: EACH(sqrtf(a[i]));
+    case OP_EXP: EACH(expf(a[i]));
+    case OP_LN: EACH(logf(a[i]));
+    case OP_LOG10: EACH(log10f(a[i]));
+    case OP_ABS: EACH(fabsf(a[i]));
+    case OP_FLOOR: EACH(floorf(a[i]));
+    case OP_CEIL: EACH(ceilf(a[i]));
+    }
+
+#undef EACH
+}
+
+void expr_eval(const expr_program_t *program, const float *x, float *y, uint32_t count) {
+    float *reg[EXPR_MAX_REGS];
+    for (int r = 1; r < EXPR_MAX_REGS; r++) {
+        reg[r] = registers[r];
+    }
+
+    for (uint32_t done = 0; done < count; done += EXPR_BATCH) {
+        uint32_t n = count - done < EXPR_BATCH ? count - done : EXPR_BATCH;
+
+        /* x is read where it is, and the result register is the output */
+        reg[0] = (float *)&x[done];
+        if (program->result == 0) {
+            memcpy(&y[done], &x[done], n * sizeof(float));
+            continue;
+        }
+        reg[program->result] = &y[done];
+
+        for (int i = 0; i < program->code_count; i++) {
+            _execute(&program->code[i], reg, program->consts, n);
+        }
+    }
+}
+
+/* Compiling */
+
+static void _fail(compiler_t *c, const char *error) {
+    if (!c->program->error) {
+        c->program->error = error;
+        c->program->error_pos = c->pos - c->text;
+    }
+}
+
+static void _skip_spaces(compiler_t *c) {
+    while (*c->pos == ' ' || *c->pos == '\t') c->pos++;
+}
+
+static bool _accept(compiler_t *c, char ch) {
+    _skip_spaces(c);
+    if (*c->pos != ch) return false;
+    c->pos++;
+    return true;
+}
+
+static operand_t _constant(float value) {
+    return (operand_t){.constant = true, .value = value};
+}
+
+static uint8_t _const_index(compiler_t *c, float value) {
+    expr_program_t *p = c->program;
+    for (int i = 0; i < p->const_count; i++) {
+        if (memcmp(&p->consts[i], &value, sizeof(float)) == 0) return i;
+    }
+    if (p->const_count == EXPR_MAX_CONSTS) {
+        _fail(c, "Too many numbers");
+        return 0;
+    }
+    p->consts[p->const_count] = value;
+    return p->const_count++;
+}
+
+static void _emit(compiler_t *c, uint8_t op, uint8_t dst, uint8_t a, uint8_t b) {
+    expr_program_t *p = c->program;
+    if (p->code_count == EXPR_MAX_CODE) {
+        _fail(c, "Expression too long");
+        return;
+    }
+    p->code[p->code_count++] = (expr_instr_t){op, dst, a, b};
+}
+
+/* Register for a result: the left operand's if it has one, then the right's, else a new one */
+static uint8_t _result_reg(compiler_t *c, operand_t a, operand_t b) {
+    if (!a.constant && a.reg != 0) return a.reg;
+    if (!b.constant && b.reg != 0) return b.reg;
+    if (c->next_reg == EXPR_MAX_REGS) {
+        _fail(c, "Expression too deep");
+        return 0;
+    }
+    return c->next_reg++;
+}
+
+/* Work out an operation on constants with the instruction the program would run */
+static float _fold(uint8_t op, float a, float b) {
+    float d, av = a, bv = b;
+    float *reg[3] = {&d, &av, &bv};
+    expr_instr_t in = {op, 0, 1, 2};
+    _execute(&in, reg, NULL, 1);
+    return d;
+}
+
+static operand_t _unary(compiler_t *c, uint8_t op, operand_t a) {
+    if (a.constant) return _constant(_fold(op, a.value, 0));
+
+    uint8_t dst = _result_reg(c, a, a);
+    _emit(c, op, dst, a.reg, 0);
+    return (operand_t){.reg = dst};
+}
+
+static operand_t _binary(compiler_t *c, uint8_t op, operand_t a, operand_t b) {
+    if (a.constant && b.constant) return _constant(_fold(op, a.value, b.value));
+
+    if (b.constant) {
+        /* Operations with a constant on the right: drop the ones that change nothing and
+           turn the rest into ADDK, MULK or cheaper forms of power */
+        float v = b.value;
+        if (((op == OP_ADD || op == OP_SUB) && v == 0) || ((op == OP_MUL || op == OP_DIV || op == OP_POW) && v == 1)) {
+            return a;
+        }
+        if (op == OP_POW && v == 2) return _unary(c, OP_SQUARE, a);
+        if (op == OP_POW && v == 0.5f) return _unary(c, OP_SQRT, a);
+        if (op == OP_SUB) {
+            op = OP_ADD;
+            v = -v;
+        } else if (op == OP_DIV) {
+            op = OP_MUL;
+            v = 1 / v;
+        }
+        uint8_t k = _const_index(c, v);
+        uint8_t dst = _result_reg(c, a, a);
+        _emit(c, op == OP_ADD ? OP_ADDK : op == OP_MUL ? OP_MULK : OP_POWK, dst, a.reg, k);
+        return (operand_t){.reg = dst};
+    }
+
+    if (a.constant) {
+        /* A constant on the left: ADD and MUL swap round, the others have their own forms */
+        uint8_t k = _const_index(c, a.value);
+        uint8_t dst = _result_reg(c, b, b);
+        switch (op) {
+        case OP_ADD: _emit(c, OP_ADDK, dst, b.reg, k); break;
+        case OP_MUL: _emit(c, OP_MULK, dst, b.reg, k); break;
+        case OP_SUB: _emit(c, OP_KSUB, dst, k, b.reg); break;
+        case OP_DIV: _emit(c, OP_KDIV, dst, k, b.reg); break;
+        default: _emit(c, OP_KPOW, dst, k, b.reg); break;
+        }
+        return (operand_t){.reg = dst};
+    }
+
+    uint8_t dst = _result_reg(c, a, b);
+    _emit(c, op, dst, a.reg, b.reg);
+    if (a.reg != 0 && b.reg != 0) {
+        c->next_reg--;  /* b is the top register */
+    }
+    return (operand_t){.reg = dst};
+}
+
+static operand_t _expression(compiler_t *c);
+static operand_t _unary_expression(compiler_t *c);
+
+/* A name or bracket can follow a value without an operator (2x, 3(x+1)), so this says
+   whether one starts here; two numbers in a row are an error rather than a product */
+static bool _primary_starts(compiler_t *c) {
+    _skip_spaces(c);
+    return isalpha((unsigned char)*c->pos) || *c->pos == '(';
+}
+
+static operand_t _primary(compiler_t *c) {
+    _skip_spaces(c);
+
+    if (_accept(c, '(')) {
+        operand_t value = _expression(c);
+        if (!_accept(c, ')')) _fail(c, "Expected )");
+        return value;
+    }
+
+    if (isdigit((unsigned char)*c->pos) || *c->pos == '.') {
+        char *end;
+        float value = strtof(c->pos, &end);
+        if (end == c->pos) {
+            _fail(c, "Bad number");
+            return _constant(0);
+        }
+        c->pos = end;
+        return _constant(value);
+    }
+
+    if (isalpha((unsigned char)*c->pos)) {
+        const char *start = c->pos;
+        while (isalnum((unsigned char)*c->pos)) c->pos++;
+        size_t length = c->pos - start;
+
+        if (length == 1 && *start == 'x') return (operand_t){.reg = 0};
+        if (length == 2 && strncmp(start, "pi", 2) == 0) return _constant((float)M_PI);
+        if (length == 1 && *start == 'e') return _constant((float)M_E);
+
+        for (size_t i = 0; i < sizeof(functions) / sizeof(functions[0]); i++) {
+            if (strlen(functions[i].name) == length && strncmp(start, functions[i].name, length) == 0) {
+                if (!_accept(c, '(')) {
+                    _fail(c, "Expected (");
+                    return _constant(0);
+                }
+                operand_t argument = _expression(c);
+                if (!_accept(c, ')')) _fail(c, "Expected )");
+                return _unary(c, functions[i].op, argument);
+            }
+        }
+        c->pos = start;
+        _fail(c, "Unknown name");
+        return _constant(0);
+    }
+
+    _fail(c, *c->pos ? "Expected a number, x or (" : "Unexpected end");
+    return _constant(0);
+}
+
+/* power: primary [^ unary], so 2^-x works and a^b^c is a^(b^c) */
+static operand_t _power(compiler_t *c) {
+    operand_t base = _primary(c);
+    if (_accept(c, '^')) {
+        operand_t exponent = _unary_expression(c);
+        return _binary(c, OP_POW, base, exponent);
+    }
+    return base;
+}
+
+/* unary: -unary | +unary | power, so -x^2 is -(x^2). Every bracket, sign and power nests
+   through here, so the depth is limited here to bound the recursion. */
+static operand_t _unary_expression(compiler_t *c) {
+    if (c->depth == EXPR_MAX_DEPTH) {
+        _fail(c, "Too deeply nested");
+        return _constant(0);
+    }
+    c->depth++;
+
+    operand_t value;
+    if (_accept(c, '-')) {
+        value = _unary(c, OP_NEG, _unary_expression(c));
+    } else if (_accept(c, '+')) {
+        value = _unary_expression(c);
+    } else {
+        value = _power(c);
+    }
+    c->depth--;
+    return value;
+}
+
+/* term: unary {(* | / | nothing) unary} */
+static operand_t _term(compiler_t *c) {
+    operand_t value = _unary_expression(c);
+    while (!c->program->error) {
+        if (_accept(c, '*')) {
+            value = _binary(c, OP_MUL, value, _unary_expression(c));
+        } else if (_accept(c, '/')) {
+            value = _binary(c, OP_DIV, value, _unary_expression(c));
+        } else if (_primary_starts(c)) {
+            value = _binary(c, OP_MUL, value, _power(c));
+        } else {
+            break;
+        }
+    }
+    return value;
+}
+
+/* expression: term {(+ | -) term} */
+static operand_t _expression(compiler_t *c) {
+    operand_t value = _term(c);
+    while (!c->program->error) {
+        if (_accept(c, '+')) {
+            value = _binary(c, OP_ADD, value, _term(c));
+        } else if (_accept(c, '-')) {
+            value = _binary(c, OP_SUB, value, _term(c));
+        } else {
+            break;
+        }
+    }
+    return value;
+}
+
+bool expr_compile(expr_program_t *program, const char *text) {
+    if (!memory_registered) {
+        mem_register_static("expr registers", sizeof(registers));
+        memory_registered = true;
+    }
+
+    memset(program, 0, sizeof(*program));
+    compiler_t c = {.program = program, .text = text, .pos = text, .next_reg = 1};
+
+    operand_t value = _expression(&c);
+    _skip_spaces(&c);
+    if (*c.pos) _fail(&c, "Unexpected character");
+
+    /* A constant result is loaded into a register, so the result is always a register */
+    if (!program->error && value.constant) {
+        _emit(&c, OP_LOADK, 1, _const_index(&c, value.value), 0);
+        value = (operand_t){.reg = 1};
+    }
+    program->result = value.reg;
+    return program->error == NULL;
+}
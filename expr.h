@@ -0,0 +1,47 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+  Expressions of x, compiled once and evaluated for many values of x (used by plot)
+  - Numbers, x, pi, e, + - * / ^ (power, right to left), unary minus, brackets and
+    functions of one value: sin cos tan asin acos atan sinh cosh tanh sqrt exp ln log abs
+    floor ceil. A value followed directly by a name or bracket multiplies (2x, 3sin(x),
+    (x+1)(x-1)).
+  - Compiled to a register bytecode: each instruction takes registers or a constant, and
+    register 0 holds x. Parts that do not depend on x are worked out while compiling, and
+    x^2 becomes a multiply.
+  - Evaluated EXPR_BATCH values at a time: each instruction runs over the whole batch
+    before the next, so decoding an instruction costs once per batch, not once per value
+  - Single precision, as the FPU; results can be NaN or infinite (sqrt(-1), 1/0)
+*/
+
+#define EXPR_MAX_CODE   64  /* instructions in a program */
+#define EXPR_MAX_CONSTS 32  /* constants in a program */
+#define EXPR_MAX_REGS   8   /* registers, including x; intermediate results held at once */
+#define EXPR_MAX_DEPTH  16  /* brackets, signs and powers nested inside each other */
+#define EXPR_BATCH      32  /* values evaluated together */
+
+typedef struct {
+    uint8_t op;
+    uint8_t dst;   /* register written */
+    uint8_t a, b;  /* registers read, or index of a constant for the forms that take one */
+} expr_instr_t;
+
+typedef struct {
+    expr_instr_t code[EXPR_MAX_CODE];
+    float consts[EXPR_MAX_CONSTS];
+    uint8_t code_count;
+    uint8_t const_count;
+    uint8_t result;      /* register holding the value after the last instruction */
+    const char *error;   /* why compiling failed, NULL if it did not */
+    uint16_t error_pos;  /* offset in the text where it failed */
+} expr_program_t;
+
+/* Compile text into a program. Returns false with error and error_pos set if the text is
+   not a valid expression or is too long or deep for the limits above. */
+bool expr_compile(expr_program_t *program, const char *text);
+
+/* Evaluate a compiled program for count values of x, writing them to y */
+void expr_eval(const expr_program_t *program, const float *x, float *y, uint32_t count);
@@ -1,5 +1,9 @@
 #include "gfx.h"
+#include "gfx_particles.h"
+#include "gfx_affine.h"
 #include "drivers/lcd.h"
+#include "drivers/memstat.h"
+#include "drivers/scratch.h"
 #include <string.h>
 #include <stdlib.h>
 #include "pico/time.h"
@@ -7,12 +11,13 @@
 /* Graphics system with single persistent framebuffer
    - tilesheet_ptr: pointer to tile images (16x16 pixels each, RGB565)
    - tiles_count: number of tiles in tilesheet
-   - framebuffer: single persistent buffer holding the complete screen image (WIDTH x HEIGHT pixels)
+   - framebuffer: single persistent buffer holding the complete screen image (WIDTH x HEIGHT pixels),
+     leased from the scratch memory by gfx_init() and returned by gfx_release()
    - tilemap: tracks which tiles are where
    - Sprites are composited directly into framebuffer
 
    Key principle: framebuffer is created once and reused.
-   - On init: framebuffer is created and filled with tiles
+   - On init: framebuffer is leased and filled with tiles
    - On sprite move: erase old sprite position (redraw tiles), draw new sprite position, send to display
    - On tile change: redraw affected tiles into framebuffer
    - Full redraw only when explicitly requested
@@ -23,9 +28,11 @@
 static const uint16_t background = GFX_BACKGROUND_COLOR;
 static const uint16_t *tilesheet = NULL;
 static uint16_t tiles_count = 0;
+static const uint8_t *tile_flags = NULL;  /* optional GFX_TILE_* flags per tile */
 
-/* Single persistent framebuffer - holds complete screen image */
-static uint16_t framebuffer[WIDTH * HEIGHT] __attribute__((aligned(4)));
+/* Single persistent framebuffer - holds complete screen image (leased from scratch memory) */
+#define GFX_FRAMEBUFFER_SIZE (WIDTH * HEIGHT * sizeof(uint16_t))
+static uint16_t *framebuffer = NULL;
 
 /* Tilemap - tracks current tile layout */
 static uint16_t tilemap[GFX_TILEMAP_SIZE];
@@ -41,6 +48,15 @@ static bool vblank_sync_enabled = true;
 /* Sprite storage */
 static gfx_sprite_info_t sprites[GFX_MAX_SPRITES];
 
+/* Raster effects: per-row table (NULL for none), tints pre-halved for blending, and the
+   row buffer each effect row is built in before it is sent */
+static const gfx_raster_line_t *raster_table = NULL;
+static uint16_t raster_tints[GFX_RASTER_TINTS];
+static uint16_t raster_rows[WIDTH];
+
+/* Tiles the particles were drawn on last frame (one bit per tile), redrawn before the next */
+static uint32_t particle_tiles[(GFX_TILEMAP_SIZE + 31) / 32];
+
 /* Helper: index in tilemap from tx,ty */
 static inline uint32_t _tile_index(uint16_t tx, uint16_t ty) {
     return (uint32_t)ty * GFX_TILES_X + tx;
@@ -58,52 +74,63 @@ static inline int16_t _clamp_i16(int16_t v, int16_t a, int16_t b) {
     return v;
 }
 
-/* Draw a tile into the framebuffer at pixel position (screen_x, screen_y) */
-static void _draw_tile_to_framebuffer(uint16_t tile_index, uint16_t screen_x, uint16_t screen_y) {
-    /* Draw tile pixels into framebuffer */
-    if (tile_index == UINT16_MAX) {
-        /* Blank tile - fill with background color */
-        for (uint16_t y = 0; y < GFX_TILE_H; y++) {
-            for (uint16_t x = 0; x < GFX_TILE_W; x++) {
-                uint16_t fx = screen_x + x;
-                uint16_t fy = screen_y + y;
-                if (fx < WIDTH && fy < HEIGHT) {
-                    framebuffer[_fb_index(fx, fy)] = background;
-                }
-            }
+/* Fill a tile-sized area of the framebuffer with one colour */
+static void _fill_tile_in_framebuffer(uint16_t colour, uint16_t screen_x, uint16_t screen_y) {
+    uint16_t w = (screen_x + GFX_TILE_W <= WIDTH) ? GFX_TILE_W : WIDTH - screen_x;
+    uint16_t h = (screen_y + GFX_TILE_H <= HEIGHT) ? GFX_TILE_H : HEIGHT - screen_y;
+
+    for (uint16_t y = 0; y < h; y++) {
+        uint16_t *dst = &framebuffer[_fb_index(screen_x, screen_y + y)];
+        for (uint16_t x = 0; x < w; x++) {
+            dst[x] = colour;
         }
-        return;
     }
+}
 
-    if (!tilesheet || tile_index >= tiles_count) {
-        /* Invalid tile - fill with background */
-        for (uint16_t y = 0; y < GFX_TILE_H; y++) {
-            for (uint16_t x = 0; x < GFX_TILE_W; x++) {
-                uint16_t fx = screen_x + x;
-                uint16_t fy = screen_y + y;
-                if (fx < WIDTH && fy < HEIGHT) {
-                    framebuffer[_fb_index(fx, fy)] = background;
-                }
-            }
-        }
+/* Draw a tile into the framebuffer at pixel position (screen_x, screen_y) */
+static void _draw_tile_to_framebuffer(uint16_t tile_value, uint16_t screen_x, uint16_t screen_y) {
+    if (screen_x >= WIDTH || screen_y >= HEIGHT) return;
+
+    uint16_t tile_index = tile_value & GFX_TILE_INDEX_MASK;
+    if (tile_value == UINT16_MAX || !tilesheet || tile_index >= tiles_count) {
+        /* Blank or invalid tile - fill with background color */
+        _fill_tile_in_framebuffer(background, screen_x, screen_y);
         return;
     }
 
-    /* Copy tile pixels to framebuffer */
     const uint16_t *tile_pixels = tilesheet + (size_t)tile_index * (GFX_TILE_W * GFX_TILE_H);
-    for (uint16_t y = 0; y < GFX_TILE_H; y++) {
-        for (uint16_t x = 0; x < GFX_TILE_W; x++) {
-            uint16_t fx = screen_x + x;
-            uint16_t fy = screen_y + y;
-            if (fx < WIDTH && fy < HEIGHT) {
-                framebuffer[_fb_index(fx, fy)] = tile_pixels[y * GFX_TILE_W + x];
+    uint8_t flags = tile_flags ? tile_flags[tile_index] : 0;
+    if (flags & GFX_TILE_TRANSPARENT) {
+        _fill_tile_in_framebuffer(background, screen_x, screen_y);
+        return;
+    }
+    if (flags & GFX_TILE_UNIFORM) {
+        /* Mirroring a single colour changes nothing */
+        _fill_tile_in_framebuffer(tile_pixels[0], screen_x, screen_y);
+        return;
+    }
+
+    /* Copy tile pixels to framebuffer, mirrored if asked */
+    uint16_t w = (screen_x + GFX_TILE_W <= WIDTH) ? GFX_TILE_W : WIDTH - screen_x;
+    uint16_t h = (screen_y + GFX_TILE_H <= HEIGHT) ? GFX_TILE_H : HEIGHT - screen_y;
+    bool flip_x = tile_value & GFX_TILE_FLIP_X;
+    bool flip_y = tile_value & GFX_TILE_FLIP_Y;
+
+    for (uint16_t y = 0; y < h; y++) {
+        const uint16_t *src = tile_pixels + (flip_y ? GFX_TILE_H - 1 - y : y) * GFX_TILE_W;
+        uint16_t *dst = &framebuffer[_fb_index(screen_x, screen_y + y)];
+        if (flip_x) {
+            for (uint16_t x = 0; x < w; x++) {
+                dst[x] = src[GFX_TILE_W - 1 - x];
             }
+        } else {
+            memcpy(dst, src, w * sizeof(uint16_t));
         }
     }
 }
 
 /* Erase sprite from framebuffer by redrawing tiles underneath */
-static void _erase_sprite_from_framebuffer(int16_t x, int16_t y, uint8_t w, uint8_t h) {
+static void _erase_sprite_from_framebuffer(int16_t x, int16_t y, uint16_t w, uint16_t h) {
     if (w == 0 || h == 0) return;
 
     /* Calculate which tiles are affected */
@@ -130,32 +157,132 @@ static void _erase_sprite_from_framebuffer(int16_t x, int16_t y, uint8_t w, uint
     }
 }
 
+/* A sprite can be drawn if it has RGB565 pixels, or 4-bpp pixels and a palette */
+static inline bool _sprite_has_image(const gfx_sprite_info_t *s) {
+    return s->indexed ? s->palette != NULL : s->image != NULL;
+}
+
+/* Draw columns x0..x1-1 of rows y0..y1-1 of a 4-bpp sprite, two pixels per byte */
+static void _draw_sprite_4bpp(const gfx_sprite_info_t *s, int x0, int y0, int x1, int y1) {
+    /* Copy the palette so that every lookup is a RAM read, even if the palette lives in flash */
+    uint16_t palette[16];
+    memcpy(palette, s->palette, sizeof(palette));
+    uint32_t stride = (s->w + 1) / 2;
+
+    for (int yy = y0; yy < y1; yy++) {
+        const uint8_t *src = s->indexed + (uint32_t)yy * stride;
+        uint16_t *dst = &framebuffer[_fb_index(s->x + x0, s->y + yy)];
+        int xx = x0;
+
+        /* Clipped on an odd column: start with a low nibble */
+        if (xx & 1) {
+            uint8_t index = src[xx >> 1] & 0x0F;
+            if (index) *dst = palette[index];
+            dst++;
+            xx++;
+        }
+
+        for (; xx + 1 < x1; xx += 2, dst += 2) {
+            uint8_t pair = src[xx >> 1];
+            if (pair == 0) continue;  /* both transparent */
+            if (pair >> 4) dst[0] = palette[pair >> 4];
+            if (pair & 0x0F) dst[1] = palette[pair & 0x0F];
+        }
+
+        /* Odd width or clipped on an even column: end with a high nibble */
+        if (xx < x1) {
+            uint8_t index = src[xx >> 1] >> 4;
+            if (index) *dst = palette[index];
+        }
+    }
+}
+
 /* Draw sprite into framebuffer with transparency */
 static void _draw_sprite_to_framebuffer(const gfx_sprite_info_t *s) {
-    if (!s->active || !s->image || s->w == 0 || s->h == 0) return;
+    if (!s->active || !_sprite_has_image(s) || s->w == 0 || s->h == 0) return;
 
-    /* Draw sprite pixels into framebuffer */
-    for (uint16_t yy = 0; yy < s->h; yy++) {
-        for (uint16_t xx = 0; xx < s->w; xx++) {
-            int scr_x = s->x + xx;
-            int scr_y = s->y + yy;
-
-            /* Clip to screen bounds */
-            if (scr_x < 0 || scr_y < 0 || scr_x >= (int)WIDTH || scr_y >= (int)HEIGHT) {
-                continue;
-            }
+    /* Clip to screen bounds: only columns x0..x1-1 and rows y0..y1-1 of the sprite are visible */
+    int x0 = s->x < 0 ? -s->x : 0;
+    int y0 = s->y < 0 ? -s->y : 0;
+    int x1 = (s->x + s->w > (int)WIDTH) ? (int)WIDTH - s->x : s->w;
+    int y1 = (s->y + s->h > (int)HEIGHT) ? (int)HEIGHT - s->y : s->h;
+    if (x0 >= x1 || y0 >= y1) return;
 
-            uint32_t sprite_idx = (uint32_t)yy * s->w + xx;
-            uint16_t pixel = s->image[sprite_idx];
+    if (s->indexed) {
+        _draw_sprite_4bpp(s, x0, y0, x1, y1);
+        return;
+    }
+
+    /* Draw sprite pixels into framebuffer */
+    for (int yy = y0; yy < y1; yy++) {
+        const uint16_t *src = s->image + (uint32_t)yy * s->w;
+        uint16_t *dst = &framebuffer[_fb_index(s->x + x0, s->y + yy)];
+        for (int xx = x0; xx < x1; xx++, dst++) {
+            uint16_t pixel = src[xx];
 
             /* Only draw non-transparent pixels */
             if (pixel != GFX_TRANSPARENT_COLOR) {
-                framebuffer[_fb_index(scr_x, scr_y)] = pixel;
+                *dst = pixel;
             }
         }
     }
 }
 
+/* Copy a framebuffer row with its raster effect applied: shifted, wrapping around, and
+   blended half way to the tint colour if it has one */
+static void _apply_raster_row(uint16_t *dst, const uint16_t *src, const gfx_raster_line_t *line) {
+    int shift = line->offset % (int)WIDTH;
+    if (shift < 0) shift += WIDTH;
+
+    /* src[0..WIDTH-shift) goes to dst[shift..WIDTH), the rest wraps to the start */
+    const uint16_t *from[2] = {src + WIDTH - shift, src};
+    uint16_t *to[2] = {dst, dst + shift};
+    int count[2] = {shift, WIDTH - shift};
+
+    uint8_t tint = line->tint < GFX_RASTER_TINTS ? line->tint : 0;
+    if (tint == 0) {
+        memcpy(to[0], from[0], count[0] * sizeof(uint16_t));
+        memcpy(to[1], from[1], count[1] * sizeof(uint16_t));
+        return;
+    }
+
+    /* Halve each channel (dropping its low bit) and add the halved tint colour */
+    uint16_t half = raster_tints[tint];
+    for (int part = 0; part < 2; part++) {
+        for (int i = 0; i < count[part]; i++) {
+            to[part][i] = ((from[part][i] & 0xF7DE) >> 1) + half;
+        }
+    }
+}
+
+static inline bool _has_raster_effect(const gfx_raster_line_t *line) {
+    return line->offset != 0 || line->tint != 0;
+}
+
+/* Send the framebuffer to the LCD. Rows without a raster effect go straight from the
+   framebuffer, as many at a time as possible; rows with one go through a row buffer. */
+static void _scan_out(void) {
+    if (!raster_table) {
+        lcd_blit(framebuffer, 0, 0, WIDTH, HEIGHT);
+        return;
+    }
+
+    uint16_t y = 0;
+    while (y < HEIGHT) {
+        uint16_t start = y;
+        while (y < HEIGHT && !_has_raster_effect(&raster_table[y])) y++;
+        if (y > start) {
+            lcd_blit(&framebuffer[_fb_index(0, start)], 0, start, WIDTH, y - start);
+        }
+
+        /* Each effect row is built and then sent; lcd_blit returns once the row is on the LCD */
+        for (; y < HEIGHT && _has_raster_effect(&raster_table[y]); y++) {
+            _apply_raster_row(raster_rows, &framebuffer[_fb_index(0, y)], &raster_table[y]);
+            lcd_blit(raster_rows, 0, y, WIDTH, 1);
+        }
+    }
+}
+
 /* Rebuild entire framebuffer from tiles */
 static void _rebuild_framebuffer(void) {
     /* Draw all tiles into framebuffer */
@@ -173,12 +300,18 @@ static void _rebuild_framebuffer(void) {
 }
 
 /* Initialize gfx */
-void gfx_init(const uint16_t *tilesheet_ptr, uint16_t tcount) {
+bool gfx_init(const uint16_t *tilesheet_ptr, uint16_t tcount) {
     tilesheet = tilesheet_ptr;
     tiles_count = tcount;
 
+    /* Lease the framebuffer; fails if a text-mode app is holding scratch memory */
+    if (!framebuffer) {
+        framebuffer = scratch_lease(0, GFX_FRAMEBUFFER_SIZE, "gfx framebuffer");
+        if (!framebuffer) return false;
+    }
+
     /* Clear framebuffer - essential to remove any previous LCD content */
-    memset(framebuffer, 0, sizeof(framebuffer));
+    memset(framebuffer, 0, GFX_FRAMEBUFFER_SIZE);
 
     /* Init tilemap to "blank" sentinel (UINT16_MAX) */
     for (uint32_t i = 0; i < GFX_TILEMAP_SIZE; i++) {
@@ -189,14 +322,37 @@ void gfx_init(const uint16_t *tilesheet_ptr, uint16_t tcount) {
     for (int i = 0; i < GFX_MAX_SPRITES; i++) {
         sprites[i].active = false;
         sprites[i].image = NULL;
+        sprites[i].indexed = NULL;
         sprites[i].has_prev = false;
     }
 
+    /* Clear particles, raster effects and the affine plane */
+    gfx_particles_clear();
+    raster_table = NULL;
+    gfx_affine_set_map(NULL, 0, 0);
+    memset(particle_tiles, 0, sizeof(particle_tiles));
+
     /* Initialize vblank timer */
     next_vblank_time = make_timeout_time_us(VBLANK_PERIOD_US);
 
     /* Mark framebuffer as needing rebuild */
     framebuffer_dirty = true;
+    return true;
+}
+
+/* Return the framebuffer to the scratch memory */
+void gfx_release(void) {
+    if (framebuffer) {
+        scratch_release(framebuffer);
+        framebuffer = NULL;
+    }
+    for (int i = 0; i < GFX_MAX_SPRITES; i++) {
+        sprites[i].active = false;
+        sprites[i].has_prev = false;
+    }
+    gfx_particles_clear();
+    raster_table = NULL;
+    gfx_affine_set_map(NULL, 0, 0);
 }
 
 /* Set / replace tilesheet pointer */
@@ -206,6 +362,12 @@ void gfx_set_tilesheet(const uint16_t *tilesheet_ptr, uint16_t tcount) {
     framebuffer_dirty = true;
 }
 
+/* Set / clear the per-tile flags */
+void gfx_set_tile_flags(const uint8_t *flags) {
+    tile_flags = flags;
+    framebuffer_dirty = true;
+}
+
 /* Set tile at tilemap coordinates */
 void gfx_set_tile(uint16_t tx, uint16_t ty, uint16_t tile_index) {
     if (tx >= GFX_TILES_X || ty >= GFX_TILES_Y) return;
@@ -215,7 +377,7 @@ void gfx_set_tile(uint16_t tx, uint16_t ty, uint16_t tile_index) {
         tilemap[idx] = tile_index;
 
         /* Redraw this tile into framebuffer immediately if framebuffer is valid */
-        if (!framebuffer_dirty) {
+        if (framebuffer && !framebuffer_dirty) {
             uint16_t sx = tx * GFX_TILE_W;
             uint16_t sy = ty * GFX_TILE_H;
             _draw_tile_to_framebuffer(tile_index, sx, sy);
@@ -244,7 +406,7 @@ void gfx_mark_all_dirty(void) {
 
 /* Force draw single tile (updates framebuffer and sends to display) */
 void gfx_force_draw_tile(uint16_t tx, uint16_t ty) {
-    if (tx >= GFX_TILES_X || ty >= GFX_TILES_Y) return;
+    if (!framebuffer || tx >= GFX_TILES_X || ty >= GFX_TILES_Y) return;
 
     uint16_t tile_index = tilemap[_tile_index(tx, ty)];
     uint16_t screen_x = tx * GFX_TILE_W;
@@ -266,23 +428,47 @@ void gfx_present(void) {
     }
     */
 
-    /* Rebuild framebuffer if needed (full redraw) */
-    if (framebuffer_dirty) {
-        _rebuild_framebuffer();
-    }
+    if (!framebuffer) return;
+
+    if (gfx_affine_enabled()) {
+        /* The plane is drawn whole every frame, which also erases the sprites and particles */
+        gfx_affine_render(framebuffer, 0, HEIGHT, tilesheet, tiles_count);
+        memset(particle_tiles, 0, sizeof(particle_tiles));
+        framebuffer_dirty = true;  /* the tiles come back when the plane is turned off */
+    } else {
+        /* Rebuild framebuffer if needed (full redraw) */
+        if (framebuffer_dirty) {
+            _rebuild_framebuffer();
+        }
 
-    /* Erase previous sprite positions by redrawing tiles */
-    for (int i = 0; i < GFX_MAX_SPRITES; i++) {
-        if (sprites[i].active && sprites[i].has_prev) {
-            _erase_sprite_from_framebuffer(sprites[i].prev_x, sprites[i].prev_y, sprites[i].w, sprites[i].h);
+        /* Erase previous sprite positions by redrawing tiles */
+        for (int i = 0; i < GFX_MAX_SPRITES; i++) {
+            if (sprites[i].active && sprites[i].has_prev) {
+                _erase_sprite_from_framebuffer(sprites[i].prev_x, sprites[i].prev_y, sprites[i].prev_w, sprites[i].prev_h);
+            }
+        }
+
+        /* Erase the particles by redrawing the tiles they were drawn on */
+        for (uint32_t w = 0; w < sizeof(particle_tiles) / sizeof(particle_tiles[0]); w++) {
+            uint32_t bits = particle_tiles[w];
+            while (bits) {
+                uint32_t idx = w * 32 + __builtin_ctz(bits);
+                bits &= bits - 1;
+                _draw_tile_to_framebuffer(tilemap[idx], (idx % GFX_TILES_X) * GFX_TILE_W, (idx / GFX_TILES_X) * GFX_TILE_H);
+            }
+            particle_tiles[w] = 0;
         }
     }
 
+    /* Move the particles and draw them under the sprites */
+    gfx_particles_update();
+    gfx_particles_draw(framebuffer, particle_tiles);
+
     /* Sort sprites by z-order */
     int active_ids[GFX_MAX_SPRITES];
     int active_count = 0;
     for (int i = 0; i < GFX_MAX_SPRITES; i++) {
-        if (sprites[i].active && sprites[i].image && sprites[i].w > 0 && sprites[i].h > 0) {
+        if (sprites[i].active && _sprite_has_image(&sprites[i]) && sprites[i].w > 0 && sprites[i].h > 0) {
             active_ids[active_count++] = i;
         }
     }
@@ -303,22 +489,37 @@ void gfx_present(void) {
         int si = active_ids[idx_i];
         gfx_sprite_info_t *s = &sprites[si];
 
-        /* Skip if entirely off-screen */
-        if (s->x + s->w <= 0 || s->y + s->h <= 0 || s->x >= (int)WIDTH || s->y >= (int)HEIGHT) {
+        /* Skip if entirely off-screen (a transformed sprite covers its rotated bounds) */
+        int16_t bx, by;
+        uint16_t bw, bh;
+        gfx_affine_sprite_bounds(s, &bx, &by, &bw, &bh);
+        if (bx + bw <= 0 || by + bh <= 0 || bx >= (int)WIDTH || by >= (int)HEIGHT) {
             continue;
         }
 
         /* Draw sprite to framebuffer */
-        _draw_sprite_to_framebuffer(s);
+        if (s->transformed) {
+            gfx_affine_draw_sprite(framebuffer, s);
+        } else {
+            _draw_sprite_to_framebuffer(s);
+        }
 
-        /* Save position for next frame */
-        s->prev_x = s->x;
-        s->prev_y = s->y;
+        /* Save the area drawn on for next frame */
+        s->prev_x = bx;
+        s->prev_y = by;
+        s->prev_w = bw;
+        s->prev_h = bh;
         s->has_prev = true;
     }
 
-    /* Send entire framebuffer to display */
-    lcd_blit(framebuffer, 0, 0, WIDTH, HEIGHT);
+    /* Send entire framebuffer to display, applying the raster effects */
+    _scan_out();
+}
+
+/* A new image can have a different size and transparent border */
+static void _sprite_image_changed(gfx_sprite_info_t *s) {
+    gfx_affine_sprite_opaque(s);
+    if (s->transformed) gfx_affine_sprite_transform(s);
 }
 
 /* Sprite API implementations */
@@ -327,12 +528,16 @@ gfx_sprite_t gfx_create_sprite(const uint16_t *image, uint8_t w, uint8_t h, int1
         if (!sprites[i].active) {
             sprites[i].active = true;
             sprites[i].image = image;
+            sprites[i].indexed = NULL;
+            sprites[i].palette = NULL;
             sprites[i].w = w;
             sprites[i].h = h;
             sprites[i].x = x;
             sprites[i].y = y;
             sprites[i].z = z;
+            sprites[i].transformed = false;
             sprites[i].has_prev = false;
+            gfx_affine_sprite_opaque(&sprites[i]);
             return i;
         }
     }
@@ -343,12 +548,13 @@ bool gfx_destroy_sprite(gfx_sprite_t id) {
     if (id < 0 || id >= GFX_MAX_SPRITES) return false;
 
     /* Erase sprite from framebuffer before destroying */
-    if (sprites[id].active && sprites[id].has_prev) {
-        _erase_sprite_from_framebuffer(sprites[id].prev_x, sprites[id].prev_y, sprites[id].w, sprites[id].h);
+    if (framebuffer && sprites[id].active && sprites[id].has_prev) {
+        _erase_sprite_from_framebuffer(sprites[id].prev_x, sprites[id].prev_y, sprites[id].prev_w, sprites[id].prev_h);
     }
 
     sprites[id].active = false;
     sprites[id].image = NULL;
+    sprites[id].indexed = NULL;
     sprites[id].has_prev = false;
     return true;
 }
@@ -372,11 +578,66 @@ bool gfx_set_sprite_image(gfx_sprite_t id, const uint16_t *image, uint8_t w, uin
     if (id < 0 || id >= GFX_MAX_SPRITES) return false;
     if (!sprites[id].active) return false;
     sprites[id].image = image;
+    sprites[id].indexed = NULL;
     sprites[id].w = w;
     sprites[id].h = h;
+    _sprite_image_changed(&sprites[id]);
     return true;
 }
 
+gfx_sprite_t gfx_create_sprite_4bpp(const uint8_t *pixels, const uint16_t *palette, uint8_t w, uint8_t h, int16_t x, int16_t y, uint8_t z) {
+    gfx_sprite_t id = gfx_create_sprite(NULL, w, h, x, y, z);
+    if (id >= 0) {
+        sprites[id].indexed = pixels;
+        sprites[id].palette = palette;
+        gfx_affine_sprite_opaque(&sprites[id]);
+    }
+    return id;
+}
+
+bool gfx_set_sprite_image_4bpp(gfx_sprite_t id, const uint8_t *pixels, uint8_t w, uint8_t h) {
+    if (id < 0 || id >= GFX_MAX_SPRITES) return false;
+    if (!sprites[id].active) return false;
+    sprites[id].image = NULL;
+    sprites[id].indexed = pixels;
+    sprites[id].w = w;
+    sprites[id].h = h;
+    _sprite_image_changed(&sprites[id]);
+    return true;
+}
+
+bool gfx_set_sprite_palette(gfx_sprite_t id, const uint16_t *palette) {
+    if (id < 0 || id >= GFX_MAX_SPRITES) return false;
+    if (!sprites[id].active) return false;
+    sprites[id].palette = palette;
+    return true;
+}
+
+bool gfx_set_sprite_transform(gfx_sprite_t id, float angle, float scale) {
+    if (id < 0 || id >= GFX_MAX_SPRITES) return false;
+    if (!sprites[id].active || !(scale > 0)) return false;
+
+    if (scale < GFX_SPRITE_MIN_SCALE) scale = GFX_SPRITE_MIN_SCALE;
+    if (scale > GFX_SPRITE_MAX_SCALE) scale = GFX_SPRITE_MAX_SCALE;
+    sprites[id].angle = angle;
+    sprites[id].scale = scale;
+    sprites[id].transformed = angle != 0 || scale != 1;
+    if (sprites[id].transformed) {
+        gfx_affine_sprite_transform(&sprites[id]);
+    }
+    return true;
+}
+
+/* Raster effects */
+void gfx_set_raster_table(const gfx_raster_line_t *table) {
+    raster_table = table;
+}
+
+void gfx_set_raster_tint(uint8_t index, uint16_t colour) {
+    if (index == 0 || index >= GFX_RASTER_TINTS) return;
+    raster_tints[index] = (colour & 0xF7DE) >> 1;
+}
+
 /* Fill rectangle in tile units */
 void gfx_fill_tiles_rect(uint16_t tx, uint16_t ty, uint16_t tw, uint16_t th, uint16_t tile_index) {
     for (uint16_t yy = ty; yy < ty + th && yy < GFX_TILES_Y; yy++) {
@@ -397,3 +658,9 @@ void gfx_set_vblank_sync(bool enabled) {
 bool gfx_get_vblank_sync(void) {
     return vblank_sync_enabled;
 }
+
+/* Register the static buffers with the memory statistics module */
+void gfx_register_memory(void) {
+    mem_register_static("gfx tilemap+sprites", sizeof(tilemap) + sizeof(sprites) + sizeof(particle_tiles) +
+                        sizeof(raster_tints) + sizeof(raster_rows));
+}
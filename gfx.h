@@ -9,7 +9,10 @@
   - Tileset: tiles are 16x16 pixels, RGB565 (uint16_t per pixel)
   - Screen: WIDTH x HEIGHT (from lcd.h), assumed divisible by 16
   - Double buffering at tilemap level: two tile-index maps are kept and compared on present()
-  - Sprites: arbitrary w x h (<=16x16 recommended), use a transparent colour value
+  - Sprites: arbitrary w x h (<=16x16 recommended), either RGB565 with a transparent colour value
+    or 4 bits per pixel with a 16-colour palette per sprite (index 0 is transparent)
+  - Sprites can be rotated and scaled, and the tilemap replaced by a rotated and scaled tile
+    plane (see gfx_affine.h)
 */
 
 /* Tile dimensions */
@@ -21,11 +24,25 @@
 #define GFX_TILES_Y (HEIGHT / GFX_TILE_H)
 #define GFX_TILEMAP_SIZE (GFX_TILES_X * GFX_TILES_Y)
 
+/* Tile values: a tilesheet index plus optional mirroring (as written by the deduplicating
+   tileset converter's remap table). UINT16_MAX is the blank tile. */
+#define GFX_TILE_INDEX_MASK 0x3FFF
+#define GFX_TILE_FLIP_X     0x8000  /* mirror left-right */
+#define GFX_TILE_FLIP_Y     0x4000  /* mirror top-bottom */
+
+/* Per-tile flags (tileset converter's _tile_flags array) for drawing fast paths */
+#define GFX_TILE_OPAQUE      0x01   /* no transparent pixels */
+#define GFX_TILE_TRANSPARENT 0x02   /* only transparent pixels: drawn as background */
+#define GFX_TILE_UNIFORM     0x04   /* every pixel the same colour: drawn as a fill */
+
 /* Transparent colour (RGB565) used in sprite images */
 #ifndef GFX_TRANSPARENT_COLOR
 #define GFX_TRANSPARENT_COLOR 0xFFFF  /* default: white as transparent (can be overridden) */
 #endif
 
+/* Bytes of 4-bpp sprite data for a w x h image (each row padded to a whole byte) */
+#define GFX_SPRITE_4BPP_SIZE(w, h) ((((w) + 1) / 2) * (h))
+
 /* Max number of tiles in the tilesheet (user can change before compilation) */
 #ifndef GFX_MAX_TILES
 #define GFX_MAX_TILES 256
@@ -36,6 +53,22 @@
 #define GFX_MAX_SPRITES 16
 #endif
 
+/* Range of sprite scales */
+#define GFX_SPRITE_MIN_SCALE (1.0f / 16)
+#define GFX_SPRITE_MAX_SCALE 8.0f
+
+/* Raster effects: tints a row can use (index 0 is no tint) */
+#ifndef GFX_RASTER_TINTS
+#define GFX_RASTER_TINTS 8
+#endif
+
+/* Raster effect for one screen row, applied as the row is sent to the LCD */
+typedef struct {
+    int16_t offset;  /* horizontal shift in pixels, wrapping around (positive moves right) */
+    uint8_t tint;    /* tint index (0 = none): the row is blended half way to the tint colour */
+    uint8_t reserved;
+} gfx_raster_line_t;
+
 /* Sprite handle type */
 typedef int gfx_sprite_t; /* -1 == invalid */
 
@@ -47,23 +80,44 @@ typedef struct {
     uint8_t w;    /* width in pixels */
     uint8_t h;    /* height in pixels */
     const uint16_t *image; /* pointer to w*h RGB565 pixel data; use GFX_TRANSPARENT_COLOR for transparent pixels */
+    const uint8_t *indexed; /* or 4-bpp pixel data: two pixels per byte, left pixel in the high nibble */
+    const uint16_t *palette; /* 16 RGB565 colours for indexed pixels; index 0 is transparent */
     uint8_t z;    /* z-order (draw order) - lower drawn first */
-    /* Previous position for erasing old sprite position */
+    /* Rotation and scaling about the centre of the sprite (gfx_set_sprite_transform) */
+    bool transformed;
+    float angle;  /* radians, clockwise */
+    float scale;
+    int32_t inverse[4];      /* screen to image steps, 16.16: du/dx, du/dy, dv/dx, dv/dy */
+    uint16_t half_w, half_h; /* half the size of the transformed bounds, rounded up */
+    uint8_t opaque[4];       /* x0, y0, x1, y1 of the part of the image that is not transparent */
+    /* Previous area for erasing old sprite position */
     int16_t prev_x;
     int16_t prev_y;
+    uint16_t prev_w;
+    uint16_t prev_h;
     bool has_prev; /* true if we need to erase previous position */
 } gfx_sprite_info_t;
 
 /* Initialize gfx module
    - tilesheet_ptr may be NULL; use gfx_set_tilesheet() later
    - tiles_count number of tiles in tilesheet_ptr
+   - leases the framebuffer from the scratch memory; returns false if it is in use
 */
-void gfx_init(const uint16_t *tilesheet_ptr, uint16_t tiles_count);
+bool gfx_init(const uint16_t *tilesheet_ptr, uint16_t tiles_count);
+
+/* Return the framebuffer to the scratch memory (rendering must be stopped) */
+void gfx_release(void);
 
 /* Set / replace tilesheet pointer (tiles are contiguous: tile0 16x16 pixels, tile1, ...) */
 void gfx_set_tilesheet(const uint16_t *tilesheet_ptr, uint16_t tiles_count);
 
-/* Set tile at tilemap coordinates tx,ty to tile index (0..tiles_count-1).
+/* Set / clear the per-tile flags (one GFX_TILE_* byte per tilesheet tile, or NULL).
+   Call before gfx_init() or while rendering is stopped.
+*/
+void gfx_set_tile_flags(const uint8_t *flags);
+
+/* Set tile at tilemap coordinates tx,ty to tile index (0..tiles_count-1),
+   optionally ORed with GFX_TILE_FLIP_X / GFX_TILE_FLIP_Y.
    If tile_index == UINT16_MAX => treat as "blank" (draw background colour).
 */
 void gfx_set_tile(uint16_t tx, uint16_t ty, uint16_t tile_index);
@@ -89,6 +143,26 @@ bool gfx_move_sprite(gfx_sprite_t id, int16_t x, int16_t y);
 bool gfx_set_sprite_z(gfx_sprite_t id, uint8_t z);
 bool gfx_set_sprite_image(gfx_sprite_t id, const uint16_t *image, uint8_t w, uint8_t h);
 
+/* 4-bpp sprites: GFX_SPRITE_4BPP_SIZE(w, h) bytes of palette indices and a 16-colour palette.
+   Changing the palette recolours the sprite without touching its pixels (team colours, flashes).
+*/
+gfx_sprite_t gfx_create_sprite_4bpp(const uint8_t *pixels, const uint16_t *palette, uint8_t w, uint8_t h, int16_t x, int16_t y, uint8_t z);
+bool gfx_set_sprite_image_4bpp(gfx_sprite_t id, const uint8_t *pixels, uint8_t w, uint8_t h);
+bool gfx_set_sprite_palette(gfx_sprite_t id, const uint16_t *palette);
+
+/* Rotate a sprite by angle (radians, clockwise) and scale it about its centre; an angle of 0
+   and a scale of 1 draw it normally again. The scale is limited to GFX_SPRITE_MIN_SCALE ..
+   GFX_SPRITE_MAX_SCALE; returns false for a bad sprite or a scale that is not positive.
+*/
+bool gfx_set_sprite_transform(gfx_sprite_t id, float angle, float scale);
+
+/* Raster effects (wavy water, parallax skies, split screens): table of HEIGHT rows, or NULL
+   for none. The table is read at every present, so keep it unchanged while it is in use
+   (from core 0 use gfx_core_gfx_raster_begin/commit, which double buffer it).
+*/
+void gfx_set_raster_table(const gfx_raster_line_t *table);
+void gfx_set_raster_tint(uint8_t index, uint16_t colour);
+
 /* Update single tile on screen immediately (bypass double-buffer tilemap compare) */
 void gfx_force_draw_tile(uint16_t tx, uint16_t ty);
 
@@ -99,6 +173,9 @@ void gfx_fill_tiles_rect(uint16_t tx, uint16_t ty, uint16_t tw, uint16_t th, uin
 void gfx_set_vblank_sync(bool enabled);
 bool gfx_get_vblank_sync(void);
 
+/* Register the static buffers with the memory statistics module */
+void gfx_register_memory(void);
+
 /* Get constants */
 static inline uint16_t gfx_tiles_x(void) { return GFX_TILES_X; }
 static inline uint16_t gfx_tiles_y(void) { return GFX_TILES_Y; }
@@ -0,0 +1,395 @@
+#include "gfx_affine.h"
+#include "gfx.h"
+#include "hardware/interp.h"
+#include <math.h>
+#include <string.h>
+
+/* Texture stepping with the SIO interpolators
+
+   Both interpolators hold the texture point (u, v) in their accumulators and the step
+   for one pixel right in BASE0/BASE1; each POP adds the step (ADD_RAW), so the two stay
+   in lock step. Their lanes cut different bits out of u and v:
+   - interp0 gives the address of the map entry: base2 (the map) + tile x * 2 +
+     tile y * map width * 2, wrapping at the edges of the map
+   - interp1 gives the byte offset of the texel inside its tile: (y * 16 + x) * 2
+   The inner loop is then two POPs, the map read and the texel read per pixel.
+*/
+
+#define AFFINE_TILE_LOG2 4                        /* 16x16 pixel tiles */
+#define AFFINE_PIXEL_SHIFT (GFX_AFFINE_FRAC - 1)  /* 16.16 pixels to byte offsets of uint16_t */
+#define AFFINE_MAX_DISTANCE 8192.0f               /* farthest floor row, keeps 16.16 in range */
+
+/* Mirroring a tile flips the bits of the texel x (FLIP_X) or y (FLIP_Y) in the offset */
+static const uint16_t flip_offset[4] = {
+    0,
+    (GFX_TILE_H - 1) * GFX_TILE_W * 2,                          /* GFX_TILE_FLIP_Y */
+    (GFX_TILE_W - 1) * 2,                                       /* GFX_TILE_FLIP_X */
+    (GFX_TILE_H - 1) * GFX_TILE_W * 2 + (GFX_TILE_W - 1) * 2,   /* both */
+};
+
+typedef enum {
+    AFFINE_PLANE,
+    AFFINE_FLOOR,
+} affine_mode_t;
+
+static const uint16_t *map = NULL;
+static uint8_t map_width_log2 = 0;
+static uint8_t map_height_log2 = 0;
+static affine_mode_t mode = AFFINE_PLANE;
+static gfx_affine_t plane = {0, 0, GFX_AFFINE_FIX(1), 0, 0, GFX_AFFINE_FIX(1)};
+static gfx_affine_floor_t floor_view;
+
+void gfx_affine_set_map(const uint16_t *m, uint8_t width_log2, uint8_t height_log2) {
+    if (width_log2 < 1 || width_log2 > GFX_AFFINE_MAX_MAP_LOG2 ||
+        height_log2 < 1 || height_log2 > GFX_AFFINE_MAX_MAP_LOG2) {
+        m = NULL;
+    }
+    map = m;
+    map_width_log2 = width_log2;
+    map_height_log2 = height_log2;
+}
+
+void gfx_affine_set_plane(const gfx_affine_t *transform) {
+    plane = *transform;
+    mode = AFFINE_PLANE;
+}
+
+void gfx_affine_set_floor(const gfx_affine_floor_t *floor) {
+    floor_view = *floor;
+    mode = AFFINE_FLOOR;
+}
+
+bool gfx_affine_enabled(void) {
+    return map != NULL;
+}
+
+void gfx_affine_rotozoom(gfx_affine_t *t, float u, float v, float angle, float zoom) {
+    float c = cosf(angle) / zoom;
+    float s = sinf(angle) / zoom;
+    t->dudx = GFX_AFFINE_FIX(c);
+    t->dvdx = GFX_AFFINE_FIX(s);
+    t->dudy = GFX_AFFINE_FIX(-s);
+    t->dvdy = GFX_AFFINE_FIX(c);
+    t->u0 = GFX_AFFINE_FIX(u - c * (WIDTH / 2) + s * (HEIGHT / 2));
+    t->v0 = GFX_AFFINE_FIX(v - s * (WIDTH / 2) - c * (HEIGHT / 2));
+}
+
+/* Configure both interpolators for the current map (they are per core, and only the core
+   drawing the plane uses them) */
+static void _setup_interpolators(void) {
+    interp_config cfg;
+
+    /* interp0: map entry address */
+    cfg = interp_default_config();
+    interp_config_set_add_raw(&cfg, true);
+    interp_config_set_shift(&cfg, AFFINE_PIXEL_SHIFT + AFFINE_TILE_LOG2);
+    interp_config_set_mask(&cfg, 1, map_width_log2);
+    interp_set_config(interp0, 0, &cfg);
+
+    cfg = interp_default_config();
+    interp_config_set_add_raw(&cfg, true);
+    interp_config_set_shift(&cfg, AFFINE_PIXEL_SHIFT + AFFINE_TILE_LOG2 - map_width_log2);
+    interp_config_set_mask(&cfg, map_width_log2 + 1, map_width_log2 + map_height_log2);
+    interp_set_config(interp0, 1, &cfg);
+    interp0->base[2] = (uint32_t)map;
+
+    /* interp1: texel offset within the tile */
+    cfg = interp_default_config();
+    interp_config_set_add_raw(&cfg, true);
+    interp_config_set_shift(&cfg, AFFINE_PIXEL_SHIFT);
+    interp_config_set_mask(&cfg, 1, AFFINE_TILE_LOG2);
+    interp_set_config(interp1, 0, &cfg);
+
+    cfg = interp_default_config();
+    interp_config_set_add_raw(&cfg, true);
+    interp_config_set_shift(&cfg, AFFINE_PIXEL_SHIFT - AFFINE_TILE_LOG2);
+    interp_config_set_mask(&cfg, AFFINE_TILE_LOG2 + 1, 2 * AFFINE_TILE_LOG2);
+    interp_set_config(interp1, 1, &cfg);
+    interp1->base[2] = 0;
+}
+
+/* Draw one row starting at texture point (u, v), stepping (du, dv) per pixel */
+static void __not_in_flash_func(_render_row)(uint16_t *dst, int32_t u, int32_t v, int32_t du, int32_t dv,
+                                             const uint16_t *tilesheet, uint16_t tiles_count) {
+    interp0->accum[0] = u;
+    interp0->accum[1] = v;
+    interp0->base[0] = du;
+    interp0->base[1] = dv;
+    interp1->accum[0] = u;
+    interp1->accum[1] = v;
+    interp1->base[0] = du;
+    interp1->base[1] = dv;
+
+    const uint8_t *texels = (const uint8_t *)tilesheet;
+    for (uint16_t *end = dst + WIDTH; dst < end; dst++) {
+        uint16_t tile = *(const uint16_t *)interp0->pop[2];
+        uint32_t offset = interp1->pop[2];
+        uint16_t index = tile & GFX_TILE_INDEX_MASK;
+        if (tile == UINT16_MAX || index >= tiles_count) {
+            *dst = 0;  /* blank: background */
+            continue;
+        }
+        offset ^= flip_offset[tile >> 14];
+        *dst = *(const uint16_t *)(texels + ((uint32_t)index * GFX_TILE_W * GFX_TILE_H * 2 + offset));
+    }
+}
+
+/* Camera direction and position on the map, worked out once per render */
+typedef struct {
+    float c, s;    /* cos and sin of the angle */
+    float x, y;    /* position, moved onto the map so the coordinates stay small */
+} floor_camera_t;
+
+static void _floor_camera(floor_camera_t *cam) {
+    const gfx_affine_floor_t *f = &floor_view;
+    float map_w = (float)(GFX_TILE_W << map_width_log2);
+    float map_h = (float)(GFX_TILE_H << map_height_log2);
+    cam->c = cosf(f->angle);
+    cam->s = sinf(f->angle);
+    cam->x = f->x - floorf(f->x / map_w) * map_w;
+    cam->y = f->y - floorf(f->y / map_h) * map_h;
+}
+
+/* Row y of the floor: the texture line seen on it, or false if the row is sky */
+static bool _floor_row(const floor_camera_t *cam, uint16_t y, int32_t *u, int32_t *v, int32_t *du, int32_t *dv) {
+    const gfx_affine_floor_t *f = &floor_view;
+    if (y <= f->horizon) return false;
+
+    /* The row looks at the plane at this distance ahead of the camera */
+    float distance = f->height * f->focal / (float)(y - f->horizon);
+    if (distance > AFFINE_MAX_DISTANCE) distance = AFFINE_MAX_DISTANCE;
+    float step = distance / f->focal;  /* texture pixels per screen pixel */
+
+    /* Centre of the row is straight ahead, the row runs to the right (-sin, cos) */
+    *du = GFX_AFFINE_FIX(-cam->s * step);
+    *dv = GFX_AFFINE_FIX(cam->c * step);
+    *u = GFX_AFFINE_FIX(cam->x + cam->c * distance + cam->s * step * (WIDTH / 2));
+    *v = GFX_AFFINE_FIX(cam->y + cam->s * distance - cam->c * step * (WIDTH / 2));
+    return true;
+}
+
+void gfx_affine_render(uint16_t *dst, uint16_t y0, uint16_t rows, const uint16_t *tilesheet, uint16_t tiles_count) {
+    if (!map || !tilesheet) return;
+
+    _setup_interpolators();
+    floor_camera_t cam;
+    _floor_camera(&cam);
+
+    /* Plane mode steps the row start incrementally, floor mode works each row out */
+    int32_t u = plane.u0 + plane.dudy * y0;
+    int32_t v = plane.v0 + plane.dvdy * y0;
+    for (uint16_t y = y0; y < y0 + rows; y++, dst += WIDTH) {
+        if (mode == AFFINE_PLANE) {
+            _render_row(dst, u, v, plane.dudx, plane.dvdx, tilesheet, tiles_count);
+            u += plane.dudy;
+            v += plane.dvdy;
+            continue;
+        }
+
+        int32_t fu, fv, fdu, fdv;
+        if (_floor_row(&cam, y, &fu, &fv, &fdu, &fdv)) {
+            _render_row(dst, fu, fv, fdu, fdv, tilesheet, tiles_count);
+        } else {
+            for (uint16_t x = 0; x < WIDTH; x++) {
+                dst[x] = floor_view.sky;
+            }
+        }
+    }
+}
+
+/* Rotated and scaled sprites
+
+   Every screen pixel in the transformed bounds is mapped back into the image (an
+   inverse-mapped blit). For each row the span of pixels that land inside the opaque part
+   of the image is worked out first, so the transparent border around most sprites and the
+   empty corners of the rotated bounds cost nothing. Along the span the image coordinates
+   are stepped in 16.16 fixed point; for RGB565 images a power of two wide, interp0 also
+   turns them into the texel address.
+*/
+
+void gfx_affine_sprite_opaque(gfx_sprite_info_t *s) {
+    int x0 = s->w, y0 = s->h, x1 = 0, y1 = 0;
+    uint32_t stride = (s->w + 1) / 2;
+
+    for (int y = 0; y < s->h; y++) {
+        for (int x = 0; x < s->w; x++) {
+            bool opaque;
+            if (s->indexed) {
+                uint8_t pair = s->indexed[(uint32_t)y * stride + (x >> 1)];
+                opaque = (x & 1 ? pair & 0x0F : pair >> 4) != 0;
+            } else {
+                opaque = s->image && s->image[(uint32_t)y * s->w + x] != GFX_TRANSPARENT_COLOR;
+            }
+            if (opaque) {
+                if (x < x0) x0 = x;
+                if (x >= x1) x1 = x + 1;
+                if (y < y0) y0 = y;
+                y1 = y + 1;
+            }
+        }
+    }
+
+    if (x0 >= x1) x0 = x1 = y0 = y1 = 0;  /* nothing to draw */
+    s->opaque[0] = x0;
+    s->opaque[1] = y0;
+    s->opaque[2] = x1;
+    s->opaque[3] = y1;
+}
+
+void gfx_affine_sprite_transform(gfx_sprite_info_t *s) {
+    float c = cosf(s->angle);
+    float n = sinf(s->angle);
+
+    /* Screen offset from the centre to image offset: rotate back and shrink */
+    s->inverse[0] = GFX_AFFINE_FIX(c / s->scale);   /* du/dx */
+    s->inverse[1] = GFX_AFFINE_FIX(n / s->scale);   /* du/dy */
+    s->inverse[2] = GFX_AFFINE_FIX(-n / s->scale);  /* dv/dx */
+    s->inverse[3] = GFX_AFFINE_FIX(c / s->scale);   /* dv/dy */
+
+    /* Bounds of the rotated rectangle, with a pixel to spare for rounding */
+    s->half_w = (uint16_t)ceilf((fabsf(c) * s->w + fabsf(n) * s->h) * s->scale / 2) + 1;
+    s->half_h = (uint16_t)ceilf((fabsf(n) * s->w + fabsf(c) * s->h) * s->scale / 2) + 1;
+}
+
+void gfx_affine_sprite_bounds(const gfx_sprite_info_t *s, int16_t *x, int16_t *y, uint16_t *w, uint16_t *h) {
+    if (!s->transformed) {
+        *x = s->x;
+        *y = s->y;
+        *w = s->w;
+        *h = s->h;
+        return;
+    }
+    *x = s->x + s->w / 2 - s->half_w;
+    *y = s->y + s->h / 2 - s->half_h;
+    *w = 2 * s->half_w + 1;
+    *h = 2 * s->half_h + 1;
+}
+
+static inline int64_t _div_floor(int64_t a, int64_t b) {
+    int64_t q = a / b;
+    return (a % b != 0 && (a < 0) != (b < 0)) ? q - 1 : q;
+}
+
+static inline int64_t _div_ceil(int64_t a, int64_t b) {
+    int64_t q = a / b;
+    return (a % b != 0 && (a < 0) == (b < 0)) ? q + 1 : q;
+}
+
+/* Narrow the steps first..last-1 to those n for which lo <= start + step * n <= hi */
+static void _clip_span(int32_t start, int32_t step, int32_t lo, int32_t hi, int *first, int *last) {
+    int64_t from, to;
+    if (step == 0) {
+        if (start < lo || start > hi) *last = *first;
+        return;
+    }
+    if (step > 0) {
+        from = _div_ceil((int64_t)lo - start, step);
+        to = _div_floor((int64_t)hi - start, step);
+    } else {
+        from = _div_ceil((int64_t)hi - start, step);
+        to = _div_floor((int64_t)lo - start, step);
+    }
+    if (from > *first) *first = from < *last ? (int)from : *last;
+    if (to + 1 < *last) *last = to + 1 > *first ? (int)(to + 1) : *first;
+}
+
+/* Configure interp0 to turn (u, v) into the address of a texel of an image a power of two
+   wide: image + (v * width + u) * 2 */
+static void _setup_sprite_interpolator(const uint16_t *image, uint8_t width_log2) {
+    interp_config cfg = interp_default_config();
+    interp_config_set_add_raw(&cfg, true);
+    interp_config_set_shift(&cfg, AFFINE_PIXEL_SHIFT);
+    interp_config_set_mask(&cfg, 1, width_log2);
+    interp_set_config(interp0, 0, &cfg);
+
+    cfg = interp_default_config();
+    interp_config_set_add_raw(&cfg, true);
+    interp_config_set_shift(&cfg, AFFINE_PIXEL_SHIFT - width_log2);
+    interp_config_set_mask(&cfg, width_log2 + 1, width_log2 + 8);
+    interp_set_config(interp0, 1, &cfg);
+    interp0->base[2] = (uint32_t)image;
+}
+
+/* Draw count pixels of an RGB565 span through interp0 */
+static void __not_in_flash_func(_sprite_span_interp)(uint16_t *dst, int count, int32_t u, int32_t v, int32_t du, int32_t dv) {
+    interp0->accum[0] = u;
+    interp0->accum[1] = v;
+    interp0->base[0] = du;
+    interp0->base[1] = dv;
+    for (uint16_t *end = dst + count; dst < end; dst++) {
+        uint16_t pixel = *(const uint16_t *)interp0->pop[2];
+        if (pixel != GFX_TRANSPARENT_COLOR) *dst = pixel;
+    }
+}
+
+/* Draw count pixels of a span of any other image */
+static void _sprite_span(uint16_t *dst, int count, int32_t u, int32_t v, int32_t du, int32_t dv,
+                         const gfx_sprite_info_t *s, const uint16_t *palette) {
+    uint32_t stride = (s->w + 1) / 2;
+    for (uint16_t *end = dst + count; dst < end; dst++, u += du, v += dv) {
+        uint32_t tx = (uint32_t)u >> GFX_AFFINE_FRAC;
+        uint32_t ty = (uint32_t)v >> GFX_AFFINE_FRAC;
+        if (s->indexed) {
+            uint8_t pair = s->indexed[ty * stride + (tx >> 1)];
+            uint8_t index = tx & 1 ? pair & 0x0F : pair >> 4;
+            if (index) *dst = palette[index];
+        } else {
+            uint16_t pixel = s->image[ty * s->w + tx];
+            if (pixel != GFX_TRANSPARENT_COLOR) *dst = pixel;
+        }
+    }
+}
+
+void gfx_affine_draw_sprite(uint16_t *framebuffer, const gfx_sprite_info_t *s) {
+    int16_t bx, by;
+    uint16_t bw, bh;
+    gfx_affine_sprite_bounds(s, &bx, &by, &bw, &bh);
+
+    int x0 = bx < 0 ? 0 : bx;
+    int y0 = by < 0 ? 0 : by;
+    int x1 = bx + bw > (int)WIDTH ? (int)WIDTH : bx + bw;
+    int y1 = by + bh > (int)HEIGHT ? (int)HEIGHT : by + bh;
+    if (x0 >= x1 || y0 >= y1 || s->opaque[0] >= s->opaque[2]) return;
+
+    int32_t dudx = s->inverse[0], dudy = s->inverse[1];
+    int32_t dvdx = s->inverse[2], dvdy = s->inverse[3];
+
+    /* Opaque part of the image, inclusive, in 16.16 */
+    int32_t u_lo = (int32_t)s->opaque[0] << GFX_AFFINE_FRAC;
+    int32_t v_lo = (int32_t)s->opaque[1] << GFX_AFFINE_FRAC;
+    int32_t u_hi = ((int32_t)s->opaque[2] << GFX_AFFINE_FRAC) - 1;
+    int32_t v_hi = ((int32_t)s->opaque[3] << GFX_AFFINE_FRAC) - 1;
+
+    /* Image point under the centre of screen pixel (x0, y0), relative to the sprite centre */
+    int64_t cx = (int64_t)s->x * (1 << GFX_AFFINE_FRAC) + ((int64_t)s->w << (GFX_AFFINE_FRAC - 1));
+    int64_t cy = (int64_t)s->y * (1 << GFX_AFFINE_FRAC) + ((int64_t)s->h << (GFX_AFFINE_FRAC - 1));
+    int64_t dx = ((int64_t)x0 << GFX_AFFINE_FRAC) + (1 << (GFX_AFFINE_FRAC - 1)) - cx;
+    int64_t dy = ((int64_t)y0 << GFX_AFFINE_FRAC) + (1 << (GFX_AFFINE_FRAC - 1)) - cy;
+    int32_t u_row = (int32_t)((dudx * dx + dudy * dy) >> GFX_AFFINE_FRAC) + ((int32_t)s->w << (GFX_AFFINE_FRAC - 1));
+    int32_t v_row = (int32_t)((dvdx * dx + dvdy * dy) >> GFX_AFFINE_FRAC) + ((int32_t)s->h << (GFX_AFFINE_FRAC - 1));
+
+    /* RGB565 images a power of two wide go through the interpolator */
+    bool fast = !s->indexed && s->w >= 2 && (s->w & (s->w - 1)) == 0;
+    uint16_t palette[16];
+    if (fast) {
+        _setup_sprite_interpolator(s->image, (uint8_t)__builtin_ctz(s->w));
+    } else if (s->indexed) {
+        memcpy(palette, s->palette, sizeof(palette));
+    }
+
+    for (int y = y0; y < y1; y++, u_row += dudy, v_row += dvdy) {
+        int first = 0, last = x1 - x0;
+        _clip_span(u_row, dudx, u_lo, u_hi, &first, &last);
+        _clip_span(v_row, dvdx, v_lo, v_hi, &first, &last);
+        if (first >= last) continue;
+
+        uint16_t *dst = &framebuffer[(uint32_t)y * WIDTH + x0 + first];
+        int32_t u = u_row + dudx * first;
+        int32_t v = v_row + dvdx * first;
+        if (fast) {
+            _sprite_span_interp(dst, last - first, u, v, dudx, dvdx);
+        } else {
+            _sprite_span(dst, last - first, u, v, dudx, dvdx, s, palette);
+        }
+    }
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "gfx.h"
+
+/*
+  Affine background plane ("Mode 7") for the gfx module
+  - A map of tiles, as many as a power of two across and down, wrapping around, drawn
+    rotated and scaled in place of the tilemap
+  - Plane mode: one affine transform (a 2x2 matrix and an origin) for the whole screen
+  - Floor mode: a camera above the plane, with a transform per row for a perspective floor
+    below the horizon and a plain sky colour above it
+  - Texture coordinates are stepped along each row in 16.16 fixed point by the SIO
+    interpolators, which also give the map entry and texel addresses
+  - Map entries are tile values as in the tilemap (GFX_TILE_FLIP_X / _Y, UINT16_MAX for
+    blank); the per-tile flags are not used
+  - Rotated and scaled sprites are drawn the same way, see gfx_set_sprite_transform()
+  - The plane lives on core 1: from core 0 use gfx_core_gfx_affine_map(),
+    gfx_core_gfx_affine_plane() and gfx_core_gfx_affine_floor()
+*/
+
+/* Fixed point: 16.16 texture pixels */
+#define GFX_AFFINE_FRAC 16
+#define GFX_AFFINE_FIX(v) ((int32_t)((v) * (1 << GFX_AFFINE_FRAC)))
+
+/* Largest map, as log2 of its size in tiles (the smallest is 2x2 tiles) */
+#define GFX_AFFINE_MAX_MAP_LOG2 8
+
+/* Plane transform: the texture pixel (u, v) shown at screen pixel (x, y) is
+     u = u0 + dudx * x + dudy * y
+     v = v0 + dvdx * x + dvdy * y
+   all in 16.16 fixed point */
+typedef struct {
+    int32_t u0, v0;      /* texture point at the top-left screen pixel */
+    int32_t dudx, dvdx;  /* step for one pixel right */
+    int32_t dudy, dvdy;  /* step for one row down */
+} gfx_affine_t;
+
+/* Perspective floor seen from a camera above the plane */
+typedef struct {
+    float x, y;          /* camera position on the plane (texture pixels) */
+    float angle;         /* direction the camera looks in (radians, 0 is towards +u) */
+    float height;        /* camera height above the plane (texture pixels) */
+    float focal;         /* focal length (screen pixels; WIDTH / 2 gives a 90 degree view) */
+    uint16_t horizon;    /* screen row of the horizon; rows above it are sky */
+    uint16_t sky;        /* RGB565 colour of the sky */
+} gfx_affine_floor_t;
+
+/* Set the map: (1 << width_log2) x (1 << height_log2) tile values, row by row, or NULL to
+   turn the plane off and go back to the tilemap. The map is read every frame, keep it. */
+void gfx_affine_set_map(const uint16_t *map, uint8_t width_log2, uint8_t height_log2);
+
+/* Draw the plane with one transform (plane mode) */
+void gfx_affine_set_plane(const gfx_affine_t *transform);
+
+/* Draw the plane as a floor seen from a camera (floor mode) */
+void gfx_affine_set_floor(const gfx_affine_floor_t *floor);
+
+/* True if a map is set, so the plane replaces the tilemap */
+bool gfx_affine_enabled(void);
+
+/* Fill a transform that shows texture point (u, v) at the centre of the screen, turned by
+   angle (radians) and magnified by zoom (2 shows every texture pixel twice as large) */
+void gfx_affine_rotozoom(gfx_affine_t *transform, float u, float v, float angle, float zoom);
+
+/* Draw rows y0..y0+rows-1 of the plane into dst (WIDTH pixels per row, dst is row y0).
+   The rows can be the whole framebuffer or a band that is sent while the next is drawn. */
+void gfx_affine_render(uint16_t *dst, uint16_t y0, uint16_t rows, const uint16_t *tilesheet, uint16_t tiles_count);
+
+/* Rotated and scaled sprites (used by gfx_present for sprites with a transform) */
+
+/* Find the part of the sprite image that is not transparent, after the image changes */
+void gfx_affine_sprite_opaque(gfx_sprite_info_t *sprite);
+
+/* Work out the inverse transform and bounds from the angle, scale and size of the sprite */
+void gfx_affine_sprite_transform(gfx_sprite_info_t *sprite);
+
+/* Screen area the sprite can draw on this frame (its size if it has no transform) */
+void gfx_affine_sprite_bounds(const gfx_sprite_info_t *sprite, int16_t *x, int16_t *y, uint16_t *w, uint16_t *h);
+
+/* Draw a transformed sprite into a WIDTH x HEIGHT framebuffer */
+void gfx_affine_draw_sprite(uint16_t *framebuffer, const gfx_sprite_info_t *sprite);
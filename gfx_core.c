@@ -7,6 +7,12 @@
 
 #include "gfx_core.h"
 #include "gfx.h"
+#include "gfx_map.h"
+#include "gfx_particles.h"
+#include "drivers/memstat.h"
+#include "drivers/idle.h"
+#include "drivers/governor.h"
+#include "drivers/dpm.h"
 #include "pico/multicore.h"
 #include "pico/mutex.h"
 #include "pico/time.h"
@@ -16,6 +22,8 @@
 static volatile bool gfx_core_running = false;
 static volatile bool gfx_core_rendering_enabled = false;
 static mutex_t gfx_mutex;
+static governor_profile_t text_profile = GOVERNOR_NORMAL; // clock profile to restore when rendering stops
+static bool fast_clock = false;
 
 // Command pool (prevents stack corruption issues)
 #define CMD_POOL_SIZE 4
@@ -23,104 +31,237 @@ static gfx_command_t cmd_pool[CMD_POOL_SIZE];
 static volatile int next_cmd_slot = 0;
 static mutex_t cmd_pool_mutex;
 
-// Frame timing (60 FPS)
-#define FRAME_TIME_US 16667  // ~60Hz
+// Raster effect tables: core 0 fills one while core 1 uses the other
+static gfx_raster_line_t raster_tables[2][HEIGHT];
+static int raster_back = 0;                 // table core 0 fills next
+static volatile bool raster_pending = false; // a committed table has not been taken yet
 
-// Core 1 main loop - continuous rendering
-static void gfx_core1_main(void) {
-    gfx_core_running = true;
-    absolute_time_t next_frame_time = get_absolute_time();
+// Command batches: core 0 fills one while core 1 executes the other
+static gfx_command_t batches[2][GFX_CORE_BATCH_SIZE];
+static int batch_back = 0;                  // batch core 0 fills next
+static uint16_t batch_count = 0;            // commands in it
+static bool batching = false;               // commands go into the batch instead of the FIFO
+static volatile bool batch_pending = false; // a committed batch has not been executed yet
 
-    while (gfx_core_running) {
-        // Process any pending commands from FIFO (non-blocking)
-        while (multicore_fifo_rvalid()) {
-            uint32_t cmd_ptr = multicore_fifo_pop_blocking();
+// Frame timing (60 FPS)
+#define FRAME_TIME_US 16667  // ~60Hz
 
-            if (cmd_ptr == 0) {
-                // Shutdown command
-                gfx_core_running = false;
-                return;
+// Core 1 rings this doorbell on core 0 after sending each frame to the LCD
+static int frame_doorbell = -1;
+static volatile uint32_t frame_count = 0;
+static volatile uint64_t frame_sent_us = 0;
+static volatile uint64_t frame_next_us = 0;
+
+// Execute one command on core 1
+static void gfx_core1_execute(const gfx_command_t *cmd) {
+    switch (cmd->type) {
+        case GFX_CMD_INIT: {
+            bool ok = gfx_init(cmd->data.init.tilesheet, cmd->data.init.tiles_count);
+            if (cmd->data.init.result) {
+                *cmd->data.init.result = ok;
             }
+            // Don't enable rendering yet - wait for scene setup
+            break;
+        }
 
-            gfx_command_t *cmd = (gfx_command_t *)cmd_ptr;
-
-            // Execute command on core 1
-            switch (cmd->type) {
-                case GFX_CMD_INIT:
-                    gfx_init(cmd->data.init.tilesheet, cmd->data.init.tiles_count);
-                    // Don't enable rendering yet - wait for scene setup
-                    break;
-
-                case GFX_CMD_START_RENDERING:
-                    gfx_core_rendering_enabled = true;
-                    break;
-
-                case GFX_CMD_STOP_RENDERING:
-                    gfx_core_rendering_enabled = false;
-                    break;
-
-                case GFX_CMD_SET_TILE:
-                    gfx_set_tile(cmd->data.set_tile.x,
-                                cmd->data.set_tile.y,
-                                cmd->data.set_tile.tile_index);
-                    break;
-
-                case GFX_CMD_CLEAR:
-                    gfx_clear_backmap(cmd->data.clear.bg_tile);
-                    break;
-
-                case GFX_CMD_CREATE_SPRITE: {
-                    int sprite_id = gfx_create_sprite(
-                        cmd->data.create_sprite.image,
-                        cmd->data.create_sprite.w,
-                        cmd->data.create_sprite.h,
-                        cmd->data.create_sprite.x,
-                        cmd->data.create_sprite.y,
-                        cmd->data.create_sprite.z
-                    );
-                    // Store result if pointer provided
-                    if (cmd->data.create_sprite.result_id) {
-                        *cmd->data.create_sprite.result_id = sprite_id;
-                    }
-                    break;
-                }
-
-                case GFX_CMD_MOVE_SPRITE:
-                    gfx_move_sprite(cmd->data.move_sprite.sprite_id,
-                                   cmd->data.move_sprite.x,
-                                   cmd->data.move_sprite.y);
-                    break;
-
-                case GFX_CMD_DESTROY_SPRITE:
-                    gfx_destroy_sprite(cmd->data.destroy_sprite.sprite_id);
-                    // Don't disable rendering here - use STOP_RENDERING command explicitly
-                    break;
-
-                case GFX_CMD_SHUTDOWN:
-                    gfx_core_running = false;
-                    return;
-
-                default:
-                    break;
+        case GFX_CMD_RELEASE:
+            gfx_core_rendering_enabled = false;
+            gfx_release();
+            break;
+
+        case GFX_CMD_START_RENDERING:
+            gfx_core_rendering_enabled = true;
+            break;
+
+        case GFX_CMD_STOP_RENDERING:
+            gfx_core_rendering_enabled = false;
+            break;
+
+        case GFX_CMD_SET_TILE:
+            gfx_set_tile(cmd->data.set_tile.x,
+                        cmd->data.set_tile.y,
+                        cmd->data.set_tile.tile_index);
+            break;
+
+        case GFX_CMD_CLEAR:
+            gfx_clear_backmap(cmd->data.clear.bg_tile);
+            break;
+
+        case GFX_CMD_CREATE_SPRITE: {
+            int sprite_id;
+            if (cmd->data.create_sprite.indexed) {
+                sprite_id = gfx_create_sprite_4bpp(
+                    cmd->data.create_sprite.indexed,
+                    cmd->data.create_sprite.palette,
+                    cmd->data.create_sprite.w,
+                    cmd->data.create_sprite.h,
+                    cmd->data.create_sprite.x,
+                    cmd->data.create_sprite.y,
+                    cmd->data.create_sprite.z
+                );
+            } else {
+                sprite_id = gfx_create_sprite(
+                    cmd->data.create_sprite.image,
+                    cmd->data.create_sprite.w,
+                    cmd->data.create_sprite.h,
+                    cmd->data.create_sprite.x,
+                    cmd->data.create_sprite.y,
+                    cmd->data.create_sprite.z
+                );
             }
+            // Store result if pointer provided
+            if (cmd->data.create_sprite.result_id) {
+                *cmd->data.create_sprite.result_id = sprite_id;
+            }
+            break;
+        }
 
-            // Signal completion back to core 0 (only for INIT - critical for startup)
-            if (cmd->type == GFX_CMD_INIT) {
-                multicore_fifo_push_blocking(1); // ACK
+        case GFX_CMD_MOVE_SPRITE:
+            gfx_move_sprite(cmd->data.move_sprite.sprite_id,
+                           cmd->data.move_sprite.x,
+                           cmd->data.move_sprite.y);
+            break;
+
+        case GFX_CMD_DESTROY_SPRITE:
+            gfx_destroy_sprite(cmd->data.destroy_sprite.sprite_id);
+            // Don't disable rendering here - use STOP_RENDERING command explicitly
+            break;
+
+        case GFX_CMD_SET_SPRITE_PALETTE:
+            gfx_set_sprite_palette(cmd->data.sprite_palette.sprite_id,
+                                   cmd->data.sprite_palette.palette);
+            break;
+
+        case GFX_CMD_SET_SPRITE_IMAGE_4BPP:
+            gfx_set_sprite_image_4bpp(cmd->data.sprite_image_4bpp.sprite_id,
+                                      cmd->data.sprite_image_4bpp.pixels,
+                                      cmd->data.sprite_image_4bpp.w,
+                                      cmd->data.sprite_image_4bpp.h);
+            break;
+
+        case GFX_CMD_SPRITE_TRANSFORM:
+            gfx_set_sprite_transform(cmd->data.sprite_transform.sprite_id,
+                                     cmd->data.sprite_transform.angle,
+                                     cmd->data.sprite_transform.scale);
+            break;
+
+        case GFX_CMD_EMIT_PARTICLES:
+            gfx_particles_emit(&cmd->data.emit_particles.emitter,
+                               cmd->data.emit_particles.count);
+            break;
+
+        case GFX_CMD_PARTICLE_GRAVITY:
+            gfx_particles_set_gravity(cmd->data.particle_gravity.gravity);
+            break;
+
+        case GFX_CMD_SET_RASTER_TABLE:
+            gfx_set_raster_table(cmd->data.raster_table.table);
+            raster_pending = false;
+            break;
+
+        case GFX_CMD_SET_RASTER_TINT:
+            gfx_set_raster_tint(cmd->data.raster_tint.index, cmd->data.raster_tint.colour);
+            break;
+
+        case GFX_CMD_AFFINE_MAP:
+            gfx_affine_set_map(cmd->data.affine_map.map,
+                               cmd->data.affine_map.width_log2,
+                               cmd->data.affine_map.height_log2);
+            break;
+
+        case GFX_CMD_AFFINE_PLANE:
+            gfx_affine_set_plane(&cmd->data.affine_plane);
+            break;
+
+        case GFX_CMD_AFFINE_FLOOR:
+            gfx_affine_set_floor(&cmd->data.affine_floor);
+            break;
+
+        case GFX_CMD_RUN:
+            cmd->data.run.job();
+            break;
+
+        case GFX_CMD_BATCH:
+            for (uint16_t i = 0; i < cmd->data.batch.count; i++) {
+                gfx_core1_execute(&cmd->data.batch.commands[i]);
             }
+            batch_pending = false;
+            break;
+
+        case GFX_CMD_SHUTDOWN:
+            gfx_core_running = false;
+            break;
+
+        default:
+            break;
+    }
+}
+
+// Execute the commands core 0 has pushed, returns false on shutdown
+static bool gfx_core1_take_commands(void) {
+    while (multicore_fifo_rvalid()) {
+        uint32_t cmd_ptr = multicore_fifo_pop_blocking();
+
+        if (cmd_ptr == 0) {
+            // Shutdown command
+            gfx_core_running = false;
+            return false;
         }
 
+        gfx_command_t *cmd = (gfx_command_t *)cmd_ptr;
+        gfx_core1_execute(cmd);
+        if (!gfx_core_running) {
+            return false;
+        }
+
+        // Signal completion back to core 0 (only for INIT and RELEASE, which change
+        // the ownership of the framebuffer)
+        if (cmd->type == GFX_CMD_INIT || cmd->type == GFX_CMD_RELEASE) {
+            multicore_fifo_push_blocking(1); // ACK
+        }
+    }
+    return true;
+}
+
+// Core 1 main loop - continuous rendering
+static void gfx_core1_main(void) {
+    gfx_core_running = true;
+    absolute_time_t next_frame_time = get_absolute_time();
+
+    while (gfx_core1_take_commands()) {
         // Continuous rendering loop (60 FPS)
         if (gfx_core_rendering_enabled) {
-            // Wait for next frame time
-            sleep_until(next_frame_time);
+            // Start again from now after a pause rather than catching up on missed frames
+            if (absolute_time_diff_us(next_frame_time, get_absolute_time()) > FRAME_TIME_US) {
+                next_frame_time = get_absolute_time();
+            }
+
+            // Wait for next frame time, then take what core 0 sent meanwhile so that it
+            // shows in this frame rather than the next
+            idle_sleep_until(next_frame_time);
             next_frame_time = delayed_by_us(next_frame_time, FRAME_TIME_US);
+            if (!gfx_core1_take_commands()) {
+                break;
+            }
+            if (!gfx_core_rendering_enabled) {
+                continue;
+            }
 
             // Render frame
             gfx_present();
+
+            // Tell core 0 the frame is out and when the commands for the next one are taken
+            frame_sent_us = time_us_64();
+            frame_next_us = to_us_since_boot(next_frame_time);
+            frame_count++;
+            multicore_doorbell_set_other_core(frame_doorbell);
+            idle_signal();
         } else {
-            // If rendering disabled, yield CPU briefly to allow command processing
-            tight_loop_contents();
+            // If rendering disabled, sleep until core 0 pushes a command
+            // (multicore_fifo_push_blocking signals an event)
+            if (!multicore_fifo_rvalid()) {
+                idle_wait();
+            }
         }
     }
 }
@@ -130,18 +271,30 @@ void gfx_core_init(void) {
     mutex_init(&gfx_mutex);
     mutex_init(&cmd_pool_mutex);
 
+    gfx_register_memory();
+    gfx_map_register_memory();
+    gfx_particles_register_memory();
+    mem_register_static("gfx raster tables", sizeof(raster_tables));
+
+    mem_register_static("gfx command batches", sizeof(batches));
+
+    // Both cores claim the frame doorbell; core 1 rings it on core 0
+    frame_doorbell = multicore_doorbell_claim_unused((1u << 0) | (1u << 1), true);
+
+    // Paint the core 1 stack so its high-water mark can be measured
+    mem_paint_core1_stack();
+
     // Launch core 1 with graphics loop
     multicore_launch_core1(gfx_core1_main);
 
-    // Wait a bit for core 1 to start
-    sleep_ms(10);
+    // Wait for core 1 to start taking commands
+    while (!gfx_core_running) {
+        tight_loop_contents();
+    }
 }
 
-// Send a command to the graphics core (non-blocking for most commands)
-bool gfx_core_send_command(const gfx_command_t *cmd) {
-    if (!gfx_core_running) {
-        return false;
-    }
+// Push a command to core 1 through the FIFO
+static bool gfx_core_push_command(const gfx_command_t *cmd) {
 
     // Get a slot from the command pool (round-robin)
     mutex_enter_blocking(&cmd_pool_mutex);
@@ -155,26 +308,133 @@ bool gfx_core_send_command(const gfx_command_t *cmd) {
     multicore_fifo_push_blocking((uint32_t)&cmd_pool[slot]);
     mutex_exit(&cmd_pool_mutex);
 
-    // Only wait for ACK on INIT command (critical for startup synchronization)
-    if (cmd->type == GFX_CMD_INIT) {
+    // Only wait for ACK on INIT and RELEASE commands (framebuffer ownership changes)
+    if (cmd->type == GFX_CMD_INIT || cmd->type == GFX_CMD_RELEASE) {
         multicore_fifo_pop_blocking();
     }
 
     return true;
 }
 
+// Commands that core 0 waits on, or that change whether core 1 renders, are never batched
+static bool gfx_core_batchable(gfx_cmd_type_t type) {
+    switch (type) {
+        case GFX_CMD_INIT:
+        case GFX_CMD_RELEASE:
+        case GFX_CMD_CREATE_SPRITE:
+        case GFX_CMD_START_RENDERING:
+        case GFX_CMD_STOP_RENDERING:
+        case GFX_CMD_SHUTDOWN:
+        case GFX_CMD_RUN:
+        case GFX_CMD_BATCH:
+            return false;
+        default:
+            return true;
+    }
+}
+
+// Send a command to the graphics core (non-blocking for most commands)
+bool gfx_core_send_command(const gfx_command_t *cmd) {
+    if (!gfx_core_running) {
+        return false;
+    }
+
+    if (batching && gfx_core_batchable(cmd->type)) {
+        if (batch_count == GFX_CORE_BATCH_SIZE) {
+            gfx_core_batch_commit();
+        }
+        batches[batch_back][batch_count++] = *cmd;
+        return true;
+    }
+
+    // Anything batched so far has to reach core 1 first
+    if (batch_count > 0) {
+        gfx_core_batch_commit();
+    }
+    return gfx_core_push_command(cmd);
+}
+
+//
+// Frames and batches
+//
+
+void gfx_core_batch_begin(void) {
+    batching = true;
+}
+
+void gfx_core_batch_commit(void) {
+    if (batch_count == 0) {
+        return;
+    }
+
+    // Core 1 executes a committed batch at its next frame, after which the other one is free
+    while (batch_pending && gfx_core_running) {
+        idle_wait();
+    }
+
+    batch_pending = true;
+    gfx_command_t cmd = {
+        .type = GFX_CMD_BATCH,
+        .data.batch = {
+            .commands = batches[batch_back],
+            .count = batch_count
+        }
+    };
+    if (!gfx_core_push_command(&cmd)) {
+        batch_pending = false;
+    }
+    batch_back ^= 1;
+    batch_count = 0;
+}
+
+void gfx_core_batch_end(void) {
+    gfx_core_batch_commit();
+    batching = false;
+}
+
+bool gfx_core_wait_frame(gfx_core_frame_t *frame) {
+    while (!multicore_doorbell_is_set_current_core(frame_doorbell)) {
+        if (!gfx_core_rendering_enabled) {
+            return false;
+        }
+        idle_wait();
+    }
+    multicore_doorbell_clear_current_core(frame_doorbell);
+
+    if (frame) {
+        frame->count = frame_count;
+        frame->sent_us = frame_sent_us;
+        frame->next_us = frame_next_us;
+    }
+    return true;
+}
+
+void gfx_core_clear_frame(void) {
+    multicore_doorbell_clear_current_core(frame_doorbell);
+}
+
 //
 // High-level API wrappers
 //
 
-void gfx_core_gfx_init(const uint16_t *tilesheet_ptr, uint16_t tiles_count) {
+bool gfx_core_gfx_init(const uint16_t *tilesheet_ptr, uint16_t tiles_count) {
+    bool result = false;
     gfx_command_t cmd = {
         .type = GFX_CMD_INIT,
         .data.init = {
             .tilesheet = tilesheet_ptr,
-            .tiles_count = tiles_count
+            .tiles_count = tiles_count,
+            .result = &result
         }
     };
+    // INIT waits for the ACK, so the result is valid on return
+    return gfx_core_send_command(&cmd) && result;
+}
+
+void gfx_core_gfx_release(void) {
+    gfx_command_t cmd = {
+        .type = GFX_CMD_RELEASE
+    };
     gfx_core_send_command(&cmd);
 }
 
@@ -205,12 +465,16 @@ void gfx_core_gfx_clear_backmap(uint16_t bg_tile) {
     gfx_core_send_command(&cmd);
 }
 
-int gfx_core_gfx_create_sprite(const uint16_t *image, uint8_t w, uint8_t h, int16_t x, int16_t y, uint8_t z) {
+// Create an RGB565 sprite (image) or a 4-bpp one (indexed and palette) on core 1
+static int gfx_core_create_sprite(const uint16_t *image, const uint8_t *indexed, const uint16_t *palette,
+                                  uint8_t w, uint8_t h, int16_t x, int16_t y, uint8_t z) {
     volatile int sprite_id = -1;
     gfx_command_t cmd = {
         .type = GFX_CMD_CREATE_SPRITE,
         .data.create_sprite = {
             .image = image,
+            .indexed = indexed,
+            .palette = palette,
             .w = w,
             .h = h,
             .x = x,
@@ -231,6 +495,14 @@ int gfx_core_gfx_create_sprite(const uint16_t *image, uint8_t w, uint8_t h, int1
     return sprite_id;
 }
 
+int gfx_core_gfx_create_sprite(const uint16_t *image, uint8_t w, uint8_t h, int16_t x, int16_t y, uint8_t z) {
+    return gfx_core_create_sprite(image, NULL, NULL, w, h, x, y, z);
+}
+
+int gfx_core_gfx_create_sprite_4bpp(const uint8_t *pixels, const uint16_t *palette, uint8_t w, uint8_t h, int16_t x, int16_t y, uint8_t z) {
+    return gfx_core_create_sprite(NULL, pixels, palette, w, h, x, y, z);
+}
+
 void gfx_core_gfx_move_sprite(int sprite_id, int16_t x, int16_t y) {
     gfx_command_t cmd = {
         .type = GFX_CMD_MOVE_SPRITE,
@@ -253,13 +525,164 @@ void gfx_core_gfx_destroy_sprite(int sprite_id) {
     gfx_core_send_command(&cmd);
 }
 
+void gfx_core_gfx_set_sprite_palette(int sprite_id, const uint16_t *palette) {
+    gfx_command_t cmd = {
+        .type = GFX_CMD_SET_SPRITE_PALETTE,
+        .data.sprite_palette = {
+            .sprite_id = sprite_id,
+            .palette = palette
+        }
+    };
+    gfx_core_send_command(&cmd);
+}
+
+void gfx_core_gfx_set_sprite_image_4bpp(int sprite_id, const uint8_t *pixels, uint8_t w, uint8_t h) {
+    gfx_command_t cmd = {
+        .type = GFX_CMD_SET_SPRITE_IMAGE_4BPP,
+        .data.sprite_image_4bpp = {
+            .sprite_id = sprite_id,
+            .pixels = pixels,
+            .w = w,
+            .h = h
+        }
+    };
+    gfx_core_send_command(&cmd);
+}
+
+void gfx_core_gfx_set_sprite_transform(int sprite_id, float angle, float scale) {
+    gfx_command_t cmd = {
+        .type = GFX_CMD_SPRITE_TRANSFORM,
+        .data.sprite_transform = {
+            .sprite_id = sprite_id,
+            .angle = angle,
+            .scale = scale
+        }
+    };
+    gfx_core_send_command(&cmd);
+}
+
+void gfx_core_gfx_emit_particles(const gfx_particle_emitter_t *emitter, uint16_t count) {
+    gfx_command_t cmd = {
+        .type = GFX_CMD_EMIT_PARTICLES,
+        .data.emit_particles = {
+            .emitter = *emitter,
+            .count = count
+        }
+    };
+    gfx_core_send_command(&cmd);
+}
+
+void gfx_core_gfx_set_particle_gravity(int16_t gravity) {
+    gfx_command_t cmd = {
+        .type = GFX_CMD_PARTICLE_GRAVITY,
+        .data.particle_gravity = {
+            .gravity = gravity
+        }
+    };
+    gfx_core_send_command(&cmd);
+}
+
+gfx_raster_line_t *gfx_core_gfx_raster_begin(void) {
+    // Core 1 takes a committed table between frames, after which the other one is free
+    // (a table still waiting in the batch is sent now, or it would never be taken)
+    if (raster_pending) {
+        gfx_core_batch_commit();
+    }
+    while (raster_pending && gfx_core_running) {
+        sleep_us(100);
+    }
+    return raster_tables[raster_back];
+}
+
+void gfx_core_gfx_raster_commit(void) {
+    raster_pending = true;
+    gfx_command_t cmd = {
+        .type = GFX_CMD_SET_RASTER_TABLE,
+        .data.raster_table = {
+            .table = raster_tables[raster_back]
+        }
+    };
+    if (!gfx_core_send_command(&cmd)) {
+        raster_pending = false;
+        return;
+    }
+    raster_back ^= 1;
+}
+
+void gfx_core_gfx_raster_off(void) {
+    gfx_command_t cmd = {
+        .type = GFX_CMD_SET_RASTER_TABLE,
+        .data.raster_table = {
+            .table = NULL
+        }
+    };
+    gfx_core_send_command(&cmd);
+}
+
+void gfx_core_gfx_set_raster_tint(uint8_t index, uint16_t colour) {
+    gfx_command_t cmd = {
+        .type = GFX_CMD_SET_RASTER_TINT,
+        .data.raster_tint = {
+            .index = index,
+            .colour = colour
+        }
+    };
+    gfx_core_send_command(&cmd);
+}
+
+void gfx_core_gfx_affine_map(const uint16_t *map, uint8_t width_log2, uint8_t height_log2) {
+    gfx_command_t cmd = {
+        .type = GFX_CMD_AFFINE_MAP,
+        .data.affine_map = {
+            .map = map,
+            .width_log2 = width_log2,
+            .height_log2 = height_log2
+        }
+    };
+    gfx_core_send_command(&cmd);
+}
+
+void gfx_core_gfx_affine_plane(const gfx_affine_t *transform) {
+    gfx_command_t cmd = {
+        .type = GFX_CMD_AFFINE_PLANE,
+        .data.affine_plane = *transform
+    };
+    gfx_core_send_command(&cmd);
+}
+
+void gfx_core_gfx_affine_floor(const gfx_affine_floor_t *floor) {
+    gfx_command_t cmd = {
+        .type = GFX_CMD_AFFINE_FLOOR,
+        .data.affine_floor = *floor
+    };
+    gfx_core_send_command(&cmd);
+}
+
 void gfx_core_start_rendering(void) {
+    // Keep the display awake and raise the clock while core 1 is not yet
+    // drawing to the LCD
+    dpm_inhibit(true);
+    if (!fast_clock) {
+        text_profile = governor_get_profile();
+        fast_clock = governor_set_profile(GOVERNOR_FAST);
+    }
+
     gfx_command_t cmd = {
         .type = GFX_CMD_START_RENDERING
     };
     gfx_core_send_command(&cmd);
 }
 
+bool gfx_core_run(void (*job)(void)) {
+    gfx_command_t cmd = {
+        .type = GFX_CMD_RUN,
+        .data.run = {
+            .job = job
+        }
+    };
+    return gfx_core_send_command(&cmd);
+}
+
 void gfx_core_stop_rendering(void) {
     gfx_command_t cmd = {
         .type = GFX_CMD_STOP_RENDERING
@@ -273,4 +696,10 @@ void gfx_core_stop_rendering(void) {
         sleep_us(100); // Wait 100us at a time
         timeout++;
     }
+
+    if (fast_clock && !gfx_core_rendering_enabled) {
+        governor_set_profile(text_profile);
+        fast_clock = false;
+    }
+    dpm_inhibit(gfx_core_rendering_enabled);
 }
@@ -2,6 +2,9 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include "gfx.h"
+#include "gfx_particles.h"
+#include "gfx_affine.h"
 
 // Graphics commands that can be sent to core 1
 typedef enum {
@@ -12,19 +15,38 @@ typedef enum {
     GFX_CMD_CREATE_SPRITE,  // Create a sprite
     GFX_CMD_MOVE_SPRITE,    // Move a sprite
     GFX_CMD_DESTROY_SPRITE, // Destroy a sprite
+    GFX_CMD_SET_SPRITE_PALETTE, // Change the palette of a 4-bpp sprite
+    GFX_CMD_SET_SPRITE_IMAGE_4BPP, // Change the pixels of a 4-bpp sprite (animation)
+    GFX_CMD_SPRITE_TRANSFORM, // Rotate and scale a sprite
+    GFX_CMD_EMIT_PARTICLES, // Create particles
+    GFX_CMD_PARTICLE_GRAVITY, // Set the particle gravity
+    GFX_CMD_SET_RASTER_TABLE, // Switch to another raster effect table
+    GFX_CMD_SET_RASTER_TINT,  // Set a raster effect tint colour
+    GFX_CMD_AFFINE_MAP,     // Set or clear the map of the affine plane
+    GFX_CMD_AFFINE_PLANE,   // Set the transform of the affine plane
+    GFX_CMD_AFFINE_FLOOR,   // Show the affine plane as a perspective floor
     GFX_CMD_DRAW_SPRITE,    // Draw sprites
     GFX_CMD_START_RENDERING,// Start continuous rendering
     GFX_CMD_STOP_RENDERING, // Stop continuous rendering
     GFX_CMD_SHUTDOWN,       // Shutdown graphics core
+    GFX_CMD_RELEASE,        // Return the framebuffer to the scratch memory
+    GFX_CMD_RUN,            // Run a background job (e.g. slow hardware start-up)
+    GFX_CMD_BATCH,          // Execute a batch of commands before the next frame
 } gfx_cmd_type_t;
 
+// Commands in one batch (a full batch is committed early)
+#ifndef GFX_CORE_BATCH_SIZE
+#define GFX_CORE_BATCH_SIZE 32
+#endif
+
 // Graphics command structure
-typedef struct {
+typedef struct gfx_command {
     gfx_cmd_type_t type;
     union {
         struct {
             const uint16_t *tilesheet;
             uint16_t tiles_count;
+            bool *result;    // pointer to store the init result
         } init;
         struct {
             uint16_t x, y;
@@ -35,6 +57,8 @@ typedef struct {
         } clear;
         struct {
             const uint16_t *image;
+            const uint8_t *indexed;   // 4-bpp pixels instead of image
+            const uint16_t *palette;  // palette of the 4-bpp pixels
             uint8_t w, h;
             int16_t x, y;
             uint8_t z;
@@ -47,9 +71,56 @@ typedef struct {
         struct {
             int sprite_id;
         } destroy_sprite;
+        struct {
+            int sprite_id;
+            const uint16_t *palette;
+        } sprite_palette;
+        struct {
+            int sprite_id;
+            const uint8_t *pixels;
+            uint8_t w, h;
+        } sprite_image_4bpp;
+        struct {
+            int sprite_id;
+            float angle, scale;
+        } sprite_transform;
+        struct {
+            gfx_particle_emitter_t emitter;
+            uint16_t count;
+        } emit_particles;
+        struct {
+            int16_t gravity;
+        } particle_gravity;
+        struct {
+            const gfx_raster_line_t *table;
+        } raster_table;
+        struct {
+            uint8_t index;
+            uint16_t colour;
+        } raster_tint;
+        struct {
+            const uint16_t *map;
+            uint8_t width_log2, height_log2;
+        } affine_map;
+        gfx_affine_t affine_plane;
+        gfx_affine_floor_t affine_floor;
+        struct {
+            void (*job)(void);
+        } run;
+        struct {
+            const struct gfx_command *commands;
+            uint16_t count;
+        } batch;
     } data;
 } gfx_command_t;
 
+// A frame core 1 has sent to the LCD
+typedef struct {
+    uint32_t count;    // frames sent since start-up
+    uint64_t sent_us;  // when it finished sending (time since boot)
+    uint64_t next_us;  // when core 1 takes the commands for the next frame
+} gfx_core_frame_t;
+
 // Initialize the graphics core system
 void gfx_core_init(void);
 
@@ -63,12 +134,48 @@ void gfx_core_wait_idle(void);
 bool gfx_core_is_busy(void);
 
 // High-level API wrappers (call these instead of gfx_* functions)
-void gfx_core_gfx_init(const uint16_t *tilesheet_ptr, uint16_t tiles_count);
+bool gfx_core_gfx_init(const uint16_t *tilesheet_ptr, uint16_t tiles_count);
+void gfx_core_gfx_release(void);
 void gfx_core_gfx_present(void);
 void gfx_core_gfx_set_tile(uint16_t x, uint16_t y, uint16_t tile_index);
 void gfx_core_gfx_clear_backmap(uint16_t bg_tile);
 int gfx_core_gfx_create_sprite(const uint16_t *image, uint8_t w, uint8_t h, int16_t x, int16_t y, uint8_t z);
 void gfx_core_gfx_move_sprite(int sprite_id, int16_t x, int16_t y);
 void gfx_core_gfx_destroy_sprite(int sprite_id);
+int gfx_core_gfx_create_sprite_4bpp(const uint8_t *pixels, const uint16_t *palette, uint8_t w, uint8_t h, int16_t x, int16_t y, uint8_t z);
+void gfx_core_gfx_set_sprite_palette(int sprite_id, const uint16_t *palette);
+void gfx_core_gfx_set_sprite_image_4bpp(int sprite_id, const uint8_t *pixels, uint8_t w, uint8_t h);
+void gfx_core_gfx_set_sprite_transform(int sprite_id, float angle, float scale);
+void gfx_core_gfx_emit_particles(const gfx_particle_emitter_t *emitter, uint16_t count);
+void gfx_core_gfx_set_particle_gravity(int16_t gravity);
+
+// Raster effects: fill every row of the table returned by begin (it still holds the table
+// committed two commits ago) and commit it; core 1 switches to it at the next frame.
+// begin waits until core 1 has taken the last table committed.
+gfx_raster_line_t *gfx_core_gfx_raster_begin(void);
+void gfx_core_gfx_raster_commit(void);
+void gfx_core_gfx_raster_off(void);
+void gfx_core_gfx_set_raster_tint(uint8_t index, uint16_t colour);
+
+// Affine plane: a NULL map turns it off
+void gfx_core_gfx_affine_map(const uint16_t *map, uint8_t width_log2, uint8_t height_log2);
+void gfx_core_gfx_affine_plane(const gfx_affine_t *transform);
+void gfx_core_gfx_affine_floor(const gfx_affine_floor_t *floor);
 void gfx_core_start_rendering(void);
 void gfx_core_stop_rendering(void);
+
+// Run a job on core 1 without waiting for it (returns false if core 1 is not running)
+bool gfx_core_run(void (*job)(void));
+
+// Frames: core 1 rings a doorbell on core 0 after sending each frame. wait_frame sleeps
+// until it rings (returns at once if a frame was sent since the last call) and returns
+// false if rendering is stopped; clear_frame forgets a frame that has not been waited for.
+bool gfx_core_wait_frame(gfx_core_frame_t *frame);
+void gfx_core_clear_frame(void);
+
+// Batches: between begin and end, scene commands are kept on core 0 and commit sends
+// them in one go, to be executed just before the next frame. Commands that return a
+// result or start and stop rendering commit the batch and are sent at once.
+void gfx_core_batch_begin(void);
+void gfx_core_batch_commit(void);
+void gfx_core_batch_end(void);
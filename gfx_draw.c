@@ -0,0 +1,556 @@
+#include "gfx_draw.h"
+#include "drivers/lcd.h"
+#include "drivers/memstat.h"
+#include <stdlib.h>
+
+/* Vector drawing
+
+   All drawing ends up as clipped horizontal spans or single pixels. Spans are filled two
+   pixels per 32-bit store once the address is word aligned. Lines are clipped to the clip
+   rectangle before they are stepped, so a line from far off the canvas costs no more than
+   the part that shows. Each primitive adds its clipped bounds to the damage list.
+*/
+
+/* Polygon edge. Where it crosses the centre of a row, x is the first pixel whose centre is
+   at or right of the crossing, kept exactly as x - rem / den in half pixels (no rounding
+   builds up along long edges). */
+typedef struct {
+    int32_t x;
+    int32_t rem;       /* 0 <= rem < den */
+    int32_t den;       /* twice the height of the edge */
+    int32_t step;      /* x moves step + step_rem / den pixels per row */
+    int32_t step_rem;
+    int32_t dx;        /* width of the edge, bottom x - top x */
+    int16_t x_top;     /* top end point */
+    int16_t y_top;     /* first row crossed */
+    int16_t y_bottom;  /* row after the last one crossed */
+} edge_t;
+
+static edge_t edges[GFX_DRAW_MAX_POINTS];   /* edge table, sorted by y_top */
+static uint8_t active[GFX_DRAW_MAX_POINTS]; /* edges crossing the current row, sorted by x */
+static bool memory_registered = false;
+
+static inline int32_t _min(int32_t a, int32_t b) { return a < b ? a : b; }
+static inline int32_t _max(int32_t a, int32_t b) { return a > b ? a : b; }
+static inline int64_t _min64(int64_t a, int64_t b) { return a < b ? a : b; }
+
+/* Damage list */
+
+static inline int64_t _area(int32_t x0, int32_t y0, int32_t x1, int32_t y1) {
+    return (int64_t)(x1 - x0) * (y1 - y0);
+}
+
+/* Add a changed area, merging it into a rectangle it overlaps or touches, or when the list is
+   full into the one that grows least */
+static void _damage(gfx_canvas_t *c, int32_t x0, int32_t y0, int32_t x1, int32_t y1) {
+    if (x0 >= x1 || y0 >= y1) return;
+
+    int best = -1;
+    int64_t best_growth = INT64_MAX;
+    for (int i = 0; i < c->damage_count; i++) {
+        gfx_rect_t *d = &c->damage[i];
+        bool touches = x0 <= d->x1 && d->x0 <= x1 && y0 <= d->y1 && d->y0 <= y1;
+        int64_t growth = _area(_min(x0, d->x0), _min(y0, d->y0), _max(x1, d->x1), _max(y1, d->y1)) -
+                         _area(d->x0, d->y0, d->x1, d->y1);
+        if (touches) growth = -1;  /* always merge touching areas */
+        if (growth < best_growth) {
+            best = i;
+            best_growth = growth;
+        }
+    }
+
+    if (best < 0 || (best_growth >= 0 && c->damage_count < GFX_DRAW_MAX_DAMAGE)) {
+        c->damage[c->damage_count++] = (gfx_rect_t){x0, y0, x1, y1};
+        return;
+    }
+
+    gfx_rect_t *d = &c->damage[best];
+    d->x0 = _min(x0, d->x0);
+    d->y0 = _min(y0, d->y0);
+    d->x1 = _max(x1, d->x1);
+    d->y1 = _max(y1, d->y1);
+}
+
+/* Add the part of an area that lies inside the clip rectangle */
+static void _damage_clipped(gfx_canvas_t *c, int32_t x0, int32_t y0, int32_t x1, int32_t y1) {
+    _damage(c, _max(x0, c->clip.x0), _max(y0, c->clip.y0), _min(x1, c->clip.x1), _min(y1, c->clip.y1));
+}
+
+/* Canvas */
+
+void gfx_canvas_init(gfx_canvas_t *c, uint16_t *pixels, uint16_t width, uint16_t height) {
+    if (!memory_registered) {
+        mem_register_static("gfx draw edges", sizeof(edges) + sizeof(active));
+        memory_registered = true;
+    }
+
+    c->pixels = pixels;
+    c->width = width;
+    c->height = height;
+    c->damage_count = 0;
+    gfx_canvas_set_clip(c, NULL);
+}
+
+void gfx_canvas_set_clip(gfx_canvas_t *c, const gfx_rect_t *clip) {
+    c->clip = (gfx_rect_t){0, 0, (int16_t)c->width, (int16_t)c->height};
+    if (clip) {
+        c->clip.x0 = _max(clip->x0, 0);
+        c->clip.y0 = _max(clip->y0, 0);
+        c->clip.x1 = _max(_min(clip->x1, c->width), c->clip.x0);
+        c->clip.y1 = _max(_min(clip->y1, c->height), c->clip.y0);
+    }
+}
+
+void gfx_canvas_clear(gfx_canvas_t *c, uint16_t colour) {
+    gfx_fill_rect(c, c->clip.x0, c->clip.y0, c->clip.x1 - c->clip.x0, c->clip.y1 - c->clip.y0, colour);
+}
+
+void gfx_canvas_damage(gfx_canvas_t *c, int16_t x0, int16_t y0, int16_t x1, int16_t y1) {
+    _damage(c, _max(x0, 0), _max(y0, 0), _min(x1, c->width), _min(y1, c->height));
+}
+
+void gfx_canvas_flush(gfx_canvas_t *c, uint16_t x, uint16_t y) {
+    for (int i = 0; i < c->damage_count; i++) {
+        const gfx_rect_t *d = &c->damage[i];
+        uint16_t w = d->x1 - d->x0;
+
+        /* Whole rows are contiguous and go in one transfer, narrower areas a row at a time */
+        if (w == c->width) {
+            lcd_blit(&c->pixels[(uint32_t)d->y0 * c->width], x, y + d->y0, w, d->y1 - d->y0);
+            continue;
+        }
+        for (int16_t row = d->y0; row < d->y1; row++) {
+            lcd_blit(&c->pixels[(uint32_t)row * c->width + d->x0], x + d->x0, y + row, w, 1);
+        }
+    }
+    c->damage_count = 0;
+}
+
+/* Spans and pixels */
+
+/* Fill n pixels, two per 32-bit store */
+static inline void _fill(uint16_t *dst, int32_t n, uint16_t colour) {
+    if (n <= 0) return;
+    if ((uintptr_t)dst & 2) {
+        *dst++ = colour;
+        n--;
+    }
+    uint32_t pair = colour | (uint32_t)colour << 16;
+    uint32_t *words = (uint32_t *)dst;
+    for (int32_t i = n >> 1; i > 0; i--) {
+        *words++ = pair;
+    }
+    if (n & 1) {
+        *(uint16_t *)words = colour;
+    }
+}
+
+/* Fill columns x0..x1-1 of row y, clipped; no damage recorded */
+static inline void _span(gfx_canvas_t *c, int32_t x0, int32_t x1, int32_t y, uint16_t colour) {
+    if (y < c->clip.y0 || y >= c->clip.y1) return;
+    x0 = _max(x0, c->clip.x0);
+    x1 = _min(x1, c->clip.x1);
+    if (x0 < x1) {
+        _fill(&c->pixels[(uint32_t)y * c->width + x0], x1 - x0, colour);
+    }
+}
+
+static inline void _plot(gfx_canvas_t *c, int32_t x, int32_t y, uint16_t colour) {
+    if (x >= c->clip.x0 && x < c->clip.x1 && y >= c->clip.y0 && y < c->clip.y1) {
+        c->pixels[(uint32_t)y * c->width + x] = colour;
+    }
+}
+
+void gfx_draw_pixel(gfx_canvas_t *c, int16_t x, int16_t y, uint16_t colour) {
+    _plot(c, x, y, colour);
+    _damage_clipped(c, x, y, x + 1, y + 1);
+}
+
+/* Filled area x0..x1-1 by y0..y1-1, clipped */
+static void _area_fill(gfx_canvas_t *c, int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint16_t colour) {
+    for (int32_t y = _max(y0, c->clip.y0); y < _min(y1, c->clip.y1); y++) {
+        _span(c, x0, x1, y, colour);
+    }
+    _damage_clipped(c, x0, y0, x1, y1);
+}
+
+/* Column x, rows y0..y1-1, clipped */
+static void _column(gfx_canvas_t *c, int32_t x, int32_t y0, int32_t y1, uint16_t colour) {
+    if (x < c->clip.x0 || x >= c->clip.x1) return;
+    int32_t top = _max(y0, c->clip.y0);
+    int32_t bottom = _min(y1, c->clip.y1);
+    uint16_t *dst = &c->pixels[(uint32_t)top * c->width + x];
+    for (int32_t y = top; y < bottom; y++, dst += c->width) {
+        *dst = colour;
+    }
+    _damage_clipped(c, x, y0, x + 1, y1);
+}
+
+void gfx_draw_hline(gfx_canvas_t *c, int16_t x, int16_t y, int16_t w, uint16_t colour) {
+    _area_fill(c, x, y, (int32_t)x + w, y + 1, colour);
+}
+
+void gfx_draw_vline(gfx_canvas_t *c, int16_t x, int16_t y, int16_t h, uint16_t colour) {
+    _column(c, x, y, (int32_t)y + h, colour);
+}
+
+void gfx_fill_rect(gfx_canvas_t *c, int16_t x, int16_t y, int16_t w, int16_t h, uint16_t colour) {
+    _area_fill(c, x, y, (int32_t)x + w, (int32_t)y + h, colour);
+}
+
+void gfx_draw_rect(gfx_canvas_t *c, int16_t x, int16_t y, int16_t w, int16_t h, uint16_t colour) {
+    if (w <= 0 || h <= 0) return;
+    int32_t x1 = (int32_t)x + w, y1 = (int32_t)y + h;
+    _area_fill(c, x, y, x1, y + 1, colour);
+    _area_fill(c, x, y1 - 1, x1, y1, colour);
+    _column(c, x, y + 1, y1 - 1, colour);
+    _column(c, x1 - 1, y + 1, y1 - 1, colour);
+}
+
+/* Lines */
+
+/* Bresenham steps of a line as a function of the step number k along the major axis: the
+   minor axis has moved m(k) = ceil((k * minor - e0) / major) pixels (at least 0), where e0
+   is major / 2 and minor, major are the lengths along the two axes. Clipping works out
+   the first and last step inside the clip rectangle from this, so a clipped line has
+   exactly the pixels of the unclipped one. */
+static inline int32_t _minor_at(int32_t k, int32_t minor, int32_t major) {
+    int64_t z = (int64_t)k * minor - major / 2;
+    return z > 0 ? (int32_t)((z + major - 1) / major) : 0;
+}
+
+/* First step where the minor axis has moved at least a pixels (past the end if never) */
+static inline int32_t _first_step(int32_t a, int32_t minor, int32_t major) {
+    if (a <= 0) return 0;
+    return (int32_t)_min64(((int64_t)(a - 1) * major + major / 2) / minor + 1, major + 1);
+}
+
+/* Last step where the minor axis has moved at most b pixels */
+static inline int32_t _last_step(int32_t b, int32_t minor, int32_t major) {
+    if (b < 0) return -1;
+    return (int32_t)_min64(((int64_t)b * major + major / 2) / minor, major);
+}
+
+/* Bresenham error term before step k */
+static inline int32_t _error_at(int32_t k, int32_t m, int32_t minor, int32_t major) {
+    return (int32_t)(major / 2 - (int64_t)k * minor + (int64_t)m * major);
+}
+
+void gfx_draw_line(gfx_canvas_t *c, int16_t ax, int16_t ay, int16_t bx, int16_t by, uint16_t colour) {
+    /* Straight lines are spans */
+    if (ay == by) {
+        _area_fill(c, _min(ax, bx), ay, _max(ax, bx) + 1, ay + 1, colour);
+        return;
+    }
+    if (ax == bx) {
+        _column(c, ax, _min(ay, by), _max(ay, by) + 1, colour);
+        return;
+    }
+
+    /* Always step down the canvas */
+    int32_t x0 = ax, y0 = ay, x1 = bx, y1 = by;
+    if (y0 > y1) {
+        x0 = bx; y0 = by;
+        x1 = ax; y1 = ay;
+    }
+    int32_t dx = abs(x1 - x0);
+    int32_t dy = y1 - y0;
+    int32_t sx = x0 < x1 ? 1 : -1;
+    const gfx_rect_t *clip = &c->clip;
+
+    /* Steps along x that stay inside the clip rectangle */
+    int32_t kx0 = sx > 0 ? clip->x0 - x0 : x0 - (clip->x1 - 1);
+    int32_t kx1 = sx > 0 ? clip->x1 - 1 - x0 : x0 - clip->x0;
+
+    if (dx > dy) {
+        /* Mostly horizontal: x is the major axis and each row is a run, filled as a span */
+        int32_t k0 = _max(_max(kx0, 0), _first_step(clip->y0 - y0, dy, dx));
+        int32_t k1 = _min(_min(kx1, dx), _last_step(clip->y1 - 1 - y0, dy, dx));
+        if (k0 > k1) return;
+
+        int32_t m = _minor_at(k0, dy, dx);
+        int32_t err = _error_at(k0, m, dy, dx);
+        int32_t x = x0 + sx * k0;
+        int32_t x_end = x0 + sx * k1;
+        uint16_t *row = &c->pixels[(uint32_t)(y0 + m) * c->width];
+        int32_t run = x;
+        _damage(c, _min(x, x_end), y0 + m, _max(x, x_end) + 1, y0 + _minor_at(k1, dy, dx) + 1);
+
+        for (;; x += sx) {
+            bool last = x == x_end;
+            err -= dy;
+            if (err < 0 || last) {
+                _fill(&row[_min(run, x)], abs(x - run) + 1, colour);
+                if (last) break;
+                err += dx;
+                row += c->width;
+                run = x + sx;
+            }
+        }
+    } else {
+        /* Mostly vertical: y is the major axis */
+        int32_t k0 = _max(_max(clip->y0 - y0, 0), _first_step(kx0, dx, dy));
+        int32_t k1 = _min(_min(clip->y1 - 1 - y0, dy), _last_step(kx1, dx, dy));
+        if (k0 > k1) return;
+
+        int32_t m = _minor_at(k0, dx, dy);
+        int32_t err = _error_at(k0, m, dx, dy);
+        int32_t x = x0 + sx * m;
+        int32_t x_end = x0 + sx * _minor_at(k1, dx, dy);
+        int32_t y = y0 + k0;
+        uint16_t *dst = &c->pixels[(uint32_t)y * c->width];
+        _damage(c, _min(x, x_end), y, _max(x, x_end) + 1, y0 + k1 + 1);
+
+        for (int32_t n = k1 - k0; n >= 0; n--, dst += c->width) {
+            dst[x] = colour;
+            err -= dx;
+            if (err < 0) {
+                err += dy;
+                x += sx;
+            }
+        }
+    }
+}
+
+/* Circles and ellipses */
+
+void gfx_draw_circle(gfx_canvas_t *c, int16_t cx, int16_t cy, int16_t r, uint16_t colour) {
+    if (r < 0) return;
+
+    /* Midpoint circle, one octant mirrored eight ways */
+    int32_t x = r, y = 0, err = 1 - r;
+    while (x >= y) {
+        _plot(c, cx + x, cy + y, colour);
+        _plot(c, cx - x, cy + y, colour);
+        _plot(c, cx + x, cy - y, colour);
+        _plot(c, cx - x, cy - y, colour);
+        _plot(c, cx + y, cy + x, colour);
+        _plot(c, cx - y, cy + x, colour);
+        _plot(c, cx + y, cy - x, colour);
+        _plot(c, cx - y, cy - x, colour);
+        y++;
+        if (err < 0) {
+            err += 2 * y + 1;
+        } else {
+            x--;
+            err += 2 * (y - x) + 1;
+        }
+    }
+    _damage_clipped(c, (int32_t)cx - r, (int32_t)cy - r, (int32_t)cx + r + 1, (int32_t)cy + r + 1);
+}
+
+void gfx_fill_circle(gfx_canvas_t *c, int16_t cx, int16_t cy, int16_t r, uint16_t colour) {
+    if (r < 0) return;
+
+    /* Same points as gfx_draw_circle: rows cy +/- y are as wide as x, and rows cy +/- x are
+       drawn once, as wide as the last y before x moves in */
+    int32_t x = r, y = 0, err = 1 - r;
+    while (x >= y) {
+        _span(c, cx - x, cx + x + 1, cy + y, colour);
+        if (y) _span(c, cx - x, cx + x + 1, cy - y, colour);
+        if (err >= 0 && x > y) {
+            _span(c, cx - y, cx + y + 1, cy + x, colour);
+            _span(c, cx - y, cx + y + 1, cy - x, colour);
+        }
+        y++;
+        if (err < 0) {
+            err += 2 * y + 1;
+        } else {
+            x--;
+            err += 2 * (y - x) + 1;
+        }
+    }
+    _damage_clipped(c, (int32_t)cx - r, (int32_t)cy - r, (int32_t)cx + r + 1, (int32_t)cy + r + 1);
+}
+
+/* Midpoint ellipse in two regions (shallow, then steep), each point mirrored four ways. For
+   a fill, the widest point of each row is kept until the row changes and then drawn as spans. */
+static void _ellipse(gfx_canvas_t *c, int32_t cx, int32_t cy, int32_t rx, int32_t ry, uint16_t colour, bool fill) {
+    if (rx < 0 || ry < 0) return;
+    if (rx == 0 || ry == 0) {
+        _area_fill(c, cx - rx, cy - ry, cx + rx + 1, cy + ry + 1, colour);
+        return;
+    }
+
+    int64_t rx2 = (int64_t)rx * rx;
+    int64_t ry2 = (int64_t)ry * ry;
+    int32_t x = 0, y = ry;
+    int64_t px = 0, py = 2 * rx2 * y;
+    int32_t row = ry, width = 0;  /* pending span of a fill */
+    int region = 1;
+    int64_t p = ry2 - rx2 * ry + rx2 / 4;
+
+    while (y >= 0) {
+        if (y == 0 && x < rx) {
+            /* Very flat ellipses reach the middle row before x reaches rx: finish the row */
+            if (!fill) {
+                _span(c, cx + x, cx + rx + 1, cy, colour);
+                _span(c, cx - rx, cx - x + 1, cy, colour);
+            }
+            x = rx;
+        }
+
+        if (fill) {
+            if (y != row) {
+                _span(c, cx - width, cx + width + 1, cy + row, colour);
+                if (row) _span(c, cx - width, cx + width + 1, cy - row, colour);
+                row = y;
+            }
+            width = x;
+        } else {
+            _plot(c, cx + x, cy + y, colour);
+            _plot(c, cx - x, cy + y, colour);
+            _plot(c, cx + x, cy - y, colour);
+            _plot(c, cx - x, cy - y, colour);
+        }
+        if (y == 0) break;
+
+        if (region == 1 && px >= py) {
+            /* Steep from here on: decide at the midpoint between two columns */
+            region = 2;
+            p = ry2 * ((int64_t)x * x + x) + ry2 / 4 + rx2 * ((int64_t)(y - 1) * (y - 1)) - rx2 * ry2;
+        }
+
+        if (region == 1) {
+            x++;
+            px += 2 * ry2;
+            if (p < 0) {
+                p += ry2 + px;
+            } else {
+                y--;
+                py -= 2 * rx2;
+                p += ry2 + px - py;
+            }
+        } else {
+            y--;
+            py -= 2 * rx2;
+            if (p > 0) {
+                p += rx2 - py;
+            } else {
+                x++;
+                px += 2 * ry2;
+                p += rx2 - py + px;
+            }
+        }
+    }
+    if (fill) {
+        _span(c, cx - width, cx + width + 1, cy + row, colour);
+        if (row) _span(c, cx - width, cx + width + 1, cy - row, colour);
+    }
+    _damage_clipped(c, cx - rx, cy - ry, cx + rx + 1, cy + ry + 1);
+}
+
+void gfx_draw_ellipse(gfx_canvas_t *c, int16_t cx, int16_t cy, int16_t rx, int16_t ry, uint16_t colour) {
+    _ellipse(c, cx, cy, rx, ry, colour, false);
+}
+
+void gfx_fill_ellipse(gfx_canvas_t *c, int16_t cx, int16_t cy, int16_t rx, int16_t ry, uint16_t colour) {
+    _ellipse(c, cx, cy, rx, ry, colour, true);
+}
+
+/* Polygons */
+
+void gfx_draw_polygon(gfx_canvas_t *c, const gfx_point_t *points, int count, uint16_t colour) {
+    for (int i = 0; i < count; i++) {
+        const gfx_point_t *a = &points[i];
+        const gfx_point_t *b = &points[(i + 1) % count];
+        gfx_draw_line(c, a->x, a->y, b->x, b->y, colour);
+    }
+}
+
+/* Floor of a / b for b > 0 */
+static inline int64_t _floor_div(int64_t a, int64_t b) {
+    return a >= 0 ? a / b : -((-a + b - 1) / b);
+}
+
+/* Scanline fill with an edge table: edges are sorted by their first row and join the active
+   list as the scan reaches them; on each row the active edges, sorted by x, are paired up
+   into spans. A pixel is filled if its centre is inside the polygon. */
+void gfx_fill_polygon(gfx_canvas_t *c, const gfx_point_t *points, int count, uint16_t colour) {
+    if (count < 3 || count > GFX_DRAW_MAX_POINTS) return;
+
+    /* Edge table, skipping horizontal edges */
+    int edge_count = 0;
+    int32_t y_min = INT16_MAX, y_max = INT16_MIN, x_min = INT16_MAX, x_max = INT16_MIN;
+    for (int i = 0; i < count; i++) {
+        const gfx_point_t *a = &points[i];
+        const gfx_point_t *b = &points[(i + 1) % count];
+        x_min = _min(x_min, a->x);
+        x_max = _max(x_max, a->x);
+        if (a->y == b->y) continue;
+        if (a->y > b->y) {
+            const gfx_point_t *t = a; a = b; b = t;
+        }
+
+        edge_t e;
+        e.dx = b->x - a->x;
+        e.den = 2 * (b->y - a->y);
+        e.step = (int32_t)_floor_div(2 * e.dx, e.den);
+        e.step_rem = 2 * e.dx - e.step * e.den;
+        e.x_top = a->x;
+        e.y_top = a->y;
+        e.y_bottom = b->y;
+        y_min = _min(y_min, a->y);
+        y_max = _max(y_max, b->y);
+
+        /* Insertion sort by first row */
+        int j = edge_count++;
+        while (j > 0 && edges[j - 1].y_top > e.y_top) {
+            edges[j] = edges[j - 1];
+            j--;
+        }
+        edges[j] = e;
+    }
+    if (edge_count == 0) return;
+
+    int32_t y0 = _max(y_min, c->clip.y0);
+    int32_t y1 = _min(y_max, c->clip.y1);
+    int next = 0;
+    int active_count = 0;
+    for (int32_t y = y0; y < y1; y++) {
+        /* Edges reaching this row join, part way down if the top was clipped. The crossing
+           less half a pixel is (2 * x_top - 1) / 2 + (2 * (y - y_top) + 1) * dx / den. */
+        while (next < edge_count && edges[next].y_top <= y) {
+            edge_t *e = &edges[next];
+            if (e->y_bottom > y) {
+                int64_t n = (int64_t)(2 * e->x_top - 1) * (e->den / 2) + (int64_t)(2 * (y - e->y_top) + 1) * e->dx;
+                e->x = (int32_t)-_floor_div(-n, e->den);
+                e->rem = (int32_t)((int64_t)e->x * e->den - n);
+                active[active_count++] = next;
+            }
+            next++;
+        }
+
+        /* Drop finished edges, keep the rest sorted by x (it changes little between rows) */
+        int n = 0;
+        for (int i = 0; i < active_count; i++) {
+            if (edges[active[i]].y_bottom > y) active[n++] = active[i];
+        }
+        active_count = n;
+        for (int i = 1; i < active_count; i++) {
+            uint8_t k = active[i];
+            int j = i;
+            while (j > 0 && edges[active[j - 1]].x > edges[k].x) {
+                active[j] = active[j - 1];
+                j--;
+            }
+            active[j] = k;
+        }
+
+        /* Pixels whose centres lie between a pair of crossings */
+        for (int i = 0; i + 1 < active_count; i += 2) {
+            _span(c, edges[active[i]].x, edges[active[i + 1]].x, y, colour);
+        }
+
+        for (int i = 0; i < active_count; i++) {
+            edge_t *e = &edges[active[i]];
+            e->x += e->step;
+            e->rem -= e->step_rem;
+            if (e->rem < 0) {
+                e->rem += e->den;
+                e->x++;
+            }
+        }
+    }
+    _damage_clipped(c, x_min, y_min, x_max + 1, y_max);
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+  Vector drawing for plots, charts and UI widgets
+  - Lines, rectangles, circles, ellipses and filled polygons drawn into a canvas: any RGB565
+    buffer, such as a full-screen frame leased from the scratch memory
+  - Everything is clipped to the canvas and to its clip rectangle, so coordinates can be
+    anywhere in the int16_t range
+  - Horizontal runs of pixels are written a 32-bit word (two pixels) at a time
+  - Every primitive adds the area it changed to the damage list of the canvas, and
+    gfx_canvas_flush() sends only those areas to the LCD
+*/
+
+/* Damage rectangles kept per canvas; further areas are merged into them */
+#ifndef GFX_DRAW_MAX_DAMAGE
+#define GFX_DRAW_MAX_DAMAGE 8
+#endif
+
+/* Most corners of a filled polygon */
+#ifndef GFX_DRAW_MAX_POINTS
+#define GFX_DRAW_MAX_POINTS 64
+#endif
+
+/* Rectangle from (x0, y0) up to but not including (x1, y1) */
+typedef struct {
+    int16_t x0, y0;
+    int16_t x1, y1;
+} gfx_rect_t;
+
+typedef struct {
+    int16_t x, y;
+} gfx_point_t;
+
+/* A buffer to draw into */
+typedef struct {
+    uint16_t *pixels;      /* width x height RGB565 pixels, row by row */
+    uint16_t width, height;
+    gfx_rect_t clip;       /* drawing is limited to this part of the canvas */
+    gfx_rect_t damage[GFX_DRAW_MAX_DAMAGE]; /* areas changed since the last flush */
+    uint8_t damage_count;
+} gfx_canvas_t;
+
+/* Set up a canvas over a buffer, with no clipping beyond its edges and no damage */
+void gfx_canvas_init(gfx_canvas_t *canvas, uint16_t *pixels, uint16_t width, uint16_t height);
+
+/* Limit drawing to a rectangle (kept within the canvas), or NULL for the whole canvas */
+void gfx_canvas_set_clip(gfx_canvas_t *canvas, const gfx_rect_t *clip);
+
+/* Fill the clip rectangle with one colour */
+void gfx_canvas_clear(gfx_canvas_t *canvas, uint16_t colour);
+
+/* Add an area changed by other means to the damage list */
+void gfx_canvas_damage(gfx_canvas_t *canvas, int16_t x0, int16_t y0, int16_t x1, int16_t y1);
+
+/* Send the damaged areas to the LCD, with the canvas at screen position (x, y), and empty
+   the damage list. Returns once they are sent, so the canvas can be drawn on straight away. */
+void gfx_canvas_flush(gfx_canvas_t *canvas, uint16_t x, uint16_t y);
+
+/* Primitives (colours are RGB565) */
+void gfx_draw_pixel(gfx_canvas_t *canvas, int16_t x, int16_t y, uint16_t colour);
+void gfx_draw_hline(gfx_canvas_t *canvas, int16_t x, int16_t y, int16_t w, uint16_t colour);
+void gfx_draw_vline(gfx_canvas_t *canvas, int16_t x, int16_t y, int16_t h, uint16_t colour);
+void gfx_draw_line(gfx_canvas_t *canvas, int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t colour);
+void gfx_draw_rect(gfx_canvas_t *canvas, int16_t x, int16_t y, int16_t w, int16_t h, uint16_t colour);
+void gfx_fill_rect(gfx_canvas_t *canvas, int16_t x, int16_t y, int16_t w, int16_t h, uint16_t colour);
+void gfx_draw_circle(gfx_canvas_t *canvas, int16_t cx, int16_t cy, int16_t r, uint16_t colour);
+void gfx_fill_circle(gfx_canvas_t *canvas, int16_t cx, int16_t cy, int16_t r, uint16_t colour);
+void gfx_draw_ellipse(gfx_canvas_t *canvas, int16_t cx, int16_t cy, int16_t rx, int16_t ry, uint16_t colour);
+void gfx_fill_ellipse(gfx_canvas_t *canvas, int16_t cx, int16_t cy, int16_t rx, int16_t ry, uint16_t colour);
+
+/* Polygons: the outline joins the last point back to the first. Filling uses the even-odd
+   rule, so concave and self-crossing polygons work; up to GFX_DRAW_MAX_POINTS points. */
+void gfx_draw_polygon(gfx_canvas_t *canvas, const gfx_point_t *points, int count, uint16_t colour);
+void gfx_fill_polygon(gfx_canvas_t *canvas, const gfx_point_t *points, int count, uint16_t colour);
@@ -0,0 +1,89 @@
+#include "gfx_game.h"
+#include "gfx_core.h"
+#include "pico/time.h"
+#include <string.h>
+
+/* Fixed-timestep loop
+
+   Core 1 publishes with each frame the time at which it will take the commands for the
+   next one. Those times are exact multiples of the frame period, so adding their
+   differences to the accumulator gives the same number of updates every frame, where
+   measuring the time core 0 woke up would jitter between one and two. */
+
+static gfx_game_stats_t stats;
+
+static void _frame_done(uint64_t start_us, const gfx_core_frame_t *frame) {
+    uint64_t done_us = time_us_64();
+    uint32_t update_us = (uint32_t)(done_us - start_us);
+    int32_t slack_us = (int32_t)((int64_t)frame->next_us - (int64_t)done_us);
+
+    stats.frames++;
+    stats.update_us_total += update_us;
+    if (update_us > stats.update_us_max) {
+        stats.update_us_max = update_us;
+    }
+    stats.slack_us_total += slack_us;
+    if (slack_us < stats.slack_us_min) {
+        stats.slack_us_min = slack_us;
+    }
+    if (slack_us < 0) {
+        stats.late_frames++;
+    }
+}
+
+bool gfx_game_run(gfx_game_update_t update, uint32_t fps) {
+    if (update == NULL || fps == 0 || fps > 1000000) {
+        return false;
+    }
+    uint32_t step_us = 1000000 / fps;
+
+    memset(&stats, 0, sizeof(stats));
+    stats.slack_us_min = INT32_MAX;
+
+    /* Start on a fresh frame, not one sent before the loop began */
+    gfx_core_frame_t frame;
+    gfx_core_clear_frame();
+    if (!gfx_core_wait_frame(&frame)) {
+        return false;
+    }
+
+    uint32_t accumulator = step_us;  /* the first frame gets an update */
+    gfx_core_batch_begin();
+    bool running = true;
+    while (running) {
+        uint64_t start_us = time_us_64();
+
+        int steps = 0;
+        while (running && accumulator >= step_us) {
+            if (steps == GFX_GAME_MAX_STEPS) {
+                stats.dropped_updates += accumulator / step_us;
+                accumulator %= step_us;
+                break;
+            }
+            running = update();
+            stats.updates++;
+            steps++;
+            accumulator -= step_us;
+        }
+
+        /* Everything this frame changed goes to core 1 at once */
+        gfx_core_batch_commit();
+        _frame_done(start_us, &frame);
+        if (!running) {
+            break;
+        }
+
+        gfx_core_frame_t last = frame;
+        if (!gfx_core_wait_frame(&frame)) {
+            break;
+        }
+        stats.skipped_frames += frame.count - last.count - 1;
+        accumulator += (uint32_t)(frame.next_us - last.next_us);
+    }
+    gfx_core_batch_end();
+    return true;
+}
+
+void gfx_game_get_stats(gfx_game_stats_t *out) {
+    *out = stats;
+}
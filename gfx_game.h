@@ -0,0 +1,44 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+  Game loop for the gfx module
+  - gfx_game_run() calls the game's update function at a fixed rate, locked to the frames
+    core 1 sends to the LCD: core 0 sleeps until core 1 rings the frame doorbell, runs the
+    updates that are due, and goes back to sleep
+  - Time is counted in whole frames, so at 60 updates per second each frame gets exactly
+    one update; at 30 every other frame gets one, and at 120 every frame gets two
+  - Everything an update changes (sprites, tiles, particles...) is sent to core 1 as one
+    batch, which core 1 applies just before drawing the next frame
+  - The time spent on updates and the slack left before core 1 takes the batch are kept
+    for gfx_game_get_stats()
+*/
+
+/* Most updates run for one frame; after a longer stall the rest are dropped */
+#ifndef GFX_GAME_MAX_STEPS
+#define GFX_GAME_MAX_STEPS 4
+#endif
+
+/* Called once per step; return false to leave the loop */
+typedef bool (*gfx_game_update_t)(void);
+
+typedef struct {
+    uint32_t frames;           /* frames the loop ran for */
+    uint32_t updates;          /* calls of update */
+    uint32_t skipped_frames;   /* frames sent while core 0 was still busy with an earlier one */
+    uint32_t late_frames;      /* frames whose batch missed them and showed a frame later */
+    uint32_t dropped_updates;  /* updates left out after a stall */
+    uint32_t update_us_max;    /* longest time spent on one frame's updates */
+    uint64_t update_us_total;
+    int32_t slack_us_min;      /* least time left before core 1 took a batch (negative if late) */
+    int64_t slack_us_total;
+} gfx_game_stats_t;
+
+/* Run update fps times a second until it returns false. Rendering must have been
+   started (gfx_core_start_rendering). Returns false if it was not, or fps is 0. */
+bool gfx_game_run(gfx_game_update_t update, uint32_t fps);
+
+/* Statistics of the last (or current) gfx_game_run */
+void gfx_game_get_stats(gfx_game_stats_t *stats);
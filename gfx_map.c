@@ -0,0 +1,380 @@
+#include "gfx_map.h"
+#include "gfx.h"
+#include "gfx_core.h"
+#include "drivers/fat32.h"
+#include "drivers/memstat.h"
+#include <string.h>
+
+/* Chunked tile maps (v2 map files)
+
+   File layout (little-endian, see docs/gfx_map.md):
+   - 32-byte header: "JOBMAP", version, chunk size, map size, tile size, layer and object counts
+   - 32-byte layer descriptions
+   - 32-byte object records
+   - chunk index, starting on a 512-byte sector: 8 bytes per chunk for each tile layer
+   - chunk data, starting on a sector; a chunk never crosses a sector unless it is
+     larger than one, so a chunk costs one index read and one data read
+
+   Chunks are decoded into a small cache. Moving the camera by a few tiles only
+   reads the chunks that scroll into view; everything else stays on the card.
+*/
+
+#define MAP_SECTOR_SIZE 512
+#define MAP_CHUNK_TILES (GFX_MAP_CHUNK * GFX_MAP_CHUNK)
+#define MAP_CHUNK_BYTES (MAP_CHUNK_TILES * sizeof(uint16_t))
+
+/* Chunk codecs */
+#define MAP_CODEC_RAW   0
+#define MAP_CODEC_RLE   1
+#define MAP_CODEC_EMPTY 2
+
+typedef struct {
+    char magic[6];
+    uint8_t version;
+    uint8_t chunk_size;
+    uint16_t width;
+    uint16_t height;
+    uint8_t tile_w;
+    uint8_t tile_h;
+    uint16_t bitmap_start_id;
+    uint16_t layer_count;
+    uint16_t object_count;
+    uint16_t chunks_x;
+    uint16_t chunks_y;
+    uint8_t reserved[8];
+} __attribute__((packed)) map_header_t;
+
+typedef struct {
+    char name[GFX_MAP_NAME_LEN];
+    uint8_t type;
+    uint8_t reserved1;
+    uint16_t reserved2;
+    uint32_t offset;
+    uint32_t count;
+    uint32_t reserved3;
+} __attribute__((packed)) map_layer_record_t;
+
+typedef struct {
+    int32_t x;
+    int32_t y;
+    uint16_t w;
+    uint16_t h;
+    uint16_t id;
+    uint16_t tile;
+    uint8_t layer;
+    uint8_t solid;
+    uint16_t reserved;
+    char type[GFX_MAP_TYPE_LEN];
+} __attribute__((packed)) map_object_record_t;
+
+typedef struct {
+    uint32_t offset;
+    uint16_t size;
+    uint8_t codec;
+    uint8_t reserved;
+} __attribute__((packed)) map_index_entry_t;
+
+/* A decoded chunk */
+typedef struct {
+    bool valid;
+    uint8_t layer;
+    uint16_t cx;
+    uint16_t cy;
+    uint32_t last_used;     /* for least-recently-used replacement */
+    uint16_t tiles[MAP_CHUNK_TILES];
+} map_chunk_t;
+
+static fat32_file_t map_file;
+static bool map_open = false;
+static map_header_t header;
+static gfx_map_layer_t layers[GFX_MAP_MAX_LAYERS];
+static int layer_count = 0;
+
+static map_chunk_t cache[GFX_MAP_CACHE_CHUNKS];
+static uint32_t use_clock = 0;
+static uint32_t cache_hits = 0;
+static uint32_t cache_misses = 0;
+
+/* Tiles last sent to the graphics core, so camera moves only send changes */
+static uint16_t view[GFX_TILEMAP_SIZE];
+static bool view_valid = false;
+static int view_layer = -1;
+
+/* Read size bytes at a file offset */
+static bool _read_at(uint32_t offset, void *buffer, size_t size) {
+    size_t bytes_read = 0;
+    if (fat32_seek(&map_file, offset) != FAT32_OK) return false;
+    if (fat32_read(&map_file, buffer, size, &bytes_read) != FAT32_OK) return false;
+    return bytes_read == size;
+}
+
+/* Expand an RLE chunk: control byte n, then either one value repeated (n & 0x7F) + 1
+   times (bit 7 set) or n + 1 literal values */
+static bool _rle_decode(const uint8_t *src, uint16_t size, uint16_t *dst) {
+    uint32_t in = 0;
+    uint32_t out = 0;
+
+    while (in < size) {
+        uint8_t n = src[in++];
+        uint32_t count = (n & 0x7F) + 1;
+        if (out + count > MAP_CHUNK_TILES) return false;
+
+        if (n & 0x80) {
+            if (in + 2 > size) return false;
+            uint16_t value = (uint16_t)(src[in] | (src[in + 1] << 8));
+            in += 2;
+            while (count--) dst[out++] = value;
+        } else {
+            if (in + count * 2 > size) return false;
+            memcpy(&dst[out], &src[in], count * 2);
+            in += count * 2;
+            out += count;
+        }
+    }
+    return out == MAP_CHUNK_TILES;
+}
+
+/* Read and decode one chunk into a cache slot */
+static bool _load_chunk(map_chunk_t *chunk, int layer, uint16_t cx, uint16_t cy) {
+    map_index_entry_t entry;
+    uint32_t index = (uint32_t)cy * header.chunks_x + cx;
+
+    chunk->valid = false;
+    if (!_read_at(layers[layer].offset + index * sizeof(entry), &entry, sizeof(entry))) return false;
+
+    switch (entry.codec) {
+    case MAP_CODEC_EMPTY:
+        for (uint32_t i = 0; i < MAP_CHUNK_TILES; i++) chunk->tiles[i] = UINT16_MAX;
+        break;
+    case MAP_CODEC_RAW:
+        if (entry.size != MAP_CHUNK_BYTES) return false;
+        if (!_read_at(entry.offset, chunk->tiles, MAP_CHUNK_BYTES)) return false;
+        break;
+    case MAP_CODEC_RLE: {
+        /* Decode straight out of the file system's sector cache, with no copy */
+        const void *packed;
+        if (entry.size == 0 || entry.size > MAP_CHUNK_BYTES) return false;
+        if (fat32_map(&map_file, entry.offset, entry.size, &packed) != FAT32_OK) return false;
+        bool decoded = _rle_decode(packed, entry.size, chunk->tiles);
+        fat32_unmap(packed);
+        if (!decoded) return false;
+        break;
+    }
+    default:
+        return false;
+    }
+
+    chunk->layer = (uint8_t)layer;
+    chunk->cx = cx;
+    chunk->cy = cy;
+    chunk->valid = true;
+    return true;
+}
+
+/* Find a decoded chunk, reading it (over the least recently used one) if needed */
+static const map_chunk_t *_get_chunk(int layer, uint16_t cx, uint16_t cy) {
+    map_chunk_t *victim = &cache[0];
+
+    use_clock++;
+    for (int i = 0; i < GFX_MAP_CACHE_CHUNKS; i++) {
+        map_chunk_t *c = &cache[i];
+        if (c->valid && c->layer == layer && c->cx == cx && c->cy == cy) {
+            c->last_used = use_clock;
+            cache_hits++;
+            return c;
+        }
+        if (victim->valid && (!c->valid || c->last_used < victim->last_used)) {
+            victim = c;
+        }
+    }
+
+    cache_misses++;
+    if (!_load_chunk(victim, layer, cx, cy)) return NULL;
+    victim->last_used = use_clock;
+    return victim;
+}
+
+static bool _is_tile_layer(int layer) {
+    return map_open && layer >= 0 && layer < layer_count && layers[layer].type != GFX_MAP_LAYER_OBJECTS;
+}
+
+/* Open a map file */
+bool gfx_map_open(const char *path) {
+    map_layer_record_t record;
+
+    gfx_map_close();
+    if (fat32_open(&map_file, path) != FAT32_OK) return false;
+    map_open = true;
+
+    if (!_read_at(0, &header, sizeof(header)) ||
+        memcmp(header.magic, "JOBMAP", sizeof(header.magic)) != 0 ||
+        header.version != 2 || header.chunk_size != GFX_MAP_CHUNK ||
+        header.layer_count > GFX_MAP_MAX_LAYERS) {
+        gfx_map_close();
+        return false;
+    }
+
+    for (int i = 0; i < header.layer_count; i++) {
+        if (!_read_at(sizeof(header) + i * sizeof(record), &record, sizeof(record))) {
+            gfx_map_close();
+            return false;
+        }
+        memcpy(layers[i].name, record.name, GFX_MAP_NAME_LEN);
+        layers[i].name[GFX_MAP_NAME_LEN] = '\0';
+        layers[i].type = (gfx_map_layer_type_t)record.type;
+        layers[i].offset = record.offset;
+        layers[i].count = record.count;
+    }
+    layer_count = header.layer_count;
+    return true;
+}
+
+/* Close the map file */
+void gfx_map_close(void) {
+    if (map_open) {
+        fat32_close(&map_file);
+        map_open = false;
+    }
+    memset(&header, 0, sizeof(header));
+    layer_count = 0;
+    for (int i = 0; i < GFX_MAP_CACHE_CHUNKS; i++) cache[i].valid = false;
+    use_clock = 0;
+    cache_hits = 0;
+    cache_misses = 0;
+    view_valid = false;
+    view_layer = -1;
+}
+
+uint16_t gfx_map_width(void) {
+    return header.width;
+}
+
+uint16_t gfx_map_height(void) {
+    return header.height;
+}
+
+int gfx_map_layer_count(void) {
+    return layer_count;
+}
+
+bool gfx_map_get_layer(int layer, gfx_map_layer_t *info) {
+    if (!map_open || layer < 0 || layer >= layer_count) return false;
+    *info = layers[layer];
+    return true;
+}
+
+int gfx_map_find_layer(const char *name) {
+    for (int i = 0; i < layer_count; i++) {
+        if (strcmp(layers[i].name, name) == 0) return i;
+    }
+    return -1;
+}
+
+/* Tile at map coordinates in a tile or collision layer */
+uint16_t gfx_map_get_tile(int layer, int32_t x, int32_t y) {
+    if (!_is_tile_layer(layer)) return UINT16_MAX;
+    if (x < 0 || y < 0 || x >= header.width || y >= header.height) return UINT16_MAX;
+
+    const map_chunk_t *chunk = _get_chunk(layer, x / GFX_MAP_CHUNK, y / GFX_MAP_CHUNK);
+    if (!chunk) return UINT16_MAX;
+    return chunk->tiles[(y % GFX_MAP_CHUNK) * GFX_MAP_CHUNK + (x % GFX_MAP_CHUNK)];
+}
+
+/* True if any collision layer has a tile at x,y */
+bool gfx_map_is_solid(int32_t x, int32_t y) {
+    if (x < 0 || y < 0 || x >= header.width || y >= header.height) return true;
+
+    for (int i = 0; i < layer_count; i++) {
+        if (layers[i].type == GFX_MAP_LAYER_COLLISION && gfx_map_get_tile(i, x, y) != UINT16_MAX) {
+            return true;
+        }
+    }
+    return false;
+}
+
+uint16_t gfx_map_object_count(void) {
+    return header.object_count;
+}
+
+/* Objects are read from the card on demand */
+bool gfx_map_get_object(uint16_t index, gfx_map_object_t *obj) {
+    map_object_record_t record;
+    uint32_t offset = sizeof(header) + layer_count * sizeof(map_layer_record_t) + index * sizeof(record);
+
+    if (!map_open || index >= header.object_count) return false;
+    if (!_read_at(offset, &record, sizeof(record))) return false;
+
+    obj->x = record.x;
+    obj->y = record.y;
+    obj->w = record.w;
+    obj->h = record.h;
+    obj->id = record.id;
+    obj->tile = record.tile;
+    obj->layer = record.layer;
+    obj->solid = record.solid != 0;
+    memcpy(obj->type, record.type, GFX_MAP_TYPE_LEN);
+    obj->type[GFX_MAP_TYPE_LEN] = '\0';
+    return true;
+}
+
+/* Show the part of a layer whose top-left tile is at tx,ty */
+bool gfx_map_set_camera(int layer, int32_t tx, int32_t ty) {
+    bool ok = true;
+
+    if (!_is_tile_layer(layer)) return false;
+    if (layer != view_layer) {
+        view_valid = false;
+        view_layer = layer;
+    }
+
+    /* Walk the window a chunk at a time so each chunk is looked up once */
+    for (int32_t y0 = ty; y0 < ty + GFX_TILES_Y; ) {
+        int32_t y1 = (y0 < 0) ? y0 + 1 : (y0 / GFX_MAP_CHUNK + 1) * GFX_MAP_CHUNK;
+        if (y1 > ty + GFX_TILES_Y) y1 = ty + GFX_TILES_Y;
+
+        for (int32_t x0 = tx; x0 < tx + GFX_TILES_X; ) {
+            int32_t x1 = (x0 < 0) ? x0 + 1 : (x0 / GFX_MAP_CHUNK + 1) * GFX_MAP_CHUNK;
+            if (x1 > tx + GFX_TILES_X) x1 = tx + GFX_TILES_X;
+
+            const map_chunk_t *chunk = NULL;
+            bool inside = x0 >= 0 && y0 >= 0 && x0 < header.width && y0 < header.height;
+            if (inside) {
+                chunk = _get_chunk(layer, x0 / GFX_MAP_CHUNK, y0 / GFX_MAP_CHUNK);
+                if (!chunk) ok = false;
+            }
+
+            for (int32_t y = y0; y < y1; y++) {
+                for (int32_t x = x0; x < x1; x++) {
+                    uint16_t tile = UINT16_MAX;
+                    if (chunk && x < header.width && y < header.height) {
+                        tile = chunk->tiles[(y % GFX_MAP_CHUNK) * GFX_MAP_CHUNK + (x % GFX_MAP_CHUNK)];
+                    }
+
+                    uint16_t sx = (uint16_t)(x - tx);
+                    uint16_t sy = (uint16_t)(y - ty);
+                    uint16_t *shown = &view[sy * GFX_TILES_X + sx];
+                    if (!view_valid || *shown != tile) {
+                        *shown = tile;
+                        gfx_core_gfx_set_tile(sx, sy, tile);
+                    }
+                }
+            }
+            x0 = x1;
+        }
+        y0 = y1;
+    }
+
+    /* After a read error the shown tiles are not the map's, so send them all next time */
+    view_valid = ok;
+    return ok;
+}
+
+void gfx_map_get_stats(uint32_t *hits, uint32_t *misses) {
+    *hits = cache_hits;
+    *misses = cache_misses;
+}
+
+/* Register the static buffers with the memory statistics module */
+void gfx_map_register_memory(void) {
+    mem_register_static("gfx map cache", sizeof(cache) + sizeof(view));
+}
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+  Chunked tile maps for the gfx module
+  - Reads the v2 map files written by tools/tmx_to_bin_map.py from the SD card
+  - Maps are split into 16x16-tile chunks; only the chunks under the camera are read
+    and decoded, into a small cache of recently used chunks
+  - Tile values are tilesheet indexes; UINT16_MAX is a blank tile (as in gfx_set_tile)
+  - Call from core 0 (the SD card is used from core 0); the visible window is sent to
+    core 1 with gfx_core_gfx_set_tile()
+*/
+
+/* Chunk size in tiles (fixed by the file format) */
+#define GFX_MAP_CHUNK 16
+
+/* Decoded chunks kept in memory (a 20x20-tile screen touches at most 3x3 chunks) */
+#ifndef GFX_MAP_CACHE_CHUNKS
+#define GFX_MAP_CACHE_CHUNKS 12
+#endif
+
+/* Max number of layers (tile, collision and object layers) */
+#ifndef GFX_MAP_MAX_LAYERS
+#define GFX_MAP_MAX_LAYERS 8
+#endif
+
+#define GFX_MAP_NAME_LEN 16
+#define GFX_MAP_TYPE_LEN 12
+
+/* Layer types */
+typedef enum {
+    GFX_MAP_LAYER_TILES = 0,      /* tiles to draw */
+    GFX_MAP_LAYER_COLLISION = 1,  /* non-blank tiles are solid */
+    GFX_MAP_LAYER_OBJECTS = 2,    /* object records */
+} gfx_map_layer_type_t;
+
+/* Layer description */
+typedef struct {
+    char name[GFX_MAP_NAME_LEN + 1];
+    gfx_map_layer_type_t type;
+    uint32_t offset;    /* file offset of the chunk index or of the first object */
+    uint32_t count;     /* number of chunks or objects */
+} gfx_map_layer_t;
+
+/* Object from an object layer (coordinates in pixels) */
+typedef struct {
+    int32_t x;
+    int32_t y;
+    uint16_t w;
+    uint16_t h;
+    uint16_t id;        /* object id in Tiled */
+    uint16_t tile;      /* tile index for tile objects, UINT16_MAX otherwise */
+    uint8_t layer;      /* index of the object layer */
+    bool solid;         /* from a collision object layer or object */
+    char type[GFX_MAP_TYPE_LEN + 1];
+} gfx_map_object_t;
+
+/* Open a map file, returns false if it cannot be read or is not a v2 map */
+bool gfx_map_open(const char *path);
+
+/* Close the map file and drop the decoded chunks */
+void gfx_map_close(void);
+
+/* Map size in tiles (0 if no map is open) */
+uint16_t gfx_map_width(void);
+uint16_t gfx_map_height(void);
+
+/* Layers */
+int gfx_map_layer_count(void);
+bool gfx_map_get_layer(int layer, gfx_map_layer_t *info);
+int gfx_map_find_layer(const char *name);   /* -1 if there is no such layer */
+
+/* Tile at map coordinates x,y in a tile or collision layer (UINT16_MAX if blank or outside) */
+uint16_t gfx_map_get_tile(int layer, int32_t x, int32_t y);
+
+/* True if any collision layer has a tile at x,y (outside the map is solid) */
+bool gfx_map_is_solid(int32_t x, int32_t y);
+
+/* Objects (all object layers, in file order) */
+uint16_t gfx_map_object_count(void);
+bool gfx_map_get_object(uint16_t index, gfx_map_object_t *obj);
+
+/* Show the part of a layer whose top-left tile is at tx,ty; only tiles that changed
+   since the last call are sent to the graphics core. Returns false on a read error. */
+bool gfx_map_set_camera(int layer, int32_t tx, int32_t ty);
+
+/* Chunk cache statistics since the map was opened */
+void gfx_map_get_stats(uint32_t *hits, uint32_t *misses);
+
+/* Register the static buffers with the memory statistics module */
+void gfx_map_register_memory(void);
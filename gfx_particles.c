@@ -0,0 +1,169 @@
+#include "gfx_particles.h"
+#include "gfx.h"
+#include "drivers/memstat.h"
+
+/* Particle storage as a structure of arrays
+
+   Each field has its own array, so the update loop walks a few dense arrays with no
+   branches and the draw loop only touches what it needs. Live particles are kept at
+   the front: a dead particle is replaced by the last one, so the order changes but the
+   arrays never have holes.
+
+   Positions are signed 10.6 fixed point, enough for the screen plus a margin; particles
+   are removed before they can leave that range.
+*/
+
+#define PARTICLE_MIN_POS (-128)                   /* pixels; above or left of this a particle is dead */
+#define PARTICLE_MAX_POS (511 - GFX_PARTICLE_MAX_SPEED - GFX_PARTICLE_MAX_SIZE)
+#define PARTICLE_MAX_VELOCITY (GFX_PARTICLE_MAX_SPEED << GFX_PARTICLE_FRAC)
+
+static int16_t particle_x[GFX_MAX_PARTICLES];
+static int16_t particle_y[GFX_MAX_PARTICLES];
+static int16_t particle_vx[GFX_MAX_PARTICLES];
+static int16_t particle_vy[GFX_MAX_PARTICLES];
+static uint16_t particle_colour[GFX_MAX_PARTICLES];
+static uint16_t particle_life[GFX_MAX_PARTICLES];
+static uint8_t particle_size[GFX_MAX_PARTICLES];
+
+static int particle_count = 0;
+static int16_t gravity = 0;
+static uint32_t random_state = 0x2545F491;
+
+/* xorshift32: cheap and good enough for scattering particles */
+static inline uint32_t _random(void) {
+    uint32_t r = random_state;
+    r ^= r << 13;
+    r ^= r >> 17;
+    r ^= r << 5;
+    random_state = r;
+    return r;
+}
+
+/* Random value from -spread to +spread */
+static inline int32_t _random_spread(int32_t spread) {
+    return spread ? (int32_t)(_random() % (uint32_t)(2 * spread + 1)) - spread : 0;
+}
+
+static inline int32_t _clamp(int32_t v, int32_t lo, int32_t hi) {
+    if (v < lo) return lo;
+    if (v > hi) return hi;
+    return v;
+}
+
+int gfx_particles_emit(const gfx_particle_emitter_t *e, int count) {
+    if (count > GFX_MAX_PARTICLES - particle_count) {
+        count = GFX_MAX_PARTICLES - particle_count;
+    }
+
+    uint8_t size = (uint8_t)_clamp(e->size, 1, GFX_PARTICLE_MAX_SIZE);
+    int32_t spread = _clamp(e->spread, 0, PARTICLE_MAX_VELOCITY);
+    for (int n = 0; n < count; n++) {
+        int i = particle_count++;
+        int32_t x = e->x + (e->w ? (int32_t)(_random() % e->w) : 0);
+        int32_t y = e->y + (e->h ? (int32_t)(_random() % e->h) : 0);
+        particle_x[i] = (int16_t)(_clamp(x, PARTICLE_MIN_POS, PARTICLE_MAX_POS) * (1 << GFX_PARTICLE_FRAC));
+        particle_y[i] = (int16_t)(_clamp(y, PARTICLE_MIN_POS, PARTICLE_MAX_POS) * (1 << GFX_PARTICLE_FRAC));
+        particle_vx[i] = (int16_t)_clamp(e->vx + _random_spread(spread), -PARTICLE_MAX_VELOCITY, PARTICLE_MAX_VELOCITY);
+        particle_vy[i] = (int16_t)_clamp(e->vy + _random_spread(spread), -PARTICLE_MAX_VELOCITY, PARTICLE_MAX_VELOCITY);
+        particle_colour[i] = e->colour;
+        particle_life[i] = (uint16_t)_clamp(e->life + (e->life_spread ? _random() % (e->life_spread + 1u) : 0), 1, UINT16_MAX);
+        particle_size[i] = size;
+    }
+    return count;
+}
+
+void gfx_particles_set_gravity(int16_t g) {
+    gravity = g;
+}
+
+void gfx_particles_clear(void) {
+    particle_count = 0;
+}
+
+int gfx_particles_count(void) {
+    return particle_count;
+}
+
+/* Move every particle by one frame; particles age and die as they are drawn */
+void gfx_particles_update(void) {
+    int n = particle_count;
+    int16_t g = gravity;
+
+    for (int i = 0; i < n; i++) {
+        particle_vy[i] = (int16_t)_clamp(particle_vy[i] + g, -PARTICLE_MAX_VELOCITY, PARTICLE_MAX_VELOCITY);
+    }
+    for (int i = 0; i < n; i++) {
+        particle_x[i] += particle_vx[i];
+        particle_y[i] += particle_vy[i];
+    }
+}
+
+/* Replace particle i by the last one */
+static inline void _remove(int i) {
+    int last = --particle_count;
+    particle_x[i] = particle_x[last];
+    particle_y[i] = particle_y[last];
+    particle_vx[i] = particle_vx[last];
+    particle_vy[i] = particle_vy[last];
+    particle_colour[i] = particle_colour[last];
+    particle_life[i] = particle_life[last];
+    particle_size[i] = particle_size[last];
+}
+
+static inline void _mark_tile(uint32_t *tiles, int tx, int ty) {
+    uint32_t t = (uint32_t)ty * GFX_TILES_X + tx;
+    tiles[t >> 5] |= 1u << (t & 31);
+}
+
+void gfx_particles_draw(uint16_t *framebuffer, uint32_t *tiles) {
+    int i = 0;
+    while (i < particle_count) {
+        int x = particle_x[i] >> GFX_PARTICLE_FRAC;
+        int y = particle_y[i] >> GFX_PARTICLE_FRAC;
+        int size = particle_size[i];
+        uint16_t colour = particle_colour[i];
+
+        /* Dead: out of time, off either side, below the screen or too far above it */
+        if (particle_life[i] == 0 || x + size <= 0 || x >= (int)WIDTH || y >= (int)HEIGHT || y < PARTICLE_MIN_POS) {
+            _remove(i);
+            continue;
+        }
+        /* Counted after the test, so a particle with a life of L is drawn L times */
+        particle_life[i]--;
+        i++;
+
+        /* Above the screen, it may still fall into view */
+        if (y + size <= 0) continue;
+
+        if (size == 1) {
+            framebuffer[(uint32_t)y * WIDTH + x] = colour;
+            _mark_tile(tiles, x / GFX_TILE_W, y / GFX_TILE_H);
+            continue;
+        }
+
+        int x0 = x < 0 ? 0 : x;
+        int y0 = y < 0 ? 0 : y;
+        int x1 = x + size > (int)WIDTH ? (int)WIDTH : x + size;
+        int y1 = y + size > (int)HEIGHT ? (int)HEIGHT : y + size;
+        for (int yy = y0; yy < y1; yy++) {
+            uint16_t *dst = &framebuffer[(uint32_t)yy * WIDTH + x0];
+            for (int xx = x0; xx < x1; xx++) {
+                *dst++ = colour;
+            }
+        }
+
+        /* A particle of up to 4 pixels touches at most 2x2 tiles */
+        int tx0 = x0 / GFX_TILE_W, tx1 = (x1 - 1) / GFX_TILE_W;
+        int ty0 = y0 / GFX_TILE_H, ty1 = (y1 - 1) / GFX_TILE_H;
+        _mark_tile(tiles, tx0, ty0);
+        _mark_tile(tiles, tx1, ty0);
+        _mark_tile(tiles, tx0, ty1);
+        _mark_tile(tiles, tx1, ty1);
+    }
+}
+
+/* Register the static buffers with the memory statistics module */
+void gfx_particles_register_memory(void) {
+    mem_register_static("gfx particles", sizeof(particle_x) + sizeof(particle_y) + sizeof(particle_vx) +
+                        sizeof(particle_vy) + sizeof(particle_colour) + sizeof(particle_life) + sizeof(particle_size));
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+  Particles for the gfx module
+  - Thousands of 1-4 pixel particles (rain, sparks, explosions) drawn into the framebuffer
+    by gfx_present(), above the tiles and below the sprites
+  - Each particle has a position, velocity, colour, size and lifetime; the particle dies
+    when its lifetime runs out or it leaves the screen
+  - Positions and velocities are fixed point with GFX_PARTICLE_FRAC fraction bits, in
+    pixels and pixels per frame; GFX_PARTICLE_FIX() converts from pixels
+  - Particles live on core 1: from core 0 use gfx_core_gfx_emit_particles() and
+    gfx_core_gfx_set_particle_gravity()
+*/
+
+/* Max number of live particles (user can change before compilation) */
+#ifndef GFX_MAX_PARTICLES
+#define GFX_MAX_PARTICLES 2048
+#endif
+
+/* Fixed point: 1/64 pixel */
+#define GFX_PARTICLE_FRAC 6
+#define GFX_PARTICLE_FIX(v) ((int16_t)((v) * (1 << GFX_PARTICLE_FRAC)))
+
+/* Fastest particle, in pixels per frame (faster velocities are clamped) */
+#define GFX_PARTICLE_MAX_SPEED 64
+
+/* Largest particle, in pixels */
+#define GFX_PARTICLE_MAX_SIZE 4
+
+/* Where and how particles are born */
+typedef struct {
+    int16_t x, y;        /* top-left corner of the area particles start in (pixels) */
+    uint16_t w, h;       /* size of that area (0 for a point) */
+    int16_t vx, vy;      /* velocity (fixed point pixels per frame) */
+    int16_t spread;      /* random part of the velocity, +/- in each direction (fixed point) */
+    uint16_t colour;     /* RGB565 */
+    uint16_t life;       /* lifetime in frames */
+    uint16_t life_spread; /* random extra lifetime, 0 to life_spread frames */
+    uint8_t size;        /* 1..GFX_PARTICLE_MAX_SIZE pixels square */
+} gfx_particle_emitter_t;
+
+/* Create up to count particles, returns how many fitted */
+int gfx_particles_emit(const gfx_particle_emitter_t *emitter, int count);
+
+/* Acceleration added to every vertical velocity each frame (fixed point, default 0) */
+void gfx_particles_set_gravity(int16_t gravity);
+
+/* Remove every particle */
+void gfx_particles_clear(void);
+
+/* Number of live particles */
+int gfx_particles_count(void);
+
+/* Advance every particle by one frame */
+void gfx_particles_update(void);
+
+/* Draw the particles into a WIDTH x HEIGHT framebuffer, removing the dead ones, and set the
+   bit of every tile drawn on in tiles (one bit per tile, row by row; not cleared first) */
+void gfx_particles_draw(uint16_t *framebuffer, uint32_t *tiles);
+
+/* Register the static buffers with the memory statistics module */
+void gfx_particles_register_memory(void);
@@ -9,6 +9,9 @@
 #include "drivers/onboard_led.h"
 #include "drivers/lcd.h"
 #include "drivers/ds3231.h"
+#include "drivers/memstat.h"
+#include "drivers/boottime.h"
+#include "drivers/sdcard.h"
 
 #include "commands.h"
 #include "wifi.h"
@@ -158,20 +161,21 @@ int main()
 {
     char buffer[40];
 
-    // Initialize the LED driver and set the LED callback
-    // If the LED driver fails to initialize, we can still run the text starter
-    // without LED support, so we pass NULL to picocalc_init.
-    int led_init_result = led_init();
+    // Paint the stack first so the high-water mark covers the whole run
+    mem_init();
+    boot_mark("main");
 
-    stdio_init_all();
-    picocalc_init();
-    if (led_init_result == 0) {
-        display_set_led_callback(set_onboard_led);
-    }
-
-    // Initialize Core 1 for graphics processing AFTER hardware is ready
+    // Start core 1 first so it can power up the SD card while core 0
+    // brings up the LCD
     gfx_core_init();
+    sd_init();
+    gfx_core_run(sd_card_prepare);
+    boot_mark("core 1");
+
+    stdio_init_all();
+    boot_mark("usb");
 
+    picocalc_init();
 
     printf("\033c\033[1m\n Hello from the PicoCalc Text Starter!\033[0m\n\n");
     printf("      Contributed to the community\n");
@@ -185,12 +189,23 @@ int main()
     } else {
         printf("Warning: DS3231 RTC not detected\n\n");
     }
+    boot_mark("rtc");
 
     //JOBOND: TEMPORARILY DISABLED
     //test_wifi();
 
     // A very simple REPL
     printf("\033[qReady.\n");
+    boot_mark("prompt");
+
+    // The LED is only used to show that a command is running, so bring up
+    // the (slow) wireless chip that drives it after the prompt is shown.
+    // Keys pressed meanwhile are buffered by the keyboard driver.
+    if (led_init() == 0) {
+        display_set_led_callback(set_onboard_led);
+    }
+    boot_mark("led");
+
     while (true)
     {
         readline(buffer, sizeof(buffer));
@@ -78,3 +78,47 @@ const uint16_t sprite1_pixels[16 * 16] = {
     T,K,K,R,R,R,R,R,R,R,R,R,K,K,T,T,
     T,T,T,K,K,K,K,K,K,K,K,K,T,T,T,T
 };
+
+/*
+   ======================================================================
+   SPRITE (16x16, 4 bits per pixel)
+   ----------------------------------------------------------------------
+   The same hero as palette indices: 128 bytes instead of 512.
+   0 = transparent, 1 = outline, 2 = body, 3 = visor, 4 = decoration
+   Each palette below gives it different colours.
+   ======================================================================
+*/
+
+const uint8_t sprite1_4bpp[GFX_SPRITE_4BPP_SIZE(16, 16)] = {
+    0x00,0x01,0x11,0x11,0x11,0x11,0x00,0x00,
+    0x01,0x12,0x22,0x22,0x22,0x22,0x11,0x00,
+    0x12,0x22,0x22,0x22,0x22,0x22,0x22,0x10,
+    0x12,0x24,0x42,0x22,0x22,0x44,0x22,0x10,
+    0x12,0x22,0x22,0x22,0x22,0x22,0x22,0x10,
+    0x12,0x22,0x22,0x22,0x22,0x22,0x22,0x10,
+    0x12,0x22,0x33,0x33,0x33,0x33,0x22,0x10,
+    0x12,0x22,0x33,0x33,0x33,0x33,0x22,0x10,
+    0x12,0x22,0x23,0x33,0x33,0x32,0x22,0x10,
+    0x12,0x22,0x22,0x22,0x22,0x22,0x22,0x10,
+    0x12,0x22,0x22,0x22,0x22,0x22,0x22,0x10,
+    0x12,0x22,0x22,0x22,0x22,0x22,0x22,0x10,
+    0x12,0x22,0x22,0x22,0x22,0x22,0x22,0x10,
+    0x12,0x22,0x22,0x22,0x22,0x22,0x22,0x10,
+    0x01,0x12,0x22,0x22,0x22,0x22,0x11,0x00,
+    0x00,0x01,0x11,0x11,0x11,0x11,0x00,0x00
+};
+
+/* Red team (as sprite1_pixels) */
+const uint16_t sprite1_palette_red[16] = {
+    0, K, R, B, Y
+};
+
+/* Green team */
+const uint16_t sprite1_palette_green[16] = {
+    0, K, C16(0,48,0), C16(31,63,31), C16(31,40,0)
+};
+
+/* Damage flash: everything but the outline white */
+const uint16_t sprite1_palette_flash[16] = {
+    0, K, C16(31,63,31), C16(31,63,31), C16(31,63,31)
+};
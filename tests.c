@@ -3,9 +3,20 @@
 #include <string.h>
 
 #include "pico/rand.h"
+#include "drivers/assetpack.h"
 #include "drivers/audio.h"
 #include "drivers/fat32.h"
 #include "drivers/lcd.h"
+#include "drivers/memstat.h"
+#include "drivers/governor.h"
+#include "drivers/scratch.h"
+#include "gfx.h"
+#include "gfx_particles.h"
+#include "gfx_affine.h"
+#include "gfx_draw.h"
+#include "gfx_map.h"
+#include "bignum.h"
+#include "calc.h"
 #include "tests.h"
 
 extern volatile bool user_interrupt;
@@ -359,6 +370,9 @@ void displaytest()
     int row = 1;
     printf("\033[?25l"); // Hide cursor
 
+    mem_usage_t usage;
+    mem_bench_begin();
+
     absolute_time_t start_time = get_absolute_time();
 
     if (columns == 40)
@@ -409,6 +423,8 @@ void displaytest()
     float chars_per_second = output_chars / cps_elapsed_seconds;
     float displayed_per_second = chars / cps_elapsed_seconds;
 
+    mem_bench_end(&usage);
+
     printf("\n\n\n\033(B\033[m\033[?25h");
     printf("Display stress test complete.\n");
     printf("\nRows processed: %d\n", row - 1);
@@ -419,6 +435,8 @@ void displaytest()
     printf("Average characters per second: %.0f\n", chars_per_second);
     printf("Characters displayed: %d\n", chars);
     printf("Average displayed cps: %.0f\n", displayed_per_second);
+    printf("\nPeak heap: %u bytes\n", usage.heap_peak);
+    printf("Peak stack (core 0): %u bytes\n", usage.stack0_peak);
 }
 
 void lcdtest()
@@ -440,6 +458,87 @@ void lcdtest()
     }
 }
 
+//
+// Clock profile test
+//
+// Times a compose-and-display workload at each clock profile. The compose
+// step builds a full-screen RGB565 frame on the CPU; the display step sends
+// it to the LCD over SPI.
+//
+
+#define CLOCK_TEST_FRAMES (20)
+
+static void clock_test_compose(uint16_t *frame, int frame_number)
+{
+    for (int y = 0; y < HEIGHT; y++)
+    {
+        for (int x = 0; x < WIDTH; x++)
+        {
+            int r = (x + frame_number * 4) & 0xFF;
+            int g = (y + frame_number * 2) & 0xFF;
+            int b = ((x ^ y) + frame_number) & 0xFF;
+            *frame++ = RGB(r, g, b);
+        }
+    }
+}
+
+void clocktest()
+{
+    uint16_t *frame = scratch_lease_any(WIDTH * HEIGHT * sizeof(uint16_t), "clock test");
+    if (frame == NULL)
+    {
+        printf("FAIL: Cannot lease a frame of scratch memory\n");
+        return;
+    }
+
+    governor_profile_t saved_profile = governor_get_profile();
+    uint64_t compose_us[GOVERNOR_NUM_PROFILES] = {0};
+    uint64_t display_us[GOVERNOR_NUM_PROFILES] = {0};
+    bool tested[GOVERNOR_NUM_PROFILES] = {false};
+
+    for (int p = 0; p < GOVERNOR_NUM_PROFILES && !user_interrupt; p++)
+    {
+        if (!governor_set_profile((governor_profile_t)p))
+        {
+            continue;
+        }
+        tested[p] = true;
+
+        for (int i = 0; i < CLOCK_TEST_FRAMES && !user_interrupt; i++)
+        {
+            absolute_time_t start_time = get_absolute_time();
+            clock_test_compose(frame, i);
+            absolute_time_t composed_time = get_absolute_time();
+            lcd_blit(frame, 0, 0, WIDTH, HEIGHT);
+            absolute_time_t end_time = get_absolute_time();
+
+            compose_us[p] += absolute_time_diff_us(start_time, composed_time);
+            display_us[p] += absolute_time_diff_us(composed_time, end_time);
+        }
+    }
+
+    governor_set_profile(saved_profile);
+    scratch_release(frame);
+
+    printf("\033[m\033[2J\033[H");
+    printf("Clock profile test complete.\n\n");
+    printf("Profile  MHz  Compose  Display  Frame\n");
+    for (int p = 0; p < GOVERNOR_NUM_PROFILES; p++)
+    {
+        const governor_profile_info_t *info = governor_get_profile_info((governor_profile_t)p);
+        if (!tested[p])
+        {
+            printf("%-7s %4lu  not available\n", info->name, info->sys_khz / 1000);
+            continue;
+        }
+        printf("%-7s %4lu %6.1fms %6.1fms %5.1fms\n", info->name, info->sys_khz / 1000,
+               compose_us[p] / 1000.0f / CLOCK_TEST_FRAMES,
+               display_us[p] / 1000.0f / CLOCK_TEST_FRAMES,
+               (compose_us[p] + display_us[p]) / 1000.0f / CLOCK_TEST_FRAMES);
+    }
+    printf("\n(times are the average per frame)\n");
+}
+
 void keyboardtest()
 {
     while (!user_interrupt)
@@ -1234,13 +1333,1215 @@ void fat32test()
     printf("- Data integrity across boundaries\n");
 }
 
+#define ASSET_TEST_COUNT (16)
+#define ASSET_TEST_SLOTS (32)
+#define ASSET_TEST_MAX_SIZE (8192)
+
+static uint32_t asset_test_size(int asset)
+{
+    return 256 + asset * 397;
+}
+
+static void asset_test_fill(uint8_t *data, int asset)
+{
+    for (uint32_t i = 0; i < asset_test_size(asset); i++)
+    {
+        data[i] = (uint8_t)(i * 31 + asset * 7);
+    }
+}
+
+static bool asset_test_write(fat32_file_t *file, const void *data, uint32_t size)
+{
+    size_t bytes_written;
+    return fat32_write(file, data, size, &bytes_written) == FAT32_OK && bytes_written == size;
+}
+
+// Write each asset as its own file, and all of them as a pack (the layout tools/mkpack.py writes)
+static bool asset_test_create(uint8_t *buffer)
+{
+    char name[16];
+    uint8_t sector[512];
+    fat32_file_t pack;
+
+    for (int a = 0; a < ASSET_TEST_COUNT; a++)
+    {
+        fat32_file_t file;
+        snprintf(name, sizeof(name), "asset%02d.bin", a);
+        fat32_delete(name);
+        asset_test_fill(buffer, a);
+        if (fat32_create(&file, name) != FAT32_OK)
+        {
+            printf("FAIL: Cannot create %s\n", name);
+            return false;
+        }
+        bool ok = asset_test_write(&file, buffer, asset_test_size(a));
+        fat32_close(&file);
+        if (!ok)
+        {
+            printf("FAIL: Cannot write %s\n", name);
+            return false;
+        }
+    }
+
+    fat32_delete("assets.pak");
+    if (fat32_create(&pack, "assets.pak") != FAT32_OK)
+    {
+        printf("FAIL: Cannot create assets.pak\n");
+        return false;
+    }
+
+    // Header
+    uint32_t toc_offset = 512;
+    uint32_t data_offset = toc_offset + ASSET_TEST_SLOTS * 64;
+    memset(sector, 0, sizeof(sector));
+    memcpy(sector, "JOBPAK", 6);
+    sector[6] = 1;
+    uint32_t header[4] = {ASSET_TEST_COUNT, ASSET_TEST_SLOTS, toc_offset, data_offset};
+    memcpy(sector + 8, header, sizeof(header));
+    bool ok = asset_test_write(&pack, sector, sizeof(sector));
+
+    // Table of contents
+    uint8_t toc[ASSET_TEST_SLOTS][64];
+    memset(toc, 0, sizeof(toc));
+    uint32_t offset = data_offset;
+    for (int a = 0; a < ASSET_TEST_COUNT; a++)
+    {
+        snprintf(name, sizeof(name), "asset%02d.bin", a);
+        asset_test_fill(buffer, a);
+        uint32_t slot = assetpack_hash(name) & (ASSET_TEST_SLOTS - 1);
+        while (toc[slot][0])
+        {
+            slot = (slot + 1) & (ASSET_TEST_SLOTS - 1);
+        }
+        uint32_t entry[3] = {offset, asset_test_size(a), assetpack_crc32(buffer, asset_test_size(a))};
+        strcpy((char *)toc[slot], name);
+        memcpy(&toc[slot][48], entry, sizeof(entry));
+        offset += (asset_test_size(a) + 511) & ~511u;
+    }
+    ok = ok && asset_test_write(&pack, toc, sizeof(toc));
+
+    // Data, each asset padded to a sector
+    for (int a = 0; a < ASSET_TEST_COUNT && ok; a++)
+    {
+        uint32_t padded = (asset_test_size(a) + 511) & ~511u;
+        memset(buffer, 0, padded);
+        asset_test_fill(buffer, a);
+        ok = asset_test_write(&pack, buffer, padded);
+    }
+
+    fat32_close(&pack);
+    if (!ok)
+    {
+        printf("FAIL: Cannot write assets.pak\n");
+    }
+    return ok;
+}
+
+static void asset_test_remove(void)
+{
+    char name[16];
+    for (int a = 0; a < ASSET_TEST_COUNT; a++)
+    {
+        snprintf(name, sizeof(name), "asset%02d.bin", a);
+        fat32_delete(name);
+    }
+    fat32_delete("assets.pak");
+}
+
+void assettest()
+{
+    uint8_t *buffer = scratch_lease_any(ASSET_TEST_MAX_SIZE, "asset test");
+    if (buffer == NULL)
+    {
+        printf("FAIL: Cannot lease scratch memory\n");
+        return;
+    }
+
+    printf("Creating %d assets as files and as a pack...\n", ASSET_TEST_COUNT);
+    if (!fat32_test_setup() || !asset_test_create(buffer))
+    {
+        scratch_release(buffer);
+        fat32_set_current_dir("/");
+        return;
+    }
+
+    // Individual files: directory scan and cluster chain for every asset
+    char name[16];
+    bool files_ok = true;
+    absolute_time_t start_time = get_absolute_time();
+    for (int a = 0; a < ASSET_TEST_COUNT && files_ok; a++)
+    {
+        fat32_file_t file;
+        size_t bytes_read = 0;
+        snprintf(name, sizeof(name), "asset%02d.bin", a);
+        files_ok = fat32_open(&file, name) == FAT32_OK &&
+                   fat32_read(&file, buffer, ASSET_TEST_MAX_SIZE, &bytes_read) == FAT32_OK &&
+                   bytes_read == asset_test_size(a);
+        fat32_close(&file);
+    }
+    int64_t files_us = absolute_time_diff_us(start_time, get_absolute_time());
+
+    // Pack: one open, then a hash lookup and a multi-block read per asset
+    bool pack_ok = true;
+    start_time = get_absolute_time();
+    pack_ok = assetpack_open("assets.pak");
+    int64_t open_us = absolute_time_diff_us(start_time, get_absolute_time());
+    for (int a = 0; a < ASSET_TEST_COUNT && pack_ok; a++)
+    {
+        uint32_t size = 0;
+        snprintf(name, sizeof(name), "asset%02d.bin", a);
+        pack_ok = assetpack_load(name, buffer, ASSET_TEST_MAX_SIZE, &size) && size == asset_test_size(a);
+    }
+    int64_t pack_us = absolute_time_diff_us(start_time, get_absolute_time());
+
+    // Check the pack contents against the checksums
+    bool check_ok = pack_ok;
+    for (int a = 0; a < ASSET_TEST_COUNT && check_ok; a++)
+    {
+        assetpack_info_t info;
+        snprintf(name, sizeof(name), "asset%02d.bin", a);
+        check_ok = assetpack_find(name, &info) &&
+                   assetpack_load(name, buffer, ASSET_TEST_MAX_SIZE, NULL) &&
+                   assetpack_check(buffer, &info);
+    }
+    check_ok = check_ok && !assetpack_find("missing.bin", &(assetpack_info_t){0});
+
+    assetpack_close();
+    asset_test_remove();
+    fat32_set_current_dir("/");
+    scratch_release(buffer);
+
+    if (!files_ok || !pack_ok)
+    {
+        printf("FAIL: Cannot read the %s\n", files_ok ? "pack" : "files");
+        return;
+    }
+    printf("Individual files: %6.1fms\n", files_us / 1000.0f);
+    printf("Asset pack:       %6.1fms (open %.1fms)\n", pack_us / 1000.0f, open_us / 1000.0f);
+    printf("Checksums:        %s\n", check_ok ? "PASS" : "FAIL");
+}
+
+//
+// Defragmentation Test
+//
+
+#define DEFRAG_TEST_CLUSTERS (16)
+#define DEFRAG_TEST_BUFFER_SIZE (65536)
+
+static void defrag_test_fill(uint8_t *data, uint32_t size, uint32_t cluster)
+{
+    for (uint32_t i = 0; i < size; i++)
+    {
+        data[i] = (uint8_t)(i * 13 + cluster * 7);
+    }
+}
+
+// Write one cluster at a time to two files in turn, so each gets every other cluster
+static bool defrag_test_create(uint8_t *buffer, uint32_t cluster_size)
+{
+    fat32_file_t first, second;
+    fat32_delete("frag1.bin");
+    fat32_delete("frag2.bin");
+    if (fat32_create(&first, "frag1.bin") != FAT32_OK)
+    {
+        return false;
+    }
+    if (fat32_create(&second, "frag2.bin") != FAT32_OK)
+    {
+        fat32_close(&first);
+        return false;
+    }
+
+    bool ok = true;
+    for (uint32_t c = 0; c < DEFRAG_TEST_CLUSTERS && ok; c++)
+    {
+        size_t bytes_written;
+        defrag_test_fill(buffer, cluster_size, c);
+        ok = fat32_write(&first, buffer, cluster_size, &bytes_written) == FAT32_OK && bytes_written == cluster_size &&
+             fat32_write(&second, buffer, cluster_size, &bytes_written) == FAT32_OK && bytes_written == cluster_size;
+    }
+    fat32_close(&first);
+    fat32_close(&second);
+    fat32_delete("frag2.bin");
+    return ok;
+}
+
+// Read the whole file a cluster at a time, optionally checking the pattern
+static bool defrag_test_read(uint8_t *buffer, uint32_t cluster_size, bool check, int64_t *us)
+{
+    fat32_file_t file;
+    bool ok = fat32_open(&file, "frag1.bin") == FAT32_OK;
+
+    absolute_time_t start_time = get_absolute_time();
+    for (uint32_t c = 0; c < DEFRAG_TEST_CLUSTERS && ok; c++)
+    {
+        size_t bytes_read;
+        ok = fat32_read(&file, buffer, cluster_size, &bytes_read) == FAT32_OK && bytes_read == cluster_size;
+        for (uint32_t i = 0; i < cluster_size && ok && check; i++)
+        {
+            ok = buffer[i] == (uint8_t)(i * 13 + c * 7);
+        }
+    }
+    *us = absolute_time_diff_us(start_time, get_absolute_time());
+    fat32_close(&file);
+    return ok;
+}
+
+static bool defrag_test_fragments(uint32_t *fragments)
+{
+    fat32_file_t file;
+    uint32_t clusters;
+    bool ok = fat32_open(&file, "frag1.bin") == FAT32_OK &&
+              fat32_get_fragments(&file, &clusters, fragments) == FAT32_OK;
+    fat32_close(&file);
+    return ok;
+}
+
+void defragtest()
+{
+    uint8_t *buffer = scratch_lease_any(DEFRAG_TEST_BUFFER_SIZE, "defrag test");
+    if (buffer == NULL)
+    {
+        printf("FAIL: Cannot lease scratch memory\n");
+        return;
+    }
+    if (!fat32_test_setup())
+    {
+        scratch_release(buffer);
+        return;
+    }
+
+    // The card is mounted by now
+    uint32_t cluster_size = fat32_get_cluster_size();
+    if (cluster_size == 0 || cluster_size > DEFRAG_TEST_BUFFER_SIZE)
+    {
+        printf("FAIL: Unsupported cluster size %lu\n", cluster_size);
+        scratch_release(buffer);
+        fat32_set_current_dir("/");
+        return;
+    }
+
+    printf("Writing a file in %d pieces...\n", DEFRAG_TEST_CLUSTERS);
+    if (!defrag_test_create(buffer, cluster_size))
+    {
+        printf("FAIL: Cannot write the test files\n");
+        fat32_delete("frag1.bin");
+        fat32_delete("frag2.bin");
+        scratch_release(buffer);
+        fat32_set_current_dir("/");
+        return;
+    }
+
+    uint32_t fragments_before = 0, fragments_after = 0;
+    int64_t before_us = 0, after_us = 0, defrag_us = 0;
+    bool ok = defrag_test_fragments(&fragments_before) &&
+              defrag_test_read(buffer, cluster_size, false, &before_us);
+
+    fat32_error_t result = FAT32_OK;
+    if (ok)
+    {
+        fat32_file_t file;
+        absolute_time_t start_time = get_absolute_time();
+        result = fat32_open(&file, "frag1.bin");
+        if (result == FAT32_OK)
+        {
+            result = fat32_defrag(&file, buffer, DEFRAG_TEST_BUFFER_SIZE);
+            fat32_close(&file);
+        }
+        defrag_us = absolute_time_diff_us(start_time, get_absolute_time());
+    }
+
+    ok = ok && result == FAT32_OK &&
+         defrag_test_fragments(&fragments_after) &&
+         defrag_test_read(buffer, cluster_size, false, &after_us);
+    bool check_ok = ok && defrag_test_read(buffer, cluster_size, true, &(int64_t){0});
+
+    fat32_delete("frag1.bin");
+    fat32_set_current_dir("/");
+    scratch_release(buffer);
+
+    if (!ok)
+    {
+        printf("FAIL: %s\n", result != FAT32_OK ? fat32_error_string(result) : "Cannot read the test file");
+        return;
+    }
+
+    uint32_t kb = DEFRAG_TEST_CLUSTERS * cluster_size / 1024;
+    printf("Before: %2lu pieces, %6.1fms (%.0fKB/s)\n", fragments_before, before_us / 1000.0f,
+           kb * 1000000.0f / before_us);
+    printf("After:  %2lu pieces, %6.1fms (%.0fKB/s)\n", fragments_after, after_us / 1000.0f,
+           kb * 1000000.0f / after_us);
+    printf("Defrag:     %6.1fms\n", defrag_us / 1000.0f);
+    printf("Contents:   %s\n", check_ok ? "PASS" : "FAIL");
+}
+
+//
+// File System Check Test
+//
+
+#define FSCK_TEST_SMALL_BUFFER (12 * 1024) // fixed 10KB and a bitmap of 16384 clusters a pass
+
+// One read-only check of the whole card, timed
+static bool fsck_test_pass(fat32_check_t *report, void *buffer, uint32_t size, int64_t *us)
+{
+    absolute_time_t start_time = get_absolute_time();
+    fat32_error_t result = fat32_check(report, false, buffer, size);
+    *us = absolute_time_diff_us(start_time, get_absolute_time());
+    if (result != FAT32_OK)
+    {
+        printf("FAIL: %s\n", fat32_error_string(result));
+        return false;
+    }
+    return true;
+}
+
+// Check with as much memory as fsck gets and with little enough for several passes; the two
+// must find the same, except that a cross-link can be counted once in each pass
+void fscktest()
+{
+    uint32_t size = scratch_get_largest_free();
+    uint8_t *buffer = size >= FSCK_TEST_SMALL_BUFFER ? scratch_lease_any(size, "fsck test") : NULL;
+    if (buffer == NULL)
+    {
+        printf("FAIL: Cannot lease scratch memory\n");
+        return;
+    }
+
+    printf("Checking the SD card, nothing is written...\n");
+    fat32_check_t full, small;
+    int64_t full_us = 0, small_us = 0;
+    bool ok = fsck_test_pass(&full, buffer, size, &full_us) &&
+              fsck_test_pass(&small, buffer, FSCK_TEST_SMALL_BUFFER, &small_us);
+    scratch_release(buffer);
+    if (!ok)
+    {
+        return;
+    }
+
+    uint64_t total = 0;
+    fat32_get_total_space(&total);
+    uint32_t clusters = (uint32_t)(total / fat32_get_cluster_size());
+    bool clean = !full.lost_clusters && !full.cross_links && !full.bad_chains && !full.size_mismatches;
+    bool same = small.files == full.files && small.directories == full.directories &&
+                small.lost_clusters == full.lost_clusters && small.cross_links >= full.cross_links &&
+                small.bad_chains == full.bad_chains && small.size_mismatches == full.size_mismatches &&
+                small.free_clusters == full.free_clusters;
+
+    printf("Volume:     %.1fGB, %lu clusters of %luKB\n", total / (1024.0f * 1024 * 1024), clusters,
+           fat32_get_cluster_size() / 1024);
+    printf("Tree:       %lu files in %lu directories\n", full.files, full.directories);
+    printf("Full pass:  %6.2fs in %lu %s (%luKB)\n", full_us / 1000000.0f, full.passes,
+           full.passes == 1 ? "pass" : "passes", size / 1024);
+    printf("Small:      %6.2fs in %lu passes (%dKB)\n", small_us / 1000000.0f, small.passes,
+           FSCK_TEST_SMALL_BUFFER / 1024);
+    printf("Problems:   %s\n", clean ? "none" : "found, run 'fsck' for details");
+    printf("Same found: %s\n", same ? "PASS" : "FAIL");
+}
+
+//
+// Tile Map Test
+//
+
+#define MAP_TEST_CHUNKS (8)                             // chunks across and down
+#define MAP_TEST_SIZE (MAP_TEST_CHUNKS * GFX_MAP_CHUNK) // tiles across and down
+#define MAP_TEST_DATA_OFFSET (1024)                     // header and layer, then the index
+
+// Chunks cycle through RLE (a tile per row), raw and empty, so every codec is read
+static uint8_t map_test_codec(uint32_t cx, uint32_t cy)
+{
+    static const uint8_t codecs[3] = {1, 0, 2}; // RLE, raw, empty
+    return codecs[(cx + cy) % 3];
+}
+
+static uint16_t map_test_tile(uint32_t x, uint32_t y)
+{
+    uint32_t cx = x / GFX_MAP_CHUNK;
+    uint32_t cy = y / GFX_MAP_CHUNK;
+    switch (map_test_codec(cx, cy))
+    {
+    case 1:
+        return (uint16_t)((y * 3 + cx) % 64);
+    case 0:
+        return (uint16_t)((x * 7 + y * 13) % 64);
+    default:
+        return UINT16_MAX;
+    }
+}
+
+// Bytes of chunk data: RLE is one run per row, a control byte and a tile
+static uint32_t map_test_chunk_size(uint32_t cx, uint32_t cy)
+{
+    switch (map_test_codec(cx, cy))
+    {
+    case 1:
+        return GFX_MAP_CHUNK * 3;
+    case 0:
+        return GFX_MAP_CHUNK * GFX_MAP_CHUNK * sizeof(uint16_t);
+    default:
+        return 0;
+    }
+}
+
+// Lay the chunks out as tools/tmx_to_bin_map.py does, none crossing a sector
+static void map_test_layout(uint32_t *offsets)
+{
+    uint32_t offset = MAP_TEST_DATA_OFFSET;
+    for (uint32_t c = 0; c < MAP_TEST_CHUNKS * MAP_TEST_CHUNKS; c++)
+    {
+        uint32_t size = map_test_chunk_size(c % MAP_TEST_CHUNKS, c / MAP_TEST_CHUNKS);
+        if (offset / 512 != (offset + size - 1) / 512 && offset % 512)
+        {
+            offset += 512 - offset % 512;
+        }
+        offsets[c] = offset;
+        offset += size;
+    }
+    offsets[MAP_TEST_CHUNKS * MAP_TEST_CHUNKS] = offset;
+}
+
+static void map_test_chunk(uint8_t *data, uint32_t cx, uint32_t cy)
+{
+    for (uint32_t y = 0; y < GFX_MAP_CHUNK; y++)
+    {
+        for (uint32_t x = 0; x < GFX_MAP_CHUNK; x++)
+        {
+            uint16_t tile = map_test_tile(cx * GFX_MAP_CHUNK + x, cy * GFX_MAP_CHUNK + y);
+            if (map_test_codec(cx, cy) == 1)
+            {
+                data[y * 3] = 0x80 | (GFX_MAP_CHUNK - 1);
+                data[y * 3 + 1] = (uint8_t)tile;
+                data[y * 3 + 2] = (uint8_t)(tile >> 8);
+                break;
+            }
+            data[(y * GFX_MAP_CHUNK + x) * 2] = (uint8_t)tile;
+            data[(y * GFX_MAP_CHUNK + x) * 2 + 1] = (uint8_t)(tile >> 8);
+        }
+    }
+}
+
+// Write a version 2 map with one tile layer
+static bool map_test_create(uint8_t *buffer, uint32_t buffer_size)
+{
+    static uint32_t offsets[MAP_TEST_CHUNKS * MAP_TEST_CHUNKS + 1];
+    map_test_layout(offsets);
+    uint32_t size = offsets[MAP_TEST_CHUNKS * MAP_TEST_CHUNKS];
+    if (size > buffer_size)
+    {
+        return false;
+    }
+    memset(buffer, 0, size);
+
+    // Header and layer record
+    uint16_t header[] = {MAP_TEST_SIZE, MAP_TEST_SIZE, GFX_TILE_W | GFX_TILE_H << 8, 0, 1, 0,
+                         MAP_TEST_CHUNKS, MAP_TEST_CHUNKS};
+    memcpy(buffer, "JOBMAP", 6);
+    buffer[6] = 2;
+    buffer[7] = GFX_MAP_CHUNK;
+    memcpy(buffer + 8, header, sizeof(header));
+    strcpy((char *)buffer + 32, "ground");
+    uint32_t layer[2] = {512, MAP_TEST_CHUNKS * MAP_TEST_CHUNKS};
+    memcpy(buffer + 32 + 20, layer, sizeof(layer));
+
+    // Chunk index and data
+    for (uint32_t c = 0; c < MAP_TEST_CHUNKS * MAP_TEST_CHUNKS; c++)
+    {
+        uint32_t cx = c % MAP_TEST_CHUNKS;
+        uint32_t cy = c / MAP_TEST_CHUNKS;
+        uint8_t *entry = buffer + 512 + c * 8;
+        uint16_t chunk_size = (uint16_t)map_test_chunk_size(cx, cy);
+        memcpy(entry, &offsets[c], 4);
+        memcpy(entry + 4, &chunk_size, 2);
+        entry[6] = map_test_codec(cx, cy);
+        map_test_chunk(buffer + offsets[c], cx, cy);
+    }
+
+    fat32_file_t file;
+    size_t bytes_written = 0;
+    fat32_delete("maptest.map");
+    if (fat32_create(&file, "maptest.map") != FAT32_OK)
+    {
+        return false;
+    }
+    bool ok = fat32_write(&file, buffer, size, &bytes_written) == FAT32_OK && bytes_written == size;
+    fat32_close(&file);
+    return ok;
+}
+
+void maptest()
+{
+    const uint32_t buffer_size = MAP_TEST_DATA_OFFSET + MAP_TEST_CHUNKS * MAP_TEST_CHUNKS * 512;
+    uint8_t *buffer = scratch_lease_any(buffer_size, "map test");
+    if (buffer == NULL)
+    {
+        printf("FAIL: Cannot lease scratch memory\n");
+        return;
+    }
+
+    printf("Writing a %dx%d-tile map...\n", MAP_TEST_SIZE, MAP_TEST_SIZE);
+    bool created = fat32_test_setup() && map_test_create(buffer, buffer_size);
+    scratch_release(buffer);
+    if (!created)
+    {
+        printf("FAIL: Cannot write maptest.map\n");
+        fat32_set_current_dir("/");
+        return;
+    }
+
+    absolute_time_t start_time = get_absolute_time();
+    bool ok = gfx_map_open("maptest.map");
+    int64_t open_us = absolute_time_diff_us(start_time, get_absolute_time());
+    if (!ok)
+    {
+        printf("FAIL: Cannot open maptest.map\n");
+        fat32_delete("maptest.map");
+        fat32_set_current_dir("/");
+        return;
+    }
+
+    // Pan right along a row, down a column and back diagonally, a tile at a time, so the
+    // camera crosses chunk boundaries in every direction
+    const int32_t last = MAP_TEST_SIZE - GFX_TILES_X;
+    int64_t load_us = 0, move_us = 0;
+    uint32_t moves = 0, loads = 0;
+    for (int leg = 0; leg < 3 && ok && !user_interrupt; leg++)
+    {
+        for (int32_t step = 0; step <= last && ok; step++)
+        {
+            int32_t tx = leg == 0 ? step : leg == 1 ? last : last - step;
+            int32_t ty = leg == 0 ? GFX_MAP_CHUNK / 2 : leg == 1 ? step : last - step;
+
+            uint32_t hits_before, misses_before, hits, misses;
+            gfx_map_get_stats(&hits_before, &misses_before);
+            start_time = get_absolute_time();
+            ok = gfx_map_set_camera(0, tx, ty);
+            int64_t elapsed_us = absolute_time_diff_us(start_time, get_absolute_time());
+            gfx_map_get_stats(&hits, &misses);
+
+            if (misses > misses_before)
+            {
+                load_us += elapsed_us;
+                loads += misses - misses_before;
+            }
+            else
+            {
+                move_us += elapsed_us;
+                moves++;
+            }
+        }
+    }
+
+    uint32_t hits, misses;
+    gfx_map_get_stats(&hits, &misses);
+
+    // Every tile read back through the cache must match what was written
+    bool tiles_ok = ok;
+    for (int32_t y = 0; y < MAP_TEST_SIZE && tiles_ok; y++)
+    {
+        for (int32_t x = 0; x < MAP_TEST_SIZE && tiles_ok; x++)
+        {
+            tiles_ok = gfx_map_get_tile(0, x, y) == map_test_tile(x, y);
+        }
+    }
+
+    gfx_map_close();
+    fat32_delete("maptest.map");
+    fat32_set_current_dir("/");
+
+    if (!ok)
+    {
+        printf("FAIL: Cannot read a chunk\n");
+        return;
+    }
+    printf("Open:          %6.2fms\n", open_us / 1000.0f);
+    printf("Chunk load:    %6.2fms (%lu chunks)\n", loads ? load_us / 1000.0f / loads : 0.0f, loads);
+    printf("Cached move:   %6.2fms (%lu moves)\n", moves ? move_us / 1000.0f / moves : 0.0f, moves);
+    printf("Cache hits:    %5.1f%% (%lu of %lu lookups)\n",
+           hits + misses ? hits * 100.0f / (hits + misses) : 0.0f, hits, hits + misses);
+    printf("Tiles:         %s\n", tiles_ok ? "PASS" : "FAIL");
+}
+
+//
+// Particle Test
+//
+
+#define PARTICLE_TEST_FRAMES (60)
+#define PARTICLE_TEST_FRAME_US (16667)
+
+void particletest()
+{
+    uint16_t *frame = scratch_lease_any(WIDTH * HEIGHT * sizeof(uint16_t), "particle test");
+    if (frame == NULL)
+    {
+        printf("FAIL: Cannot lease a frame of scratch memory\n");
+        return;
+    }
+
+    printf("\033[m\033[2J\033[H");
+    printf("Particle test (%d frames each)\n\n", PARTICLE_TEST_FRAMES);
+    printf("Particles  Update    Draw  Per 1000  At 60 FPS\n");
+
+    for (int count = 256; count <= GFX_MAX_PARTICLES && !user_interrupt; count *= 2)
+    {
+        // Sparks scattered over the whole screen, falling slowly so that few are lost
+        gfx_particles_clear();
+        gfx_particles_set_gravity(1);
+        gfx_particle_emitter_t sparks = {
+            .x = 0, .y = 0, .w = WIDTH, .h = HEIGHT / 2,
+            .vx = 0, .vy = 0, .spread = GFX_PARTICLE_FIX(1),
+            .colour = RGB(255, 192, 64), .life = 1000, .size = 1,
+        };
+        gfx_particles_emit(&sparks, count / 2);
+        sparks.size = 2;
+        sparks.colour = RGB(255, 64, 0);
+        gfx_particles_emit(&sparks, count - count / 2);
+
+        uint64_t update_us = 0;
+        uint64_t draw_us = 0;
+        uint64_t particle_frames = 0;
+        uint32_t tiles[(GFX_TILEMAP_SIZE + 31) / 32];
+        for (int i = 0; i < PARTICLE_TEST_FRAMES; i++)
+        {
+            memset(frame, 0, WIDTH * HEIGHT * sizeof(uint16_t));
+            memset(tiles, 0, sizeof(tiles));
+            particle_frames += gfx_particles_count();
+
+            absolute_time_t start_time = get_absolute_time();
+            gfx_particles_update();
+            absolute_time_t updated_time = get_absolute_time();
+            gfx_particles_draw(frame, tiles);
+            absolute_time_t end_time = get_absolute_time();
+
+            update_us += absolute_time_diff_us(start_time, updated_time);
+            draw_us += absolute_time_diff_us(updated_time, end_time);
+        }
+        lcd_blit(frame, 0, 0, WIDTH, HEIGHT);
+
+        float us_per_particle = (float)(update_us + draw_us) / particle_frames;
+        printf("%9d %5.2fms %6.2fms %7.1fus %10.0f\n", count,
+               update_us / 1000.0f / PARTICLE_TEST_FRAMES,
+               draw_us / 1000.0f / PARTICLE_TEST_FRAMES,
+               us_per_particle * 1000,
+               PARTICLE_TEST_FRAME_US / us_per_particle);
+    }
+
+    gfx_particles_clear();
+    gfx_particles_set_gravity(0);
+    scratch_release(frame);
+
+    printf("\n(times are the average per frame; the last column is how\n");
+    printf(" many particles one core could move and draw in 1/60 s)\n");
+}
+
+//
+// Affine Plane Test
+//
+
+#define MODE7_TEST_FRAMES (30)
+#define MODE7_BAND_ROWS (16)
+#define MODE7_TILES (4)
+#define MODE7_MAP_LOG2 (4)
+
+// Four patterned tiles and a map of them, so every pixel goes through the map and tilesheet
+static void mode7_test_setup(uint16_t *tiles, uint16_t *map)
+{
+    static const uint16_t colours[MODE7_TILES][2] = {
+        {RGB(32, 160, 32), RGB(16, 96, 16)},
+        {RGB(160, 160, 160), RGB(96, 96, 96)},
+        {RGB(32, 64, 192), RGB(64, 128, 255)},
+        {RGB(192, 160, 96), RGB(128, 96, 48)},
+    };
+
+    for (int t = 0; t < MODE7_TILES; t++)
+    {
+        for (int y = 0; y < GFX_TILE_H; y++)
+        {
+            for (int x = 0; x < GFX_TILE_W; x++)
+            {
+                bool edge = x == 0 || y == 0;
+                *tiles++ = colours[t][edge || ((x ^ y) & 4) ? 1 : 0];
+            }
+        }
+    }
+
+    for (int i = 0; i < (1 << (2 * MODE7_MAP_LOG2)); i++)
+    {
+        map[i] = (i * 7 + i / (1 << MODE7_MAP_LOG2)) % MODE7_TILES;
+    }
+}
+
+// Set the plane for a frame: a spinning, breathing rotozoom or a turning floor
+static void mode7_test_frame(bool floor, int frame)
+{
+    if (floor)
+    {
+        gfx_affine_floor_t view = {
+            .x = frame * 4.0f, .y = frame * 2.0f, .angle = frame * 0.02f,
+            .height = 24.0f, .focal = WIDTH / 2, .horizon = HEIGHT / 4, .sky = RGB(96, 160, 255),
+        };
+        gfx_affine_set_floor(&view);
+    }
+    else
+    {
+        gfx_affine_t plane;
+        gfx_affine_rotozoom(&plane, frame * 3.0f, frame * 2.0f, frame * 0.05f, 0.5f + (frame % 20) * 0.1f);
+        gfx_affine_set_plane(&plane);
+    }
+}
+
+void mode7test()
+{
+    // A band to draw into, then the tiles and the map
+    const uint32_t band_pixels = WIDTH * MODE7_BAND_ROWS;
+    const uint32_t tile_pixels = MODE7_TILES * GFX_TILE_W * GFX_TILE_H;
+    const uint32_t map_entries = 1 << (2 * MODE7_MAP_LOG2);
+    uint16_t *memory = scratch_lease_any((band_pixels + tile_pixels + map_entries) * sizeof(uint16_t), "mode7 test");
+    if (memory == NULL)
+    {
+        printf("FAIL: Cannot lease scratch memory\n");
+        return;
+    }
+    uint16_t *band = memory;
+    uint16_t *tiles = memory + band_pixels;
+    uint16_t *map = tiles + tile_pixels;
+    mode7_test_setup(tiles, map);
+    gfx_affine_set_map(map, MODE7_MAP_LOG2, MODE7_MAP_LOG2);
+
+    governor_profile_t saved_profile = governor_get_profile();
+    uint64_t render_us[GOVERNOR_NUM_PROFILES][2] = {0};
+    uint64_t serial_us[GOVERNOR_NUM_PROFILES][2] = {0};
+    bool tested[GOVERNOR_NUM_PROFILES] = {false};
+
+    for (int p = 0; p < GOVERNOR_NUM_PROFILES && !user_interrupt; p++)
+    {
+        if (!governor_set_profile((governor_profile_t)p))
+        {
+            continue;
+        }
+        tested[p] = true;
+
+        for (int floor = 0; floor < 2; floor++)
+        {
+            // Drawing alone
+            for (int i = 0; i < MODE7_TEST_FRAMES && !user_interrupt; i++)
+            {
+                mode7_test_frame(floor, i);
+                absolute_time_t start_time = get_absolute_time();
+                for (uint16_t y = 0; y < HEIGHT; y += MODE7_BAND_ROWS)
+                {
+                    gfx_affine_render(band, y, MODE7_BAND_ROWS, tiles, MODE7_TILES);
+                }
+                render_us[p][floor] += absolute_time_diff_us(start_time, get_absolute_time());
+            }
+
+            // Drawing each band and then sending it; lcd_blit returns once the band is sent
+            for (int i = 0; i < MODE7_TEST_FRAMES && !user_interrupt; i++)
+            {
+                mode7_test_frame(floor, i);
+                absolute_time_t start_time = get_absolute_time();
+                for (uint16_t y = 0; y < HEIGHT; y += MODE7_BAND_ROWS)
+                {
+                    gfx_affine_render(band, y, MODE7_BAND_ROWS, tiles, MODE7_TILES);
+                    lcd_blit(band, 0, y, WIDTH, MODE7_BAND_ROWS);
+                }
+                serial_us[p][floor] += absolute_time_diff_us(start_time, get_absolute_time());
+            }
+        }
+    }
+
+    governor_set_profile(saved_profile);
+    gfx_affine_set_map(NULL, 0, 0);
+    scratch_release(memory);
+
+    printf("\033[m\033[2J\033[H");
+    printf("Affine plane test complete.\n\n");
+    printf("Profile Mode   Render  R+Send 60Hz 30Hz\n");
+    for (int p = 0; p < GOVERNOR_NUM_PROFILES; p++)
+    {
+        const governor_profile_info_t *info = governor_get_profile_info((governor_profile_t)p);
+        if (!tested[p])
+        {
+            printf("%-7s not available\n", info->name);
+            continue;
+        }
+        for (int floor = 0; floor < 2; floor++)
+        {
+            float render_ms = render_us[p][floor] / 1000.0f / MODE7_TEST_FRAMES;
+            float serial_ms = serial_us[p][floor] / 1000.0f / MODE7_TEST_FRAMES;
+            printf("%-7s %-5s %5.1fms %5.1fms %3.0f%% %3.0f%%\n", floor ? "" : info->name,
+                   floor ? "floor" : "plane", render_ms, serial_ms,
+                   serial_ms * 100 / 16.667f, serial_ms * 100 / 33.333f);
+        }
+    }
+    printf("\n(full 320x320 frames drawn in %d-row bands;\n", MODE7_BAND_ROWS);
+    printf(" R+Send draws each band, then sends it;\n");
+    printf(" the last columns are its share of a frame\n");
+    printf(" at 60 and 30 FPS)\n");
+}
+
+//
+// Rotozoom Test
+//
+
+#define ROTOZOOM_TEST_FRAMES (30)
+#define ROTOZOOM_TEST_FRAME_US (16667)
+#define ROTOZOOM_SIZE (32)
+#define ROTOZOOM_IMAGE_ROWS (ROTOZOOM_SIZE * ROTOZOOM_SIZE / WIDTH + 1)
+
+// A 32x32 ring with a pointer, transparent outside the ring as most sprites are
+static void rotozoom_test_image(uint16_t *image)
+{
+    const int r = ROTOZOOM_SIZE / 2;
+    for (int y = 0; y < ROTOZOOM_SIZE; y++)
+    {
+        for (int x = 0; x < ROTOZOOM_SIZE; x++)
+        {
+            int dx = x - r, dy = y - r;
+            int d2 = dx * dx + dy * dy;
+            uint16_t pixel = GFX_TRANSPARENT_COLOR;
+            if (d2 < r * r)
+            {
+                pixel = d2 > (r - 3) * (r - 3) ? RGB(255, 255, 0) : RGB(0, 96, 192);
+            }
+            if (dy > -3 && dy < 3 && dx > 0 && dx < r - 3)
+            {
+                pixel = RGB(255, 64, 64);
+            }
+            *image++ = pixel;
+        }
+    }
+}
+
+void rotozoomtest()
+{
+    uint16_t *frame = scratch_lease_any(WIDTH * HEIGHT * sizeof(uint16_t), "rotozoom test");
+    if (frame == NULL)
+    {
+        printf("FAIL: Cannot lease a frame of scratch memory\n");
+        return;
+    }
+
+    // The image lives in the last rows of the frame, below where the sprites are drawn
+    const int rows = HEIGHT - ROTOZOOM_IMAGE_ROWS;
+    uint16_t *image = frame + rows * WIDTH;
+    rotozoom_test_image(image);
+
+    gfx_sprite_info_t sprite = {
+        .active = true, .image = image, .w = ROTOZOOM_SIZE, .h = ROTOZOOM_SIZE,
+        .transformed = true, .scale = 1.0f,
+    };
+    gfx_affine_sprite_opaque(&sprite);
+
+    printf("\033[m\033[2J\033[H");
+    printf("Rotozoom test (%dx%d sprites, %d frames each)\n\n", ROTOZOOM_SIZE, ROTOZOOM_SIZE, ROTOZOOM_TEST_FRAMES);
+    printf("Sprites   Frame  Per sprite  At 60 FPS\n");
+
+    for (int count = 8; count <= 128 && !user_interrupt; count *= 2)
+    {
+        uint64_t draw_us = 0;
+        for (int i = 0; i < ROTOZOOM_TEST_FRAMES; i++)
+        {
+            memset(frame, 0, rows * WIDTH * sizeof(uint16_t));
+
+            // Each sprite gets its own angle every frame, as spinning sprites would
+            absolute_time_t start_time = get_absolute_time();
+            for (int n = 0; n < count; n++)
+            {
+                sprite.x = ROTOZOOM_SIZE + (n * 37) % (WIDTH - 3 * ROTOZOOM_SIZE);
+                sprite.y = ROTOZOOM_SIZE + (n * 53) % (rows - 3 * ROTOZOOM_SIZE);
+                sprite.angle = (i + n) * 0.1f;
+                gfx_affine_sprite_transform(&sprite);
+                gfx_affine_draw_sprite(frame, &sprite);
+            }
+            draw_us += absolute_time_diff_us(start_time, get_absolute_time());
+        }
+        lcd_blit(frame, 0, 0, WIDTH, rows);
+
+        float us_per_sprite = (float)draw_us / ROTOZOOM_TEST_FRAMES / count;
+        printf("%7d %5.2fms %9.1fus %10.0f\n", count,
+               draw_us / 1000.0f / ROTOZOOM_TEST_FRAMES, us_per_sprite,
+               ROTOZOOM_TEST_FRAME_US / us_per_sprite);
+    }
+
+    scratch_release(frame);
+
+    printf("\n(times are the average per frame; the last column is how\n");
+    printf(" many rotated sprites one core could draw in 1/60 s)\n");
+}
+
+//
+// Vector Drawing Test
+//
+
+#define VECTOR_TEST_US (250000)
+#define VECTOR_TEST_BATCH (16)
+#define VECTOR_TEST_MARGIN (40)
+
+enum
+{
+    VECTOR_LINE,
+    VECTOR_HLINE,
+    VECTOR_CIRCLE,
+    VECTOR_FILL_CIRCLE,
+    VECTOR_FILL_ELLIPSE,
+    VECTOR_TRIANGLE,
+    VECTOR_STAR,
+    VECTOR_KINDS
+};
+
+static const char *vector_test_names[VECTOR_KINDS] = {
+    "Line", "H-line", "Circle", "Fill circle", "Fill ellipse", "Triangle", "Star",
+};
+
+// Cheap random numbers, so the timings are mostly drawing
+static uint32_t vector_test_seed = 1;
+
+static int vector_test_random(int range)
+{
+    vector_test_seed ^= vector_test_seed << 13;
+    vector_test_seed ^= vector_test_seed >> 17;
+    vector_test_seed ^= vector_test_seed << 5;
+    return vector_test_seed % range;
+}
+
+// A point anywhere on the screen or a little off it, so some shapes are clipped
+static int16_t vector_test_coord(int size)
+{
+    return vector_test_random(size + 2 * VECTOR_TEST_MARGIN) - VECTOR_TEST_MARGIN;
+}
+
+static void vector_test_draw(gfx_canvas_t *canvas, int kind)
+{
+    uint16_t colour = vector_test_random(0x10000);
+    int16_t x = vector_test_coord(WIDTH);
+    int16_t y = vector_test_coord(HEIGHT);
+
+    switch (kind)
+    {
+    case VECTOR_LINE:
+        gfx_draw_line(canvas, x, y, vector_test_coord(WIDTH), vector_test_coord(HEIGHT), colour);
+        break;
+    case VECTOR_HLINE:
+        gfx_draw_hline(canvas, x, y, vector_test_random(WIDTH), colour);
+        break;
+    case VECTOR_CIRCLE:
+        gfx_draw_circle(canvas, x, y, 4 + vector_test_random(40), colour);
+        break;
+    case VECTOR_FILL_CIRCLE:
+        gfx_fill_circle(canvas, x, y, 4 + vector_test_random(40), colour);
+        break;
+    case VECTOR_FILL_ELLIPSE:
+        gfx_fill_ellipse(canvas, x, y, 4 + vector_test_random(60), 4 + vector_test_random(30), colour);
+        break;
+    case VECTOR_TRIANGLE:
+    {
+        gfx_point_t points[3];
+        for (int i = 0; i < 3; i++)
+        {
+            points[i].x = x + vector_test_random(81) - 40;
+            points[i].y = y + vector_test_random(81) - 40;
+        }
+        gfx_fill_polygon(canvas, points, 3, colour);
+        break;
+    }
+    case VECTOR_STAR:
+    {
+        // Five-pointed star, concave, 50 pixels across
+        static const int8_t star[10][2] = {
+            {0, -25}, {6, -8}, {24, -8}, {10, 3}, {15, 20},
+            {0, 10}, {-15, 20}, {-10, 3}, {-24, -8}, {-6, -8},
+        };
+        gfx_point_t points[10];
+        for (int i = 0; i < 10; i++)
+        {
+            points[i].x = x + star[i][0];
+            points[i].y = y + star[i][1];
+        }
+        gfx_fill_polygon(canvas, points, 10, colour);
+        break;
+    }
+    }
+}
+
+void vectortest()
+{
+    uint16_t *frame = scratch_lease_any(WIDTH * HEIGHT * sizeof(uint16_t), "vector test");
+    if (frame == NULL)
+    {
+        printf("FAIL: Cannot lease a frame of scratch memory\n");
+        return;
+    }
+
+    gfx_canvas_t canvas;
+    gfx_canvas_init(&canvas, frame, WIDTH, HEIGHT);
+
+    uint32_t counts[VECTOR_KINDS] = {0};
+    int64_t draw_us[VECTOR_KINDS] = {0};
+    int64_t flush_us[VECTOR_KINDS] = {0};
+    uint8_t damage[VECTOR_KINDS] = {0};
+
+    for (int kind = 0; kind < VECTOR_KINDS && !user_interrupt; kind++)
+    {
+        gfx_canvas_clear(&canvas, 0);
+
+        absolute_time_t start_time = get_absolute_time();
+        do
+        {
+            for (int i = 0; i < VECTOR_TEST_BATCH; i++)
+            {
+                vector_test_draw(&canvas, kind);
+            }
+            counts[kind] += VECTOR_TEST_BATCH;
+            draw_us[kind] = absolute_time_diff_us(start_time, get_absolute_time());
+        } while (draw_us[kind] < VECTOR_TEST_US);
+
+        damage[kind] = canvas.damage_count;
+        start_time = get_absolute_time();
+        gfx_canvas_flush(&canvas, 0, 0);
+        flush_us[kind] = absolute_time_diff_us(start_time, get_absolute_time());
+    }
+
+    scratch_release(frame);
+
+    printf("\033[m\033[2J\033[H");
+    printf("Vector drawing test complete.\n\n");
+    printf("Primitive    Per sec Per frame     Flush\n");
+    for (int kind = 0; kind < VECTOR_KINDS; kind++)
+    {
+        if (counts[kind] == 0)
+        {
+            continue;
+        }
+        float per_second = counts[kind] * 1000000.0f / draw_us[kind];
+        printf("%-12s%8.0f%10.0f %5.1fms/%d\n", vector_test_names[kind], per_second, per_second / 60,
+               flush_us[kind] / 1000.0f, damage[kind]);
+    }
+
+    printf("\n(shapes are random and partly off screen;\n");
+    printf(" per frame is at 60 FPS; flush is the\n");
+    printf(" time to send the damaged areas / how\n");
+    printf(" many areas there were)\n");
+}
+
+//
+// Arbitrary-Precision Arithmetic Test
+//
+
+#define BIGNUM_TEST_US (100000)
+
+static const uint32_t bignum_test_limbs[] = {8, 16, 24, 32, 48, 64, 96, 128};
+
+static const struct
+{
+    const char *expression;
+    uint32_t digits;
+} bignum_test_sums[] = {
+    {"1000!", 30},
+    {"10000!", 30},
+    {"2^100000", 30},
+    {"pi", 1000},
+    {"e", 1000},
+    {"sqrt(2)", 1000},
+    {"pi", 5000},
+};
+
+// Average time of one product, in microseconds
+static float bignum_test_product(const bn_t *a, const bn_t *b)
+{
+    uint32_t count = 0;
+    int64_t elapsed_us;
+    absolute_time_t start_time = get_absolute_time();
+    do
+    {
+        uint32_t mark = bn_mark();
+        bn_t product;
+        bn_init(&product);
+        bn_mul(&product, a, b);
+        bn_release(mark);
+        count++;
+        elapsed_us = absolute_time_diff_us(start_time, get_absolute_time());
+    } while (elapsed_us < BIGNUM_TEST_US);
+    return (float)elapsed_us / count;
+}
+
+void bignumtest()
+{
+    scratch_arena_t arena;
+    if (!scratch_arena_open(&arena, 0, "bignum test"))
+    {
+        printf("FAIL: Cannot open a scratch memory arena\n");
+        return;
+    }
+
+    // One level of Karatsuba over schoolbook halves, against schoolbook throughout:
+    // BN_KARATSUBA_THRESHOLD should be about where the first starts to win
+    printf("Product of two n-limb numbers:\n\n");
+    printf("Limbs Schoolbook Karatsuba\n");
+    bn_use_arena(&arena);
+    for (size_t i = 0; i < sizeof(bignum_test_limbs) / sizeof(bignum_test_limbs[0]) && !user_interrupt; i++)
+    {
+        uint32_t limbs = bignum_test_limbs[i];
+        arena.used = 0;
+        bn_t a, b;
+        bn_init(&a);
+        bn_init(&b);
+        a.limb = scratch_arena_alloc(&arena, limbs * sizeof(uint32_t));
+        b.limb = scratch_arena_alloc(&arena, limbs * sizeof(uint32_t));
+        for (uint32_t j = 0; j < limbs; j++)
+        {
+            a.limb[j] = get_rand_32() | 1;
+            b.limb[j] = get_rand_32() | 1;
+        }
+        a.size = a.capacity = b.size = b.capacity = limbs;
+
+        bn_set_karatsuba_threshold(UINT32_MAX);
+        float school_us = bignum_test_product(&a, &b);
+        bn_set_karatsuba_threshold(limbs);
+        float karatsuba_us = bignum_test_product(&a, &b);
+        printf("%5lu %8.1fus %8.1fus\n", limbs, school_us, karatsuba_us);
+    }
+    bn_set_karatsuba_threshold(BN_KARATSUBA_THRESHOLD);
+
+    // Whole calculations, including the conversion to decimal
+    printf("\nCalculation       Digits      Time\n");
+    uint32_t precision = calc_get_precision();
+    calc_init(&arena);
+    for (size_t i = 0; i < sizeof(bignum_test_sums) / sizeof(bignum_test_sums[0]) && !user_interrupt; i++)
+    {
+        calc_set_precision(bignum_test_sums[i].digits);
+        calc_result_t result;
+        absolute_time_t start_time = get_absolute_time();
+        bool ok = calc_evaluate(bignum_test_sums[i].expression, &result);
+        int64_t elapsed_us = absolute_time_diff_us(start_time, get_absolute_time());
+        if (!ok)
+        {
+            printf("%-16s FAIL: %s\n", bignum_test_sums[i].expression, result.error);
+            continue;
+        }
+        printf("%-16s %7lu %8.3fs\n", bignum_test_sums[i].expression, result.length, elapsed_us / 1000000.0f);
+    }
+    calc_set_precision(precision);
+    scratch_arena_close(&arena);
+
+    printf("\n(BN_KARATSUBA_THRESHOLD is %d limbs)\n", BN_KARATSUBA_THRESHOLD);
+}
+
 // Song table for easy access
 const test_t tests[] = {
+    {"assets", assettest, "Asset Pack Test"},
     {"audio", audiotest, "Audio Driver Test"},
+    {"bignum", bignumtest, "Arbitrary-Precision Arithmetic Benchmark"},
+    {"clock", clocktest, "Clock Profile Test"},
+    {"defrag", defragtest, "Defragmentation Benchmark"},
     {"display", displaytest, "Display Driver Test"},
     {"fat32", fat32test, "FAT32 File System Test"},
+    {"fsck", fscktest, "File System Check Benchmark"},
     {"keyboard", keyboardtest, "Keyboard Driver Test"},
     {"lcd", lcdtest, "LCD Driver Test"},
+    {"map", maptest, "Tile Map Streaming Benchmark"},
+    {"mode7", mode7test, "Affine Plane Benchmark"},
+    {"particles", particletest, "Particle System Benchmark"},
+    {"rotozoom", rotozoomtest, "Rotated Sprite Benchmark"},
+    {"vector", vectortest, "Vector Drawing Benchmark"},
     {NULL, NULL, NULL} // End marker
 };
 
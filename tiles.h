@@ -6,7 +6,7 @@
 
 /*
    ======================================================================
-   TILESET (176 tiles, 16x16 RGB565)
+   TILESET (104 unique of 176 tiles, 16x16 RGB565)
    ----------------------------------------------------------------------
    Generated from ./data/Tileset.png
    ======================================================================
@@ -89,24 +89,6 @@ static const uint16_t my_tilesheet[] = {
     C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(4,7,6),C16(4,7,6),C16(4,7,6),
 
     /* === Tile 4 === */
-    C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),
-    C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),
-    C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),
-    C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),
-    C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),
-    C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),
-    C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),
-    C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),
-    C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),
-    C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),
-    C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),
-    C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),
-    C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),
-    C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),
-    C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),
-
-    /* === Tile 5 === */
     C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
     C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
     C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
@@ -124,7 +106,7 @@ static const uint16_t my_tilesheet[] = {
     C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
     C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
 
-    /* === Tile 6 === */
+    /* === Tile 5 === */
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
     C16(4,7,6),C16(14,40,3),C16(20,51,8),C16(28,50,6),C16(28,50,6),C16(20,51,8),C16(20,51,8),C16(20,51,8),C16(20,51,8),C16(20,51,8),C16(20,51,8),C16(20,51,8),C16(20,51,8),C16(20,51,8),C16(20,51,8),C16(20,51,8),
     C16(4,7,6),C16(5,33,1),C16(14,40,3),C16(28,50,6),C16(28,50,6),C16(28,50,6),C16(28,50,6),C16(14,40,3),C16(14,40,3),C16(14,40,3),C16(14,40,3),C16(14,40,3),C16(14,40,3),C16(14,40,3),C16(14,40,3),C16(14,40,3),
@@ -142,7 +124,7 @@ static const uint16_t my_tilesheet[] = {
     C16(4,7,6),C16(14,10,7),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(16,12,8),C16(4,7,6),C16(4,7,6),C16(14,10,7),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),
     C16(4,7,6),C16(16,12,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(14,10,7),C16(14,10,7),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(18,15,7),
 
-    /* === Tile 7 === */
+    /* === Tile 6 === */
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
     C16(20,51,8),C16(20,51,8),C16(20,51,8),C16(20,51,8),C16(28,50,6),C16(20,51,8),C16(20,51,8),C16(20,51,8),C16(20,51,8),C16(20,51,8),C16(20,51,8),C16(20,51,8),C16(20,51,8),C16(20,51,8),C16(20,51,8),C16(20,51,8),
     C16(14,40,3),C16(14,40,3),C16(28,50,6),C16(28,50,6),C16(28,50,6),C16(14,40,3),C16(14,40,3),C16(14,40,3),C16(14,40,3),C16(14,40,3),C16(14,40,3),C16(14,40,3),C16(14,40,3),C16(14,40,3),C16(14,40,3),C16(14,40,3),
@@ -160,7 +142,7 @@ static const uint16_t my_tilesheet[] = {
     C16(18,15,7),C16(18,15,7),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(16,12,8),C16(4,7,6),C16(4,7,6),C16(14,10,7),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),
     C16(18,15,7),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(14,10,7),C16(14,10,7),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(18,15,7),
 
-    /* === Tile 8 === */
+    /* === Tile 7 === */
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
     C16(20,51,8),C16(20,51,8),C16(20,51,8),C16(20,51,8),C16(20,51,8),C16(20,51,8),C16(20,51,8),C16(20,51,8),C16(20,51,8),C16(20,51,8),C16(20,51,8),C16(20,51,8),C16(20,51,8),C16(20,51,8),C16(28,60,18),C16(4,7,6),
     C16(14,40,3),C16(14,40,3),C16(28,50,6),C16(28,50,6),C16(14,40,3),C16(14,40,3),C16(14,40,3),C16(14,40,3),C16(14,40,3),C16(28,50,6),C16(28,50,6),C16(14,40,3),C16(14,40,3),C16(14,40,3),C16(20,51,8),C16(4,7,6),
@@ -178,7 +160,7 @@ static const uint16_t my_tilesheet[] = {
     C16(18,15,7),C16(18,15,7),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(14,10,7),C16(4,7,6),C16(4,7,6),C16(14,10,7),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(4,7,6),
     C16(18,15,7),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(14,10,7),C16(14,10,7),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(4,7,6),
 
-    /* === Tile 9 === */
+    /* === Tile 8 === */
     C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(18,15,7),C16(18,15,7),
     C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(20,17,8),
     C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(20,17,8),C16(20,17,8),
@@ -196,7 +178,7 @@ static const uint16_t my_tilesheet[] = {
     C16(18,15,7),C16(18,15,7),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(16,12,8),C16(16,12,8),C16(14,10,7),
     C16(18,15,7),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(4,7,6),C16(4,7,6),C16(4,7,6),
 
-    /* === Tile 10 === */
+    /* === Tile 9 === */
     C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(18,15,7),C16(18,15,7),
     C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(20,17,8),
     C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(20,17,8),C16(20,17,8),
@@ -214,25 +196,7 @@ static const uint16_t my_tilesheet[] = {
     C16(14,10,7),C16(14,10,7),C16(16,12,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(16,12,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(18,15,7),
 
-    /* === Tile 11 === */
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-
-    /* === Tile 12 === */
+    /* === Tile 10 === */
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
     C16(4,7,6),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(21,46,24),C16(27,56,28),C16(31,63,31),C16(31,63,31),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(31,63,31),C16(31,63,31),C16(31,63,31),C16(31,63,31),
     C16(4,7,6),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(21,46,24),C16(16,35,19),C16(27,56,28),C16(27,56,28),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(21,46,24),
@@ -250,7 +214,7 @@ static const uint16_t my_tilesheet[] = {
     C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(16,35,19),C16(16,35,19),
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
 
-    /* === Tile 13 === */
+    /* === Tile 11 === */
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
     C16(27,56,28),C16(27,56,28),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(21,46,24),C16(27,56,28),C16(27,56,28),
     C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),
@@ -268,7 +232,7 @@ static const uint16_t my_tilesheet[] = {
     C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(16,35,19),C16(16,35,19),
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
 
-    /* === Tile 14 === */
+    /* === Tile 12 === */
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
     C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(31,63,31),C16(31,63,31),C16(4,7,6),
     C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(16,35,19),C16(27,56,28),C16(4,7,6),
@@ -286,7 +250,7 @@ static const uint16_t my_tilesheet[] = {
     C16(21,46,24),C16(21,46,24),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
 
-    /* === Tile 15 === */
+    /* === Tile 13 === */
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
     C16(4,7,6),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(31,63,31),C16(4,7,6),
     C16(4,7,6),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(16,35,19),C16(16,35,19),C16(31,63,31),C16(4,7,6),
@@ -304,7 +268,7 @@ static const uint16_t my_tilesheet[] = {
     C16(4,7,6),C16(21,46,24),C16(27,56,28),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
     C16(4,7,6),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
 
-    /* === Tile 16 === */
+    /* === Tile 14 === */
     C16(4,7,6),C16(16,12,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),
     C16(4,7,6),C16(16,12,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),
     C16(4,7,6),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),
@@ -322,7 +286,7 @@ static const uint16_t my_tilesheet[] = {
     C16(4,7,6),C16(16,12,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),
     C16(4,7,6),C16(16,12,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),
 
-    /* === Tile 17 === */
+    /* === Tile 15 === */
     C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),
     C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),
     C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),
@@ -340,7 +304,7 @@ static const uint16_t my_tilesheet[] = {
     C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),
     C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),
 
-    /* === Tile 18 === */
+    /* === Tile 16 === */
     C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(4,7,6),
     C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(4,7,6),
     C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(25,39,13),C16(4,7,6),
@@ -358,7 +322,7 @@ static const uint16_t my_tilesheet[] = {
     C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(4,7,6),
     C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(4,7,6),
 
-    /* === Tile 19 === */
+    /* === Tile 17 === */
     C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
     C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),C16(4,7,6),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),
     C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),C16(4,7,6),C16(3,35,16),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),
@@ -376,7 +340,7 @@ static const uint16_t my_tilesheet[] = {
     C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(16,12,8),C16(16,12,8),
     C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),
 
-    /* === Tile 20 === */
+    /* === Tile 18 === */
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),
     C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(27,56,28),C16(12,54,17),C16(22,61,23),C16(4,7,6),C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),
     C16(6,44,14),C16(6,44,14),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(6,44,14),C16(12,54,17),C16(4,7,6),C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),
@@ -394,25 +358,7 @@ static const uint16_t my_tilesheet[] = {
     C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),
     C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),
 
-    /* === Tile 21 === */
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-
-    /* === Tile 22 === */
+    /* === Tile 19 === */
     C16(4,7,6),C16(16,12,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(18,15,7),C16(18,15,7),
     C16(4,7,6),C16(16,12,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(20,17,8),
     C16(4,7,6),C16(16,12,8),C16(20,17,8),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(20,17,8),C16(20,17,8),
@@ -430,7 +376,7 @@ static const uint16_t my_tilesheet[] = {
     C16(4,7,6),C16(14,10,7),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),
     C16(4,7,6),C16(16,12,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(18,15,7),
 
-    /* === Tile 23 === */
+    /* === Tile 20 === */
     C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(18,15,7),C16(18,15,7),
     C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(20,17,8),
     C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(20,17,8),C16(20,17,8),
@@ -448,7 +394,7 @@ static const uint16_t my_tilesheet[] = {
     C16(18,15,7),C16(18,15,7),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),
     C16(18,15,7),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(18,15,7),
 
-    /* === Tile 24 === */
+    /* === Tile 21 === */
     C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(20,17,8),C16(4,7,6),
     C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(18,15,7),C16(20,17,8),C16(4,7,6),
     C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(23,27,10),C16(4,7,6),
@@ -466,7 +412,7 @@ static const uint16_t my_tilesheet[] = {
     C16(18,15,7),C16(18,15,7),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(4,7,6),
     C16(18,15,7),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(4,7,6),
 
-    /* === Tile 25 === */
+    /* === Tile 22 === */
     C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(20,17,8),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
     C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(20,17,8),C16(4,7,6),C16(14,40,3),C16(20,51,8),C16(20,51,8),C16(20,51,8),C16(20,51,8),C16(20,51,8),C16(20,51,8),
     C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(20,17,8),C16(20,17,8),C16(4,7,6),C16(5,33,1),C16(14,40,3),C16(14,40,3),C16(14,40,3),C16(14,40,3),C16(14,40,3),C16(14,40,3),
@@ -484,7 +430,7 @@ static const uint16_t my_tilesheet[] = {
     C16(18,15,7),C16(18,15,7),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),
     C16(18,15,7),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(18,15,7),
 
-    /* === Tile 26 === */
+    /* === Tile 23 === */
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(18,15,7),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(18,15,7),C16(18,15,7),
     C16(20,51,8),C16(20,51,8),C16(20,51,8),C16(20,51,8),C16(28,50,6),C16(20,51,8),C16(28,60,18),C16(4,7,6),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(20,17,8),
     C16(14,40,3),C16(14,40,3),C16(28,50,6),C16(28,50,6),C16(28,50,6),C16(14,40,3),C16(20,51,8),C16(4,7,6),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(20,17,8),C16(20,17,8),
@@ -502,25 +448,7 @@ static const uint16_t my_tilesheet[] = {
     C16(18,15,7),C16(18,15,7),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),
     C16(18,15,7),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(18,15,7),
 
-    /* === Tile 27 === */
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-
-    /* === Tile 28 === */
+    /* === Tile 24 === */
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
     C16(4,7,6),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(31,63,31),C16(31,63,31),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(31,63,31),C16(31,63,31),C16(31,63,31),C16(4,7,6),
     C16(4,7,6),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(16,35,19),C16(16,35,19),C16(31,63,31),C16(4,7,6),
@@ -538,7 +466,7 @@ static const uint16_t my_tilesheet[] = {
     C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
 
-    /* === Tile 29 === */
+    /* === Tile 25 === */
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
     C16(4,7,6),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(31,63,31),C16(31,63,31),C16(27,56,28),
     C16(4,7,6),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(21,46,24),C16(21,46,24),
@@ -556,7 +484,7 @@ static const uint16_t my_tilesheet[] = {
     C16(4,7,6),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),
     C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(12,25,15),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),
 
-    /* === Tile 30 === */
+    /* === Tile 26 === */
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
     C16(27,56,28),C16(27,56,28),C16(31,63,31),C16(31,63,31),C16(31,63,31),C16(31,63,31),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(31,62,31),C16(4,7,6),
     C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(12,25,15),C16(12,25,15),C16(27,56,28),C16(4,7,6),
@@ -574,7 +502,7 @@ static const uint16_t my_tilesheet[] = {
     C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(27,56,28),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(31,63,31),C16(4,7,6),
     C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(31,63,31),C16(4,7,6),
 
-    /* === Tile 31 === */
+    /* === Tile 27 === */
     C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
     C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
     C16(4,7,6),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
@@ -592,7 +520,7 @@ static const uint16_t my_tilesheet[] = {
     C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
     C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
 
-    /* === Tile 32 === */
+    /* === Tile 28 === */
     C16(4,7,6),C16(16,12,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),
     C16(4,7,6),C16(16,12,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),
     C16(4,7,6),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),
@@ -610,7 +538,7 @@ static const uint16_t my_tilesheet[] = {
     C16(4,7,6),C16(16,12,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(16,12,8),C16(16,12,8),
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
 
-    /* === Tile 33 === */
+    /* === Tile 29 === */
     C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),
     C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),
     C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),
@@ -628,7 +556,7 @@ static const uint16_t my_tilesheet[] = {
     C16(16,12,8),C16(16,12,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(16,12,8),C16(16,12,8),
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
 
-    /* === Tile 34 === */
+    /* === Tile 30 === */
     C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(4,7,6),
     C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(4,7,6),
     C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(25,39,13),C16(4,7,6),
@@ -646,61 +574,7 @@ static const uint16_t my_tilesheet[] = {
     C16(16,12,8),C16(16,12,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(23,27,10),C16(4,7,6),
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
 
-    /* === Tile 35 === */
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-
-    /* === Tile 36 === */
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-
-    /* === Tile 37 === */
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-
-    /* === Tile 38 === */
+    /* === Tile 31 === */
     C16(4,7,6),C16(16,12,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(18,15,7),C16(18,15,7),
     C16(4,7,6),C16(16,12,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(20,17,8),
     C16(4,7,6),C16(16,12,8),C16(20,17,8),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(20,17,8),C16(20,17,8),
@@ -718,7 +592,7 @@ static const uint16_t my_tilesheet[] = {
     C16(4,7,6),C16(14,10,7),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(14,10,7),C16(14,10,7),C16(14,10,7),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(14,10,7),
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
 
-    /* === Tile 39 === */
+    /* === Tile 32 === */
     C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(18,15,7),C16(18,15,7),
     C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(20,17,8),
     C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(20,17,8),C16(20,17,8),
@@ -736,7 +610,7 @@ static const uint16_t my_tilesheet[] = {
     C16(14,10,7),C16(14,10,7),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(14,10,7),C16(14,10,7),C16(14,10,7),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(14,10,7),
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
 
-    /* === Tile 40 === */
+    /* === Tile 33 === */
     C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(18,15,7),C16(4,7,6),
     C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(4,7,6),
     C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(20,17,8),C16(14,10,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(23,27,10),C16(4,7,6),
@@ -754,115 +628,43 @@ static const uint16_t my_tilesheet[] = {
     C16(14,10,7),C16(14,10,7),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(14,10,7),C16(14,10,7),C16(14,10,7),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(20,17,8),C16(4,7,6),
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
 
-    /* === Tile 41 === */
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
+    /* === Tile 34 === */
+    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),
+    C16(4,7,6),C16(16,35,19),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(21,46,24),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),
+    C16(4,7,6),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),
+    C16(4,7,6),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),
+    C16(4,7,6),C16(21,46,24),C16(27,56,28),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),
+    C16(4,7,6),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),
+    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),
+    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(12,25,15),C16(16,35,19),C16(16,35,19),
+    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(21,46,24),
+    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(21,46,24),C16(21,46,24),
+    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(21,46,24),C16(21,46,24),C16(21,46,24),
+    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),
+    C16(4,7,6),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(27,56,28),
+    C16(4,7,6),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),
+    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
 
-    /* === Tile 42 === */
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
+    /* === Tile 35 === */
+    C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(12,25,15),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(4,7,6),
+    C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(21,46,24),C16(21,46,24),C16(12,25,15),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(21,46,24),C16(27,56,28),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(27,56,28),C16(27,56,28),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(27,56,28),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(21,46,24),C16(27,56,28),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(27,56,28),C16(27,56,28),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(12,25,15),C16(12,25,15),C16(27,56,28),C16(4,7,6),
+    C16(27,56,28),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(12,25,15),C16(12,25,15),C16(27,56,28),C16(4,7,6),
+    C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
 
-    /* === Tile 43 === */
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-
-    /* === Tile 44 === */
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-
-    /* === Tile 45 === */
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),
-    C16(4,7,6),C16(16,35,19),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(21,46,24),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),
-    C16(4,7,6),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),
-    C16(4,7,6),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),
-    C16(4,7,6),C16(21,46,24),C16(27,56,28),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),
-    C16(4,7,6),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(12,25,15),C16(16,35,19),C16(16,35,19),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(21,46,24),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(21,46,24),C16(21,46,24),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(21,46,24),C16(21,46,24),C16(21,46,24),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),
-    C16(4,7,6),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(27,56,28),
-    C16(4,7,6),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-
-    /* === Tile 46 === */
-    C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(12,25,15),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(4,7,6),
-    C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(21,46,24),C16(21,46,24),C16(12,25,15),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(21,46,24),C16(27,56,28),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(27,56,28),C16(27,56,28),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(27,56,28),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(21,46,24),C16(27,56,28),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(27,56,28),C16(27,56,28),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(12,25,15),C16(12,25,15),C16(27,56,28),C16(4,7,6),
-    C16(27,56,28),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(12,25,15),C16(12,25,15),C16(27,56,28),C16(4,7,6),
-    C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-
-    /* === Tile 47 === */
+    /* === Tile 36 === */
     C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(31,63,31),C16(4,7,6),
     C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(4,7,6),
     C16(4,7,6),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(4,7,6),
@@ -880,817 +682,187 @@ static const uint16_t my_tilesheet[] = {
     C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
 
-    /* === Tile 48 === */
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
+    /* === Tile 37 === */
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
+    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(16,35,19),
+    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
+    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
+    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
+    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
+    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
+    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
+    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
+    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
+    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
+    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
+    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
+    C16(4,7,6),C16(9,17,11),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(4,7,6),
+    C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(4,7,6),C16(4,7,6),
 
-    /* === Tile 49 === */
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
+    /* === Tile 38 === */
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
+    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(16,35,19),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(16,35,19),
+    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
+    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
+    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
+    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
+    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
+    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
+    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
+    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
+    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
+    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
+    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
+    C16(4,7,6),C16(9,17,11),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(4,7,6),
+    C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(4,7,6),C16(4,7,6),
 
-    /* === Tile 50 === */
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
+    /* === Tile 39 === */
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
+    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(16,35,19),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
+    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
+    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
+    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
+    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
+    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
+    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
+    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
+    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
+    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
+    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
+    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
+    C16(4,7,6),C16(9,17,11),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(4,7,6),
+    C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(4,7,6),C16(4,7,6),
 
-    /* === Tile 51 === */
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
+    /* === Tile 40 === */
+    C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(4,7,6),C16(4,7,6),
+    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(16,35,19),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
+    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
+    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
+    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
+    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
+    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
+    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
+    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
+    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
+    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
+    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
+    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
+    C16(4,7,6),C16(9,17,11),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(4,7,6),
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
 
-    /* === Tile 52 === */
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
+    /* === Tile 41 === */
+    C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(4,7,6),C16(4,7,6),
+    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(16,35,19),
+    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
+    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
+    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
+    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
+    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
+    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
+    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
+    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
+    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
+    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
+    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
+    C16(4,7,6),C16(9,17,11),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(4,7,6),
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
 
-    /* === Tile 53 === */
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-
-    /* === Tile 54 === */
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-
-    /* === Tile 55 === */
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-
-    /* === Tile 56 === */
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-
-    /* === Tile 57 === */
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-
-    /* === Tile 58 === */
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-
-    /* === Tile 59 === */
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-
-    /* === Tile 60 === */
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-
-    /* === Tile 61 === */
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-
-    /* === Tile 62 === */
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-
-    /* === Tile 63 === */
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-
-    /* === Tile 64 === */
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(16,35,19),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
-    C16(4,7,6),C16(9,17,11),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(4,7,6),
-    C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(4,7,6),C16(4,7,6),
-
-    /* === Tile 65 === */
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(16,35,19),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(16,35,19),
-    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
-    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
-    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
-    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
-    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
-    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
-    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
-    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
-    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
-    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
-    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
-    C16(4,7,6),C16(9,17,11),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(4,7,6),
-    C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(4,7,6),C16(4,7,6),
-
-    /* === Tile 66 === */
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(16,35,19),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(4,7,6),C16(9,17,11),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(4,7,6),
-    C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(4,7,6),C16(4,7,6),
-
-    /* === Tile 67 === */
-    C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(4,7,6),C16(4,7,6),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(16,35,19),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(4,7,6),C16(9,17,11),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(4,7,6),
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-
-    /* === Tile 68 === */
-    C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(4,7,6),C16(4,7,6),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(16,35,19),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
-    C16(4,7,6),C16(9,17,11),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(4,7,6),
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-
-    /* === Tile 69 === */
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-
-    /* === Tile 70 === */
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-    C16(4,7,6),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(31,63,31),C16(4,7,6),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),
-    C16(4,7,6),C16(9,17,11),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(16,35,19),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-    C16(4,7,6),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(21,46,24),C16(27,56,28),C16(31,63,31),C16(4,7,6),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(31,63,31),C16(4,7,6),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-
-    /* === Tile 71 === */
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-    C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),
-    C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),
-    C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(21,46,24),
-    C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),
-    C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),
-    C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(16,35,19),C16(16,35,19),
-    C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),
-    C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(4,7,6),
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(4,7,6),
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(4,7,6),
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(4,7,6),
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(4,7,6),
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-
-    /* === Tile 72 === */
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-    C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(31,63,31),C16(4,7,6),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(31,63,31),C16(4,7,6),
-    C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(21,46,24),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(12,25,15),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(9,17,11),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-    C16(4,7,6),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(31,63,31),C16(4,7,6),C16(21,46,24),C16(27,56,28),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(31,63,31),C16(4,7,6),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-
-    /* === Tile 73 === */
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(4,7,6),
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(4,7,6),
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(4,7,6),
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(4,7,6),
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(4,7,6),
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(31,63,31),C16(4,7,6),
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(4,7,6),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(31,63,31),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-
-    /* === Tile 74 === */
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-    C16(4,7,6),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(31,63,31),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-    C16(4,7,6),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(21,46,24),C16(27,56,28),C16(31,63,31),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(12,25,15),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(4,7,6),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(4,7,6),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(4,7,6),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(4,7,6),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(4,7,6),
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-
-    /* === Tile 75 === */
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-
-    /* === Tile 76 === */
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-    C16(4,7,6),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),
-    C16(4,7,6),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),
-    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),
-    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(12,54,17),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),
-    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(6,44,14),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),
-    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(6,44,14),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),
-    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(6,44,14),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),
-    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),
-    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),
-    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),
-    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),
-    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(2,22,13),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),
-    C16(4,7,6),C16(3,35,16),C16(2,22,13),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),
-    C16(4,7,6),C16(2,22,13),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-
-    /* === Tile 77 === */
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-    C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),
-    C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),
-    C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),
-    C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),
-    C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),
-    C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),
-    C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),
-    C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),
-    C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),
-    C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),
-    C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),
-    C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),
-    C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),
-    C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-
-    /* === Tile 78 === */
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-    C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(22,61,23),C16(4,7,6),
-    C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(22,61,23),C16(12,54,17),C16(4,7,6),
-    C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(31,63,31),C16(12,54,17),C16(12,54,17),C16(4,7,6),
-    C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(31,63,31),C16(31,63,31),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
-    C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(2,22,13),C16(31,63,31),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
-    C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(2,22,13),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
-    C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(2,22,13),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
-    C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(6,44,14),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
-    C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(6,44,14),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
-    C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(6,44,14),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
-    C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
-    C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(4,7,6),
-    C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(4,7,6),
-    C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(4,7,6),
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-
-    /* === Tile 79 === */
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-    C16(4,7,6),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(22,61,23),C16(4,7,6),
-    C16(4,7,6),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(22,61,23),C16(12,54,17),C16(4,7,6),
-    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(31,63,31),C16(12,54,17),C16(12,54,17),C16(4,7,6),
-    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(12,54,17),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(31,63,31),C16(31,63,31),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
-    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(6,44,14),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(2,22,13),C16(31,63,31),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
-    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(6,44,14),C16(3,35,16),C16(3,35,16),C16(2,22,13),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
-    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(6,44,14),C16(2,22,13),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
-    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
-    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
-    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
-    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
-    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
-    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
-    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
-    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
-
-    /* === Tile 80 === */
-    C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(4,7,6),C16(4,7,6),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(4,7,6),C16(9,17,11),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(4,7,6),
-    C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(4,7,6),C16(4,7,6),
-
-    /* === Tile 81 === */
-    C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(4,7,6),C16(4,7,6),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(9,17,11),C16(9,17,11),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(9,17,11),
-    C16(4,7,6),C16(9,17,11),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(4,7,6),
-    C16(4,7,6),C16(9,17,11),C16(12,25,15),C16(12,25,15),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(12,25,15),C16(12,25,15),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(4,7,6),
-    C16(4,7,6),C16(9,17,11),C16(12,25,15),C16(12,25,15),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(4,7,6),
-    C16(4,7,6),C16(9,17,11),C16(12,25,15),C16(12,25,15),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(4,7,6),
-    C16(4,7,6),C16(9,17,11),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(4,7,6),
-    C16(4,7,6),C16(9,17,11),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(4,7,6),
-    C16(4,7,6),C16(9,17,11),C16(12,25,15),C16(12,25,15),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(4,7,6),
-    C16(4,7,6),C16(9,17,11),C16(12,25,15),C16(12,25,15),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(4,7,6),
-    C16(4,7,6),C16(9,17,11),C16(12,25,15),C16(12,25,15),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(12,25,15),C16(12,25,15),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(4,7,6),
-    C16(4,7,6),C16(9,17,11),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(4,7,6),
-    C16(4,7,6),C16(9,17,11),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(4,7,6),
-    C16(4,7,6),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(12,25,15),C16(4,7,6),
-    C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(4,7,6),C16(4,7,6),
-
-    /* === Tile 82 === */
-    C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(4,7,6),C16(4,7,6),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(4,7,6),C16(9,17,11),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(4,7,6),
-    C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(4,7,6),C16(4,7,6),
-
-    /* === Tile 83 === */
+    /* === Tile 42 === */
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(16,35,19),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(4,7,6),C16(9,17,11),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(4,7,6),
-    C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(4,7,6),C16(4,7,6),
-
-    /* === Tile 84 === */
+    C16(4,7,6),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(31,63,31),C16(4,7,6),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),
+    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),
+    C16(4,7,6),C16(9,17,11),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),
+    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),
+    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),
+    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(16,35,19),
+    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),
+    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(16,35,19),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
-    C16(4,7,6),C16(9,17,11),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(4,7,6),
-    C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(4,7,6),C16(4,7,6),
-
-    /* === Tile 85 === */
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-
-    /* === Tile 86 === */
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(4,7,6),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(4,7,6),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(4,7,6),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(4,7,6),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(4,7,6),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
+    C16(4,7,6),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(21,46,24),C16(27,56,28),C16(31,63,31),C16(4,7,6),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(31,63,31),C16(4,7,6),
+    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
     C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
 
-    /* === Tile 87 === */
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
+    /* === Tile 43 === */
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-
-    /* === Tile 88 === */
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(4,7,6),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(4,7,6),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-
-    /* === Tile 89 === */
+    C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),
+    C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),
+    C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(21,46,24),
+    C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),
+    C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),
+    C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(16,35,19),C16(16,35,19),
+    C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),
+    C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-    C16(4,7,6),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(4,7,6),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(31,63,31),C16(4,7,6),
-    C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(4,7,6),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(12,25,15),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(9,17,11),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(4,7,6),
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(4,7,6),
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(4,7,6),
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(4,7,6),
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(4,7,6),
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(31,63,31),C16(4,7,6),
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
+
+    /* === Tile 44 === */
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
+    C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(31,63,31),C16(4,7,6),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(31,63,31),C16(4,7,6),
+    C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(21,46,24),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(12,25,15),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(9,17,11),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
+    C16(4,7,6),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(31,63,31),C16(4,7,6),C16(21,46,24),C16(27,56,28),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(31,63,31),C16(4,7,6),
+    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
 
-    /* === Tile 90 === */
+    /* === Tile 45 === */
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-    C16(4,7,6),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(31,63,31),C16(4,7,6),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(31,63,31),C16(4,7,6),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(21,46,24),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(4,7,6),
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(4,7,6),
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(4,7,6),
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(4,7,6),
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(4,7,6),
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-    C16(4,7,6),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-    C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-    C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-    C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-    C16(4,7,6),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(31,63,31),C16(4,7,6),
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(4,7,6),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(31,63,31),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
 
-    /* === Tile 91 === */
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-
-    /* === Tile 92 === */
+    /* === Tile 46 === */
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-    C16(4,7,6),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(22,61,23),C16(4,7,6),
-    C16(4,7,6),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(22,61,23),C16(12,54,17),C16(4,7,6),
-    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(31,63,31),C16(12,54,17),C16(12,54,17),C16(4,7,6),
-    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(12,54,17),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(31,63,31),C16(31,63,31),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
-    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(6,44,14),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(2,22,13),C16(31,63,31),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
-    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(6,44,14),C16(3,35,16),C16(3,35,16),C16(2,22,13),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
-    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(6,44,14),C16(2,22,13),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
-    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(22,61,23),C16(6,44,14),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
-    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(6,44,14),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
-    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(6,44,14),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
-    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
-    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(2,22,13),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(4,7,6),
-    C16(4,7,6),C16(3,35,16),C16(2,22,13),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(4,7,6),
-    C16(4,7,6),C16(2,22,13),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(4,7,6),
+    C16(4,7,6),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(31,63,31),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
+    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
+    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
+    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
+    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
+    C16(4,7,6),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(21,46,24),C16(27,56,28),C16(31,63,31),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
+    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
+    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(12,25,15),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
+    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(4,7,6),
+    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(4,7,6),
+    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(4,7,6),
+    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(4,7,6),
+    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(4,7,6),
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
 
-    /* === Tile 93 === */
+    /* === Tile 47 === */
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
     C16(4,7,6),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),
     C16(4,7,6),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),
@@ -1699,16 +871,34 @@ static const uint16_t my_tilesheet[] = {
     C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(6,44,14),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),
     C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(6,44,14),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),
     C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(6,44,14),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),
-    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(6,44,14),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),
-    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),
-    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),
-    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),
-    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(12,54,17),
-    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),
-    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),
-    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(6,44,14),C16(6,44,14),C16(6,44,14),
+    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),
+    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),
+    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),
+    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),
+    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(2,22,13),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),
+    C16(4,7,6),C16(3,35,16),C16(2,22,13),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),
+    C16(4,7,6),C16(2,22,13),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
 
-    /* === Tile 94 === */
+    /* === Tile 48 === */
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
+    C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),
+    C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),
+    C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),
+    C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),
+    C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),
+    C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),
+    C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),
+    C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),
+    C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),
+    C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),
+    C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),
+    C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),
+    C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),
+    C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
+
+    /* === Tile 49 === */
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
     C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(22,61,23),C16(4,7,6),
     C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(22,61,23),C16(12,54,17),C16(4,7,6),
@@ -1717,24 +907,24 @@ static const uint16_t my_tilesheet[] = {
     C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(2,22,13),C16(31,63,31),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
     C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(2,22,13),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
     C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(2,22,13),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
-    C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(2,22,13),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
-    C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
-    C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(22,61,23),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
-    C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(22,61,23),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
-    C16(12,54,17),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(22,61,23),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
-    C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(22,61,23),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
-    C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(22,61,23),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
-    C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(22,61,23),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
+    C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(6,44,14),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
+    C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(6,44,14),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
+    C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(6,44,14),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
+    C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
+    C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(4,7,6),
+    C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(4,7,6),
+    C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(4,7,6),
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
 
-    /* === Tile 95 === */
-    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
-    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
-    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
-    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
-    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
-    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
-    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
-    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
+    /* === Tile 50 === */
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
+    C16(4,7,6),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(22,61,23),C16(4,7,6),
+    C16(4,7,6),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(22,61,23),C16(12,54,17),C16(4,7,6),
+    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(31,63,31),C16(12,54,17),C16(12,54,17),C16(4,7,6),
+    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(12,54,17),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(31,63,31),C16(31,63,31),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
+    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(6,44,14),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(2,22,13),C16(31,63,31),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
+    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(6,44,14),C16(3,35,16),C16(3,35,16),C16(2,22,13),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
+    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(6,44,14),C16(2,22,13),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
     C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
     C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
     C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
@@ -1744,285 +934,159 @@ static const uint16_t my_tilesheet[] = {
     C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
     C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
 
-    /* === Tile 96 === */
+    /* === Tile 51 === */
     C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(4,7,6),C16(4,7,6),
     C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(16,35,19),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
     C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
-    C16(4,7,6),C16(9,17,11),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(4,7,6),
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-
-    /* === Tile 97 === */
-    C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(4,7,6),C16(4,7,6),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(16,35,19),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(16,35,19),
-    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
-    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
-    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
-    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
-    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
-    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
-    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
-    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
-    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
-    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
-    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
-    C16(4,7,6),C16(9,17,11),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(4,7,6),
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-
-    /* === Tile 98 === */
-    C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(4,7,6),C16(4,7,6),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(16,35,19),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
-    C16(4,7,6),C16(9,17,11),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(4,7,6),
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-
-    /* === Tile 99 === */
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
+    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
+    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
+    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
+    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
+    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
+    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
+    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
+    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
+    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
+    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
+    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
+    C16(4,7,6),C16(9,17,11),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(4,7,6),
+    C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(4,7,6),C16(4,7,6),
 
-    /* === Tile 100 === */
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
+    /* === Tile 52 === */
+    C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(4,7,6),C16(4,7,6),
+    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
+    C16(9,17,11),C16(9,17,11),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(9,17,11),
+    C16(4,7,6),C16(9,17,11),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(4,7,6),
+    C16(4,7,6),C16(9,17,11),C16(12,25,15),C16(12,25,15),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(12,25,15),C16(12,25,15),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(4,7,6),
+    C16(4,7,6),C16(9,17,11),C16(12,25,15),C16(12,25,15),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(4,7,6),
+    C16(4,7,6),C16(9,17,11),C16(12,25,15),C16(12,25,15),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(4,7,6),
+    C16(4,7,6),C16(9,17,11),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(4,7,6),
+    C16(4,7,6),C16(9,17,11),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(4,7,6),
+    C16(4,7,6),C16(9,17,11),C16(12,25,15),C16(12,25,15),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(4,7,6),
+    C16(4,7,6),C16(9,17,11),C16(12,25,15),C16(12,25,15),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(4,7,6),
+    C16(4,7,6),C16(9,17,11),C16(12,25,15),C16(12,25,15),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(12,25,15),C16(12,25,15),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(4,7,6),
+    C16(4,7,6),C16(9,17,11),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(4,7,6),
+    C16(4,7,6),C16(9,17,11),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(4,7,6),
+    C16(4,7,6),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(12,25,15),C16(4,7,6),
+    C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(4,7,6),C16(4,7,6),
 
-    /* === Tile 101 === */
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
+    /* === Tile 53 === */
+    C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(4,7,6),C16(4,7,6),
+    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
+    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
+    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
+    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
+    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
+    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
+    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
+    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
+    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
+    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
+    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
+    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
+    C16(4,7,6),C16(9,17,11),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(4,7,6),
+    C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(4,7,6),C16(4,7,6),
 
-    /* === Tile 102 === */
+    /* === Tile 54 === */
+    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
+    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(4,7,6),
+    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(4,7,6),
+    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(4,7,6),
+    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(4,7,6),
+    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(4,7,6),
+    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
+    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
+    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
+    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
     C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(31,63,31),C16(4,7,6),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(16,35,19),C16(21,46,24),C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
+    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
+    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
+    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
+    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
+    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
+
+    /* === Tile 55 === */
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-    C16(4,7,6),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(21,46,24),C16(27,56,28),C16(31,63,31),C16(4,7,6),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(12,25,15),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(16,35,19),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-
-    /* === Tile 103 === */
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-    C16(4,7,6),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-    C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-    C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-    C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-    C16(4,7,6),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-    C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),
-    C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),
-    C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(16,35,19),C16(16,35,19),
-    C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),
-    C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),
-    C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(21,46,24),
-    C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),
-    C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-
-    /* === Tile 104 === */
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(4,7,6),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(31,63,31),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-    C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(31,63,31),C16(4,7,6),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(31,63,31),C16(4,7,6),
-    C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(21,46,24),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(21,46,24),C16(4,7,6),
-    C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
-    C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
 
-    /* === Tile 105 === */
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-
-    /* === Tile 106 === */
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-
-    /* === Tile 107 === */
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-
-    /* === Tile 108 === */
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
+    /* === Tile 56 === */
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(4,7,6),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(4,7,6),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
 
-    /* === Tile 109 === */
-    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(6,44,14),C16(6,44,14),C16(6,44,14),
-    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),
-    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),
-    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(12,54,17),
-    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),
-    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),
-    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(3,35,16),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),
-    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),
-    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),
-    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),
-    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),
-    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),
-    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(2,22,13),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),
-    C16(4,7,6),C16(3,35,16),C16(2,22,13),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),
-    C16(4,7,6),C16(2,22,13),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),
+    /* === Tile 57 === */
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
+    C16(4,7,6),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(4,7,6),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(31,63,31),C16(4,7,6),
+    C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(4,7,6),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(12,25,15),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(9,17,11),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(31,63,31),C16(4,7,6),
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
 
-    /* === Tile 110 === */
-    C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(22,61,23),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
-    C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(22,61,23),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
-    C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(22,61,23),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
-    C16(12,54,17),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(22,61,23),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
-    C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(22,61,23),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
-    C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(22,61,23),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
-    C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(12,54,17),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
-    C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(6,44,14),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
-    C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(6,44,14),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
-    C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(6,44,14),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
-    C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(6,44,14),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
-    C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
-    C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(4,7,6),
-    C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(4,7,6),
-    C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(4,7,6),
+    /* === Tile 58 === */
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
+    C16(4,7,6),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(31,63,31),C16(4,7,6),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(31,63,31),C16(4,7,6),
+    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
+    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(21,46,24),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
+    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
+    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
+    C16(4,7,6),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
+    C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
+    C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
+    C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
+    C16(4,7,6),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
 
-    /* === Tile 111 === */
-    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
-    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
-    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
-    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
-    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
-    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
-    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
-    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
+    /* === Tile 59 === */
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
+    C16(4,7,6),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(22,61,23),C16(4,7,6),
+    C16(4,7,6),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(22,61,23),C16(12,54,17),C16(4,7,6),
+    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(31,63,31),C16(12,54,17),C16(12,54,17),C16(4,7,6),
+    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(12,54,17),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(31,63,31),C16(31,63,31),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
+    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(6,44,14),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(2,22,13),C16(31,63,31),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
+    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(6,44,14),C16(3,35,16),C16(3,35,16),C16(2,22,13),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
+    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(6,44,14),C16(2,22,13),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
     C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(22,61,23),C16(6,44,14),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
     C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(6,44,14),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
     C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(6,44,14),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
@@ -2032,295 +1096,187 @@ static const uint16_t my_tilesheet[] = {
     C16(4,7,6),C16(2,22,13),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(4,7,6),
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
 
-    /* === Tile 112 === */
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-
-    /* === Tile 113 === */
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-
-    /* === Tile 114 === */
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-
-    /* === Tile 115 === */
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-
-    /* === Tile 116 === */
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-
-    /* === Tile 117 === */
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-
-    /* === Tile 118 === */
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
+    /* === Tile 60 === */
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
+    C16(4,7,6),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),
+    C16(4,7,6),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),
+    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),
+    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(12,54,17),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),
+    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(6,44,14),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),
+    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(6,44,14),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),
+    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(6,44,14),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),
+    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(6,44,14),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),
+    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),
+    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),
+    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),
+    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(12,54,17),
+    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),
+    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),
+    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(6,44,14),C16(6,44,14),C16(6,44,14),
 
-    /* === Tile 119 === */
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
+    /* === Tile 61 === */
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
+    C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(22,61,23),C16(4,7,6),
+    C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(22,61,23),C16(12,54,17),C16(4,7,6),
+    C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(31,63,31),C16(12,54,17),C16(12,54,17),C16(4,7,6),
+    C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(31,63,31),C16(31,63,31),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
+    C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(2,22,13),C16(31,63,31),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
+    C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(2,22,13),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
+    C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(2,22,13),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
+    C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(2,22,13),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
+    C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
+    C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(22,61,23),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
+    C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(22,61,23),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
+    C16(12,54,17),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(22,61,23),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
+    C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(22,61,23),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
+    C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(22,61,23),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
+    C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(22,61,23),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
 
-    /* === Tile 120 === */
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
+    /* === Tile 62 === */
+    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
+    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
+    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
+    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
+    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
+    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
+    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
+    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
+    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
+    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
+    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
+    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
+    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
+    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
+    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
+    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
 
-    /* === Tile 121 === */
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
+    /* === Tile 63 === */
+    C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(4,7,6),C16(4,7,6),
+    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(16,35,19),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(16,35,19),
+    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
+    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
+    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
+    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
+    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
+    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
+    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
+    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
+    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
+    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
+    C16(9,17,11),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(9,17,11),
+    C16(4,7,6),C16(9,17,11),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(4,7,6),
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
 
-    /* === Tile 122 === */
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
+    /* === Tile 64 === */
+    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
+    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(31,63,31),C16(4,7,6),
+    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(12,25,15),C16(16,35,19),C16(21,46,24),C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
+    C16(4,7,6),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(21,46,24),C16(27,56,28),C16(31,63,31),C16(4,7,6),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),
+    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),
+    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(12,25,15),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(16,35,19),
+    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),
+    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),
+    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),
+    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),
+    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
 
-    /* === Tile 123 === */
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
+    /* === Tile 65 === */
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
+    C16(4,7,6),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
+    C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
+    C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
+    C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
+    C16(4,7,6),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(9,17,11),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
+    C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),
+    C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),
+    C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(16,35,19),C16(16,35,19),
+    C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),
+    C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),
+    C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(21,46,24),
+    C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),
+    C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
 
-    /* === Tile 124 === */
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
+    /* === Tile 66 === */
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(4,7,6),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(31,63,31),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
+    C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(31,63,31),C16(4,7,6),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(31,63,31),C16(4,7,6),
+    C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(21,46,24),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(21,46,24),C16(21,46,24),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(16,35,19),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(12,25,15),C16(21,46,24),C16(4,7,6),
+    C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
+    C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
 
-    /* === Tile 125 === */
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
+    /* === Tile 67 === */
+    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(6,44,14),C16(6,44,14),C16(6,44,14),
+    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),
+    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),
+    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(12,54,17),
+    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),
+    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),
+    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(3,35,16),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),
+    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),
+    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),
+    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),
+    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),
+    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),
+    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(2,22,13),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),
+    C16(4,7,6),C16(3,35,16),C16(2,22,13),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),
+    C16(4,7,6),C16(2,22,13),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
 
-    /* === Tile 126 === */
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
+    /* === Tile 68 === */
+    C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(22,61,23),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
+    C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(22,61,23),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
+    C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(22,61,23),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
+    C16(12,54,17),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(22,61,23),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
+    C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(22,61,23),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
+    C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(22,61,23),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
+    C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(12,54,17),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
+    C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(6,44,14),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
+    C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(6,44,14),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
+    C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(6,44,14),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
+    C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(6,44,14),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
+    C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
+    C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(4,7,6),
+    C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(4,7,6),
+    C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(4,7,6),
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
 
-    /* === Tile 127 === */
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
+    /* === Tile 69 === */
+    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
+    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
+    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
+    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
+    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
+    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
+    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
+    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
+    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(22,61,23),C16(6,44,14),C16(3,35,16),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
+    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(6,44,14),C16(3,35,16),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
+    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(6,44,14),C16(22,61,23),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
+    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(4,7,6),
+    C16(4,7,6),C16(3,35,16),C16(3,35,16),C16(2,22,13),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(4,7,6),
+    C16(4,7,6),C16(3,35,16),C16(2,22,13),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(12,54,17),C16(4,7,6),
+    C16(4,7,6),C16(2,22,13),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(3,35,16),C16(6,44,14),C16(4,7,6),
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
 
-    /* === Tile 128 === */
+    /* === Tile 70 === */
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
     C16(4,7,6),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),
     C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),
@@ -2338,7 +1294,7 @@ static const uint16_t my_tilesheet[] = {
     C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),
     C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),
 
-    /* === Tile 129 === */
+    /* === Tile 71 === */
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
     C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),
     C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),
@@ -2356,7 +1312,7 @@ static const uint16_t my_tilesheet[] = {
     C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),
     C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),
 
-    /* === Tile 130 === */
+    /* === Tile 72 === */
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
     C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(31,63,31),C16(4,7,6),
     C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
@@ -2374,7 +1330,7 @@ static const uint16_t my_tilesheet[] = {
     C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
     C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
 
-    /* === Tile 131 === */
+    /* === Tile 73 === */
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
@@ -2392,7 +1348,7 @@ static const uint16_t my_tilesheet[] = {
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
 
-    /* === Tile 132 === */
+    /* === Tile 74 === */
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
@@ -2406,29 +1362,11 @@ static const uint16_t my_tilesheet[] = {
     C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(12,25,15),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
     C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(9,17,11),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
     C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-    C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-    C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
-
-    /* === Tile 133 === */
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
+    C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(4,7,6),C16(4,7,6),
+    C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
+    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
 
-    /* === Tile 134 === */
+    /* === Tile 75 === */
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
     C16(4,7,6),C16(23,27,10),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(23,27,10),
     C16(4,7,6),C16(18,15,7),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(18,15,7),
@@ -2446,7 +1384,7 @@ static const uint16_t my_tilesheet[] = {
     C16(4,7,6),C16(16,12,8),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(4,7,6),
     C16(4,7,6),C16(4,7,6),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(4,7,6),C16(4,7,6),
 
-    /* === Tile 135 === */
+    /* === Tile 76 === */
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
     C16(23,27,10),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(23,27,10),
     C16(18,15,7),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(18,15,7),
@@ -2464,7 +1402,7 @@ static const uint16_t my_tilesheet[] = {
     C16(4,7,6),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(4,7,6),
     C16(4,7,6),C16(4,7,6),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(4,7,6),C16(4,7,6),
 
-    /* === Tile 136 === */
+    /* === Tile 77 === */
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
     C16(23,27,10),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(28,50,18),C16(4,7,6),
     C16(18,15,7),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(25,39,13),C16(4,7,6),
@@ -2482,7 +1420,7 @@ static const uint16_t my_tilesheet[] = {
     C16(4,7,6),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(23,27,10),C16(4,7,6),
     C16(4,7,6),C16(4,7,6),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(18,15,7),C16(4,7,6),C16(4,7,6),
 
-    /* === Tile 137 === */
+    /* === Tile 78 === */
     C16(4,7,6),C16(4,7,6),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(4,7,6),C16(4,7,6),
     C16(4,7,6),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(4,7,6),
     C16(16,12,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(18,15,7),
@@ -2500,7 +1438,7 @@ static const uint16_t my_tilesheet[] = {
     C16(4,7,6),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(4,7,6),
     C16(4,7,6),C16(4,7,6),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(4,7,6),C16(4,7,6),C16(4,7,6),
 
-    /* === Tile 138 === */
+    /* === Tile 79 === */
     C16(4,7,6),C16(4,7,6),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(4,7,6),C16(4,7,6),
     C16(4,7,6),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(4,7,6),
     C16(18,15,7),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(16,12,8),
@@ -2518,25 +1456,7 @@ static const uint16_t my_tilesheet[] = {
     C16(4,7,6),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(4,7,6),
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(4,7,6),C16(4,7,6),
 
-    /* === Tile 139 === */
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-
-    /* === Tile 140 === */
+    /* === Tile 80 === */
     C16(0,0,0),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(0,0,0),
     C16(4,7,6),C16(23,27,10),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(28,50,18),C16(4,7,6),
     C16(4,7,6),C16(18,15,7),C16(4,7,6),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(4,7,6),C16(4,7,6),C16(25,39,13),C16(16,12,8),
@@ -2554,7 +1474,7 @@ static const uint16_t my_tilesheet[] = {
     C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
     C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
 
-    /* === Tile 141 === */
+    /* === Tile 81 === */
     C16(0,0,0),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(0,0,0),
     C16(4,7,6),C16(23,27,10),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(28,50,18),C16(4,7,6),
     C16(16,12,8),C16(18,15,7),C16(4,7,6),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(4,7,6),C16(4,7,6),C16(25,39,13),C16(16,12,8),
@@ -2572,7 +1492,7 @@ static const uint16_t my_tilesheet[] = {
     C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
     C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
 
-    /* === Tile 142 === */
+    /* === Tile 82 === */
     C16(0,0,0),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(0,0,0),
     C16(4,7,6),C16(23,27,10),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(28,50,18),C16(4,7,6),
     C16(16,12,8),C16(18,15,7),C16(4,7,6),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(4,7,6),C16(4,7,6),C16(25,39,13),C16(4,7,6),
@@ -2590,25 +1510,7 @@ static const uint16_t my_tilesheet[] = {
     C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
     C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
 
-    /* === Tile 143 === */
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-
-    /* === Tile 144 === */
+    /* === Tile 83 === */
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
     C16(4,7,6),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(31,63,31),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
     C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(9,17,11),C16(4,7,6),C16(4,7,6),C16(4,7,6),
@@ -2626,7 +1528,7 @@ static const uint16_t my_tilesheet[] = {
     C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
     C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
 
-    /* === Tile 145 === */
+    /* === Tile 84 === */
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
@@ -2644,7 +1546,7 @@ static const uint16_t my_tilesheet[] = {
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
 
-    /* === Tile 146 === */
+    /* === Tile 85 === */
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(31,63,31),C16(4,7,6),
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
@@ -2662,7 +1564,7 @@ static const uint16_t my_tilesheet[] = {
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
 
-    /* === Tile 147 === */
+    /* === Tile 86 === */
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),
@@ -2680,7 +1582,7 @@ static const uint16_t my_tilesheet[] = {
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),
 
-    /* === Tile 148 === */
+    /* === Tile 87 === */
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
     C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
     C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
@@ -2698,25 +1600,7 @@ static const uint16_t my_tilesheet[] = {
     C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
     C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
 
-    /* === Tile 149 === */
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-
-    /* === Tile 150 === */
+    /* === Tile 88 === */
     C16(4,7,6),C16(4,7,6),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(4,7,6),C16(4,7,6),
     C16(4,7,6),C16(23,27,10),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(4,7,6),
     C16(4,7,6),C16(18,15,7),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(18,15,7),
@@ -2734,7 +1618,7 @@ static const uint16_t my_tilesheet[] = {
     C16(4,7,6),C16(16,12,8),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(4,7,6),
     C16(4,7,6),C16(4,7,6),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(4,7,6),C16(4,7,6),
 
-    /* === Tile 151 === */
+    /* === Tile 89 === */
     C16(4,7,6),C16(4,7,6),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(4,7,6),C16(4,7,6),
     C16(4,7,6),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(4,7,6),
     C16(16,12,8),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(16,12,8),
@@ -2752,7 +1636,7 @@ static const uint16_t my_tilesheet[] = {
     C16(4,7,6),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(4,7,6),
     C16(4,7,6),C16(4,7,6),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(4,7,6),C16(4,7,6),
 
-    /* === Tile 152 === */
+    /* === Tile 90 === */
     C16(4,7,6),C16(4,7,6),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(18,15,7),C16(4,7,6),C16(4,7,6),
     C16(4,7,6),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(28,50,18),C16(4,7,6),
     C16(18,15,7),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(25,39,13),C16(4,7,6),
@@ -2770,7 +1654,7 @@ static const uint16_t my_tilesheet[] = {
     C16(4,7,6),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(23,27,10),C16(4,7,6),
     C16(4,7,6),C16(4,7,6),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(18,15,7),C16(4,7,6),C16(4,7,6),
 
-    /* === Tile 153 === */
+    /* === Tile 91 === */
     C16(4,7,6),C16(4,7,6),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
     C16(4,7,6),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(28,50,18),C16(23,27,10),
     C16(16,12,8),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(18,15,7),
@@ -2788,7 +1672,7 @@ static const uint16_t my_tilesheet[] = {
     C16(4,7,6),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(4,7,6),
     C16(4,7,6),C16(4,7,6),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(4,7,6),C16(4,7,6),
 
-    /* === Tile 154 === */
+    /* === Tile 92 === */
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(4,7,6),C16(4,7,6),
     C16(23,27,10),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(4,7,6),
     C16(18,15,7),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(16,12,8),
@@ -2806,25 +1690,7 @@ static const uint16_t my_tilesheet[] = {
     C16(4,7,6),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(4,7,6),
     C16(4,7,6),C16(4,7,6),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(4,7,6),C16(4,7,6),
 
-    /* === Tile 155 === */
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-
-    /* === Tile 156 === */
+    /* === Tile 93 === */
     C16(0,0,0),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
     C16(4,7,6),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(31,63,31),C16(4,7,6),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),
     C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),
@@ -2842,7 +1708,7 @@ static const uint16_t my_tilesheet[] = {
     C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
     C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
 
-    /* === Tile 157 === */
+    /* === Tile 94 === */
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
     C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),
     C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),
@@ -2860,7 +1726,7 @@ static const uint16_t my_tilesheet[] = {
     C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
     C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
 
-    /* === Tile 158 === */
+    /* === Tile 95 === */
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(0,0,0),
     C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(31,63,31),C16(4,7,6),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(31,63,31),C16(4,7,6),
     C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
@@ -2878,25 +1744,7 @@ static const uint16_t my_tilesheet[] = {
     C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
     C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
 
-    /* === Tile 159 === */
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-
-    /* === Tile 160 === */
+    /* === Tile 96 === */
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
     C16(4,7,6),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(31,63,31),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
     C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
@@ -2914,7 +1762,7 @@ static const uint16_t my_tilesheet[] = {
     C16(4,7,6),C16(12,25,15),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
 
-    /* === Tile 161 === */
+    /* === Tile 97 === */
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
@@ -2932,7 +1780,7 @@ static const uint16_t my_tilesheet[] = {
     C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
 
-    /* === Tile 162 === */
+    /* === Tile 98 === */
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(21,46,24),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(27,56,28),C16(31,63,31),C16(4,7,6),
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(16,35,19),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(21,46,24),C16(27,56,28),C16(4,7,6),
@@ -2950,61 +1798,7 @@ static const uint16_t my_tilesheet[] = {
     C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(16,35,19),C16(21,46,24),C16(4,7,6),
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
 
-    /* === Tile 163 === */
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-
-    /* === Tile 164 === */
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-
-    /* === Tile 165 === */
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-
-    /* === Tile 166 === */
+    /* === Tile 99 === */
     C16(4,7,6),C16(4,7,6),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(4,7,6),C16(4,7,6),
     C16(4,7,6),C16(23,27,10),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(4,7,6),
     C16(4,7,6),C16(18,15,7),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(18,15,7),
@@ -3022,7 +1816,7 @@ static const uint16_t my_tilesheet[] = {
     C16(4,7,6),C16(16,12,8),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(4,7,6),
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
 
-    /* === Tile 167 === */
+    /* === Tile 100 === */
     C16(4,7,6),C16(4,7,6),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(4,7,6),C16(4,7,6),
     C16(4,7,6),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(4,7,6),
     C16(18,15,7),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(18,15,7),
@@ -3040,7 +1834,7 @@ static const uint16_t my_tilesheet[] = {
     C16(4,7,6),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(4,7,6),
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
 
-    /* === Tile 168 === */
+    /* === Tile 101 === */
     C16(4,7,6),C16(4,7,6),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(16,12,8),C16(18,15,7),C16(4,7,6),C16(4,7,6),
     C16(4,7,6),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(25,39,13),C16(28,50,18),C16(4,7,6),
     C16(18,15,7),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(23,27,10),C16(25,39,13),C16(4,7,6),
@@ -3058,61 +1852,7 @@ static const uint16_t my_tilesheet[] = {
     C16(4,7,6),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(18,15,7),C16(23,27,10),C16(4,7,6),
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),
 
-    /* === Tile 169 === */
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-
-    /* === Tile 170 === */
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-
-    /* === Tile 171 === */
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-
-    /* === Tile 172 === */
+    /* === Tile 102 === */
     C16(0,0,0),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(0,0,0),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(0,0,0),
     C16(4,7,6),C16(12,54,17),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(31,63,31),C16(31,63,31),C16(4,7,6),C16(12,54,17),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(31,63,31),C16(31,63,31),C16(4,7,6),
     C16(4,7,6),C16(6,44,14),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(22,61,23),C16(22,61,23),C16(4,7,6),C16(6,44,14),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(22,61,23),C16(22,61,23),C16(4,7,6),
@@ -3130,7 +1870,7 @@ static const uint16_t my_tilesheet[] = {
     C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
     C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
 
-    /* === Tile 173 === */
+    /* === Tile 103 === */
     C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(0,0,0),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(0,0,0),
     C16(12,54,17),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(31,63,31),C16(31,63,31),C16(4,7,6),C16(12,54,17),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(31,63,31),C16(31,63,31),C16(4,7,6),
     C16(6,44,14),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(22,61,23),C16(22,61,23),C16(4,7,6),C16(6,44,14),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(22,61,23),C16(22,61,23),C16(4,7,6),
@@ -3146,45 +1886,40 @@ static const uint16_t my_tilesheet[] = {
     C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
     C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
     C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
+    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0)
+};
 
-    /* === Tile 174 === */
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(0,0,0),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(0,0,0),
-    C16(12,54,17),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(31,63,31),C16(31,63,31),C16(4,7,6),C16(12,54,17),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(22,61,23),C16(31,63,31),C16(31,63,31),C16(4,7,6),
-    C16(6,44,14),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(22,61,23),C16(22,61,23),C16(4,7,6),C16(6,44,14),C16(6,44,14),C16(12,54,17),C16(12,54,17),C16(12,54,17),C16(22,61,23),C16(22,61,23),C16(4,7,6),
-    C16(2,22,13),C16(2,22,13),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(12,54,17),C16(4,7,6),C16(2,22,13),C16(2,22,13),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(6,44,14),C16(12,54,17),C16(4,7,6),
-    C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(0,0,0),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(4,7,6),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
+static const uint16_t my_tilesheet_count = 104;
 
-    /* === Tile 175 === */
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),
-    C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0),C16(0,0,0)
+static const uint8_t my_tile_flags[] = {
+    0x01,0x01,0x01,0x01,0x06,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
+    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
+    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
+    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x05,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
+    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
+    0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x00,0x00,0x00,
+    0x01,0x01,0x01,0x01,0x01,0x01,0x00,0x00,
+};
+
+/* Original tile index -> unique tile index | GFX_TILE_FLIP_X | GFX_TILE_FLIP_Y */
+static const uint16_t my_tile_remap[] = {
+    0x0000,0x0001,0x0002,0x0003,0x8003,0x0004,0x0005,0x0006,0x0007,0x0008,0x0009,0x0004,
+    0x000A,0x000B,0x000C,0x000D,0x000E,0x000F,0x0010,0x0011,0x0012,0x0004,0x0013,0x0014,
+    0x0015,0x0016,0x0017,0x0004,0x0018,0x0019,0x001A,0x001B,0x001C,0x001D,0x001E,0x0004,
+    0x0004,0x0004,0x001F,0x0020,0x0021,0x0004,0x0004,0x0004,0x0004,0x0022,0x0023,0x0024,
+    0x0004,0x0004,0x0004,0x0004,0x0004,0x0004,0x0004,0x0004,0x0004,0x0004,0x0004,0x0004,
+    0x0004,0x0004,0x0004,0x0004,0x0025,0x0026,0x0027,0x0028,0x0029,0x0004,0x002A,0x002B,
+    0x002C,0x002D,0x002E,0x0004,0x002F,0x0030,0x0031,0x0032,0x0033,0x0034,0x0035,0x0027,
+    0x0025,0x0004,0x0036,0x0037,0x0038,0x0039,0x003A,0x0004,0x003B,0x003C,0x003D,0x003E,
+    0x0029,0x003F,0x0028,0x0004,0x0004,0x0004,0x0040,0x0041,0x0042,0x0004,0x0004,0x0004,
+    0x0004,0x0043,0x0044,0x0045,0x0004,0x0004,0x0004,0x0004,0x0004,0x0004,0x0004,0x0004,
+    0x0004,0x0004,0x0004,0x0004,0x0004,0x0004,0x0004,0x0004,0x0046,0x0047,0x0048,0x0049,
+    0x004A,0x0004,0x004B,0x004C,0x004D,0x004E,0x004F,0x0004,0x0050,0x0051,0x0052,0x0004,
+    0x0053,0x0054,0x0055,0x0056,0x0057,0x0004,0x0058,0x0059,0x005A,0x005B,0x005C,0x0004,
+    0x005D,0x005E,0x005F,0x0004,0x0060,0x0061,0x0062,0x0004,0x0004,0x0004,0x0063,0x0064,
+    0x0065,0x0004,0x0004,0x0004,0x0066,0x0067,0x0067,0x0004,
 };
 
-static const uint16_t my_tilesheet_count = 176;
+static const uint16_t my_tile_remap_count = 176;
 
 #endif
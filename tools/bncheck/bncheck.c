@@ -0,0 +1,307 @@
+//
+//  Host checks and benchmarks for the arbitrary-precision calculator
+//
+//  Builds bignum.c and calc.c on a PC, with an arena the size of the device's
+//  scratch memory, for reference.py to drive: it checks every answer against
+//  Python's own integers and times the same work done in Python.
+//
+//  Usage:
+//    bncheck ops COUNT SEED    print COUNT random operations and their results,
+//                              as "op a b result..." in decimal
+//    bncheck calc [-t]         work out each line of stdin ("digits N" sets the
+//                              precision) and print the result or "error: ...";
+//                              -t puts the seconds taken in front
+//    bncheck tune              time n-limb products by schoolbook and by one
+//                              level of Karatsuba, to choose BN_KARATSUBA_THRESHOLD
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "bignum.h"
+#include "calc.h"
+
+#define MAX_LINE        4096
+#define TUNE_SECONDS    (0.05)      // minimum time measured per product
+
+static uint8_t memory[SCRATCH_SIZE];
+static scratch_arena_t arena = {memory, SCRATCH_SIZE, 0};
+
+
+//
+//  Stand-in for the scratch memory driver: only the arena allocator is used
+//
+
+void *scratch_arena_alloc(scratch_arena_t *a, uint32_t size)
+{
+    size = (size + SCRATCH_ALIGN - 1) & ~(uint32_t)(SCRATCH_ALIGN - 1);
+    if (a->base == NULL || size > a->size - a->used)
+    {
+        return NULL;
+    }
+    void *ptr = a->base + a->used;
+    a->used += size;
+    return ptr;
+}
+
+
+//
+//  Random operands
+//
+
+static uint64_t rng_state = 1;
+
+static uint32_t rng(void)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return (uint32_t)(rng_state >> 16);
+}
+
+// Sizes either side of the points where the algorithms change
+static const uint32_t sizes[] = {0, 1, 2, 3, 5, 8, 17, 31, 32, 33, 47, 63, 64, 65, 66, 97, 128, 129, 200, 333, 700};
+
+static uint32_t random_size(void)
+{
+    return sizes[rng() % (sizeof(sizes) / sizeof(sizes[0]))];
+}
+
+// Random limbs, sometimes all ones or mostly zeros, which find carry and borrow slips
+static void random_bn(bn_t *a, uint32_t size, bool allow_negative)
+{
+    bn_init(a);
+    if (size == 0)
+    {
+        bn_set_u32(a, 0);
+        return;
+    }
+    uint32_t *limb = scratch_arena_alloc(&arena, size * sizeof(uint32_t));
+    uint32_t pattern = rng() % 4;
+    for (uint32_t i = 0; i < size; i++)
+    {
+        limb[i] = pattern == 0 ? 0xFFFFFFFF : pattern == 1 && rng() % 8 ? 0 : rng();
+    }
+    if (limb[size - 1] == 0)
+    {
+        limb[size - 1] = 1 + rng() % 0xFFFF;
+    }
+    a->limb = limb;
+    a->size = size;
+    a->capacity = size;
+    a->negative = allow_negative && (rng() & 1);
+}
+
+static void print_bn(const bn_t *a)
+{
+    char *text = malloc(bn_decimal_digits(a) + 2);
+    bn_to_decimal(a, text);
+    printf(" %s", text);
+
+    // The text has to read back as the same number
+    bn_t back;
+    bn_init(&back);
+    uint32_t mark = bn_mark();
+    bn_set_decimal(&back, text + (text[0] == '-'), strlen(text) - (text[0] == '-'));
+    back.negative = text[0] == '-';
+    if (bn_cmp(&back, a) != 0)
+    {
+        printf(" (decimal round trip failed)");
+    }
+    bn_release(mark);
+    free(text);
+}
+
+static void run_ops(int count, uint32_t seed)
+{
+    rng_state = seed * 2654435761u + 1;
+    bn_use_arena(&arena);
+
+    for (int i = 0; i < count; i++)
+    {
+        arena.used = 0;
+        bn_t a, b, r, q;
+        bn_init(&r);
+        bn_init(&q);
+        int op = rng() % 7;
+
+        switch (op)
+        {
+        case 0:
+        case 1:
+            random_bn(&a, random_size(), true);
+            random_bn(&b, random_size(), true);
+            op == 0 ? bn_add(&r, &a, &b) : bn_sub(&r, &a, &b);
+            printf(op == 0 ? "add" : "sub");
+            print_bn(&a);
+            print_bn(&b);
+            print_bn(&r);
+            break;
+        case 2:
+            random_bn(&a, random_size(), true);
+            random_bn(&b, random_size(), true);
+            bn_mul(&r, &a, &b);
+            printf("mul");
+            print_bn(&a);
+            print_bn(&b);
+            print_bn(&r);
+            break;
+        case 3:
+        {
+            // A long enough dividend for the quotient to need Newton division too
+            uint32_t bs = random_size();
+            random_bn(&b, bs ? bs : 1, true);
+            random_bn(&a, b.size + random_size(), true);
+            bn_divmod(&q, &r, &a, &b);
+            printf("div");
+            print_bn(&a);
+            print_bn(&b);
+            print_bn(&q);
+            print_bn(&r);
+            break;
+        }
+        case 4:
+            random_bn(&a, random_size() * 2, false);
+            bn_sqrt(&r, &a);
+            printf("sqrt");
+            print_bn(&a);
+            print_bn(&r);
+            break;
+        case 5:
+        {
+            uint32_t n = rng() % 8 ? rng() % 300 : rng() % 3000;
+            bn_factorial(&r, n);
+            printf("fact %u", n);
+            print_bn(&r);
+            break;
+        }
+        default:
+        {
+            random_bn(&a, rng() % 3, true);
+            uint32_t n = rng() % 200;
+            bn_pow_u32(&r, &a, n);
+            printf("pow");
+            print_bn(&a);
+            printf(" %u", n);
+            print_bn(&r);
+            break;
+        }
+        }
+        printf(bn_failed() ? " (out of memory)\n" : "\n");
+    }
+}
+
+
+//
+//  Calculator
+//
+
+static double seconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void run_calc(bool timed)
+{
+    static char line[MAX_LINE];
+    calc_init(&arena);
+
+    while (fgets(line, sizeof(line), stdin))
+    {
+        line[strcspn(line, "\r\n")] = '\0';
+        if (strncmp(line, "digits ", 7) == 0)
+        {
+            calc_set_precision(strtoul(line + 7, NULL, 10));
+            continue;
+        }
+
+        calc_result_t result;
+        double start = seconds();
+        bool ok = calc_evaluate(line, &result);
+        double elapsed = seconds() - start;
+        if (timed)
+        {
+            printf("%.6f ", elapsed);
+        }
+        if (ok)
+        {
+            printf("%s\n", result.text);
+        }
+        else
+        {
+            printf("error: %s at %u\n", result.error, result.error_pos);
+        }
+        fflush(stdout);
+    }
+}
+
+
+//
+//  Threshold tuning
+//
+
+static double time_product(const bn_t *a, const bn_t *b)
+{
+    bn_t r;
+    int reps = 0;
+    double start = seconds(), elapsed;
+    do
+    {
+        uint32_t mark = bn_mark();
+        bn_init(&r);
+        bn_mul(&r, a, b);
+        bn_release(mark);
+        reps++;
+        elapsed = seconds() - start;
+    } while (elapsed < TUNE_SECONDS);
+    return elapsed / reps;
+}
+
+static void run_tune(void)
+{
+    static const uint32_t limbs[] = {8, 12, 16, 20, 24, 32, 40, 48, 64, 96, 128, 256, 512};
+    bn_use_arena(&arena);
+    printf("limbs  schoolbook_us  karatsuba_us\n");
+    for (size_t i = 0; i < sizeof(limbs) / sizeof(limbs[0]); i++)
+    {
+        arena.used = 0;
+        bn_t a, b;
+        random_bn(&a, limbs[i], false);
+        random_bn(&b, limbs[i], false);
+
+        // One level of Karatsuba over schoolbook halves, against schoolbook throughout
+        bn_set_karatsuba_threshold(UINT32_MAX);
+        double school = time_product(&a, &b);
+        bn_set_karatsuba_threshold(limbs[i]);
+        double karatsuba = time_product(&a, &b);
+        printf("%5u  %13.3f  %12.3f\n", limbs[i], school * 1e6, karatsuba * 1e6);
+    }
+    bn_set_karatsuba_threshold(BN_KARATSUBA_THRESHOLD);
+}
+
+
+int main(int argc, char **argv)
+{
+    if (argc >= 4 && strcmp(argv[1], "ops") == 0)
+    {
+        run_ops(atoi(argv[2]), strtoul(argv[3], NULL, 10));
+    }
+    else if (argc >= 2 && strcmp(argv[1], "calc") == 0)
+    {
+        run_calc(argc >= 3 && strcmp(argv[2], "-t") == 0);
+    }
+    else if (argc >= 2 && strcmp(argv[1], "tune") == 0)
+    {
+        run_tune();
+    }
+    else
+    {
+        fprintf(stderr, "usage: bncheck ops COUNT SEED | calc [-t] | tune\n");
+        return 2;
+    }
+    return 0;
+}
@@ -0,0 +1,35 @@
+#!/usr/bin/env bash
+#
+# Build the host calculator checker and compare it with Python's integers.
+#
+#   tools/bncheck/bncheck.sh            random operations and calculator expressions
+#   tools/bncheck/bncheck.sh bench      time calculations to thousands of digits against Python
+#   tools/bncheck/bncheck.sh tune       schoolbook against Karatsuba products, for the threshold
+#
+set -euo pipefail
+
+HERE="$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)"
+ROOT="$HERE/../.."
+BIN="${TMPDIR:-/tmp}/bncheck"
+
+${CC:-cc} -O2 -I"$ROOT" -o "$BIN" \
+    "$HERE/bncheck.c" \
+    "$ROOT/bignum.c" \
+    "$ROOT/calc.c" \
+    -lm
+
+case "${1:-check}" in
+check)
+    python3 "$HERE/reference.py" check "$BIN"
+    ;;
+bench)
+    python3 "$HERE/reference.py" bench "$BIN"
+    ;;
+tune)
+    "$BIN" tune
+    ;;
+*)
+    echo "usage: $0 [check|bench|tune]" >&2
+    exit 2
+    ;;
+esac
@@ -0,0 +1,228 @@
+#!/usr/bin/env python3
+"""
+Reference for the calculator: checks the answers of the host build of bignum.c and
+calc.c (bncheck) against Python's own integers, and times the same work in Python.
+
+    reference.py check BNCHECK      random operations and calculator expressions
+    reference.py bench BNCHECK      factorials, powers, products, quotients, roots and
+                                    constants to thousands of digits, in both
+"""
+
+import math
+import subprocess
+import sys
+import time
+
+sys.set_int_max_str_digits(0)
+
+
+def trunc_divmod(a, b):
+    """Division rounding towards zero, with the remainder taking the sign of a (as C)"""
+    q = abs(a) // abs(b)
+    if (a < 0) != (b < 0):
+        q = -q
+    return q, a - q * b
+
+
+def check_ops(bncheck, count=3000, seed=1):
+    out = subprocess.run([bncheck, "ops", str(count), str(seed)], capture_output=True, text=True, check=True).stdout
+    failures = 0
+    for line in out.splitlines():
+        words = line.split()
+        op, values = words[0], words[1:]
+        if "(" in line:
+            ok = False
+        elif op in ("add", "sub", "mul"):
+            a, b, r = map(int, values)
+            ok = r == (a + b if op == "add" else a - b if op == "sub" else a * b)
+        elif op == "div":
+            a, b, q, r = map(int, values)
+            ok = (q, r) == trunc_divmod(a, b)
+        elif op == "sqrt":
+            a, r = map(int, values)
+            ok = r == math.isqrt(a)
+        elif op == "fact":
+            n, r = map(int, values)
+            ok = r == math.factorial(n)
+        elif op == "pow":
+            a, n, r = map(int, values)
+            ok = r == a ** n
+        else:
+            ok = False
+        if not ok:
+            failures += 1
+            if failures <= 5:
+                print("FAIL", line[:200])
+    return len(out.splitlines()), failures
+
+
+def decimal_text(m, scale):
+    """m / 10^scale as calc prints it: no trailing zeros after the point"""
+    sign = "-" if m < 0 else ""
+    digits = str(abs(m)).rjust(scale + 1, "0")
+    whole, fraction = digits[: len(digits) - scale], digits[len(digits) - scale :]
+    fraction = fraction.rstrip("0")
+    return sign + whole + ("." + fraction if fraction else "")
+
+
+def round_shift(m, digits):
+    """m / 10^digits rounded half away from zero"""
+    q = abs(m) * 10 // 10**digits
+    q = (q + 5) // 10
+    return -q if m < 0 else q
+
+
+def machin_pi(digits):
+    unity = 10 ** (digits + 20)
+
+    def atan_inverse(x):
+        total = power = unity // x
+        k = 1
+        while power:
+            power //= x * x
+            total += (-1 if k % 2 else 1) * (power // (2 * k + 1))
+            k += 1
+        return total
+
+    return round_shift(16 * atan_inverse(5) - 4 * atan_inverse(239), 20)
+
+
+def series_e(digits):
+    unity = 10 ** (digits + 20)
+    total = term = unity
+    k = 1
+    while term:
+        term //= k
+        total += term
+        k += 1
+    return round_shift(total, 20)
+
+
+def sqrt_digits(n, digits):
+    return round_shift(math.isqrt(n * 10 ** (2 * digits + 2)), 1)
+
+
+def div_digits(a, b, digits):
+    q, r = trunc_divmod(a * 10 ** (digits + 1), b)
+    return round_shift(q, 1)
+
+
+# (precision, expression, expected)
+CASES = [
+    (30, "1+2*3", "7"),
+    (30, "2^10-1", "1023"),
+    (30, "-2^2", "-4"),
+    (30, "2^3^2", "512"),
+    (30, "(2+3)*(4-1)", "15"),
+    (30, "7/2", "3.5"),
+    (30, "6/3", "2"),
+    (30, "-7/2", "-3.5"),
+    (30, "1/3", decimal_text(div_digits(1, 3, 30), 30)),
+    (30, "2/3", decimal_text(div_digits(2, 3, 30), 30)),
+    (30, "-2/3", decimal_text(div_digits(-2, 3, 30), 30)),
+    (30, "17 % 5", "2"),
+    (30, "-17 % 5", "-2"),
+    (30, "0.1+0.2", "0.3"),
+    (30, "1.5*1.5", "2.25"),
+    (30, "0.001*0.001", "0.000001"),
+    (30, "2^-2", "0.25"),
+    (30, "1.5^3", "3.375"),
+    (30, "0.5^100", decimal_text(round_shift(5**100, 100 - 30), 30)),
+    (30, "20!", str(math.factorial(20))),
+    (30, "3!!", "720"),
+    (30, "sqrt(16)", "4"),
+    (30, "sqrt(2)", decimal_text(sqrt_digits(2, 30), 30)),
+    (30, "sqrt(0.25)", "0.5"),
+    (30, "pi", decimal_text(machin_pi(30), 30)),
+    (30, "e", decimal_text(series_e(30), 30)),
+    (30, "ans*2", decimal_text(2 * series_e(30), 30)),
+    (30, "2^200 / 2^100", str(2**100)),
+    (30, "1/0", "error: Division by zero at 3"),
+    (30, "2.5!", "error: Needs a whole number at 4"),
+    (30, "(1+2", "error: Expected ) at 4"),
+    (30, "1 2", "error: Unexpected character at 2"),
+    (30, "foo", "error: Unknown name at 0"),
+    (30, "sqrt(-1)", "error: Square root of a negative number at 8"),
+    (30, "ans", str(2**100)),  # still the last good result after the errors
+    (30, "(" * 15 + "1" + ")" * 15, "1"),
+    (30, "(" * 16 + "1" + ")" * 16, "error: Too deeply nested at 16"),
+    (30, "-" * 100 + "1", "error: Too deeply nested at 16"),
+    (1000, "pi", decimal_text(machin_pi(1000), 1000)),
+    (1000, "e", decimal_text(series_e(1000), 1000)),
+    (1000, "sqrt(3)", decimal_text(sqrt_digits(3, 1000), 1000)),
+    (1000, "1/7", decimal_text(div_digits(1, 7, 1000), 1000)),
+    (3000, "sqrt(2)", decimal_text(sqrt_digits(2, 3000), 3000)),
+    (100, "(7^3000) / (3^2000)", decimal_text(div_digits(7**3000, 3**2000, 100), 100)),
+    (30, "1000!", str(math.factorial(1000))),
+    (30, "5000! % (3^4000)", str(math.factorial(5000) % 3**4000)),
+    (30, "1000000!", "error: Result too big at 8"),
+]
+
+
+def check_calc(bncheck):
+    lines = []
+    for precision, expression, _ in CASES:
+        lines.append("digits %d" % precision)
+        lines.append(expression)
+    out = subprocess.run([bncheck, "calc"], input="\n".join(lines) + "\n", capture_output=True, text=True, check=True).stdout
+    results = out.splitlines()
+    failures = 0
+    for (precision, expression, expected), got in zip(CASES, results):
+        if got != expected:
+            failures += 1
+            print("FAIL digits %d: %s\n  got      %s\n  expected %s" % (precision, expression, got[:120], expected[:120]))
+    if len(results) != len(CASES):
+        failures += 1
+        print("FAIL: %d results for %d expressions" % (len(results), len(CASES)))
+    return len(CASES), failures
+
+
+# (name, precision, expression, Python equivalent)
+BENCH = [
+    ("10000!", 30, "10000!", lambda: str(math.factorial(10000))),
+    ("pi 10000 digits", 10000, "pi", lambda: decimal_text(machin_pi(10000), 10000)),
+    ("e 10000 digits", 10000, "e", lambda: decimal_text(series_e(10000), 10000)),
+    ("sqrt(2) 10000 digits", 10000, "sqrt(2)", lambda: decimal_text(sqrt_digits(2, 10000), 10000)),
+    ("3^100000", 30, "3^100000", lambda: str(3**100000)),
+    ("3^40000 * 7^30000", 30, "3^40000 * 7^30000", lambda: str(3**40000 * 7**30000)),
+    ("7^40000 % 3^25000", 30, "7^40000 % 3^25000", lambda: str(7**40000 % 3**25000)),
+]
+
+
+def bench(bncheck):
+    lines = []
+    for _, precision, expression, _ in BENCH:
+        lines.append("digits %d" % precision)
+        lines.append(expression)
+    out = subprocess.run([bncheck, "calc", "-t"], input="\n".join(lines) + "\n", capture_output=True, text=True, check=True).stdout
+    print("%-22s %8s %10s %10s  %s" % ("", "digits", "bncheck", "python", "same"))
+    failures = 0
+    for (name, _, _, reference), line in zip(BENCH, out.splitlines()):
+        took, text = line.split(" ", 1)
+        start = time.perf_counter()
+        expected = reference()
+        python = time.perf_counter() - start
+        same = text == expected
+        failures += not same
+        print("%-22s %8d %9.3fs %9.3fs  %s" % (name, len(expected), float(took), python, "yes" if same else "NO"))
+    return failures
+
+
+def main():
+    if len(sys.argv) != 3 or sys.argv[1] not in ("check", "bench"):
+        print(__doc__.strip())
+        sys.exit(2)
+    bncheck = sys.argv[2]
+    if sys.argv[1] == "check":
+        count, failures = check_ops(bncheck)
+        print("%d random operations, %d failed" % (count, failures))
+        cases, calc_failures = check_calc(bncheck)
+        print("%d calculator expressions, %d failed" % (cases, calc_failures))
+        failures += calc_failures
+    else:
+        failures = bench(bncheck)
+    sys.exit(1 if failures else 0)
+
+
+if __name__ == "__main__":
+    main()
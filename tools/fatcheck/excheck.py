@@ -0,0 +1,242 @@
+#!/usr/bin/env python3
+"""
+exFAT consistency check for images the host checker (fatcheck) has written to
+
+Written from the exFAT specification rather than from drivers/fat32.c, so the
+two do not share their mistakes. Every directory is walked from the root and
+every cluster of every file is given an owner; then:
+
+- each entry set has a good checksum, a stream extension, the right number of
+  name entries, a good name hash and a name unique in its directory
+- valid data length is no more than data length, and directories are whole clusters
+- contiguous (NoFatChain) runs stay on the volume and FAT chains are not broken
+  and end at the last cluster
+- no cluster has two owners
+- the allocation bitmap marks exactly the owned clusters
+
+    excheck.py IMAGE            print the problems found, exit 1 if there are any
+    excheck.py IMAGE list       also list every file with its size and MD5
+"""
+
+import hashlib
+import mmap
+import struct
+import sys
+
+SECTOR_SIZE = 512
+ENTRY_SIZE = 32
+END_OF_CHAIN = 0xFFFFFFFF
+
+
+class Volume:
+    def __init__(self, image):
+        self.image = image
+        self.base = 0
+        if image[3:11] != b"EXFAT   ":  # an MBR, take the first partition
+            self.base = struct.unpack_from("<I", image, 446 + 8)[0] * SECTOR_SIZE
+        (_, self.fat_offset, _, self.heap, self.clusters, self.root, _, _, _, _, spc_shift,
+         _) = struct.unpack_from("<QIIIIIIHHBBB", image, self.base + 72)
+        self.bytes_per_cluster = SECTOR_SIZE << spc_shift
+        self.fat = struct.unpack_from(f"<{self.clusters + 2}I", image, self.base + self.fat_offset * SECTOR_SIZE)
+        self.owner = {}
+        self.errors = []
+        self.files = []
+        self.bitmap = None
+
+    def boot_checksum_ok(self):
+        region = self.image[self.base:self.base + 11 * SECTOR_SIZE]
+        total = 0
+        for i, b in enumerate(region):
+            if i not in (106, 107, 112):
+                total = ((total >> 1) | (total << 31)) + b & 0xFFFFFFFF
+        return struct.unpack_from("<I", self.image, self.base + 11 * SECTOR_SIZE)[0] == total
+
+    def cluster_data(self, cluster):
+        offset = self.base + self.heap * SECTOR_SIZE + (cluster - 2) * self.bytes_per_cluster
+        return self.image[offset:offset + self.bytes_per_cluster]
+
+    def chain(self, first, count, path):
+        """count clusters along the FAT from first, where the last one must end the chain"""
+        clusters = []
+        cluster = first
+        for i in range(count):
+            if not 2 <= cluster < self.clusters + 2:
+                self.errors.append(f"{path}: chain broken at cluster {i} of {count}")
+                return clusters
+            clusters.append(cluster)
+            cluster = self.fat[cluster]
+        if cluster != END_OF_CHAIN:
+            self.errors.append(f"{path}: chain not ended after {count} clusters")
+        return clusters
+
+    def claim(self, clusters, path):
+        for cluster in clusters:
+            if cluster in self.owner:
+                self.errors.append(f"{path}: cluster {cluster} also belongs to {self.owner[cluster]}")
+            self.owner[cluster] = path
+
+    def clusters_of(self, first, length, contiguous, path):
+        count = (length + self.bytes_per_cluster - 1) // self.bytes_per_cluster
+        if count == 0:
+            return []
+        if not contiguous:
+            return self.chain(first, count, path)
+        if first < 2 or first + count > self.clusters + 2:
+            self.errors.append(f"{path}: contiguous run off the volume")
+            return []
+        return list(range(first, first + count))
+
+    def root_clusters(self):
+        clusters = []
+        cluster = self.root
+        while 2 <= cluster < self.clusters + 2:
+            if cluster in clusters:
+                self.errors.append("/: root chain loops")
+                break
+            clusters.append(cluster)
+            cluster = self.fat[cluster]
+        return clusters
+
+    def walk(self, clusters, path):
+        data = b"".join(self.cluster_data(c) for c in clusters)
+        entries = [data[i:i + ENTRY_SIZE] for i in range(0, len(data), ENTRY_SIZE)]
+        names = set()
+        ended = False
+        i = 0
+        while i < len(entries):
+            entry = entries[i]
+            kind = entry[0]
+            if kind == 0:
+                ended = True
+            elif ended:
+                self.errors.append(f"{path}: entry {i} after the end of the directory")
+            if kind == 0x81 and path == "/":
+                first, length = struct.unpack_from("<IQ", entry, 20)
+                clusters_used = self.chain(first, (length + self.bytes_per_cluster - 1) // self.bytes_per_cluster,
+                                           "bitmap")
+                self.claim(clusters_used, "(bitmap)")
+                self.bitmap = b"".join(self.cluster_data(c) for c in clusters_used)[:length]
+            elif kind == 0x82 and path == "/":
+                first, length = struct.unpack_from("<IQ", entry, 20)
+                self.claim(self.chain(first, (length + self.bytes_per_cluster - 1) // self.bytes_per_cluster,
+                                      "up-case table"), "(up-case table)")
+            elif kind == 0x85:
+                i += self.entry_set(entries, i, path, names)
+                continue
+            elif kind & 0x80 and kind not in (0x83, 0xA0, 0xA1, 0xA2):
+                self.errors.append(f"{path}: stray entry type {kind:02x} at {i}")
+            i += 1
+
+    def entry_set(self, entries, i, path, names):
+        """Check the file entry set at entries[i], returns the entries it takes"""
+        secondaries = entries[i][1]
+        if i + secondaries >= len(entries):
+            self.errors.append(f"{path}: entry set at {i} runs off the directory")
+            return len(entries) - i
+        raw = b"".join(entries[i:i + 1 + secondaries])
+        if set_checksum(raw) != struct.unpack_from("<H", raw, 2)[0]:
+            self.errors.append(f"{path}: bad entry set checksum at {i}")
+
+        stream = entries[i + 1]
+        if stream[0] != 0xC0:
+            self.errors.append(f"{path}: no stream extension at {i}")
+            return 1 + secondaries
+        flags, name_length = stream[1], stream[3]
+        name_hash, = struct.unpack_from("<H", stream, 4)
+        valid_length, = struct.unpack_from("<Q", stream, 8)
+        first, length = struct.unpack_from("<IQ", stream, 20)
+
+        name = ""
+        for entry in entries[i + 2:i + 1 + secondaries]:
+            if entry[0] != 0xC1:
+                self.errors.append(f"{path}: entry type {entry[0]:02x} in a name at {i}")
+                continue
+            name += entry[2:32].decode("utf-16-le")
+        name = name[:name_length]
+        full = path.rstrip("/") + "/" + name
+
+        if secondaries != 1 + (name_length + 14) // 15:
+            self.errors.append(f"{full}: {secondaries} secondary entries for a {name_length} character name")
+        if upcase_hash(name) != name_hash:
+            self.errors.append(f"{full}: bad name hash")
+        if name.upper() in names:
+            self.errors.append(f"{full}: name used twice")
+        names.add(name.upper())
+        if valid_length > length:
+            self.errors.append(f"{full}: valid data length past the data length")
+        if length and first == 0:
+            self.errors.append(f"{full}: data but no cluster")
+        if not flags & 1:
+            self.errors.append(f"{full}: AllocationPossible clear")
+
+        clusters = self.clusters_of(first, length, bool(flags & 2), full)
+        self.claim(clusters, full)
+        if struct.unpack_from("<H", entries[i], 4)[0] & 0x10:
+            if length == 0 or length % self.bytes_per_cluster:
+                self.errors.append(f"{full}: directory of {length} bytes")
+            self.files.append((full + "/", 0, ""))
+            self.walk(clusters, full)
+        else:
+            content = b"".join(self.cluster_data(c) for c in clusters)[:length]
+            self.files.append((full, length, hashlib.md5(content).hexdigest()))
+        return 1 + secondaries
+
+    def check(self):
+        if not self.boot_checksum_ok():
+            self.errors.append("bad boot region checksum")
+        root = self.root_clusters()
+        self.claim(root, "/")
+        self.walk(root, "/")
+        if self.bitmap is None:
+            self.errors.append("no allocation bitmap")
+            return
+        for cluster in range(2, self.clusters + 2):
+            used = self.bitmap[(cluster - 2) // 8] >> (cluster - 2) % 8 & 1
+            if cluster in self.owner and not used:
+                self.errors.append(f"cluster {cluster} of {self.owner[cluster]} free in the bitmap")
+            elif used and cluster not in self.owner:
+                self.errors.append(f"cluster {cluster} in use in the bitmap but owned by nothing")
+
+
+def set_checksum(raw):
+    total = 0
+    for i, b in enumerate(raw):
+        if i not in (2, 3):
+            total = ((total & 1) << 15 | total >> 1) + b & 0xFFFF
+    return total
+
+
+def upcase_hash(name):
+    total = 0
+    for ch in name:
+        c = ord(ch.upper()) if "a" <= ch <= "z" else ord(ch)
+        for b in (c & 0xFF, c >> 8):
+            total = ((total & 1) << 15 | total >> 1) + b & 0xFFFF
+    return total
+
+
+def main():
+    if len(sys.argv) not in (2, 3) or sys.argv[2:] not in ([], ["list"]):
+        print(__doc__.strip(), file=sys.stderr)
+        sys.exit(2)
+
+    with open(sys.argv[1], "rb") as f:
+        image = mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ)
+    volume = Volume(image)
+    volume.check()
+
+    for error in volume.errors[:20]:
+        print("FAIL", error)
+    if len(volume.errors) > 20:
+        print(f"... and {len(volume.errors) - 20} more")
+    files = sum(1 for f in volume.files if not f[0].endswith("/"))
+    print(f"exFAT: {files} files, {len(volume.files) - files} directories, "
+          f"{volume.clusters - len(volume.owner)} free clusters, {len(volume.errors)} problems")
+    if sys.argv[2:] == ["list"]:
+        for path, length, digest in sorted(volume.files):
+            print(path, length, digest)
+    sys.exit(1 if volume.errors else 0)
+
+
+if __name__ == "__main__":
+    main()
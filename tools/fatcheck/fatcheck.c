@@ -0,0 +1,686 @@
+//
+//  Host checks for the FAT32 and exFAT driver
+//
+//  Builds drivers/fat32.c on a PC against an SD card that is an image file
+//  made by mkimage.py. Blocks are read and written with pread and pwrite, so
+//  sparse images of full-size cards cost only the blocks that are used, and
+//  every block and command is counted.
+//
+//  Usage:
+//    fatcheck fsck IMAGE     damage a FAT32 volume in each way fat32_check looks
+//                            for, check each is reported, repair it and check
+//                            the volume is consistent afterwards
+//    fatcheck scan IMAGE     fill the volume with a directory tree, then time one
+//                            read-only fat32_check pass over it
+//    fatcheck bench IMAGE    write, read, append, create and delete files on a
+//                            FAT32 or exFAT volume, and count the SD commands
+//
+//  Times for the card are worked out from the blocks and commands with a
+//  model of the SPI link (SD_MODEL_BYTES_PER_SECOND, SD_MODEL_COMMAND_US);
+//  the time taken on the PC is shown as well, but says little about the device.
+//
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "sdcard.h"
+#include "fat32.h"
+#include "memstat.h"
+
+#define SD_MODEL_BYTES_PER_SECOND   (3000000)   // 25MHz SPI clock, less framing and CRC
+#define SD_MODEL_COMMAND_US         (100)       // command, response and busy wait
+#define CHECK_BUFFER_SIZE           (200 * 1024) // scratch memory fsck gets on the device
+#define CHECK_SMALL_BUFFER_SIZE     (11 * 1024)  // the fixed 10KB plus a window of 8192 clusters
+
+
+//
+//  SD card stand-in: an image file
+//
+
+static int image = -1;
+static uint32_t image_blocks = 0;
+
+static struct
+{
+    uint32_t blocks_read;
+    uint32_t blocks_written;
+    uint32_t read_commands;
+    uint32_t write_commands;
+} sd_stats;
+
+bool sd_card_present(void)
+{
+    return image >= 0;
+}
+
+sd_error_t sd_card_start(void)
+{
+    return image >= 0 ? SD_OK : SD_ERROR_NO_CARD;
+}
+
+void sd_init(void)
+{
+}
+
+sd_error_t sd_read_blocks(uint32_t start_block, uint32_t num_blocks, uint8_t *buffer)
+{
+    if (start_block + num_blocks > image_blocks ||
+        pread(image, buffer, (size_t)num_blocks * SD_BLOCK_SIZE, (off_t)start_block * SD_BLOCK_SIZE) !=
+            (ssize_t)num_blocks * SD_BLOCK_SIZE)
+    {
+        return SD_ERROR_READ_FAILED;
+    }
+    sd_stats.blocks_read += num_blocks;
+    sd_stats.read_commands++;
+    return SD_OK;
+}
+
+sd_error_t sd_write_blocks(uint32_t start_block, uint32_t num_blocks, const uint8_t *buffer)
+{
+    if (start_block + num_blocks > image_blocks ||
+        pwrite(image, buffer, (size_t)num_blocks * SD_BLOCK_SIZE, (off_t)start_block * SD_BLOCK_SIZE) !=
+            (ssize_t)num_blocks * SD_BLOCK_SIZE)
+    {
+        return SD_ERROR_WRITE_FAILED;
+    }
+    sd_stats.blocks_written += num_blocks;
+    sd_stats.write_commands++;
+    return SD_OK;
+}
+
+sd_error_t sd_read_block(uint32_t block, uint8_t *buffer)
+{
+    return sd_read_blocks(block, 1, buffer);
+}
+
+sd_error_t sd_write_block(uint32_t block, const uint8_t *buffer)
+{
+    return sd_write_blocks(block, 1, buffer);
+}
+
+void mem_register_static(const char *name, size_t size)
+{
+}
+
+static bool image_open(const char *path)
+{
+    image = open(path, O_RDWR);
+    if (image < 0)
+    {
+        perror(path);
+        return false;
+    }
+    image_blocks = (uint32_t)(lseek(image, 0, SEEK_END) / SD_BLOCK_SIZE);
+    fat32_init();
+    if (!fat32_is_ready())
+    {
+        fprintf(stderr, "%s: %s\n", path, fat32_error_string(fat32_get_status()));
+        return false;
+    }
+    return true;
+}
+
+// Mount again, so nothing the driver cached hides changes made behind its back
+static bool remount(void)
+{
+    fat32_unmount();
+    return fat32_is_ready();
+}
+
+static double seconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static double model_seconds(void)
+{
+    return (double)(sd_stats.blocks_read + sd_stats.blocks_written) * SD_BLOCK_SIZE / SD_MODEL_BYTES_PER_SECOND +
+           (double)(sd_stats.read_commands + sd_stats.write_commands) * SD_MODEL_COMMAND_US / 1e6;
+}
+
+
+//
+//  Raw volume access, for damage the driver would never do itself
+//
+
+static struct
+{
+    uint32_t fat_start;         // first block of the first FAT
+    uint32_t fat_blocks;        // blocks per FAT
+    uint32_t fat_count;
+    uint32_t fsinfo;            // block of the FSInfo sector
+    uint32_t clusters;          // data clusters, numbered from 2
+} volume;
+
+static void volume_read_geometry(void)
+{
+    uint8_t boot[SD_BLOCK_SIZE];
+    sd_read_block(0, boot);
+    uint32_t reserved = boot[14] | boot[15] << 8;
+    uint32_t spc = boot[13];
+    uint32_t total = boot[32] | boot[33] << 8 | boot[34] << 16 | (uint32_t)boot[35] << 24;
+
+    volume.fat_start = reserved;
+    volume.fat_count = boot[16];
+    volume.fsinfo = boot[48] | boot[49] << 8;
+    volume.fat_blocks = boot[36] | boot[37] << 8 | boot[38] << 16 | (uint32_t)boot[39] << 24;
+    volume.clusters = (total - reserved - volume.fat_count * volume.fat_blocks) / spc;
+}
+
+static uint32_t fat_get(uint32_t cluster)
+{
+    uint8_t block[SD_BLOCK_SIZE];
+    sd_read_block(volume.fat_start + cluster / 128, block);
+    uint32_t value;
+    memcpy(&value, block + (cluster % 128) * 4, 4);
+    return value & 0x0FFFFFFF;
+}
+
+static void fat_set(uint32_t cluster, uint32_t value)
+{
+    uint8_t block[SD_BLOCK_SIZE];
+    for (uint32_t n = 0; n < volume.fat_count; n++)
+    {
+        uint32_t at = volume.fat_start + n * volume.fat_blocks + cluster / 128;
+        sd_read_block(at, block);
+        memcpy(block + (cluster % 128) * 4, &value, 4);
+        sd_write_block(at, block);
+    }
+}
+
+// Link count clusters from first into one chain, a block of the FAT at a time, and take them
+// off the FSInfo free count: far quicker than writing files that size through the driver
+static void fat_set_run(uint32_t first, uint32_t count)
+{
+    uint8_t block[SD_BLOCK_SIZE];
+    for (uint32_t n = 0; n < volume.fat_count; n++)
+    {
+        uint32_t cluster = first;
+        while (cluster < first + count)
+        {
+            uint32_t at = volume.fat_start + n * volume.fat_blocks + cluster / 128;
+            sd_read_block(at, block);
+            do
+            {
+                uint32_t value = cluster + 1 < first + count ? cluster + 1 : 0x0FFFFFFF;
+                memcpy(block + (cluster % 128) * 4, &value, 4);
+                cluster++;
+            } while (cluster % 128 != 0 && cluster < first + count);
+            sd_write_block(at, block);
+        }
+    }
+
+    uint32_t free_count;
+    sd_read_block(volume.fsinfo, block);
+    memcpy(&free_count, block + 488, 4);
+    free_count -= count;
+    memcpy(block + 488, &free_count, 4);
+    sd_write_block(volume.fsinfo, block);
+}
+
+static uint32_t last_cluster(uint32_t cluster)
+{
+    while (fat_get(cluster) < 0x0FFFFFF8)
+    {
+        cluster = fat_get(cluster);
+    }
+    return cluster;
+}
+
+static uint32_t nth_cluster(uint32_t cluster, int n)
+{
+    while (n-- > 0)
+    {
+        cluster = fat_get(cluster);
+    }
+    return cluster;
+}
+
+static void set_file_size(const fat32_file_t *file, uint32_t size)
+{
+    uint8_t block[SD_BLOCK_SIZE];
+    sd_read_block(file->dir_entry_sector, block);
+    memcpy(block + file->dir_entry_offset + 28, &size, 4);
+    sd_write_block(file->dir_entry_sector, block);
+}
+
+
+//
+//  Files with contents that can be checked
+//
+
+static uint8_t file_byte(const char *path, uint32_t i)
+{
+    return (uint8_t)(i * 31 + strlen(path) * 7 + (i >> 9));
+}
+
+static bool write_file(const char *path, uint32_t size, fat32_file_t *out)
+{
+    static uint8_t data[4096];
+    fat32_file_t file;
+    if (fat32_create(&file, path) != FAT32_OK)
+    {
+        return false;
+    }
+
+    bool ok = true;
+    for (uint32_t done = 0; done < size && ok; done += sizeof(data))
+    {
+        uint32_t n = size - done < sizeof(data) ? size - done : sizeof(data);
+        for (uint32_t i = 0; i < n; i++)
+        {
+            data[i] = file_byte(path, done + i);
+        }
+        size_t written;
+        ok = fat32_write(&file, data, n, &written) == FAT32_OK && written == n;
+    }
+    if (out)
+    {
+        *out = file;
+    }
+    return fat32_close(&file) == FAT32_OK && ok;
+}
+
+// Read a file to its end, and compare it with what write_file wrote if size is not 0
+static bool read_file(const char *path, uint32_t size)
+{
+    static uint8_t data[4096];
+    fat32_file_t file;
+    if (fat32_open(&file, path) != FAT32_OK)
+    {
+        return false;
+    }
+
+    uint32_t done = 0;
+    size_t n;
+    bool ok = true;
+    while (ok && fat32_read(&file, data, sizeof(data), &n) == FAT32_OK && n > 0)
+    {
+        for (size_t i = 0; i < n && size; i++)
+        {
+            ok = data[i] == file_byte(path, done + i);
+        }
+        done += n;
+    }
+    ok = ok && done == fat32_size(&file) && (size == 0 || done == size);
+    fat32_close(&file);
+    return ok;
+}
+
+
+//
+//  fsck
+//
+
+static int checks = 0;
+static int failures = 0;
+
+static void expect(bool ok, const char *what)
+{
+    checks++;
+    failures += !ok;
+    printf("%s %s\n", ok ? "ok  " : "FAIL", what);
+}
+
+// size is the bitmap buffer; a small one makes the check take several passes
+static bool run_check(fat32_check_t *report, bool repair, size_t size)
+{
+    static uint8_t buffer[CHECK_BUFFER_SIZE];
+    fat32_error_t result = fat32_check(report, repair, buffer, size);
+    if (result != FAT32_OK)
+    {
+        printf("fat32_check: %s\n", fat32_error_string(result));
+        return false;
+    }
+    printf("     %s (%lu passes): %lu files, %lu directories, lost %lu in %lu chains, %lu cross-links, %lu bad chains, "
+           "%lu size mismatches, %lu free (FSInfo %lu)\n",
+           repair ? "repair" : "check", (unsigned long)report->passes, (unsigned long)report->files, (unsigned long)report->directories,
+           (unsigned long)report->lost_clusters, (unsigned long)report->lost_chains,
+           (unsigned long)report->cross_links, (unsigned long)report->bad_chains,
+           (unsigned long)report->size_mismatches, (unsigned long)report->free_clusters,
+           (unsigned long)report->fsinfo_free);
+    return true;
+}
+
+static bool is_clean(const fat32_check_t *report)
+{
+    return report->lost_clusters == 0 && report->cross_links == 0 && report->bad_chains == 0 &&
+           report->size_mismatches == 0 && report->fsinfo_free == report->free_clusters;
+}
+
+static int run_fsck(void)
+{
+    const uint32_t cluster = fat32_get_cluster_size();
+    fat32_file_t file, dir;
+    fat32_check_t report;
+
+    // A tree to walk, and one file for each kind of damage
+    fat32_dir_create(&dir, "/tree");
+    fat32_close(&dir);
+    for (int i = 0; i < 24; i++)
+    {
+        char path[32];
+        snprintf(path, sizeof(path), "/tree/file%02d.txt", i);
+        write_file(path, 100 + i * cluster / 3, NULL);
+    }
+    bool ok = write_file("/keep.bin", 10 * cluster, NULL) &&
+              write_file("/shared.bin", 6 * cluster, NULL) &&
+              write_file("/cross.bin", 4 * cluster, NULL) &&
+              write_file("/loop.bin", 5 * cluster, NULL) &&
+              write_file("/size.bin", 3 * cluster, &file);
+    expect(ok, "files written");
+    expect(run_check(&report, false, CHECK_BUFFER_SIZE) && is_clean(&report), "new volume is clean");
+
+    // The damage
+    volume_read_geometry();
+    uint32_t shared = 0, cross = 0, loop = 0;
+    if (fat32_open(&dir, "/shared.bin") == FAT32_OK)
+    {
+        shared = dir.start_cluster;
+        fat32_close(&dir);
+    }
+    if (fat32_open(&dir, "/cross.bin") == FAT32_OK)
+    {
+        cross = dir.start_cluster;
+        fat32_close(&dir);
+    }
+    if (fat32_open(&dir, "/loop.bin") == FAT32_OK)
+    {
+        loop = dir.start_cluster;
+        fat32_close(&dir);
+    }
+    if (!ok || !shared || !cross || !loop)
+    {
+        printf("Cannot find the files to damage\n");
+        return 1;
+    }
+
+    uint32_t lost = volume.clusters - 2; // well clear of anything written so far
+    fat_set(lost, lost + 1);
+    fat_set(lost + 1, lost + 2);
+    fat_set(lost + 2, 0x0FFFFFFF);
+    fat_set(nth_cluster(cross, 1), nth_cluster(shared, 2)); // cross.bin runs into shared.bin
+    fat_set(last_cluster(loop), loop);                        // loop.bin comes back to its start
+    set_file_size(&file, 10 * cluster);                       // size.bin has 3 clusters
+    remount();
+
+    expect(run_check(&report, false, CHECK_BUFFER_SIZE), "check of the damaged volume");
+    // The cross-link also cuts the last 2 clusters of cross.bin loose
+    expect(report.lost_clusters == 3 + 2 && report.lost_chains == 2, "lost chains reported");
+    expect(report.cross_links == 2, "cross-link and loop reported");
+    expect(report.size_mismatches == 1, "size mismatch reported");
+    expect(!report.repaired, "check alone writes nothing");
+
+    fat32_check_t windowed;
+    expect(run_check(&windowed, false, CHECK_SMALL_BUFFER_SIZE) && windowed.passes > 1 &&
+           windowed.lost_clusters == report.lost_clusters && windowed.lost_chains == report.lost_chains &&
+           windowed.cross_links == report.cross_links && windowed.size_mismatches == report.size_mismatches,
+           "same problems found a window of clusters at a time");
+
+    expect(run_check(&report, true, CHECK_BUFFER_SIZE) && report.repaired, "repair");
+    remount();
+    expect(run_check(&report, false, CHECK_BUFFER_SIZE) && is_clean(&report), "repaired volume is clean");
+    expect(report.files == 29 && report.directories == 2, "every file and directory kept");
+
+    // Undamaged files are untouched, and damaged ones can be read to their (trimmed) ends
+    bool tree_ok = true;
+    for (int i = 0; i < 24 && tree_ok; i++)
+    {
+        char path[32];
+        snprintf(path, sizeof(path), "/tree/file%02d.txt", i);
+        tree_ok = read_file(path, 100 + i * cluster / 3);
+    }
+    expect(tree_ok && read_file("/keep.bin", 10 * cluster), "undamaged files intact");
+    expect(read_file("/shared.bin", 0) && read_file("/cross.bin", 0) &&
+           read_file("/loop.bin", 0) && read_file("/size.bin", 0), "damaged files readable");
+    expect(fat32_open(&file, "/size.bin") == FAT32_OK && fat32_size(&file) == 3 * cluster, "size trimmed to the chain");
+    fat32_close(&file);
+
+    // The repaired volume still takes new files
+    expect(write_file("/after.bin", 8 * cluster, NULL) && read_file("/after.bin", 8 * cluster) &&
+           run_check(&report, false, CHECK_BUFFER_SIZE) && is_clean(&report), "volume usable after repair");
+
+    printf("%d of %d checks pass\n", checks - failures, checks);
+    return failures ? 1 : 0;
+}
+
+
+//
+//  Timed full-volume pass
+//
+
+static int run_scan(void)
+{
+    const uint32_t cluster = fat32_get_cluster_size();
+    uint64_t total = 0;
+    fat32_get_total_space(&total);
+
+    // A few hundred files in nested directories, and large files taking about a third of the card
+    char path[64];
+    fat32_file_t file;
+    for (int d = 0; d < 16; d++)
+    {
+        snprintf(path, sizeof(path), "/dir%02d", d);
+        fat32_dir_create(&file, path);
+        fat32_close(&file);
+        for (int s = 0; s < 4; s++)
+        {
+            snprintf(path, sizeof(path), "/dir%02d/sub%d", d, s);
+            fat32_dir_create(&file, path);
+            fat32_close(&file);
+            for (int f = 0; f < 8; f++)
+            {
+                snprintf(path, sizeof(path), "/dir%02d/sub%d/file%d.dat", d, s, f);
+                write_file(path, 1000 + f * cluster / 2, NULL);
+            }
+        }
+    }
+    // The large files are chained straight into the FAT at the top of the volume, where the
+    // driver has not allocated yet; fat32_check reads directories and the FAT, never file data
+    volume_read_geometry();
+    uint32_t big = volume.clusters / 3 / 8;
+    if ((uint64_t)big * cluster > 0xFFFF0000u)
+    {
+        big = 0xFFFF0000u / cluster;
+    }
+    fat32_file_t big_files[8];
+    for (int f = 0; f < 8; f++)
+    {
+        snprintf(path, sizeof(path), "/big%d.bin", f);
+        if (!write_file(path, 1, &big_files[f]))
+        {
+            printf("Cannot fill the volume: %s\n", path);
+            return 1;
+        }
+    }
+    for (int f = 0; f < 8; f++)
+    {
+        uint32_t run = volume.clusters + 2 - (f + 1) * (big - 1);
+        fat_set_run(run, big - 1);
+        fat_set(big_files[f].start_cluster, run);
+        set_file_size(&big_files[f], big * cluster);
+    }
+
+    remount();
+    memset(&sd_stats, 0, sizeof(sd_stats));
+    fat32_check_t report;
+    double start = seconds();
+    if (!run_check(&report, false, CHECK_BUFFER_SIZE))
+    {
+        return 1;
+    }
+    double elapsed = seconds() - start;
+
+    printf("Volume:    %.1fGB, %lu clusters of %luKB\n", total / (1024.0 * 1024 * 1024), (unsigned long)volume.clusters,
+           (unsigned long)(cluster / 1024));
+    printf("Passes:    %lu (%uKB bitmap buffer)\n", (unsigned long)report.passes, CHECK_BUFFER_SIZE / 1024);
+    printf("SD reads:  %lu blocks in %lu commands\n", (unsigned long)sd_stats.blocks_read,
+           (unsigned long)sd_stats.read_commands);
+    printf("Card time: %.1fs (model), %.2fs on this PC\n", model_seconds(), elapsed);
+    return is_clean(&report) ? 0 : 1;
+}
+
+
+//
+//  Workloads on FAT32 and exFAT
+//
+
+#define BENCH_BIG_FILE      (16 * 1024 * 1024)
+#define BENCH_CHUNK         (16 * 1024)
+#define BENCH_SMALL_FILES   (200)
+#define BENCH_ALLOCATE      (32 * 1024 * 1024)
+
+static bool bench_ok;
+
+static void bench_start(void)
+{
+    memset(&sd_stats, 0, sizeof(sd_stats));
+    bench_ok = true;
+}
+
+static void bench_report(const char *what)
+{
+    printf("%-30s %10lu %10lu %10lu %10lu %8.2fs%s\n", what, (unsigned long)sd_stats.read_commands,
+           (unsigned long)sd_stats.blocks_read, (unsigned long)sd_stats.write_commands,
+           (unsigned long)sd_stats.blocks_written, model_seconds(), bench_ok ? "" : "  FAILED");
+    failures += !bench_ok;
+}
+
+// Write or read size bytes of path in pieces of chunk bytes
+static void bench_write(const char *path, uint32_t size, uint32_t chunk)
+{
+    static uint8_t data[BENCH_CHUNK];
+    fat32_file_t file;
+    bench_ok = bench_ok && fat32_create(&file, path) == FAT32_OK;
+    for (uint32_t done = 0; done < size && bench_ok; done += chunk)
+    {
+        size_t written;
+        memset(data, done / chunk, chunk);
+        bench_ok = fat32_write(&file, data, chunk, &written) == FAT32_OK && written == chunk;
+    }
+    fat32_close(&file);
+}
+
+static void bench_read(const char *path, uint32_t size, uint32_t chunk)
+{
+    static uint8_t data[BENCH_CHUNK];
+    fat32_file_t file;
+    bench_ok = bench_ok && fat32_open(&file, path) == FAT32_OK;
+    for (uint32_t done = 0; done < size && bench_ok; done += chunk)
+    {
+        size_t n;
+        bench_ok = fat32_read(&file, data, chunk, &n) == FAT32_OK && n == chunk;
+    }
+    fat32_close(&file);
+}
+
+static int run_bench(void)
+{
+    printf("%s, %lu byte clusters\n", fat32_is_exfat() ? "exFAT" : "FAT32", (unsigned long)fat32_get_cluster_size());
+    printf("%-30s %10s %10s %10s %10s %9s\n", "", "read cmds", "blocks", "write cmds", "blocks", "card");
+
+    // Count the free space first, so the first write does not pay for it
+    uint64_t free_space;
+    fat32_get_free_space(&free_space);
+
+    bench_start();
+    bench_write("/big.bin", BENCH_BIG_FILE, BENCH_CHUNK);
+    bench_report("write 16 MB, 16 KB chunks");
+
+    bench_start();
+    bench_read("/big.bin", BENCH_BIG_FILE, BENCH_CHUNK);
+    bench_report("read 16 MB, 16 KB chunks");
+
+    bench_start();
+    bench_read("/big.bin", BENCH_BIG_FILE, SD_BLOCK_SIZE);
+    bench_report("read 16 MB, 512 B chunks");
+
+    bench_start();
+    bench_write("/small.bin", 1024 * 1024, SD_BLOCK_SIZE);
+    bench_report("write 1 MB, 512 B chunks");
+
+    char path[32];
+    bench_start();
+    for (int i = 0; i < BENCH_SMALL_FILES && bench_ok; i++)
+    {
+        snprintf(path, sizeof(path), "/f%03d.txt", i);
+        bench_write(path, 3000, 3000);
+    }
+    bench_report("create 200 x 3000 B files");
+
+    bench_start();
+    for (int i = 0; i < BENCH_SMALL_FILES && bench_ok; i++)
+    {
+        snprintf(path, sizeof(path), "/f%03d.txt", i);
+        bench_ok = fat32_delete(path) == FAT32_OK;
+    }
+    bench_report("delete 200 files");
+
+    bench_start();
+    bench_ok = fat32_delete("/big.bin") == FAT32_OK;
+    bench_report("delete 16 MB file");
+
+    // A seek past the end and one byte written allocate the whole gap at once
+    bench_start();
+    fat32_file_t file;
+    uint8_t byte = 0;
+    size_t written;
+    bench_ok = fat32_create(&file, "/alloc.bin") == FAT32_OK && fat32_seek(&file, BENCH_ALLOCATE - 1) == FAT32_OK &&
+               fat32_write(&file, &byte, 1, &written) == FAT32_OK && written == 1;
+    fat32_close(&file);
+    bench_report("allocate 32 MB in one write");
+
+    if (fat32_is_exfat())
+    {
+        // A file broken into a chain, then a write past the end of the volume: the write fails
+        // and gives back what it took, and excheck.py finds the chain ended where it was
+        bench_start();
+        uint32_t cluster_size = fat32_get_cluster_size();
+        bench_write("/chain.bin", cluster_size, cluster_size);
+        bench_write("/gap.bin", cluster_size, cluster_size);
+        bench_ok = bench_ok && fat32_open(&file, "/chain.bin") == FAT32_OK &&
+                   fat32_seek(&file, cluster_size) == FAT32_OK && fat32_write(&file, &byte, 1, &written) == FAT32_OK;
+        bench_ok = bench_ok && fat32_seek(&file, (uint32_t)(free_space + BENCH_ALLOCATE)) == FAT32_OK &&
+                   fat32_write(&file, &byte, 1, &written) == FAT32_ERROR_DISK_FULL &&
+                   fat32_size(&file) == cluster_size + 1;
+        fat32_close(&file);
+        bench_report("write past the end of the card");
+    }
+    else
+    {
+        fat32_check_t report;
+        remount();
+        expect(run_check(&report, false, CHECK_BUFFER_SIZE) && is_clean(&report), "volume is consistent afterwards");
+    }
+    return failures ? 1 : 0;
+}
+
+
+int main(int argc, char **argv)
+{
+    if (argc != 3 || (strcmp(argv[1], "fsck") != 0 && strcmp(argv[1], "scan") != 0 && strcmp(argv[1], "bench") != 0))
+    {
+        fprintf(stderr, "usage: fatcheck fsck|scan|bench IMAGE\n");
+        return 2;
+    }
+    if (!image_open(argv[2]))
+    {
+        return 1;
+    }
+    if (strcmp(argv[1], "bench") == 0)
+    {
+        return run_bench();
+    }
+    if (fat32_is_exfat())
+    {
+        fprintf(stderr, "%s: fsck checks FAT32 volumes only\n", argv[2]);
+        return 1;
+    }
+    return strcmp(argv[1], "fsck") == 0 ? run_fsck() : run_scan();
+}
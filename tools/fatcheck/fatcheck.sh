@@ -0,0 +1,50 @@
+#!/usr/bin/env bash
+#
+# Build the host FAT32 and exFAT checker and run it on fresh card images.
+#
+#   tools/fatcheck/fatcheck.sh          damage a volume, check fsck reports and repairs each problem
+#   tools/fatcheck/fatcheck.sh scan     time a read-only fsck pass over a full 32GB card
+#   tools/fatcheck/fatcheck.sh bench    SD commands for the same file work on FAT32 and exFAT
+#
+set -euo pipefail
+
+HERE="$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)"
+DRIVERS="$HERE/../../drivers"
+BIN="${TMPDIR:-/tmp}/fatcheck"
+IMAGE="${TMPDIR:-/tmp}/fatcheck.img"
+
+# -funsigned-char: char is unsigned on the RP2350, as the driver expects
+${CC:-cc} -O2 -funsigned-char -I"$HERE/host" -I"$DRIVERS" -o "$BIN" \
+    "$HERE/fatcheck.c" \
+    "$DRIVERS/fat32.c"
+
+trap 'rm -f "$IMAGE"' EXIT
+
+case "${1:-check}" in
+check)
+    # Small clusters give a FAT32 volume (65525 clusters or more) in a small image
+    python3 "$HERE/mkimage.py" fat32 "$IMAGE" 80 1
+    "$BIN" fsck "$IMAGE"
+    ;;
+scan)
+    # Sparse, so only the blocks written take disk space
+    python3 "$HERE/mkimage.py" fat32 "$IMAGE" 32768 32
+    "$BIN" scan "$IMAGE"
+    ;;
+bench)
+    # About 70000 clusters of 4KB in both formats; the FAT32 run takes a minute,
+    # most of it in the FAT reads of chain walks
+    for format in fat32 exfat; do
+        python3 "$HERE/mkimage.py" $format "$IMAGE" 274 4
+        "$BIN" bench "$IMAGE"
+        if [ $format = exfat ]; then
+            python3 "$HERE/excheck.py" "$IMAGE"
+        fi
+        echo
+    done
+    ;;
+*)
+    echo "usage: $0 [check|scan|bench]" >&2
+    exit 2
+    ;;
+esac
@@ -0,0 +1,3 @@
+#pragma once
+
+// Nothing from hardware/spi.h is used on the host
@@ -0,0 +1,3 @@
+#pragma once
+
+// Nothing from pico/sem.h is used on the host
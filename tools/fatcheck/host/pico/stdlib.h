@@ -0,0 +1,22 @@
+//
+//  Host stand-ins for the parts of the Pico SDK used by the file system driver
+//
+//  Just enough for drivers/fat32.c to build on a PC. The SD card itself is
+//  the image file behind the block functions in fatcheck.c, and the card
+//  detect timer never fires.
+//
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// Timers
+typedef struct repeating_timer repeating_timer_t;
+typedef bool (*repeating_timer_callback_t)(repeating_timer_t *rt);
+struct repeating_timer
+{
+    repeating_timer_callback_t callback;
+};
+static inline bool add_repeating_timer_ms(int32_t ms, repeating_timer_callback_t callback, void *data, repeating_timer_t *out) { return true; }
@@ -0,0 +1,184 @@
+#!/usr/bin/env python3
+"""
+Blank SD card images for the host file system checker (fatcheck)
+
+Writes a freshly formatted volume with no partition table, as a sparse
+file: only the boot sectors, the start of each FAT and the system clusters
+are written, so a 32GB image takes a few megabytes of disk.
+
+    mkimage.py fat32 IMAGE SIZE_MB CLUSTER_KB
+    mkimage.py exfat IMAGE SIZE_MB CLUSTER_KB
+
+The volume must have at least 65525 clusters to be FAT32, so a 512-byte
+cluster needs about 34MB and a 32KB cluster about 2GB. exFAT has no lower
+limit.
+"""
+
+import struct
+import sys
+
+SECTOR_SIZE = 512
+RESERVED_SECTORS = 32
+FAT32_MIN_CLUSTERS = 65525
+EXFAT_FAT_OFFSET = 128  # sectors before the FAT, past both boot regions
+
+
+def fat32_layout(total_sectors, sectors_per_cluster):
+    """FAT size in sectors and cluster count, the FATs sized for the clusters left after them"""
+    fat_sectors = 1
+    while True:
+        data = total_sectors - RESERVED_SECTORS - 2 * fat_sectors
+        clusters = data // sectors_per_cluster
+        needed = ((clusters + 2) * 4 + SECTOR_SIZE - 1) // SECTOR_SIZE
+        if needed <= fat_sectors:
+            return fat_sectors, clusters
+        fat_sectors = needed
+
+
+def make_fat32(path, size_mb, cluster_kb):
+    total = size_mb * 1024 * 1024 // SECTOR_SIZE
+    spc = cluster_kb * 1024 // SECTOR_SIZE
+    fat_sectors, clusters = fat32_layout(total, spc)
+    if clusters < FAT32_MIN_CLUSTERS:
+        raise ValueError(f"{clusters} clusters is too few for FAT32, make the image larger or the clusters smaller")
+
+    boot = bytearray(SECTOR_SIZE)
+    boot[0:3] = b"\xEB\x58\x90"
+    boot[3:11] = b"MSWIN4.1"
+    struct.pack_into("<HBHBHHBHHHII", boot, 11, SECTOR_SIZE, spc, RESERVED_SECTORS, 2, 0, 0, 0xF8, 0, 63, 255, 0,
+                     total)
+    struct.pack_into("<IHHIHH", boot, 36, fat_sectors, 0, 0, 2, 1, 6)  # root cluster 2, FSInfo 1, backup 6
+    boot[64] = 0x80
+    boot[66] = 0x29
+    struct.pack_into("<I", boot, 67, 0x12345678)
+    boot[71:82] = b"FATCHECK   "
+    boot[82:90] = b"FAT32   "
+    boot[510:512] = b"\x55\xAA"
+
+    fsinfo = bytearray(SECTOR_SIZE)
+    struct.pack_into("<I", fsinfo, 0, 0x41615252)
+    struct.pack_into("<III", fsinfo, 484, 0x61417272, clusters - 1, 3)  # the root takes cluster 2
+    struct.pack_into("<I", fsinfo, 508, 0xAA550000)
+
+    fat = struct.pack("<III", 0x0FFFFFF8, 0x0FFFFFFF, 0x0FFFFFF8)
+
+    with open(path, "wb") as f:
+        f.truncate(total * SECTOR_SIZE)
+        for base in (0, 6):
+            f.seek(base * SECTOR_SIZE)
+            f.write(boot + fsinfo)
+        for n in range(2):
+            f.seek((RESERVED_SECTORS + n * fat_sectors) * SECTOR_SIZE)
+            f.write(fat)
+        # An empty root directory
+        f.seek((RESERVED_SECTORS + 2 * fat_sectors) * SECTOR_SIZE)
+        f.write(bytes(spc * SECTOR_SIZE))
+
+    return clusters
+
+
+def exfat_layout(total_sectors, sectors_per_cluster):
+    """FAT size in sectors, first sector of the cluster heap and cluster count"""
+    fat_sectors = 1
+    while True:
+        heap = (EXFAT_FAT_OFFSET + fat_sectors + sectors_per_cluster - 1) // sectors_per_cluster * sectors_per_cluster
+        clusters = (total_sectors - heap) // sectors_per_cluster
+        needed = ((clusters + 2) * 4 + SECTOR_SIZE - 1) // SECTOR_SIZE
+        if needed <= fat_sectors:
+            return fat_sectors, heap, clusters
+        fat_sectors = needed
+
+
+def exfat_checksum(data, skip=()):
+    """The rotating 32-bit sum exFAT uses for the boot region and the up-case table"""
+    total = 0
+    for i, b in enumerate(data):
+        if i not in skip:
+            total = ((total >> 1) | (total << 31)) + b & 0xFFFFFFFF
+    return total
+
+
+def make_exfat(path, size_mb, cluster_kb):
+    total = size_mb * 1024 * 1024 // SECTOR_SIZE
+    spc = cluster_kb * 1024 // SECTOR_SIZE
+    bytes_per_cluster = spc * SECTOR_SIZE
+    fat_sectors, heap, clusters = exfat_layout(total, spc)
+
+    # The allocation bitmap, a minimal up-case table (ASCII a-z only) and the root, one after another
+    bitmap_length = (clusters + 7) // 8
+    upcase = b"".join(struct.pack("<H", c - 32 if ord("a") <= c <= ord("z") else c) for c in range(128))
+    bitmap_first = 2
+    upcase_first = bitmap_first + (bitmap_length + bytes_per_cluster - 1) // bytes_per_cluster
+    root_first = upcase_first + (len(upcase) + bytes_per_cluster - 1) // bytes_per_cluster
+    used = root_first + 1 - 2
+
+    fat = [0xFFFFFFF8, 0xFFFFFFFF]
+    for first, end in ((bitmap_first, upcase_first), (upcase_first, root_first), (root_first, root_first + 1)):
+        fat += [c + 1 for c in range(first, end - 1)] + [0xFFFFFFFF]
+
+    bitmap = bytearray((used + 7) // 8)
+    for c in range(used):
+        bitmap[c // 8] |= 1 << c % 8
+
+    label = "FATCHECK"
+    root = bytearray(bytes_per_cluster)
+    root[0:2] = bytes((0x83, len(label)))
+    root[2:2 + 2 * len(label)] = label.encode("utf-16-le")
+    root[32] = 0x81
+    struct.pack_into("<IQ", root, 32 + 20, bitmap_first, bitmap_length)
+    root[64] = 0x82
+    struct.pack_into("<I", root, 64 + 4, exfat_checksum(upcase))
+    struct.pack_into("<IQ", root, 64 + 20, upcase_first, len(upcase))
+
+    boot = bytearray(SECTOR_SIZE)
+    boot[0:3] = b"\xEB\x76\x90"
+    boot[3:11] = b"EXFAT   "
+    struct.pack_into("<QQIIIIIIHHBBBBB", boot, 64, 0, total, EXFAT_FAT_OFFSET, fat_sectors, heap, clusters,
+                     root_first, 0x12345678, 0x0100, 0, 9, spc.bit_length() - 1, 1, 0x80, 0)
+    boot[510:512] = b"\x55\xAA"
+    region = bytearray(12 * SECTOR_SIZE)
+    region[0:SECTOR_SIZE] = boot
+    for n in range(1, 9):  # extended boot sectors, empty but signed
+        region[n * SECTOR_SIZE + 508:(n + 1) * SECTOR_SIZE] = b"\x00\x00\x55\xAA"
+    checksum = exfat_checksum(region[:11 * SECTOR_SIZE], skip=(106, 107, 112))  # flags and percent in use
+    region[11 * SECTOR_SIZE:] = struct.pack("<I", checksum) * (SECTOR_SIZE // 4)
+
+    def cluster_offset(c):
+        return (heap + (c - 2) * spc) * SECTOR_SIZE
+
+    with open(path, "wb") as f:
+        f.truncate(total * SECTOR_SIZE)
+        for base in (0, 12):
+            f.seek(base * SECTOR_SIZE)
+            f.write(region)
+        f.seek(EXFAT_FAT_OFFSET * SECTOR_SIZE)
+        f.write(struct.pack(f"<{len(fat)}I", *fat))
+        f.seek(cluster_offset(bitmap_first))
+        f.write(bitmap)
+        f.seek(cluster_offset(upcase_first))
+        f.write(upcase)
+        f.seek(cluster_offset(root_first))
+        f.write(root)
+
+    return clusters
+
+
+FORMATS = {"fat32": ("FAT32", make_fat32), "exfat": ("exFAT", make_exfat)}
+
+
+def main():
+    if len(sys.argv) != 5 or sys.argv[1] not in FORMATS:
+        print(__doc__.strip(), file=sys.stderr)
+        sys.exit(2)
+
+    name, make = FORMATS[sys.argv[1]]
+    try:
+        clusters = make(sys.argv[2], int(sys.argv[3]), int(sys.argv[4]))
+    except ValueError as e:
+        print(f"Error: {e}", file=sys.stderr)
+        sys.exit(1)
+    print(f"{sys.argv[2]}: {name}, {clusters} clusters of {sys.argv[4]}KB")
+
+
+if __name__ == "__main__":
+    main()
@@ -8,6 +8,7 @@ Can also generate Picocalc-compatible bitmap fonts from glyph sheets.
 """
 import argparse
 import os
+import json
 import math
 from collections import defaultdict
 from PIL import Image
@@ -253,13 +254,97 @@ def write_picocalc_font(f, basename, font_data):
     f.write(f"#define {basename.upper()}_FONT_START_CHAR {start_char}\n")
     f.write(f"#define {basename.upper()}_FONT_END_CHAR {end_char}\n\n")
 
+# Flag e bit per GFX_TILES (devono corrispondere a gfx.h)
+GFX_TILE_FLIP_X = 0x8000
+GFX_TILE_FLIP_Y = 0x4000
+GFX_TILE_OPAQUE = 0x01
+GFX_TILE_TRANSPARENT = 0x02
+GFX_TILE_UNIFORM = 0x04
+
+def tile_variants(pixels, w, h):
+    """Restituisce la tile e le sue versioni specchiate come (flip_x, flip_y, pixel)."""
+    rows = [pixels[r*w:(r+1)*w] for r in range(h)]
+    return [
+        (False, False, tuple(pixels)),
+        (True, False, tuple(px for row in rows for px in row[::-1])),
+        (False, True, tuple(px for row in rows[::-1] for px in row)),
+        (True, True, tuple(px for row in rows[::-1] for px in row[::-1])),
+    ]
+
+def tile_flags(pixels, alphas):
+    """Flag per le scorciatoie del renderer: opaca, trasparente, colore uniforme."""
+    flags = 0
+    if all(a >= 128 for a in alphas):
+        flags |= GFX_TILE_OPAQUE
+    if all(a < 128 for a in alphas):
+        flags |= GFX_TILE_TRANSPARENT
+    if len(set(pixels)) == 1:
+        flags |= GFX_TILE_UNIFORM
+    return flags
+
+def dedup_tiles(tiles, w, h, flips=True):
+    """Unisce le tile uguali (anche specchiate).
+
+    Restituisce le tile uniche e, per ogni tile originale, (indice unico, flip_x, flip_y)
+    tale che la tile originale sia la tile unica disegnata con quei flip.
+    """
+    unique = []
+    seen = {}
+    remap = []
+    for pixels in tiles:
+        match = None
+        for flip_x, flip_y, variant in tile_variants(pixels, w, h):
+            if not flips and (flip_x or flip_y):
+                continue
+            if variant in seen:
+                match = (seen[variant], flip_x, flip_y)
+                break
+        if match is None:
+            match = (len(unique), False, False)
+            seen[tuple(pixels)] = len(unique)
+            unique.append(pixels)
+        remap.append(match)
+    return unique, remap
+
+def sprite_palette_4bpp(img):
+    """Palette of up to 15 RGB565 colours for the opaque pixels (index 0 is transparent).
+
+    Returns the 16-entry palette, the number of colours used and a function
+    mapping an RGBA pixel to its index.
+    """
+    opaque = [px for px in img.getdata() if px[3] >= 128]
+    colours = sorted(set(to_rgb565(px, "RGB", False) for px in opaque))
+    if len(colours) <= 15:
+        lookup = {c: i + 1 for i, c in enumerate(colours)}
+        palette = [0] + colours + [0] * (15 - len(colours))
+        return palette, len(colours), lambda px: lookup[to_rgb565(px, "RGB", False)] if px[3] >= 128 else 0
+
+    # Too many colours: reduce the opaque pixels to 15
+    strip = Image.new("RGB", (len(opaque), 1))
+    strip.putdata([px[:3] for px in opaque])
+    reduced = strip.quantize(colors=15, method=Image.Quantize.MEDIANCUT)
+    rgb = reduced.getpalette()[:15 * 3]
+    palette = [to_rgb565((rgb[i], rgb[i + 1], rgb[i + 2], 255), "RGB", False) for i in range(0, len(rgb), 3)]
+    used = len(palette)
+    palette += [0] * (15 - len(palette))
+    cache = {}
+
+    def nearest(px):
+        if px[3] < 128:
+            return 0
+        if px[:3] not in cache:
+            cache[px[:3]] = 1 + min(range(len(rgb) // 3), key=lambda i: sum(
+                (px[c] - rgb[i * 3 + c]) ** 2 for c in range(3)))
+        return cache[px[:3]]
+    return [0] + palette, used, nearest
+
 def main():
     parser = argparse.ArgumentParser(description="Convert image to C RGBA arrays (AgonLight compatible)", add_help=False)
     parser.add_argument("--aspect-ratio", type=float, default=1.0,
                    help="Compensa l'aspect ratio dei pixel (es: 2.67 per AgonLight 2)")
     parser.add_argument("input", help="Input PNG/JPEG image")
     parser.add_argument("-o","--output", help="Output .h file", default="output.h")
-    parser.add_argument("-f","--format", choices=["RGBA8888","RGBA2222","RGB565","PICOCALC_FONT","GFX_TILES"], default="RGBA8888")
+    parser.add_argument("-f","--format", choices=["RGBA8888","RGBA2222","RGB565","PICOCALC_FONT","GFX_TILES","GFX_SPRITE_4BPP"], default="RGBA8888")
     parser.add_argument("-w","--width", type=int, default=16)
     parser.add_argument("-h","--height", type=int, default=16)
     parser.add_argument("--single-array", action="store_true")
@@ -279,6 +364,16 @@ def main():
     parser.add_argument("--font-threshold", type=int, default=128,
                         help="[FONT] Threshold for pixel on/off (0-255, default: 128)")
     
+    # Opzioni specifiche per GFX_TILES
+    parser.add_argument("--name", default=None,
+                        help="[GFX_TILES/GFX_SPRITE_4BPP] Prefix of the generated arrays (default: input file name)")
+    parser.add_argument("--dedup", action="store_true",
+                        help="[GFX_TILES] Merge identical and mirrored tiles and emit a remap table")
+    parser.add_argument("--no-flip", action="store_true",
+                        help="[GFX_TILES] With --dedup, only merge identical tiles (not mirrored ones)")
+    parser.add_argument("--remap", default=None,
+                        help="[GFX_TILES] Also write the remap table as JSON for tmx_to_bin_map.py --remap")
+
     parser.add_argument("--help", action="help", help="Show this help and exit")
 
     args = parser.parse_args()
@@ -328,69 +423,171 @@ def main():
 
     # Gestione speciale per GFX_TILES (compatibile con tiles_sprites.h)
     if args.format == "GFX_TILES":
+        name = args.name or basename
         img_w, img_h = img.size
         tiles_x = math.ceil(img_w/args.width)
         tiles_y = math.ceil(img_h/args.height)
         total_tiles = tiles_x * tiles_y
 
+        # Estrai tutte le tile in RGB565 (con l'alpha per i flag)
+        tiles = []
+        alphas = []
+        for ty in range(tiles_y):
+            for tx in range(tiles_x):
+                tile = img.crop((tx*args.width, ty*args.height,
+                                tx*args.width+args.width, ty*args.height+args.height))
+                pixels = list(tile.getdata())
+                tiles.append([to_rgb565(px, "RGB", False) for px in pixels])
+                alphas.append([px[3] for px in pixels])
+
+        # Unisci le tile duplicate
+        if args.dedup:
+            unique, remap = dedup_tiles(tiles, args.width, args.height, not args.no_flip)
+            unique_alphas = [None] * len(unique)
+            for i, (u, _, _) in enumerate(remap):
+                if unique_alphas[u] is None:
+                    unique_alphas[u] = alphas[i]
+        else:
+            unique, remap, unique_alphas = tiles, None, alphas
+        flags = [tile_flags(t, a) for t, a in zip(unique, unique_alphas)]
+
         with open(args.output, "w") as f:
             f.write(f"#ifndef {header_guard}\n#define {header_guard}\n\n")
             f.write(f"#include <stdint.h>\n")
             f.write(f'#include "gfx.h"\n\n')
             f.write(f"/*\n")
             f.write(f"   ======================================================================\n")
-            f.write(f"   TILESET ({total_tiles} tiles, {args.width}x{args.height} RGB565)\n")
+            if remap is not None:
+                f.write(f"   TILESET ({len(unique)} unique of {total_tiles} tiles, {args.width}x{args.height} RGB565)\n")
+            else:
+                f.write(f"   TILESET ({total_tiles} tiles, {args.width}x{args.height} RGB565)\n")
             f.write(f"   ----------------------------------------------------------------------\n")
             f.write(f"   Generated from {args.input}\n")
             f.write(f"   ======================================================================\n")
             f.write(f"*/\n\n")
             f.write(f"#define C16(r,g,b)  (((r&0x1F)<<11)|((g&0x3F)<<5)|((b&0x1F)<<0))\n\n")
-            f.write(f"static const uint16_t {basename}_tilesheet[] = {{\n")
-
-            tile_index = 0
-            for ty in range(tiles_y):
-                for tx in range(tiles_x):
-                    f.write(f"\n    /* === Tile {tile_index} === */\n")
+            f.write(f"static const uint16_t {name}_tilesheet[] = {{\n")
 
-                    # Estrai la tile
-                    tile = img.crop((tx*args.width, ty*args.height,
-                                    tx*args.width+args.width, ty*args.height+args.height))
-                    pixels = list(tile.getdata())
+            for tile_index, pixels in enumerate(unique):
+                f.write(f"\n    /* === Tile {tile_index} === */\n")
 
-                    # Scrivi i pixel in formato RGB565
-                    for row in range(args.height):
-                        f.write("    ")
-                        for col in range(args.width):
-                            px = pixels[row * args.width + col]
-                            rgb565 = to_rgb565(px, "RGB", False)
+                # Scrivi i pixel in formato RGB565
+                for row in range(args.height):
+                    f.write("    ")
+                    for col in range(args.width):
+                        rgb565 = pixels[row * args.width + col]
 
-                            # Calcola i componenti RGB a 5/6 bit
-                            r5 = (rgb565 >> 11) & 0x1F
-                            g6 = (rgb565 >> 5) & 0x3F
-                            b5 = rgb565 & 0x1F
+                        # Calcola i componenti RGB a 5/6 bit
+                        r5 = (rgb565 >> 11) & 0x1F
+                        g6 = (rgb565 >> 5) & 0x3F
+                        b5 = rgb565 & 0x1F
 
-                            f.write(f"C16({r5},{g6},{b5})")
+                        f.write(f"C16({r5},{g6},{b5})")
 
-                            # Aggiungi virgola se non è l'ultimo pixel
-                            is_last_pixel = (tile_index == total_tiles - 1 and
-                                           row == args.height - 1 and
-                                           col == args.width - 1)
-                            if not is_last_pixel:
-                                f.write(",")
-                        f.write("\n")
+                        # Aggiungi virgola se non è l'ultimo pixel
+                        is_last_pixel = (tile_index == len(unique) - 1 and
+                                       row == args.height - 1 and
+                                       col == args.width - 1)
+                        if not is_last_pixel:
+                            f.write(",")
+                    f.write("\n")
 
-                    tile_index += 1
+            f.write("};\n\n")
+            f.write(f"static const uint16_t {name}_tilesheet_count = {len(unique)};\n\n")
 
+            # Flag per tile (GFX_TILE_OPAQUE, GFX_TILE_TRANSPARENT, GFX_TILE_UNIFORM)
+            f.write(f"static const uint8_t {name}_tile_flags[] = {{\n")
+            for i in range(0, len(flags), 16):
+                f.write("    " + ",".join(f"0x{v:02X}" for v in flags[i:i+16]) + ",\n")
             f.write("};\n\n")
-            f.write(f"static const uint16_t {basename}_tilesheet_count = {total_tiles};\n\n")
+
+            # Tabella di rimappatura: indice originale -> indice unico | flip
+            if remap is not None:
+                values = [u | (GFX_TILE_FLIP_X if fx else 0) | (GFX_TILE_FLIP_Y if fy else 0)
+                          for u, fx, fy in remap]
+                f.write(f"/* Original tile index -> unique tile index | GFX_TILE_FLIP_X | GFX_TILE_FLIP_Y */\n")
+                f.write(f"static const uint16_t {name}_tile_remap[] = {{\n")
+                for i in range(0, len(values), 12):
+                    f.write("    " + ",".join(f"0x{v:04X}" for v in values[i:i+12]) + ",\n")
+                f.write("};\n\n")
+                f.write(f"static const uint16_t {name}_tile_remap_count = {len(values)};\n\n")
+
             f.write("#endif\n")
 
+        if remap is not None and args.remap:
+            with open(args.remap, "w") as f:
+                json.dump({"tiles": len(unique),
+                           "remap": [[u, int(fx), int(fy)] for u, fx, fy in remap]}, f)
+
         print(f"[OK] Generated GFX tileset: {args.output}")
         print(f"[INFO] Tile size: {args.width}x{args.height} pixels")
         print(f"[INFO] Total tiles: {total_tiles} ({tiles_x}x{tiles_y})")
+        if remap is not None:
+            mirrored = sum(1 for _, fx, fy in remap if fx or fy)
+            print(f"[INFO] Unique tiles: {len(unique)} ({total_tiles - len(unique)} merged, {mirrored} mirrored)")
+            print(f"[INFO] Tileset size: {len(unique) * args.width * args.height * 2} bytes "
+                  f"(was {total_tiles * args.width * args.height * 2})")
+            if args.remap:
+                print(f"[INFO] Remap table: {args.remap}")
+        print(f"[INFO] Uniform tiles: {sum(1 for v in flags if v & GFX_TILE_UNIFORM)}, "
+              f"transparent: {sum(1 for v in flags if v & GFX_TILE_TRANSPARENT)}")
         print(f"[INFO] Format: RGB565 (compatible with tiles_sprites.h)")
         return
     
+    # Sprite a 4 bit per pixel con palette (gfx_create_sprite_4bpp)
+    if args.format == "GFX_SPRITE_4BPP":
+        name = args.name or basename
+        img_w, img_h = img.size
+        frames_x = math.ceil(img_w/args.width)
+        frames_y = math.ceil(img_h/args.height)
+        palette, used, index_of = sprite_palette_4bpp(img)
+        stride = (args.width + 1) // 2
+
+        frames = []
+        for fy in range(frames_y):
+            for fx in range(frames_x):
+                frame = img.crop((fx*args.width, fy*args.height,
+                                  fx*args.width+args.width, fy*args.height+args.height))
+                indices = [index_of(px) for px in frame.getdata()]
+                data = []
+                for row in range(args.height):
+                    line = indices[row*args.width:(row+1)*args.width] + [0]
+                    data += [(line[i] << 4) | line[i+1] for i in range(0, stride*2, 2)]
+                frames.append(data)
+
+        with open(args.output, "w") as f:
+            f.write(f"#ifndef {header_guard}\n#define {header_guard}\n\n")
+            f.write(f"#include <stdint.h>\n")
+            f.write(f'#include "gfx.h"\n\n')
+            f.write(f"/*\n")
+            f.write(f"   ======================================================================\n")
+            f.write(f"   SPRITES ({len(frames)} frames, {args.width}x{args.height}, 4 bits per pixel)\n")
+            f.write(f"   ----------------------------------------------------------------------\n")
+            f.write(f"   Generated from {args.input}\n")
+            f.write(f"   ======================================================================\n")
+            f.write(f"*/\n\n")
+            f.write(f"/* Index 0 is transparent */\n")
+            f.write(f"static const uint16_t {name}_palette[16] = {{\n")
+            f.write("    " + ",".join(f"0x{v:04X}" for v in palette) + "\n")
+            f.write("};\n\n")
+            f.write(f"static const uint8_t {name}_frames[{len(frames)}][GFX_SPRITE_4BPP_SIZE({args.width}, {args.height})] = {{\n")
+            for frame_index, data in enumerate(frames):
+                f.write(f"    /* === Frame {frame_index} === */\n    {{\n")
+                for row in range(args.height):
+                    f.write("        " + ",".join(f"0x{v:02X}" for v in data[row*stride:(row+1)*stride]) + ",\n")
+                f.write("    },\n")
+            f.write("};\n\n")
+            f.write(f"static const uint16_t {name}_frame_count = {len(frames)};\n\n")
+            f.write("#endif\n")
+
+        print(f"[OK] Generated 4-bpp sprites: {args.output}")
+        print(f"[INFO] Frame size: {args.width}x{args.height} pixels, {stride * args.height} bytes")
+        print(f"[INFO] Frames: {len(frames)} ({frames_x}x{frames_y})")
+        print(f"[INFO] Colours: {used} + transparent")
+        print(f"[INFO] Size: {len(frames) * stride * args.height} bytes "
+              f"(RGB565: {len(frames) * args.width * args.height * 2})")
+        return
+
     new_width = args.width 
     if args.aspect_ratio != 1.0:
         new_width = int(img.width * args.aspect_ratio)
@@ -0,0 +1,131 @@
+#!/usr/bin/env python3
+"""
+Image converter to the PicoCalc inline image escape sequence
+
+Converts PNG, JPG, BMP, etc. images to text that draws the image when it
+is printed on the PicoCalc console (see "Inline images" in docs/display.md).
+The output can be sent over the serial or USB console, or stored in a file
+and shown with 'more'.
+
+Sequence format (a subset of the kitty graphics protocol):
+  ESC _ G f=16,s=<width>,v=<height>[,o=r],m=1 ; <base64 data> ESC \\
+  ESC _ G m=1 ; <base64 data> ESC \\
+  ...
+  ESC _ G m=0 ; <base64 data> ESC \\
+
+  The data is RGB565 pixels (2 bytes each, little-endian), row by row.
+  With --rle it is run-length encoded: a control byte n, followed either
+  by one pixel repeated (n & 0x7F) + 1 times if bit 7 is set, or by
+  n + 1 literal pixels.
+
+Usage:
+  python3 img2vt.py input.png [output.vt] [--width WIDTH] [--height HEIGHT] [--rle]
+
+Example:
+  python3 img2vt.py plot.png --width 160 --rle > /dev/ttyACM0
+"""
+
+import sys
+import base64
+import struct
+import argparse
+from PIL import Image
+
+CHUNK_SIZE = 4096        # base64 characters per escape sequence
+
+
+def rgb888_to_rgb565(r, g, b):
+    """Convert RGB888 (8-bit per channel) to RGB565 (16-bit total)"""
+    return ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+
+
+def rle_encode(pixels):
+    """Run-length encode 16-bit pixels (the tile map chunk scheme)"""
+    out = bytearray()
+    literals = []
+
+    def flush_literals():
+        while literals:
+            block = literals[:128]
+            del literals[:128]
+            out.append(len(block) - 1)
+            out.extend(struct.pack("<" + "H" * len(block), *block))
+
+    i = 0
+    while i < len(pixels):
+        run = 1
+        while i + run < len(pixels) and pixels[i + run] == pixels[i] and run < 128:
+            run += 1
+        if run >= 3:
+            flush_literals()
+            out.append(0x80 | (run - 1))
+            out.extend(struct.pack("<H", pixels[i]))
+        else:
+            literals.extend(pixels[i:i + run])
+        i += run
+    flush_literals()
+    return bytes(out)
+
+
+def load_image(input_path, max_width=None, max_height=None):
+    """Open an image, scale it down to fit and return it as RGB"""
+    img = Image.open(input_path).convert('RGB')
+    if max_width and img.size[0] > max_width:
+        img = img.resize((max_width, max(1, img.size[1] * max_width // img.size[0])), Image.Resampling.LANCZOS)
+    if max_height and img.size[1] > max_height:
+        img = img.resize((max(1, img.size[0] * max_height // img.size[1]), max_height), Image.Resampling.LANCZOS)
+    return img
+
+
+def encode_image(img, rle=False):
+    """Return the escape sequences that draw an image"""
+    width, height = img.size
+    pixels = [rgb888_to_rgb565(r, g, b) for r, g, b in img.getdata()]
+    if rle:
+        data = rle_encode(pixels)
+    else:
+        data = struct.pack("<" + "H" * len(pixels), *pixels)
+
+    encoded = base64.b64encode(data)
+    chunks = [encoded[i:i + CHUNK_SIZE] for i in range(0, len(encoded), CHUNK_SIZE)] or [b""]
+
+    out = bytearray()
+    for i, chunk in enumerate(chunks):
+        more = 1 if i < len(chunks) - 1 else 0
+        if i == 0:
+            control = f"f=16,s={width},v={height}" + (",o=r" if rle else "") + f",m={more}"
+        else:
+            control = f"m={more}"
+        out += b"\x1b_G" + control.encode("ascii") + b";" + chunk + b"\x1b\\"
+    return bytes(out), len(data)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Convert an image to a PicoCalc inline image sequence")
+    parser.add_argument("input", help="Input image file")
+    parser.add_argument("output", nargs="?", help="Output file (standard output if omitted)")
+    parser.add_argument("--width", type=int, default=320, help="Maximum width (default: 320)")
+    parser.add_argument("--height", type=int, default=None, help="Maximum height")
+    parser.add_argument("--rle", action="store_true", help="Run-length encode the pixels")
+
+    args = parser.parse_args()
+
+    try:
+        img = load_image(args.input, args.width, args.height)
+    except Exception as e:
+        print(f"Error: {e}", file=sys.stderr)
+        sys.exit(1)
+
+    sequence, size = encode_image(img, args.rle)
+    if args.output:
+        with open(args.output, "wb") as f:
+            f.write(sequence)
+    else:
+        sys.stdout.buffer.write(sequence)
+
+    print(f"Image: {img.size[0]}x{img.size[1]} pixels, {size} bytes of pixel data, "
+          f"{len(sequence)} bytes to send", file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,177 @@
+#!/usr/bin/env python3
+"""
+Asset pack builder for PicoCalc
+
+Packs many small asset files into one file that the device opens once
+(see docs/assetpack.md). Each asset starts on a 512-byte sector, so the
+device loads it with a single multi-block read and no directory or FAT
+lookups.
+
+Pack file format (little-endian):
+  - Sector 0:  header
+      "JOBPAK", version (1 byte), reserved (1 byte),
+      asset count (4 bytes), TOC slots (4 bytes, a power of two),
+      TOC offset (4 bytes), data offset (4 bytes)
+  - TOC:       hash table of 64-byte slots, starting on a sector
+      name (48 bytes, NUL padded), offset (4), size (4), CRC-32 (4),
+      type (1), reserved (3)
+      An asset lives in slot (FNV-1a hash of its name) & (slots - 1),
+      or the next free slot after it. Empty slots have an empty name.
+  - Data:      each asset starts on a sector
+
+Usage:
+  python3 mkpack.py output.pak file1 file2 ...
+  python3 mkpack.py output.pak assets/ --strip assets/
+
+Example:
+  python3 mkpack.py game.pak tiles.raw level1.map title.raw
+"""
+
+import os
+import sys
+import struct
+import zlib
+import argparse
+
+PACK_MAGIC = b"JOBPAK"
+PACK_VERSION = 1
+SECTOR_SIZE = 512
+SLOT_SIZE = 64
+NAME_LEN = 48
+MAX_SLOTS = 256          # ASSETPACK_MAX_SLOTS on the device
+
+# Asset types (ASSETPACK_TYPE_* in drivers/assetpack.h)
+TYPE_DATA = 0
+TYPE_IMAGE = 1
+TYPE_MAP = 2
+TYPE_TEXT = 3
+TYPE_AUDIO = 4
+
+TYPE_BY_EXTENSION = {
+    ".raw": TYPE_IMAGE,
+    ".map": TYPE_MAP,
+    ".txt": TYPE_TEXT,
+    ".wav": TYPE_AUDIO,
+    ".pcm": TYPE_AUDIO,
+}
+
+
+def fnv1a(name):
+    """32-bit FNV-1a hash of an asset name (must match assetpack_hash)"""
+    h = 0x811C9DC5
+    for byte in name.encode("utf-8"):
+        h ^= byte
+        h = (h * 0x01000193) & 0xFFFFFFFF
+    return h
+
+
+def asset_type(path, data):
+    """Guess the asset type from the file contents or extension"""
+    if data[:6] == b"JOBMAP" or data[:6] == b"JOBGFX":
+        return TYPE_MAP
+    return TYPE_BY_EXTENSION.get(os.path.splitext(path)[1].lower(), TYPE_DATA)
+
+
+def collect_files(inputs, strip):
+    """Expand directories and return (name, path) pairs"""
+    files = []
+    for item in inputs:
+        if os.path.isdir(item):
+            for root, _, names in os.walk(item):
+                for name in sorted(names):
+                    files.append(os.path.join(root, name))
+        else:
+            files.append(item)
+
+    assets = []
+    for path in files:
+        name = path
+        if strip and name.startswith(strip):
+            name = name[len(strip):]
+        name = name.replace(os.sep, "/").lstrip("/")
+        assets.append((name, path))
+    return assets
+
+
+def build_pack(output, assets):
+    """Write the pack file"""
+    count = len(assets)
+    slots = 1
+    while slots < count * 2:
+        slots *= 2
+    slots = max(slots, SECTOR_SIZE // SLOT_SIZE)
+    if slots > MAX_SLOTS:
+        raise ValueError(f"Too many assets ({count}), the device allows {MAX_SLOTS // 2}")
+
+    toc_offset = SECTOR_SIZE
+    data_offset = toc_offset + slots * SLOT_SIZE
+    data_offset += (-data_offset) % SECTOR_SIZE
+
+    # Place each asset in the hash table and the data area
+    table = [None] * slots
+    hashes = {}
+    data = bytearray()
+    for name, path in assets:
+        encoded = name.encode("utf-8")
+        if len(encoded) >= NAME_LEN:
+            raise ValueError(f"Asset name too long: {name}")
+        h = fnv1a(name)
+        if h in hashes:
+            raise ValueError(f"Asset names {hashes[h]} and {name} have the same hash, rename one")
+        hashes[h] = name
+
+        with open(path, "rb") as f:
+            content = f.read()
+
+        offset = data_offset + len(data)
+        data.extend(content)
+        data.extend(b"\0" * ((-len(data)) % SECTOR_SIZE))
+
+        slot = h & (slots - 1)
+        while table[slot] is not None:
+            slot = (slot + 1) & (slots - 1)
+        table[slot] = struct.pack("<48sIIIB3x", encoded, offset, len(content),
+                                  zlib.crc32(content) & 0xFFFFFFFF, asset_type(path, content))
+
+    header = PACK_MAGIC + struct.pack("<BBIIII", PACK_VERSION, 0, count, slots, toc_offset, data_offset)
+    header += b"\0" * (SECTOR_SIZE - len(header))
+
+    toc = b"".join(entry if entry is not None else b"\0" * SLOT_SIZE for entry in table)
+    toc += b"\0" * (data_offset - toc_offset - len(toc))
+
+    with open(output, "wb") as f:
+        f.write(header + toc + data)
+
+    return data_offset + len(data), slots
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Build a PicoCalc asset pack")
+    parser.add_argument("output", help="Output pack file (.pak)")
+    parser.add_argument("inputs", nargs="+", help="Asset files or directories")
+    parser.add_argument("--strip", default=None, help="Prefix to remove from asset names")
+    parser.add_argument("--list", action="store_true", help="List the assets after building")
+
+    args = parser.parse_args()
+
+    assets = collect_files(args.inputs, args.strip)
+    if not assets:
+        print("Error: no assets to pack")
+        sys.exit(1)
+
+    try:
+        size, slots = build_pack(args.output, assets)
+    except ValueError as e:
+        print(f"Error: {e}")
+        sys.exit(1)
+
+    print(f"Pack created: {args.output}")
+    print(f"Assets: {len(assets)} ({slots} TOC slots)")
+    print(f"Size: {size} bytes")
+    if args.list:
+        for name, path in assets:
+            print(f"  {name:40s} {os.path.getsize(path):8d} bytes")
+
+
+if __name__ == "__main__":
+    main()
@@ -1,27 +1,137 @@
 import struct
+import base64
+import gzip
+import zlib
 from xml.etree import ElementTree as ET
 import argparse
+import json
 
-def tmx_to_bin(input_tmx: str, output_bin: str, bitmap_start_id: int = None):
-    """Converte un file .tmx in un file binario compatibile con Agon Light."""
+# Formato v2 (vedi docs/gfx_map.md)
+MAP_MAGIC = b"JOBMAP"
+MAP_VERSION = 2
+SECTOR_SIZE = 512
+CHUNK_SIZE = 16                     # chunk di 16x16 tile
+CHUNK_TILES = CHUNK_SIZE * CHUNK_SIZE
+BLANK_TILE = 0xFFFF                 # tile vuota (gid 0 in Tiled)
+NAME_LEN = 16
 
-    # Parsing file TMX
-    tree = ET.parse(input_tmx)
-    root = tree.getroot()
+LAYER_TILES = 0
+LAYER_COLLISION = 1
+LAYER_OBJECTS = 2
 
-    # Leggi attributi principali
+CODEC_RAW = 0
+CODEC_RLE = 1
+CODEC_EMPTY = 2
+
+GID_MASK = 0x1FFFFFFF               # rimuove i bit di flip di Tiled
+TILED_FLIP_H = 0x80000000
+TILED_FLIP_V = 0x40000000
+TILE_FLIP_X = 0x8000                # bit di flip nei valori delle tile (gfx.h)
+TILE_FLIP_Y = 0x4000
+TILE_INDEX_MASK = 0x3FFF
+
+
+def read_layer_gids(layer):
+    """Legge i gid di un <layer> (csv oppure base64, anche compresso)."""
+    data_tag = layer.find("data")
+    if data_tag is None or data_tag.find("chunk") is not None:
+        raise ValueError(f"Layer '{layer.attrib.get('name')}': le mappe infinite non sono supportate")
+
+    encoding = data_tag.attrib.get("encoding")
+    if encoding == "csv":
+        return [int(x.strip()) for x in data_tag.text.strip().split(",") if x.strip()]
+    if encoding == "base64":
+        raw = base64.b64decode(data_tag.text.strip())
+        compression = data_tag.attrib.get("compression")
+        if compression == "zlib":
+            raw = zlib.decompress(raw)
+        elif compression == "gzip":
+            raw = gzip.decompress(raw)
+        elif compression is not None:
+            raise ValueError(f"Compressione '{compression}' non supportata")
+        return list(struct.unpack("<" + "I" * (len(raw) // 4), raw))
+    raise ValueError(f"Codifica '{encoding}' non supportata (usare csv o base64)")
+
+
+def has_property(element, name):
+    """Vero se l'elemento ha una proprieta' booleana impostata a true."""
+    props = element.find("properties")
+    if props is None:
+        return False
+    for prop in props.findall("property"):
+        if prop.attrib.get("name") == name and prop.attrib.get("value", "").lower() == "true":
+            return True
+    return False
+
+
+def is_collision(element):
+    name = element.attrib.get("name", "").lower()
+    return "collision" in name or "collisione" in name or has_property(element, "collision")
+
+
+def pack_name(name, length):
+    return name.encode("utf-8")[:length].ljust(length, b"\0")
+
+
+def rle_encode(tiles):
+    """RLE su valori a 16 bit.
+
+    Byte di controllo n: se il bit 7 e' attivo segue un valore ripetuto
+    (n & 0x7F) + 1 volte, altrimenti seguono n + 1 valori letterali.
+    """
+    out = bytearray()
+    literals = []
+
+    def flush_literals():
+        while literals:
+            block = literals[:128]
+            del literals[:128]
+            out.append(len(block) - 1)
+            out.extend(struct.pack("<" + "H" * len(block), *block))
+
+    i = 0
+    while i < len(tiles):
+        run = 1
+        while i + run < len(tiles) and tiles[i + run] == tiles[i] and run < 128:
+            run += 1
+        if run >= 3:
+            flush_literals()
+            out.append(0x80 | (run - 1))
+            out.extend(struct.pack("<H", tiles[i]))
+            i += run
+        else:
+            literals.extend(tiles[i:i + run])
+            i += run
+    flush_literals()
+    return bytes(out)
+
+
+def encode_chunk(tiles):
+    """Sceglie la codifica piu' piccola per un chunk."""
+    if all(t == BLANK_TILE for t in tiles):
+        return CODEC_EMPTY, b""
+    raw = struct.pack("<" + "H" * len(tiles), *tiles)
+    rle = rle_encode(tiles)
+    if len(rle) < len(raw):
+        return CODEC_RLE, rle
+    return CODEC_RAW, raw
+
+
+def align(data, boundary=SECTOR_SIZE):
+    """Aggiunge padding fino al prossimo multiplo di boundary."""
+    pad = (-len(data)) % boundary
+    data.extend(b"\0" * pad)
+
+
+def tmx_to_bin_v1(root, output_bin, bitmap_start_id):
+    """Formato originale: solo il primo layer, non compresso."""
     map_width = int(root.attrib["width"])
     map_height = int(root.attrib["height"])
     tile_width = int(root.attrib["tilewidth"])
     tile_height = int(root.attrib["tileheight"])
 
     # Recupera i dati CSV della mappa
-    layer = root.find("layer")
-    data_tag = layer.find("data")
-    csv_data = data_tag.text.strip().split(",")
-
-    # Converti in interi
-    tile_ids = [int(x.strip()) for x in csv_data if x.strip()]
+    tile_ids = read_layer_gids(root.find("layer"))
 
     # Calcola o usa bitmap_start_id
     if bitmap_start_id is None:
@@ -38,23 +148,199 @@ def tmx_to_bin(input_tmx: str, output_bin: str, bitmap_start_id: int = None):
     # Crea contenuto binario della mappa (16 bit per ogni tile)
     tile_bytes = struct.pack("<" + "H" * len(tile_ids), *tile_ids)
 
-    # Unisci header e dati
-    output_data = header + tile_bytes
-
     # Scrivi file binario
     with open(output_bin, "wb") as f:
-        f.write(output_data)
+        f.write(header + tile_bytes)
 
-    print(f"File binario creato: {output_bin}")
+    print(f"File binario creato (v1): {output_bin}")
     print(f"Dimensioni mappa: {map_width}x{map_height} tiles")
     print(f"Dimensioni tile: {tile_width}x{tile_height} pixel")
     print(f"Bitmap start ID: {bitmap_start_id}")
 
+
+def load_remap(path):
+    """Legge la tabella di rimappatura scritta da img2c_array_5.py --dedup --remap."""
+    with open(path) as f:
+        return json.load(f)["remap"]
+
+
+def tmx_to_bin_v2(root, output_bin, bitmap_start_id, remap=None):
+    """Formato v2: tutti i layer, chunk 16x16 compressi, indice allineato ai settori."""
+    map_width = int(root.attrib["width"])
+    map_height = int(root.attrib["height"])
+    tile_width = int(root.attrib["tilewidth"])
+    tile_height = int(root.attrib["tileheight"])
+    chunks_x = (map_width + CHUNK_SIZE - 1) // CHUNK_SIZE
+    chunks_y = (map_height + CHUNK_SIZE - 1) // CHUNK_SIZE
+
+    # Il primo gid del tileset diventa la tile 0 del tilesheet
+    if bitmap_start_id is None:
+        tileset = root.find("tileset")
+        bitmap_start_id = int(tileset.attrib.get("firstgid", 1)) if tileset is not None else 1
+
+    def to_tile(gid):
+        flip_x = bool(gid & TILED_FLIP_H)
+        flip_y = bool(gid & TILED_FLIP_V)
+        gid &= GID_MASK
+        if gid == 0:
+            return BLANK_TILE
+        tile = max(gid - bitmap_start_id, 0)
+
+        # Tileset deduplicato: indice unico, con i flip combinati a quelli di Tiled
+        if remap is not None:
+            if tile >= len(remap):
+                raise ValueError(f"Tile {tile} non presente nella tabella di rimappatura")
+            tile, remap_x, remap_y = remap[tile]
+            flip_x ^= bool(remap_x)
+            flip_y ^= bool(remap_y)
+
+        if tile > TILE_INDEX_MASK:
+            raise ValueError(f"Tile {tile} fuori intervallo")
+        return tile | (TILE_FLIP_X if flip_x else 0) | (TILE_FLIP_Y if flip_y else 0)
+
+    # Raccoglie layer di tile e di oggetti nell'ordine del documento
+    layers = []
+    objects = []
+    for element in root.iter():
+        if element.tag == "layer":
+            gids = read_layer_gids(element)
+            if len(gids) != map_width * map_height:
+                raise ValueError(f"Layer '{element.attrib.get('name')}': dimensione errata")
+            layer_type = LAYER_COLLISION if is_collision(element) else LAYER_TILES
+            layers.append({"name": element.attrib.get("name", ""), "type": layer_type,
+                           "tiles": [to_tile(g) for g in gids]})
+        elif element.tag == "objectgroup":
+            group = {"name": element.attrib.get("name", ""), "type": LAYER_OBJECTS,
+                     "first": len(objects), "count": 0}
+            for obj in element.findall("object"):
+                gid = int(obj.attrib.get("gid", 0))
+                objects.append({
+                    "x": int(float(obj.attrib.get("x", 0))),
+                    "y": int(float(obj.attrib.get("y", 0))),
+                    "w": int(float(obj.attrib.get("width", 0))),
+                    "h": int(float(obj.attrib.get("height", 0))),
+                    "id": int(obj.attrib.get("id", 0)),
+                    "tile": to_tile(gid),
+                    "layer": len(layers),
+                    "solid": 1 if is_collision(element) or is_collision(obj) else 0,
+                    "type": obj.attrib.get("type", obj.attrib.get("class", obj.attrib.get("name", ""))),
+                })
+                group["count"] += 1
+            layers.append(group)
+
+    if len(layers) > 255:
+        raise ValueError("Troppi layer")
+
+    # Codifica i chunk di ogni layer di tile
+    for layer in layers:
+        if layer["type"] == LAYER_OBJECTS:
+            continue
+        layer["chunks"] = []
+        for cy in range(chunks_y):
+            for cx in range(chunks_x):
+                tiles = []
+                for y in range(cy * CHUNK_SIZE, (cy + 1) * CHUNK_SIZE):
+                    for x in range(cx * CHUNK_SIZE, (cx + 1) * CHUNK_SIZE):
+                        if x < map_width and y < map_height:
+                            tiles.append(layer["tiles"][y * map_width + x])
+                        else:
+                            tiles.append(BLANK_TILE)
+                layer["chunks"].append(encode_chunk(tiles))
+
+    # Posizioni: header, tabella dei layer, oggetti, indice, dati dei chunk
+    objects_offset = 32 + 32 * len(layers)
+    index_offset = objects_offset + 32 * len(objects)
+    index_offset += (-index_offset) % SECTOR_SIZE
+    chunk_count = chunks_x * chunks_y
+    tile_layers = [l for l in layers if l["type"] != LAYER_OBJECTS]
+    data_offset = index_offset + 8 * chunk_count * len(tile_layers)
+    data_offset += (-data_offset) % SECTOR_SIZE
+
+    # Dati dei chunk: un chunk non attraversa un confine di settore
+    data = bytearray()
+    next_index = index_offset
+    index = bytearray()
+    for layer in tile_layers:
+        layer["offset"] = next_index
+        next_index += 8 * chunk_count
+        for codec, payload in layer["chunks"]:
+            used = len(data) % SECTOR_SIZE
+            if payload and used + len(payload) > SECTOR_SIZE and len(payload) <= SECTOR_SIZE:
+                align(data)
+            offset = data_offset + len(data) if payload else 0
+            index += struct.pack("<IHBB", offset, len(payload), codec, 0)
+            data.extend(payload)
+
+    for layer in layers:
+        if layer["type"] == LAYER_OBJECTS:
+            layer["offset"] = objects_offset + 32 * layer["first"]
+
+    # Header (32 byte)
+    out = bytearray()
+    out += MAP_MAGIC
+    out += struct.pack("<BBHHBBHHHHH", MAP_VERSION, CHUNK_SIZE, map_width, map_height,
+                       tile_width, tile_height, bitmap_start_id, len(layers), len(objects),
+                       chunks_x, chunks_y)
+    out += b"\0" * (32 - len(out))
+
+    # Tabella dei layer (32 byte per layer)
+    for layer in layers:
+        count = layer["count"] if layer["type"] == LAYER_OBJECTS else chunk_count
+        out += pack_name(layer["name"], NAME_LEN)
+        out += struct.pack("<BBHIII", layer["type"], 0, 0, layer["offset"], count, 0)
+
+    # Oggetti (32 byte per oggetto)
+    for obj in objects:
+        out += struct.pack("<iiHHHHBBH", obj["x"], obj["y"], obj["w"], obj["h"],
+                           obj["id"], obj["tile"], obj["layer"], obj["solid"], 0)
+        out += pack_name(obj["type"], 12)
+
+    # Indice dei chunk (8 byte per chunk) e dati
+    align(out)
+    out += index
+    align(out)
+    out += data
+
+    with open(output_bin, "wb") as f:
+        f.write(out)
+
+    flat_size = 14 + 2 * map_width * map_height * len(tile_layers)
+    print(f"File binario creato (v2): {output_bin}")
+    print(f"Dimensioni mappa: {map_width}x{map_height} tiles, {chunks_x}x{chunks_y} chunk")
+    print(f"Dimensioni tile: {tile_width}x{tile_height} pixel")
+    print(f"Bitmap start ID: {bitmap_start_id}")
+    for layer in layers:
+        if layer["type"] == LAYER_OBJECTS:
+            print(f"  Layer '{layer['name']}': {layer['count']} oggetti")
+        else:
+            kind = "collisione" if layer["type"] == LAYER_COLLISION else "tile"
+            empty = sum(1 for c, _ in layer["chunks"] if c == CODEC_EMPTY)
+            rle = sum(1 for c, _ in layer["chunks"] if c == CODEC_RLE)
+            print(f"  Layer '{layer['name']}' ({kind}): {rle} RLE, {empty} vuoti, "
+                  f"{chunk_count - rle - empty} raw")
+    print(f"Dimensione: {len(out)} byte (non compressa: {flat_size} byte)")
+
+
+def tmx_to_bin(input_tmx: str, output_bin: str, bitmap_start_id: int = None, version: int = MAP_VERSION,
+               remap_json: str = None):
+    """Converte un file .tmx in un file binario per la PicoCalc."""
+    root = ET.parse(input_tmx).getroot()
+    if version == 1:
+        tmx_to_bin_v1(root, output_bin, bitmap_start_id)
+    else:
+        remap = load_remap(remap_json) if remap_json else None
+        tmx_to_bin_v2(root, output_bin, bitmap_start_id, remap)
+
+
 if __name__ == "__main__":
-    parser = argparse.ArgumentParser(description="Converte un file TMX in formato binario per Agon Light.")
+    parser = argparse.ArgumentParser(description="Converte un file TMX in formato binario per la PicoCalc.")
     parser.add_argument("input_tmx", help="Percorso del file .tmx di input")
     parser.add_argument("output_bin", help="Percorso del file .bin di output")
     parser.add_argument("--bitmap_start_id", type=int, default=None, help="ID di partenza bitmap (opzionale)")
+    parser.add_argument("--version", type=int, choices=[1, 2], default=MAP_VERSION,
+                        help="Formato di uscita: 1 = primo layer non compresso, 2 = chunk compressi (default)")
+    parser.add_argument("--remap", default=None,
+                        help="Tabella JSON di img2c_array_5.py --dedup --remap (solo formato 2)")
 
     args = parser.parse_args()
-    tmx_to_bin(args.input_tmx, args.output_bin, args.bitmap_start_id)
+    tmx_to_bin(args.input_tmx, args.output_bin, args.bitmap_start_id, args.version, args.remap)
@@ -0,0 +1,8 @@
+#pragma once
+
+#include "pico/stdlib.h"
+
+enum vreg_voltage
+{
+    VREG_VOLTAGE_DEFAULT
+};
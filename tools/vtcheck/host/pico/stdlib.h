@@ -0,0 +1,99 @@
+//
+//  Host stand-ins for the parts of the Pico SDK used by the LCD and display drivers
+//
+//  Just enough for drivers/lcd.c and drivers/display.c to build on a PC. The
+//  SPI and DMA functions feed the controller model in vtcheck.c; time does
+//  not pass, so every wait is over as soon as it starts.
+//
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdarg.h>
+
+typedef unsigned int uint;
+typedef uint64_t absolute_time_t;
+
+#ifndef MIN
+#define MIN(a, b) ((a) < (b) ? (a) : (b))
+#endif
+#ifndef MAX
+#define MAX(a, b) ((a) > (b) ? (a) : (b))
+#endif
+
+// Time
+static inline void tight_loop_contents(void) {}
+static inline absolute_time_t get_absolute_time(void) { return 0; }
+static inline absolute_time_t delayed_by_ms(absolute_time_t t, uint32_t ms) { return t; }
+static inline absolute_time_t make_timeout_time_ms(uint32_t ms) { return 0; }
+static inline bool time_reached(absolute_time_t t) { return true; }
+static inline void sleep_ms(uint32_t ms) {}
+static inline void sleep_until(absolute_time_t t) {}
+static inline void busy_wait_us(uint64_t us) {}
+
+// Timers
+typedef struct repeating_timer repeating_timer_t;
+typedef bool (*repeating_timer_callback_t)(repeating_timer_t *rt);
+struct repeating_timer
+{
+    repeating_timer_callback_t callback;
+};
+static inline bool add_repeating_timer_ms(int32_t ms, repeating_timer_callback_t callback, void *data, repeating_timer_t *out) { return true; }
+
+// Interrupts
+#define DMA_IRQ_0 (10)
+static inline uint32_t save_and_disable_interrupts(void) { return 0; }
+static inline void restore_interrupts(uint32_t status) {}
+static inline void irq_set_exclusive_handler(uint num, void (*handler)(void)) {}
+static inline void irq_set_enabled(uint num, bool enabled) {}
+
+// GPIO
+#define GPIO_OUT (1)
+#define GPIO_FUNC_SPI (1)
+static inline void gpio_init(uint gpio) {}
+static inline void gpio_set_dir(uint gpio, bool out) {}
+static inline void gpio_set_function(uint gpio, int fn) {}
+void gpio_put(uint gpio, bool value);
+
+// SPI
+typedef struct
+{
+    volatile uint32_t dr;
+} spi_hw_t;
+typedef struct spi_inst spi_inst_t;
+extern spi_inst_t *const spi1;
+#define SPI_MSB_FIRST (1)
+static inline uint spi_init(spi_inst_t *spi, uint baudrate) { return baudrate; }
+static inline uint spi_set_baudrate(spi_inst_t *spi, uint baudrate) { return baudrate; }
+static inline bool spi_is_busy(const spi_inst_t *spi) { return false; }
+static inline uint spi_get_dreq(spi_inst_t *spi, bool is_tx) { return 0; }
+spi_hw_t *spi_get_hw(spi_inst_t *spi);
+void spi_set_format(spi_inst_t *spi, uint data_bits, int cpol, int cpha, int order);
+int spi_write_blocking(spi_inst_t *spi, const uint8_t *src, size_t len);
+int spi_write16_blocking(spi_inst_t *spi, const uint16_t *src, size_t len);
+
+// DMA (a transfer completes as soon as it is started)
+typedef struct
+{
+    uint32_t ctrl;
+} dma_channel_config;
+typedef struct
+{
+    volatile uint32_t ints0;
+} dma_hw_t;
+extern dma_hw_t *const dma_hw;
+#define DMA_SIZE_16 (1)
+static inline int dma_claim_unused_channel(bool required) { return 0; }
+static inline dma_channel_config dma_channel_get_default_config(uint channel) { return (dma_channel_config){0}; }
+static inline void channel_config_set_transfer_data_size(dma_channel_config *c, int size) {}
+static inline void channel_config_set_read_increment(dma_channel_config *c, bool incr) {}
+static inline void channel_config_set_write_increment(dma_channel_config *c, bool incr) {}
+static inline void channel_config_set_dreq(dma_channel_config *c, uint dreq) {}
+static inline void dma_channel_configure(uint channel, const dma_channel_config *config, volatile void *write_addr,
+                                         const volatile void *read_addr, uint count, bool trigger) {}
+static inline void dma_channel_set_irq0_enabled(uint channel, bool enabled) {}
+static inline bool dma_channel_is_busy(uint channel) { return false; }
+void dma_channel_set_read_addr(uint channel, const volatile void *read_addr, bool trigger);
+void dma_channel_set_trans_count(uint channel, uint32_t count, bool trigger);
@@ -0,0 +1,461 @@
+//
+//  Host conformance and throughput checks for the terminal emulator
+//
+//  Builds drivers/display.c and drivers/lcd.c on a PC against the stand-ins
+//  in host/, with a model of the LCD controller behind the SPI and DMA
+//  functions. Each recording in the corpus is played into a freshly reset
+//  terminal and the visible screen is reduced to a CRC-32, so any change to
+//  the parser or the text drawing that alters a single pixel shows up.
+//
+//  The controller model follows the addressing the driver itself uses for
+//  vertical scrolling (see lcd_blit), so scrolled screens are compared with
+//  what the driver means to show.
+//
+//  Usage:
+//    vtcheck FILE...                   print "crc name" for each recording
+//    vtcheck -c EXPECTED FILE...       compare against a list printed as above
+//    vtcheck -p SCREEN.ppm FILE        also save the screen as an image
+//    vtcheck -b FILE...                measure bytes per second through display_emit
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#include "pico/stdlib.h"
+
+#include "lcd.h"
+#include "display.h"
+#include "idle.h"
+#include "governor.h"
+#include "memstat.h"
+
+#define MAX_RECORDING   (1024 * 1024)   // largest recording played
+#define BENCH_SECONDS   (0.5)           // minimum time measured per recording
+
+
+//
+//  LCD controller model
+//
+
+static uint16_t frame[FRAME_HEIGHT][WIDTH]; // frame memory
+static bool store_pixels = true;            // false to measure the driver alone
+
+static bool data_mode = false;              // state of the D/CX pin
+static uint8_t command = LCD_CMD_NOP;       // last command received
+static uint8_t params[8];                   // parameters of the last command
+static int param_count = 0;
+
+static uint16_t window_x0 = 0, window_x1 = WIDTH - 1;
+static uint16_t window_y0 = 0, window_y1 = FRAME_HEIGHT - 1;
+static uint16_t write_x = 0, write_y = 0;   // next pixel written by RAMWR
+
+static uint16_t scroll_top = 0;             // top fixed area (VSCRDEF)
+static uint16_t scroll_bottom = 0;          // bottom fixed area (VSCRDEF)
+static uint16_t scroll_start = 0;           // scroll start address (VSCSAD)
+
+static void model_command(uint8_t cmd)
+{
+    command = cmd;
+    param_count = 0;
+    if (cmd == LCD_CMD_RAMWR)
+    {
+        write_x = window_x0;
+        write_y = window_y0;
+    }
+}
+
+static void model_param(uint8_t value)
+{
+    if (param_count < (int)sizeof(params))
+    {
+        params[param_count++] = value;
+    }
+
+    if (command == LCD_CMD_CASET && param_count == 4)
+    {
+        window_x0 = params[0] << 8 | params[1];
+        window_x1 = params[2] << 8 | params[3];
+    }
+    else if (command == LCD_CMD_RASET && param_count == 4)
+    {
+        window_y0 = params[0] << 8 | params[1];
+        window_y1 = params[2] << 8 | params[3];
+    }
+    else if (command == LCD_CMD_VSCRDEF && param_count == 6)
+    {
+        scroll_top = params[0] << 8 | params[1];
+        scroll_bottom = params[4] << 8 | params[5];
+    }
+    else if (command == LCD_CMD_VSCSAD && param_count == 2)
+    {
+        scroll_start = params[0] << 8 | params[1];
+    }
+}
+
+static void model_pixel(uint16_t pixel)
+{
+    if (command != LCD_CMD_RAMWR)
+    {
+        model_param(pixel >> 8);
+        model_param(pixel & 0xFF);
+        return;
+    }
+
+    if (store_pixels && write_y <= window_y1 && write_y < FRAME_HEIGHT && write_x < WIDTH)
+    {
+        frame[write_y][write_x] = pixel;
+    }
+    if (++write_x > window_x1)
+    {
+        write_x = window_x0;
+        write_y++;
+    }
+}
+
+// Frame memory row shown on a screen row
+static int model_frame_row(int y)
+{
+    int scroll_height = FRAME_HEIGHT - scroll_top - scroll_bottom;
+    if (y < scroll_top || y >= HEIGHT - scroll_bottom || scroll_height <= 0)
+    {
+        return y;
+    }
+    return scroll_top + (scroll_start - scroll_top + y) % scroll_height;
+}
+
+
+//
+//  Pico SDK stand-ins (see host/pico/stdlib.h)
+//
+
+static spi_hw_t spi_registers;
+static dma_hw_t dma_registers;
+static struct spi_inst
+{
+    int unused;
+} spi_instance;
+
+spi_inst_t *const spi1 = &spi_instance;
+dma_hw_t *const dma_hw = &dma_registers;
+
+static const uint16_t *dma_read_addr = NULL;
+
+void gpio_put(uint gpio, bool value)
+{
+    if (gpio == LCD_DCX)
+    {
+        data_mode = value;
+    }
+}
+
+spi_hw_t *spi_get_hw(spi_inst_t *spi)
+{
+    return &spi_registers;
+}
+
+void spi_set_format(spi_inst_t *spi, uint data_bits, int cpol, int cpha, int order)
+{
+}
+
+int spi_write_blocking(spi_inst_t *spi, const uint8_t *src, size_t len)
+{
+    for (size_t i = 0; i < len; i++)
+    {
+        if (data_mode)
+        {
+            model_param(src[i]);
+        }
+        else
+        {
+            model_command(src[i]);
+        }
+    }
+    return len;
+}
+
+int spi_write16_blocking(spi_inst_t *spi, const uint16_t *src, size_t len)
+{
+    for (size_t i = 0; i < len; i++)
+    {
+        model_pixel(src[i]);
+    }
+    return len;
+}
+
+void dma_channel_set_read_addr(uint channel, const volatile void *read_addr, bool trigger)
+{
+    dma_read_addr = (const uint16_t *)read_addr;
+}
+
+void dma_channel_set_trans_count(uint channel, uint32_t count, bool trigger)
+{
+    // Pixel transfers cost the processor nothing on the device, skip them when benchmarking
+    if (trigger && (store_pixels || command != LCD_CMD_RAMWR))
+    {
+        spi_write16_blocking(spi1, dma_read_addr, count);
+    }
+}
+
+void idle_wait(void)
+{
+}
+
+void idle_signal(void)
+{
+}
+
+bool governor_register(governor_callback_t callback)
+{
+    return true;
+}
+
+void mem_register_static(const char *name, size_t size)
+{
+}
+
+
+//
+//  Screen capture
+//
+
+static uint32_t crc32_update(uint32_t crc, const uint8_t *data, size_t len)
+{
+    for (size_t i = 0; i < len; i++)
+    {
+        crc ^= data[i];
+        for (int bit = 0; bit < 8; bit++)
+        {
+            crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+        }
+    }
+    return crc;
+}
+
+// CRC-32 of the visible screen, two bytes per pixel, little-endian
+static uint32_t screen_crc()
+{
+    uint32_t crc = 0xFFFFFFFF;
+    for (int y = 0; y < HEIGHT; y++)
+    {
+        const uint16_t *line = frame[model_frame_row(y)];
+        uint8_t bytes[WIDTH * 2];
+        for (int x = 0; x < WIDTH; x++)
+        {
+            bytes[x * 2] = line[x] & 0xFF;
+            bytes[x * 2 + 1] = line[x] >> 8;
+        }
+        crc = crc32_update(crc, bytes, sizeof(bytes));
+    }
+    return ~crc;
+}
+
+static bool save_screen(const char *path)
+{
+    FILE *fp = fopen(path, "wb");
+    if (fp == NULL)
+    {
+        return false;
+    }
+
+    fprintf(fp, "P6\n%d %d\n255\n", WIDTH, HEIGHT);
+    for (int y = 0; y < HEIGHT; y++)
+    {
+        const uint16_t *line = frame[model_frame_row(y)];
+        for (int x = 0; x < WIDTH; x++)
+        {
+            uint16_t p = line[x];
+            uint8_t rgb[3] = {
+                (uint8_t)((p >> 11) << 3),
+                (uint8_t)(((p >> 5) & 0x3F) << 2),
+                (uint8_t)((p & 0x1F) << 3),
+            };
+            fwrite(rgb, 1, sizeof(rgb), fp);
+        }
+    }
+    fclose(fp);
+    return true;
+}
+
+
+//
+//  Recordings
+//
+
+static uint8_t recording[MAX_RECORDING];
+
+static size_t load_recording(const char *path)
+{
+    FILE *fp = fopen(path, "rb");
+    if (fp == NULL)
+    {
+        fprintf(stderr, "%s: cannot open\n", path);
+        exit(2);
+    }
+    size_t len = fread(recording, 1, sizeof(recording), fp);
+    fclose(fp);
+    return len;
+}
+
+static const char *base_name(const char *path)
+{
+    const char *slash = strrchr(path, '/');
+    return slash ? slash + 1 : path;
+}
+
+// Play a recording into a fresh terminal and return the CRC of the screen
+static uint32_t play(const char *path, const char *ppm)
+{
+    size_t len = load_recording(path);
+
+    display_init();
+    for (size_t i = 0; i < len; i++)
+    {
+        display_emit(recording[i]);
+    }
+
+    if (ppm && !save_screen(ppm))
+    {
+        fprintf(stderr, "%s: cannot write\n", ppm);
+        exit(2);
+    }
+    return screen_crc();
+}
+
+// Play a recording repeatedly and return bytes per second
+static double bench(const char *path)
+{
+    size_t len = load_recording(path);
+
+    store_pixels = false;
+    display_init();
+
+    struct timespec start, now;
+    double elapsed = 0;
+    uint64_t bytes = 0;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    while (elapsed < BENCH_SECONDS)
+    {
+        for (size_t i = 0; i < len; i++)
+        {
+            display_emit(recording[i]);
+        }
+        bytes += len;
+
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        elapsed = (now.tv_sec - start.tv_sec) + (now.tv_nsec - start.tv_nsec) / 1e9;
+    }
+    return bytes / elapsed;
+}
+
+// Look up the expected CRC of a recording, returns false if it is not listed
+static bool expected_crc(const char *list, const char *name, uint32_t *crc)
+{
+    FILE *fp = fopen(list, "r");
+    if (fp == NULL)
+    {
+        fprintf(stderr, "%s: cannot open\n", list);
+        exit(2);
+    }
+
+    char line[256];
+    char listed[200];
+    bool found = false;
+    while (!found && fgets(line, sizeof(line), fp))
+    {
+        found = sscanf(line, "%x %199s", crc, listed) == 2 && strcmp(listed, name) == 0;
+    }
+    fclose(fp);
+    return found;
+}
+
+// The drivers keep their state in globals, so each recording runs in its own process
+static int run_isolated(int (*fn)(const char *, const char *), const char *path, const char *arg)
+{
+    fflush(stdout);
+    pid_t pid = fork();
+    if (pid == 0)
+    {
+        int result = fn(path, arg);
+        fflush(stdout);
+        _exit(result);
+    }
+
+    int status = 0;
+    waitpid(pid, &status, 0);
+    return WIFEXITED(status) ? WEXITSTATUS(status) : 2;
+}
+
+static int print_one(const char *path, const char *ppm)
+{
+    printf("%08x %s\n", play(path, ppm), base_name(path));
+    return 0;
+}
+
+static int check_one(const char *path, const char *list)
+{
+    uint32_t expected;
+    if (!expected_crc(list, base_name(path), &expected))
+    {
+        printf("NEW  %s (%08x)\n", base_name(path), play(path, NULL));
+        return 1;
+    }
+
+    uint32_t actual = play(path, NULL);
+    if (actual != expected)
+    {
+        printf("FAIL %s (%08x, expected %08x)\n", base_name(path), actual, expected);
+        return 1;
+    }
+    printf("ok   %s\n", base_name(path));
+    return 0;
+}
+
+static int bench_one(const char *path, const char *unused)
+{
+    printf("%-24s %10.0f bytes/s\n", base_name(path), bench(path));
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    int (*fn)(const char *, const char *) = print_one;
+    const char *arg = NULL;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "c:p:b")) != -1)
+    {
+        switch (opt)
+        {
+        case 'c':
+            fn = check_one;
+            arg = optarg;
+            break;
+        case 'p':
+            fn = print_one;
+            arg = optarg;
+            break;
+        case 'b':
+            fn = bench_one;
+            break;
+        default:
+            fprintf(stderr, "usage: %s [-c expected | -p screen.ppm | -b] recording...\n", argv[0]);
+            return 2;
+        }
+    }
+
+    int failures = 0;
+    for (int i = optind; i < argc; i++)
+    {
+        failures += run_isolated(fn, argv[i], arg) != 0;
+    }
+
+    if (fn == check_one)
+    {
+        printf("%d of %d recordings match\n", argc - optind - failures, argc - optind);
+    }
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,58 @@
+#!/usr/bin/env bash
+#
+# Build the host terminal checker and play the recorded corpus through it.
+#
+#   tools/vtcheck/vtcheck.sh                compare every screen with corpus/expected.txt
+#   tools/vtcheck/vtcheck.sh bench          bytes per second through display_emit
+#   tools/vtcheck/vtcheck.sh update         rewrite corpus/expected.txt (after checking the screens)
+#   tools/vtcheck/vtcheck.sh compare [REV]  screens and speed against display.c at REV (default HEAD)
+#
+set -euo pipefail
+
+HERE="$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)"
+DRIVERS="$HERE/../../drivers"
+BIN="${TMPDIR:-/tmp}/vtcheck"
+
+# build OUTPUT DISPLAY_C
+build() {
+    # -funsigned-char: char is unsigned on the RP2350, as the parser expects
+    ${CC:-cc} -O2 -funsigned-char -I"$HERE/host" -I"$DRIVERS" -o "$1" \
+        "$HERE/vtcheck.c" \
+        "$2" \
+        "$DRIVERS/lcd.c" \
+        "$DRIVERS/font-8x10.c" \
+        "$DRIVERS/font-5x10.c"
+}
+
+build "$BIN" "$DRIVERS/display.c"
+
+case "${1:-check}" in
+check)
+    "$BIN" -c "$HERE/corpus/expected.txt" "$HERE"/corpus/*.vt
+    ;;
+bench)
+    "$BIN" -b "$HERE"/corpus/*.vt
+    ;;
+update)
+    "$BIN" "$HERE"/corpus/*.vt > "$HERE/corpus/expected.txt"
+    ;;
+compare)
+    # The other parser is built from git with today's LCD driver, so only the parser differs
+    OLD="$(mktemp -d)"
+    trap 'rm -rf "$OLD"' EXIT
+    git -C "$HERE" show "${2:-HEAD}:drivers/display.c" > "$OLD/display.c"
+    build "$OLD/vtcheck" "$OLD/display.c"
+    "$OLD/vtcheck" "$HERE"/corpus/*.vt > "$OLD/screens.txt"
+    echo "Screens against ${2:-HEAD}:"
+    "$BIN" -c "$OLD/screens.txt" "$HERE"/corpus/*.vt || true
+    echo
+    echo "Bytes per second, ${2:-HEAD} then this tree:"
+    paste <("$OLD/vtcheck" -b "$HERE"/corpus/*.vt | awk '{ print $1, $2 }') \
+          <("$BIN" -b "$HERE"/corpus/*.vt | awk '{ print $2 }') |
+        awk '{ printf "%-24s %10.0f %10.0f %+6.1f%%\n", $1, $2, $3, ($3 / $2 - 1) * 100 }'
+    ;;
+*)
+    echo "usage: $0 [check|bench|update|compare [REV]]" >&2
+    exit 2
+    ;;
+esac